@@ -0,0 +1,169 @@
+/*
+ * Copyright (c) 2018 Nicholas Corgan (n.corgan@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+
+/*
+ * Detects, loads, and validates the given saves across multiple threads,
+ * printing what each one was detected as. With --output-dir, each valid save
+ * is written back out to the given directory under the same name, with its
+ * checksums recalculated.
+ *
+ * Usage: pksav-batch [--threads N] [--output-dir DIR] SAVE [SAVE ...]
+ */
+
+#include <pksav.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(PKSAV_PLATFORM_WIN32) || defined(PKSAV_PLATFORM_MINGW)
+#    define FS_SEPARATOR "\\"
+#else
+#    define FS_SEPARATOR "/"
+#endif
+
+typedef struct
+{
+    pksav_batch_save_type_t save_type;
+    pksav_error_t error;
+    size_t worker;
+} batch_result_t;
+
+static const char* save_type_names[] =
+{
+    "none",
+    "Generation I",
+    "Generation II",
+    "Game Boy Advance",
+    "Generation IV",
+    "Generation V"
+};
+
+// Each input has its own slot, so no locking is needed.
+static void store_result(
+    const pksav_batch_item_t* item,
+    void* user_data
+)
+{
+    batch_result_t* results = (batch_result_t*)user_data;
+
+    results[item->index].save_type = item->save_type;
+    results[item->index].error = item->error;
+    results[item->index].worker = item->worker;
+}
+
+static const char* get_basename(
+    const char* filepath
+)
+{
+    const char* basename = filepath;
+    for(const char* c = filepath; *c; ++c)
+    {
+        if((*c == '/') || (*c == '\\'))
+        {
+            basename = c + 1;
+        }
+    }
+
+    return basename;
+}
+
+static void print_usage(
+    const char* program_name
+)
+{
+    fprintf(stderr, "Usage: %s [--threads N] [--output-dir DIR] SAVE [SAVE ...]\n", program_name);
+}
+
+int main(int argc, char** argv)
+{
+    pksav_batch_options_t options;
+    memset(&options, 0, sizeof(options));
+
+    const char* output_dir = NULL;
+    int first_save = 1;
+
+    while((first_save < (argc - 1)) && !strncmp(argv[first_save], "--", 2))
+    {
+        if(!strcmp(argv[first_save], "--threads"))
+        {
+            options.num_threads = (size_t)strtoul(argv[first_save+1], NULL, 10);
+        }
+        else if(!strcmp(argv[first_save], "--output-dir"))
+        {
+            output_dir = argv[first_save+1];
+        }
+        else
+        {
+            print_usage(argv[0]);
+            return EXIT_FAILURE;
+        }
+        first_save += 2;
+    }
+    if(first_save >= argc)
+    {
+        print_usage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    size_t num_saves = (size_t)(argc - first_save);
+    pksav_batch_input_t* inputs = calloc(num_saves, sizeof(pksav_batch_input_t));
+    batch_result_t* results = calloc(num_saves, sizeof(batch_result_t));
+    char** output_filepaths = calloc(num_saves, sizeof(char*));
+
+    for(size_t i = 0; i < num_saves; ++i)
+    {
+        inputs[i].filepath = argv[first_save + i];
+        if(output_dir)
+        {
+            const char* basename = get_basename(inputs[i].filepath);
+            size_t len = strlen(output_dir) + strlen(FS_SEPARATOR) + strlen(basename) + 1;
+
+            output_filepaths[i] = calloc(len, 1);
+            snprintf(output_filepaths[i], len, "%s%s%s", output_dir, FS_SEPARATOR, basename);
+            inputs[i].output_filepath = output_filepaths[i];
+        }
+    }
+
+    options.result_fcn = store_result;
+    options.user_data = results;
+
+    size_t num_failures = 0;
+    pksav_error_t error = pksav_batch_process(inputs, num_saves, &options, &num_failures);
+    if(error)
+    {
+        fprintf(stderr, "%s\n", pksav_strerror(error));
+    }
+    else
+    {
+        for(size_t i = 0; i < num_saves; ++i)
+        {
+            if(results[i].error)
+            {
+                printf("%s: %s\n", inputs[i].filepath, pksav_strerror(results[i].error));
+            }
+            else
+            {
+                printf("%s: %s (worker %zu)\n",
+                       inputs[i].filepath,
+                       save_type_names[results[i].save_type],
+                       results[i].worker);
+            }
+        }
+        printf("%zu/%zu saves loaded successfully.\n", (num_saves - num_failures), num_saves);
+    }
+
+    for(size_t i = 0; i < num_saves; ++i)
+    {
+        free(output_filepaths[i]);
+    }
+    free(output_filepaths);
+    free(results);
+    free(inputs);
+
+    return (error || num_failures) ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) 2018 Nicholas Corgan (n.corgan@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+
+/*
+ * Writes synthetic saves for the given game into an existing directory (see
+ * pksav/corpus.h), named after the game and their position. Each save's seed
+ * is the base seed plus its position, so any one of them can be regenerated
+ * on its own.
+ *
+ * Usage: pksav-corpus [--seed N] [--count N] GAME OUTPUT_DIR
+ */
+
+#include <pksav.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static const char* game_names[PKSAV_CORPUS_NUM_GAMES] =
+{
+    "red-blue",
+    "yellow",
+    "gold-silver",
+    "crystal",
+    "ruby-sapphire",
+    "emerald",
+    "firered-leafgreen"
+};
+
+static void print_usage(
+    const char* program_name
+)
+{
+    fprintf(stderr, "Usage: %s [--seed N] [--count N] GAME OUTPUT_DIR\n", program_name);
+    fprintf(stderr, "Games:");
+    for(size_t i = 0; i < PKSAV_CORPUS_NUM_GAMES; ++i)
+    {
+        fprintf(stderr, " %s", game_names[i]);
+    }
+    fprintf(stderr, "\n");
+}
+
+int main(int argc, char** argv)
+{
+    uint32_t seed = 0;
+    size_t count = 1;
+    int first_arg = 1;
+
+    while(((argc - first_arg) > 2) && !strncmp(argv[first_arg], "--", 2))
+    {
+        if(!strcmp(argv[first_arg], "--seed"))
+        {
+            seed = (uint32_t)strtoul(argv[first_arg+1], NULL, 0);
+        }
+        else if(!strcmp(argv[first_arg], "--count"))
+        {
+            count = (size_t)strtoul(argv[first_arg+1], NULL, 10);
+        }
+        else
+        {
+            print_usage(argv[0]);
+            return EXIT_FAILURE;
+        }
+
+        first_arg += 2;
+    }
+    if((argc - first_arg) != 2)
+    {
+        print_usage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    const char* game_name = argv[first_arg];
+    const char* output_dir = argv[first_arg+1];
+
+    size_t game = 0;
+    while((game < PKSAV_CORPUS_NUM_GAMES) && strcmp(game_name, game_names[game]))
+    {
+        ++game;
+    }
+    if(game == PKSAV_CORPUS_NUM_GAMES)
+    {
+        print_usage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    uint8_t* buffer = malloc(PKSAV_CORPUS_MAX_SAVE_SIZE);
+    if(!buffer)
+    {
+        fprintf(stderr, "Failed to allocate a save buffer.\n");
+        return EXIT_FAILURE;
+    }
+
+    int num_failures = 0;
+    for(size_t i = 0; i < count; ++i)
+    {
+        char filepath[4096] = {0};
+        snprintf(filepath, sizeof(filepath), "%s/%s-%05zu.sav", output_dir, game_name, i);
+
+        size_t save_size = 0;
+        pksav_error_t error = pksav_corpus_generate_save(
+                                  (pksav_corpus_game_t)game,
+                                  (seed + (uint32_t)i),
+                                  buffer,
+                                  PKSAV_CORPUS_MAX_SAVE_SIZE,
+                                  &save_size
+                              );
+        if(!error)
+        {
+            FILE* save_file = fopen(filepath, "wb");
+            if(save_file)
+            {
+                if(fwrite(buffer, 1, save_size, save_file) != save_size)
+                {
+                    error = PKSAV_ERROR_FILE_IO;
+                }
+                fclose(save_file);
+            }
+            else
+            {
+                error = PKSAV_ERROR_FILE_IO;
+            }
+        }
+
+        if(error)
+        {
+            fprintf(stderr, "%s: %s\n", filepath, pksav_strerror(error));
+            ++num_failures;
+        }
+    }
+
+    free(buffer);
+
+    printf("Wrote %zu %s saves to %s.\n",
+           (count - (size_t)num_failures),
+           game_name,
+           output_dir);
+
+    return num_failures ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,342 @@
+/*
+ * Copyright (c) 2018 Nicholas Corgan (n.corgan@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+
+/*
+ * Exports every party and PC Pokémon in the given saves into a single
+ * columnar file (see pksav/common/columnar.h). Each save's position in the
+ * argument list is written into the save_index column.
+ *
+ * Saves are loaded one at a time, and rows are written out in chunks, so
+ * memory use doesn't grow with the number of saves.
+ *
+ * Usage: pksav-export-columns [--chunk-rows N] OUTPUT SAVE [SAVE ...]
+ */
+
+#include <pksav.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+typedef pksav_error_t (*export_fcn_t)(
+                          const char*, uint32_t, pksav_columnar_writer_t*
+                      );
+
+static pksav_error_t export_gen1_save(
+    const char* filepath,
+    uint32_t save_index,
+    pksav_columnar_writer_t* writer
+)
+{
+    pksav_gen1_save_t gen1_save;
+    pksav_error_t error = pksav_gen1_save_load(filepath, &gen1_save);
+    if(error)
+    {
+        return error;
+    }
+
+    pksav_pokemon_record_t records[20];
+    size_t num_records = 0;
+
+    error = pksav_gen1_party_to_records(gen1_save.pokemon_party, records, &num_records);
+    if(!error)
+    {
+        error = pksav_columnar_writer_append(
+                    writer, records, num_records, save_index, PKSAV_COLUMNAR_LOCATION_PARTY
+                );
+    }
+
+    // The current box's contents live in a separate buffer until it's switched out.
+    uint8_t current_box = (*gen1_save.current_pokemon_box_num & PKSAV_GEN1_CURRENT_POKEMON_BOX_NUM_MASK);
+    for(uint8_t box = 0; (box < 12) && !error; ++box)
+    {
+        const pksav_gen1_pokemon_box_t* pokemon_box = (box == current_box)
+                                                    ? gen1_save.current_pokemon_box
+                                                    : gen1_save.pokemon_boxes[box];
+
+        error = pksav_gen1_box_to_records(pokemon_box, records, &num_records);
+        if(!error)
+        {
+            error = pksav_columnar_writer_append(writer, records, num_records, save_index, box);
+        }
+    }
+
+    pksav_gen1_save_free(&gen1_save);
+    return error;
+}
+
+static pksav_error_t export_gen2_save(
+    const char* filepath,
+    uint32_t save_index,
+    pksav_columnar_writer_t* writer
+)
+{
+    pksav_gen2_save_t gen2_save;
+    pksav_error_t error = pksav_gen2_save_load(filepath, &gen2_save);
+    if(error)
+    {
+        return error;
+    }
+
+    pksav_pokemon_record_t records[20];
+    size_t num_records = 0;
+
+    error = pksav_gen2_party_to_records(gen2_save.pokemon_party, records, &num_records);
+    if(!error)
+    {
+        error = pksav_columnar_writer_append(
+                    writer, records, num_records, save_index, PKSAV_COLUMNAR_LOCATION_PARTY
+                );
+    }
+
+    uint8_t current_box = *gen2_save.current_pokemon_box_num;
+    for(uint8_t box = 0; (box < 14) && !error; ++box)
+    {
+        const pksav_gen2_pokemon_box_t* pokemon_box = (box == current_box)
+                                                    ? gen2_save.current_pokemon_box
+                                                    : gen2_save.pokemon_boxes[box];
+
+        error = pksav_gen2_box_to_records(pokemon_box, records, &num_records);
+        if(!error)
+        {
+            error = pksav_columnar_writer_append(writer, records, num_records, save_index, box);
+        }
+    }
+
+    pksav_gen2_save_free(&gen2_save);
+    return error;
+}
+
+static pksav_error_t export_gba_save(
+    const char* filepath,
+    uint32_t save_index,
+    pksav_columnar_writer_t* writer
+)
+{
+    pksav_gba_save_t gba_save;
+    pksav_error_t error = pksav_gba_save_load(filepath, &gba_save);
+    if(error)
+    {
+        return error;
+    }
+
+    pksav_pokemon_record_t records[30];
+    size_t num_records = 0;
+
+    // Both the party and the PC are decrypted when the save is loaded.
+    error = pksav_gba_party_to_records(gba_save.pokemon_party, records, &num_records);
+    if(!error)
+    {
+        error = pksav_columnar_writer_append(
+                    writer, records, num_records, save_index, PKSAV_COLUMNAR_LOCATION_PARTY
+                );
+    }
+
+    for(uint8_t box = 0; (box < 14) && !error; ++box)
+    {
+        error = pksav_gba_box_to_records(&gba_save.pokemon_pc->boxes[box], records, &num_records);
+        if(!error)
+        {
+            error = pksav_columnar_writer_append(writer, records, num_records, save_index, box);
+        }
+    }
+
+    pksav_gba_save_free(&gba_save);
+    return error;
+}
+
+/*
+ * Empty Generation IV box slots don't always decrypt to an empty Pokémon, so
+ * anything whose checksum doesn't match is cleared.
+ */
+static void clear_invalid_nds_pokemon(
+    pksav_nds_pc_pokemon_t* pc_pokemon_arr,
+    size_t num_pokemon
+)
+{
+    for(size_t i = 0; i < num_pokemon; ++i)
+    {
+        uint16_t checksum = 0;
+        pksav_nds_get_pokemon_checksum(&pc_pokemon_arr[i], &checksum);
+        if(checksum != pksav_littleendian16(pc_pokemon_arr[i].checksum))
+        {
+            memset(&pc_pokemon_arr[i], 0, sizeof(pc_pokemon_arr[i]));
+        }
+    }
+}
+
+static pksav_error_t export_gen4_save(
+    const char* filepath,
+    uint32_t save_index,
+    pksav_columnar_writer_t* writer
+)
+{
+    pksav_gen4_save_t gen4_save;
+    pksav_error_t error = pksav_gen4_save_load(filepath, &gen4_save);
+    if(error)
+    {
+        return error;
+    }
+
+    pksav_pokemon_record_t records[30];
+    size_t num_records = 0;
+
+    // Decrypt copies so the save itself is left alone.
+    pksav_gen4_pokemon_party_t party = *gen4_save.pokemon_party;
+    uint32_t party_count = pksav_littleendian32(party.count);
+    if(party_count <= 6)
+    {
+        pksav_nds_decrypt_party_pokemon(party.party, party_count);
+    }
+    error = pksav_gen4_party_to_records(&party, records, &num_records);
+    if(!error)
+    {
+        error = pksav_columnar_writer_append(
+                    writer, records, num_records, save_index, PKSAV_COLUMNAR_LOCATION_PARTY
+                );
+    }
+
+    for(uint8_t box = 0; (box < PKSAV_GEN4_NUM_POKEMON_BOXES) && !error; ++box)
+    {
+        pksav_gen4_pokemon_box_t pokemon_box = *gen4_save.pokemon_boxes[box];
+        pksav_nds_decrypt_pc_pokemon(pokemon_box.entries, 30);
+        clear_invalid_nds_pokemon(pokemon_box.entries, 30);
+
+        error = pksav_gen4_box_to_records(&pokemon_box, records, &num_records);
+        if(!error)
+        {
+            error = pksav_columnar_writer_append(writer, records, num_records, save_index, box);
+        }
+    }
+
+    pksav_gen4_save_free(&gen4_save);
+    return error;
+}
+
+static pksav_error_t export_gen5_save(
+    const char* filepath,
+    uint32_t save_index,
+    pksav_columnar_writer_t* writer
+)
+{
+    pksav_gen5_save_t gen5_save;
+    pksav_error_t error = pksav_gen5_save_load(filepath, &gen5_save);
+    if(error)
+    {
+        return error;
+    }
+
+    pksav_pokemon_record_t records[30];
+    size_t num_records = 0;
+
+    error = pksav_gen5_party_to_records(gen5_save.pokemon_party, records, &num_records);
+    if(!error)
+    {
+        error = pksav_columnar_writer_append(
+                    writer, records, num_records, save_index, PKSAV_COLUMNAR_LOCATION_PARTY
+                );
+    }
+
+    for(uint8_t box = 0; (box < PKSAV_GEN5_NUM_POKEMON_BOXES) && !error; ++box)
+    {
+        const pksav_gen5_pokemon_box_t* pokemon_box = NULL;
+        error = pksav_gen5_save_get_pokemon_box(&gen5_save, box, &pokemon_box);
+        if(!error)
+        {
+            error = pksav_gen5_box_to_records(pokemon_box, records, &num_records);
+        }
+        if(!error)
+        {
+            error = pksav_columnar_writer_append(writer, records, num_records, save_index, box);
+        }
+    }
+
+    pksav_gen5_save_free(&gen5_save);
+    return error;
+}
+
+/*
+ * Tried in order until one recognizes the save. The formats with the strongest
+ * checksums go first, since Generation I's single-byte checksum can match
+ * other data by chance.
+ */
+static const export_fcn_t export_fcns[] =
+{
+    export_gen5_save,
+    export_gen4_save,
+    export_gba_save,
+    export_gen2_save,
+    export_gen1_save
+};
+
+static void print_usage(
+    const char* program_name
+)
+{
+    fprintf(stderr, "Usage: %s [--chunk-rows N] OUTPUT SAVE [SAVE ...]\n", program_name);
+}
+
+int main(int argc, char** argv)
+{
+    size_t max_chunk_rows = 0;
+    int first_arg = 1;
+
+    if((argc > 2) && !strcmp(argv[1], "--chunk-rows"))
+    {
+        max_chunk_rows = (size_t)strtoul(argv[2], NULL, 10);
+        first_arg = 3;
+    }
+    if((argc - first_arg) < 2)
+    {
+        print_usage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    const char* output_filepath = argv[first_arg];
+
+    pksav_columnar_writer_t writer;
+    pksav_error_t error = pksav_columnar_writer_open(output_filepath, max_chunk_rows, &writer);
+    if(error)
+    {
+        fprintf(stderr, "%s: %s\n", output_filepath, pksav_strerror(error));
+        return EXIT_FAILURE;
+    }
+
+    int num_failures = 0;
+    for(int arg = first_arg + 1; arg < argc; ++arg)
+    {
+        uint32_t save_index = (uint32_t)(arg - first_arg - 1);
+        const char* save_filepath = argv[arg];
+
+        error = PKSAV_ERROR_INVALID_SAVE;
+        for(size_t i = 0; (i < (sizeof(export_fcns)/sizeof(export_fcns[0]))) && (error == PKSAV_ERROR_INVALID_SAVE); ++i)
+        {
+            error = export_fcns[i](save_filepath, save_index, &writer);
+        }
+
+        if(error)
+        {
+            fprintf(stderr, "%s: %s\n", save_filepath, pksav_strerror(error));
+            ++num_failures;
+        }
+    }
+
+    uint64_t num_rows = writer.num_rows;
+    error = pksav_columnar_writer_close(&writer);
+    if(error)
+    {
+        fprintf(stderr, "%s: %s\n", output_filepath, pksav_strerror(error));
+        return EXIT_FAILURE;
+    }
+
+    printf("Wrote %llu Pokémon from %d saves to %s.\n",
+           (unsigned long long)num_rows,
+           (argc - first_arg - 1 - num_failures),
+           output_filepath);
+
+    return num_failures ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -69,6 +69,26 @@ ENDIF(NOT HAVE_STDINT_H)
 # Checks for platform-specific headers
 CHECK_INCLUDE_FILE(unistd.h HAVE_UNISTD_H)
 
+# Optional asynchronous file reading for pksav_ingest_files (Linux only)
+OPTION(PKSAV_ENABLE_IO_URING "Use io_uring to read save files asynchronously (Linux only)" OFF)
+IF(PKSAV_ENABLE_IO_URING)
+    CHECK_INCLUDE_FILE(linux/io_uring.h HAVE_LINUX_IO_URING_H)
+    IF(NOT HAVE_LINUX_IO_URING_H)
+        MESSAGE(FATAL_ERROR "PKSAV_ENABLE_IO_URING requires the header linux/io_uring.h.")
+    ENDIF(NOT HAVE_LINUX_IO_URING_H)
+ENDIF(PKSAV_ENABLE_IO_URING)
+
+# Optional per-phase timing for GBA loads and saves, compiled out by default
+OPTION(PKSAV_ENABLE_INSTRUMENTATION "Report how long each phase of loading and saving takes" OFF)
+OPTION(PKSAV_ENABLE_USDT "Fire a USDT probe for each phase, for perf and bpftrace (Linux only)" OFF)
+IF(PKSAV_ENABLE_USDT)
+    CHECK_INCLUDE_FILE(sys/sdt.h HAVE_SYS_SDT_H)
+    IF(NOT HAVE_SYS_SDT_H)
+        MESSAGE(FATAL_ERROR "PKSAV_ENABLE_USDT requires the header sys/sdt.h (systemtap-sdt-dev).")
+    ENDIF(NOT HAVE_SYS_SDT_H)
+    SET(PKSAV_ENABLE_INSTRUMENTATION ON CACHE BOOL "Report how long each phase of loading and saving takes" FORCE)
+ENDIF(PKSAV_ENABLE_USDT)
+
 # Set compiler name for CMake display
 IF(MSVC)
     IF(MSVC12)
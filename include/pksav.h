@@ -13,17 +13,29 @@
 
 #include <pksav/config.h>
 
+#include <pksav/batch.h>
+#include <pksav/corpus.h>
 #include <pksav/error.h>
+#include <pksav/ingest.h>
+#include <pksav/journal.h>
+#include <pksav/store.h>
 #include <pksav/version.h>
 
+#include <pksav/common/allocator.h>
+#include <pksav/common/base_stats.h>
+#include <pksav/common/columnar.h>
 #include <pksav/common/contest_stats.h>
 #include <pksav/common/datetime.h>
 #include <pksav/common/gen3_ribbons.h>
 #include <pksav/common/gen4_encounter_type.h>
+#include <pksav/common/instrumentation.h>
+#include <pksav/common/lcrng.h>
 #include <pksav/common/markings.h>
 #include <pksav/common/nature.h>
+#include <pksav/common/nds_crypt.h>
 #include <pksav/common/nds_pokemon.h>
 #include <pksav/common/pokedex.h>
+#include <pksav/common/pokemon_record.h>
 #include <pksav/common/pokerus.h>
 #include <pksav/common/prng.h>
 #include <pksav/common/stats.h>
@@ -32,8 +44,8 @@
 #include <pksav/gen1.h>
 #include <pksav/gen2.h>
 #include <pksav/gba.h>
-#include <pksav/gen4/text.h>
-#include <pksav/gen5/text.h>
+#include <pksav/gen4.h>
+#include <pksav/gen5.h>
 
 #include <pksav/math/base256.h>
 #include <pksav/math/bcd.h>
@@ -0,0 +1,167 @@
+/*!
+ * @file    pksav/batch.h
+ * @ingroup PKSav
+ * @brief   Loading and processing many saves across multiple threads.
+ *
+ * Copyright (c) 2018 Nicholas Corgan (n.corgan@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+#ifndef PKSAV_BATCH_H
+#define PKSAV_BATCH_H
+
+#include <pksav/config.h>
+#include <pksav/error.h>
+
+#include <pksav/gen1/save.h>
+#include <pksav/gen2/save.h>
+#include <pksav/gba/save.h>
+#include <pksav/gen4/save.h>
+#include <pksav/gen5/save.h>
+
+#include <stdint.h>
+#include <stdlib.h>
+
+//! The size of each worker's arena used by ::pksav_batch_process when given 0.
+#define PKSAV_BATCH_DEFAULT_ARENA_SIZE (2 * 1024 * 1024)
+
+//! Which kind of save an input was detected as.
+typedef enum {
+    //! The input couldn't be loaded as any kind of save.
+    PKSAV_BATCH_SAVE_TYPE_NONE = 0,
+    //! Generation I (::pksav_gen1_save_t).
+    PKSAV_BATCH_SAVE_TYPE_GEN1,
+    //! Generation II (::pksav_gen2_save_t).
+    PKSAV_BATCH_SAVE_TYPE_GEN2,
+    //! Game Boy Advance (::pksav_gba_save_t).
+    PKSAV_BATCH_SAVE_TYPE_GBA,
+    //! Generation IV (::pksav_gen4_save_t).
+    PKSAV_BATCH_SAVE_TYPE_GEN4,
+    //! Generation V (::pksav_gen5_save_t).
+    PKSAV_BATCH_SAVE_TYPE_GEN5
+} pksav_batch_save_type_t;
+
+/*!
+ * @brief A save to process, from either a file or memory.
+ */
+typedef struct {
+    //! The path of the save file, or NULL to use buffer.
+    const char* filepath;
+    //! The save data, used if filepath is NULL. It must stay valid until processing finishes.
+    const uint8_t* buffer;
+    //! The length of buffer.
+    size_t buffer_len;
+    //! If not NULL, where to write the save once it has been transformed.
+    const char* output_filepath;
+} pksav_batch_input_t;
+
+/*!
+ * @brief One input as it's being processed.
+ *
+ * The save is only valid during the callback it's passed into, and is freed
+ * afterward.
+ */
+typedef struct {
+    //! The position of this input in the input array.
+    size_t index;
+    //! The input itself.
+    const pksav_batch_input_t* input;
+    //! Which worker thread is processing this input (0-based).
+    size_t worker;
+    //! What kind of save the input was loaded as.
+    pksav_batch_save_type_t save_type;
+    /*!
+     * @brief The first error hit while processing this input.
+     *
+     * ::PKSAV_ERROR_INVALID_SAVE means the input wasn't a valid save of any kind.
+     */
+    pksav_error_t error;
+    //! The loaded save, whose active member is given by save_type.
+    union {
+        pksav_gen1_save_t gen1;
+        pksav_gen2_save_t gen2;
+        pksav_gba_save_t gba;
+        pksav_gen4_save_t gen4;
+        pksav_gen5_save_t gen5;
+    } save;
+} pksav_batch_item_t;
+
+/*!
+ * @brief Called with each successfully loaded save, before it's written out.
+ *
+ * Any error returned is stored in pksav_batch_item_t.error, and the save isn't
+ * written to pksav_batch_input_t.output_filepath.
+ */
+typedef pksav_error_t (*pksav_batch_transform_fcn_t)(
+    pksav_batch_item_t* item,
+    void* user_data
+);
+
+/*!
+ * @brief Called once for each input after it's been processed, successfully or not.
+ *
+ * If item->error is ::PKSAV_ERROR_NONE, item->save can be read.
+ */
+typedef void (*pksav_batch_result_fcn_t)(
+    const pksav_batch_item_t* item,
+    void* user_data
+);
+
+/*!
+ * @brief Options for ::pksav_batch_process.
+ *
+ * All callbacks are called from worker threads, possibly at the same time, and
+ * in no particular order.
+ */
+typedef struct {
+    //! How many threads to use, or 0 for one per processor.
+    size_t num_threads;
+    //! The size of each worker's allocation arena, or 0 for ::PKSAV_BATCH_DEFAULT_ARENA_SIZE.
+    size_t arena_size;
+    //! Called on each loaded save before writing it out (optional).
+    pksav_batch_transform_fcn_t transform_fcn;
+    //! Called with the result for each input (optional).
+    pksav_batch_result_fcn_t result_fcn;
+    //! Passed into each callback.
+    void* user_data;
+} pksav_batch_options_t;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*!
+ * @brief Detect, load, validate, and optionally transform and write many saves.
+ *
+ * Each input is loaded as whichever kind of save it validates as, trying
+ * Generation V, Generation IV, Game Boy Advance, Generation II, and Generation
+ * I in that order, so the formats with the strongest checksums come first.
+ * Each successfully loaded save is passed into options->transform_fcn and then
+ * written to its output_filepath if it has one. Finally, options->result_fcn is
+ * called with the outcome.
+ *
+ * Inputs are split evenly between the worker threads, and a worker that runs
+ * out takes half of the remaining inputs from another. The calling thread
+ * is one of the workers. Each worker loads saves into its own arena, which is
+ * reset after every input.
+ *
+ * \param inputs The saves to process
+ * \param num_inputs The number of inputs
+ * \param options How to process them
+ * \param num_failures_out Where to return how many inputs had errors (optional)
+ * \returns ::PKSAV_ERROR_NONE once every input has been processed, even if some failed
+ * \returns ::PKSAV_ERROR_NULL_POINTER if inputs or options is NULL
+ */
+PKSAV_API pksav_error_t pksav_batch_process(
+    const pksav_batch_input_t* inputs,
+    size_t num_inputs,
+    const pksav_batch_options_t* options,
+    size_t* num_failures_out
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PKSAV_BATCH_H */
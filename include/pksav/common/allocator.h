@@ -0,0 +1,56 @@
+/*!
+ * @file    pksav/common/allocator.h
+ * @ingroup PKSav
+ * @brief   Replacing the memory allocator used when loading and saving.
+ *
+ * Copyright (c) 2018 Nicholas Corgan (n.corgan@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+#ifndef PKSAV_COMMON_ALLOCATOR_H
+#define PKSAV_COMMON_ALLOCATOR_H
+
+#include <pksav/config.h>
+
+#include <stdlib.h>
+
+/*!
+ * @brief A replacement for calloc and free.
+ *
+ * calloc_fcn must return zeroed memory, or NULL on failure. free_fcn must
+ * accept NULL.
+ */
+typedef struct {
+    //! Allocates num * size zeroed bytes.
+    void* (*calloc_fcn)(size_t num, size_t size, void* user_data);
+    //! Frees memory returned by calloc_fcn.
+    void (*free_fcn)(void* ptr, void* user_data);
+    //! Passed into both functions.
+    void* user_data;
+} pksav_allocator_t;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*!
+ * @brief Set the allocator used by the save loading and saving functions on this thread.
+ *
+ * This only affects the calling thread, so each thread can allocate from its
+ * own arena without locking. The given struct is copied.
+ *
+ * A save must be freed on a thread using the same allocator it was loaded
+ * with.
+ *
+ * \param allocator The allocator to use, or NULL to go back to calloc and free
+ */
+PKSAV_API void pksav_set_thread_allocator(
+    const pksav_allocator_t* allocator
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PKSAV_COMMON_ALLOCATOR_H */
@@ -0,0 +1,192 @@
+/*!
+ * @file    pksav/common/base_stats.h
+ * @ingroup PKSav
+ * @brief   Base stat tables and battle stat calculation.
+ *
+ * Copyright (c) 2018 Nicholas Corgan (n.corgan@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+#ifndef PKSAV_COMMON_BASE_STATS_H
+#define PKSAV_COMMON_BASE_STATS_H
+
+#include <pksav/config.h>
+#include <pksav/error.h>
+
+#include <pksav/common/nature.h>
+#include <pksav/common/stats.h>
+
+#include <stdint.h>
+
+/*!
+ * @brief A species' base stats.
+ *
+ * For Generation I, the Special stat is stored in both spatk and spdef.
+ */
+typedef struct {
+    //! @brief Base HP.
+    uint8_t hp;
+    //! @brief Base Attack.
+    uint8_t attack;
+    //! @brief Base Defense.
+    uint8_t defense;
+    //! @brief Base Speed.
+    uint8_t speed;
+    //! @brief Base Special Attack (or Special).
+    uint8_t spatk;
+    //! @brief Base Special Defense (or Special).
+    uint8_t spdef;
+} pksav_base_stats_t;
+
+/*!
+ * @brief A Pokémon's calculated battle stats, in host byte order.
+ *
+ * For Generation I, the Special stat is stored in both spatk and spdef.
+ */
+typedef struct {
+    //! @brief Maximum HP.
+    uint16_t hp;
+    //! @brief Attack.
+    uint16_t attack;
+    //! @brief Defense.
+    uint16_t defense;
+    //! @brief Speed.
+    uint16_t speed;
+    //! @brief Special Attack (or Special).
+    uint16_t spatk;
+    //! @brief Special Defense (or Special).
+    uint16_t spdef;
+} pksav_battle_stats_t;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*!
+ * @brief Get a species' base stats as of Generations II-III.
+ *
+ * \param pokedex_num The species' National Pokédex number (1-386)
+ * \param base_stats_out Where to return the base stats
+ * \returns ::PKSAV_ERROR_NONE upon success
+ * \returns ::PKSAV_ERROR_NULL_POINTER if base_stats_out is NULL
+ * \returns ::PKSAV_ERROR_PARAM_OUT_OF_RANGE if pokedex_num is invalid
+ */
+PKSAV_API pksav_error_t pksav_get_base_stats(
+    uint16_t pokedex_num,
+    pksav_base_stats_t* base_stats_out
+);
+
+/*!
+ * @brief Get a species' base stats in Generation I.
+ *
+ * \param pokedex_num The species' National Pokédex number (1-151)
+ * \param base_stats_out Where to return the base stats
+ * \returns ::PKSAV_ERROR_NONE upon success
+ * \returns ::PKSAV_ERROR_NULL_POINTER if base_stats_out is NULL
+ * \returns ::PKSAV_ERROR_PARAM_OUT_OF_RANGE if pokedex_num is invalid
+ */
+PKSAV_API pksav_error_t pksav_get_gen1_base_stats(
+    uint16_t pokedex_num,
+    pksav_base_stats_t* base_stats_out
+);
+
+/*!
+ * @brief Convert a Generation I species index to a National Pokédex number.
+ *
+ * \param species_index The species index, as stored in pksav_gen1_pc_pokemon_t.species
+ * \param pokedex_num_out Where to return the National Pokédex number
+ * \returns ::PKSAV_ERROR_NONE upon success
+ * \returns ::PKSAV_ERROR_NULL_POINTER if pokedex_num_out is NULL
+ * \returns ::PKSAV_ERROR_PARAM_OUT_OF_RANGE if the index isn't a valid species
+ */
+PKSAV_API pksav_error_t pksav_gen1_species_to_pokedex_num(
+    uint8_t species_index,
+    uint16_t* pokedex_num_out
+);
+
+/*!
+ * @brief Convert a Game Boy Advance species index to a National Pokédex number.
+ *
+ * Indices 1-251 match the National Pokédex, 252-276 are unused, and Hoenn
+ * Pokémon are stored at 277-411 in a different order.
+ *
+ * \param species_index The species index, in host byte order
+ * \param pokedex_num_out Where to return the National Pokédex number
+ * \returns ::PKSAV_ERROR_NONE upon success
+ * \returns ::PKSAV_ERROR_NULL_POINTER if pokedex_num_out is NULL
+ * \returns ::PKSAV_ERROR_PARAM_OUT_OF_RANGE if the index isn't a valid species
+ */
+PKSAV_API pksav_error_t pksav_gba_species_to_pokedex_num(
+    uint16_t species_index,
+    uint16_t* pokedex_num_out
+);
+
+/*!
+ * @brief Get which stats a nature raises and lowers.
+ *
+ * Neutral natures return ::PKSAV_STAT_NONE for both.
+ *
+ * \param nature The nature
+ * \param increased_stat_out Where to return the raised stat
+ * \param decreased_stat_out Where to return the lowered stat
+ * \returns ::PKSAV_ERROR_NONE upon success
+ * \returns ::PKSAV_ERROR_NULL_POINTER if either output is NULL
+ * \returns ::PKSAV_ERROR_PARAM_OUT_OF_RANGE if nature is invalid
+ */
+PKSAV_API pksav_error_t pksav_get_nature_stat_modifiers(
+    pksav_nature_t nature,
+    pksav_battle_stat_t* increased_stat_out,
+    pksav_battle_stat_t* decreased_stat_out
+);
+
+/*!
+ * @brief Calculate a Pokémon's stats with the Generation I-II formula.
+ *
+ * \param base_stats The species' base stats
+ * \param level The Pokémon's level (1-100)
+ * \param iv_data The Pokémon's IVs, in the format read by ::pksav_get_gb_IV
+ * \param EVs The Pokémon's HP, Attack, Defense, Speed, and Special EVs, in host byte order
+ * \param stats_out Where to return the stats
+ * \returns ::PKSAV_ERROR_NONE upon success
+ * \returns ::PKSAV_ERROR_NULL_POINTER if any pointer parameter is NULL
+ * \returns ::PKSAV_ERROR_PARAM_OUT_OF_RANGE if level is invalid
+ */
+PKSAV_API pksav_error_t pksav_calc_gb_stats(
+    const pksav_base_stats_t* base_stats,
+    uint8_t level,
+    uint16_t iv_data,
+    const uint16_t* EVs,
+    pksav_battle_stats_t* stats_out
+);
+
+/*!
+ * @brief Calculate a Pokémon's stats with the Generation III+ formula.
+ *
+ * A base HP of 1 (Shedinja) always results in 1 HP.
+ *
+ * \param base_stats The species' base stats
+ * \param level The Pokémon's level (1-100)
+ * \param iv_data The Pokémon's IVs, in the format read by ::pksav_get_IV
+ * \param EVs The Pokémon's HP, Attack, Defense, Speed, Special Attack, and
+ *            Special Defense EVs
+ * \param nature The Pokémon's nature
+ * \param stats_out Where to return the stats
+ * \returns ::PKSAV_ERROR_NONE upon success
+ * \returns ::PKSAV_ERROR_NULL_POINTER if any pointer parameter is NULL
+ * \returns ::PKSAV_ERROR_PARAM_OUT_OF_RANGE if level or nature is invalid
+ */
+PKSAV_API pksav_error_t pksav_calc_stats(
+    const pksav_base_stats_t* base_stats,
+    uint8_t level,
+    uint32_t iv_data,
+    const uint8_t* EVs,
+    pksav_nature_t nature,
+    pksav_battle_stats_t* stats_out
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PKSAV_COMMON_BASE_STATS_H */
@@ -0,0 +1,254 @@
+/*!
+ * @file    pksav/common/columnar.h
+ * @ingroup PKSav
+ * @brief   Streaming normalized Pokémon records into a columnar binary file.
+ *
+ * A columnar file starts with a ::pksav_columnar_header_t, followed by one
+ * ::pksav_columnar_column_t for each column. After that come the chunks, one
+ * after another. Each chunk starts with a ::pksav_columnar_chunk_header_t.
+ * Then comes one contiguous array per column, in column order. Each array
+ * holds num_rows * width elements of element_size bytes, and is padded with
+ * zeros to a multiple of 8 bytes.
+ *
+ * All values are little-endian, and every array starts on an 8-byte
+ * boundary. A reader on a little-endian host can map the file and cast each
+ * array directly.
+ *
+ * Copyright (c) 2018 Nicholas Corgan (n.corgan@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+#ifndef PKSAV_COMMON_COLUMNAR_H
+#define PKSAV_COMMON_COLUMNAR_H
+
+#include <pksav/config.h>
+#include <pksav/error.h>
+
+#include <pksav/common/pokemon_record.h>
+
+#include <stdint.h>
+#include <stdlib.h>
+
+//! The magic number at the start of a columnar file.
+#define PKSAV_COLUMNAR_MAGIC "PKSAVCOL"
+
+//! The magic number at the start of each chunk.
+#define PKSAV_COLUMNAR_CHUNK_MAGIC "PKCHUNK\0"
+
+//! The version of the columnar format written by this version of PKSav.
+#define PKSAV_COLUMNAR_VERSION 1
+
+//! The maximum length of a column name, including the null terminator.
+#define PKSAV_COLUMNAR_COLUMN_NAME_SIZE 24
+
+//! The number of rows per chunk used by ::pksav_columnar_writer_open when given 0.
+#define PKSAV_COLUMNAR_DEFAULT_CHUNK_ROWS 65536
+
+//! The most rows a chunk can have.
+#define PKSAV_COLUMNAR_MAX_CHUNK_ROWS (1 << 24)
+
+//! The location column value for Pokémon in the trainer's party.
+#define PKSAV_COLUMNAR_LOCATION_PARTY 0xFF
+
+/*!
+ * @brief The columns in a file written by this version of PKSav, in file order.
+ *
+ * Readers should find columns by name in the ::pksav_columnar_column_t
+ * table, since later versions may add columns.
+ */
+typedef enum {
+    //! The caller-supplied index of the save the Pokémon came from (uint32).
+    PKSAV_COLUMNAR_SAVE_INDEX = 0,
+    //! pksav_pokemon_record_t.personality (uint32).
+    PKSAV_COLUMNAR_PERSONALITY,
+    //! pksav_pokemon_record_t.exp (uint32).
+    PKSAV_COLUMNAR_EXP,
+    //! pksav_pokemon_record_t.pokedex_num (uint16).
+    PKSAV_COLUMNAR_POKEDEX_NUM,
+    //! pksav_pokemon_record_t.held_item (uint16).
+    PKSAV_COLUMNAR_HELD_ITEM,
+    //! pksav_pokemon_record_t.moves (4 x uint16).
+    PKSAV_COLUMNAR_MOVES,
+    //! pksav_pokemon_record_t.ot_public_id (uint16).
+    PKSAV_COLUMNAR_OT_PUBLIC_ID,
+    //! pksav_pokemon_record_t.ot_secret_id (uint16).
+    PKSAV_COLUMNAR_OT_SECRET_ID,
+    //! pksav_pokemon_record_t.EVs (6 x uint16).
+    PKSAV_COLUMNAR_EVS,
+    //! pksav_pokemon_record_t.IVs (6 x uint8).
+    PKSAV_COLUMNAR_IVS,
+    //! Box number (0-based), or ::PKSAV_COLUMNAR_LOCATION_PARTY (uint8).
+    PKSAV_COLUMNAR_LOCATION,
+    //! pksav_pokemon_record_t.level (uint8).
+    PKSAV_COLUMNAR_LEVEL,
+    //! pksav_pokemon_record_t.friendship (uint8).
+    PKSAV_COLUMNAR_FRIENDSHIP,
+    //! pksav_pokemon_record_t.pokerus (uint8).
+    PKSAV_COLUMNAR_POKERUS,
+    //! pksav_pokemon_record_t.generation (uint8).
+    PKSAV_COLUMNAR_GENERATION,
+    //! pksav_pokemon_record_t.nature (uint8).
+    PKSAV_COLUMNAR_NATURE,
+    //! pksav_pokemon_record_t.flags (uint8).
+    PKSAV_COLUMNAR_FLAGS,
+
+    //! The number of columns.
+    PKSAV_COLUMNAR_NUM_COLUMNS
+} pksav_columnar_column_id_t;
+
+#pragma pack(push,1)
+
+/*!
+ * @brief The header at the start of a columnar file (64 bytes).
+ *
+ * num_chunks and num_rows are written by ::pksav_columnar_writer_close. A file
+ * whose writer was never closed has 0 in both fields, but its chunks are still
+ * valid and can be found by walking the chunk headers.
+ */
+typedef struct {
+    //! ::PKSAV_COLUMNAR_MAGIC, without a null terminator.
+    uint8_t magic[8];
+    //! ::PKSAV_COLUMNAR_VERSION.
+    uint32_t version;
+    //! The number of ::pksav_columnar_column_t entries after the header.
+    uint32_t num_columns;
+    //! The most rows any chunk in the file can have.
+    uint32_t max_chunk_rows;
+    //! The number of chunks in the file.
+    uint32_t num_chunks;
+    //! The total number of rows in the file.
+    uint64_t num_rows;
+    uint8_t reserved[32];
+} pksav_columnar_header_t;
+
+//! @brief A description of a column (32 bytes).
+typedef struct {
+    //! The column's name, null-terminated.
+    char name[PKSAV_COLUMNAR_COLUMN_NAME_SIZE];
+    //! The size of each element, in bytes (1, 2, or 4).
+    uint32_t element_size;
+    //! The number of elements in each row.
+    uint32_t width;
+} pksav_columnar_column_t;
+
+//! @brief The header at the start of each chunk (16 bytes).
+typedef struct {
+    //! ::PKSAV_COLUMNAR_CHUNK_MAGIC.
+    uint8_t magic[8];
+    //! The number of rows in this chunk.
+    uint32_t num_rows;
+    //! The size of the chunk's column arrays, in bytes, not including this header.
+    uint32_t num_bytes;
+} pksav_columnar_chunk_header_t;
+
+#pragma pack(pop)
+
+/*!
+ * @brief The state of a columnar file being written.
+ *
+ * Rows are buffered in memory until a full chunk is ready and are then
+ * written all at once. Memory use is set by the number of rows per chunk, not
+ * by the total number of rows written.
+ *
+ * Fill this struct by calling ::pksav_columnar_writer_open, and pass it into
+ * ::pksav_columnar_writer_close when finished.
+ */
+typedef struct {
+    //! The number of rows per chunk.
+    size_t max_chunk_rows;
+    //! The number of rows currently buffered.
+    size_t num_buffered_rows;
+    //! The number of chunks written so far.
+    uint32_t num_chunks;
+    //! The number of rows written so far, including buffered rows.
+    uint64_t num_rows;
+
+    // Do not edit these
+#ifndef __DOXYGEN__
+    void* file;
+    uint8_t* columns[PKSAV_COLUMNAR_NUM_COLUMNS];
+#endif
+} pksav_columnar_writer_t;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*!
+ * @brief Create a columnar file and write its header.
+ *
+ * Any existing file at the given path is overwritten.
+ *
+ * \param filepath Where to write the file
+ * \param max_chunk_rows How many rows to buffer before writing a chunk, or 0
+ *                       for ::PKSAV_COLUMNAR_DEFAULT_CHUNK_ROWS
+ * \param writer_out The writer to initialize
+ * \returns ::PKSAV_ERROR_NONE upon success
+ * \returns ::PKSAV_ERROR_NULL_POINTER if filepath or writer_out is NULL
+ * \returns ::PKSAV_ERROR_PARAM_OUT_OF_RANGE if max_chunk_rows is greater than
+ *         ::PKSAV_COLUMNAR_MAX_CHUNK_ROWS
+ * \returns ::PKSAV_ERROR_FILE_IO if the file cannot be created
+ */
+PKSAV_API pksav_error_t pksav_columnar_writer_open(
+    const char* filepath,
+    size_t max_chunk_rows,
+    pksav_columnar_writer_t* writer_out
+);
+
+/*!
+ * @brief Append records to a columnar file.
+ *
+ * The records are copied into the writer's buffers, and a chunk is written
+ * each time the buffers fill up.
+ *
+ * \param writer The writer to append to
+ * \param records The records to append
+ * \param num_records The number of records to append
+ * \param save_index The value to write into the save index column for these records
+ * \param location The box number these records came from, or ::PKSAV_COLUMNAR_LOCATION_PARTY
+ * \returns ::PKSAV_ERROR_NONE upon success
+ * \returns ::PKSAV_ERROR_NULL_POINTER if writer or records is NULL
+ * \returns ::PKSAV_ERROR_FILE_IO if a chunk could not be written
+ */
+PKSAV_API pksav_error_t pksav_columnar_writer_append(
+    pksav_columnar_writer_t* writer,
+    const pksav_pokemon_record_t* records,
+    size_t num_records,
+    uint32_t save_index,
+    uint8_t location
+);
+
+/*!
+ * @brief Write any buffered rows as a chunk.
+ *
+ * This does nothing if no rows are buffered.
+ *
+ * \param writer The writer to flush
+ * \returns ::PKSAV_ERROR_NONE upon success
+ * \returns ::PKSAV_ERROR_NULL_POINTER if writer is NULL
+ * \returns ::PKSAV_ERROR_FILE_IO if the chunk could not be written
+ */
+PKSAV_API pksav_error_t pksav_columnar_writer_flush(
+    pksav_columnar_writer_t* writer
+);
+
+/*!
+ * @brief Flush any buffered rows, finalize the header, and close the file.
+ *
+ * The writer's memory is freed even if writing fails.
+ *
+ * \param writer The writer to close
+ * \returns ::PKSAV_ERROR_NONE upon success
+ * \returns ::PKSAV_ERROR_NULL_POINTER if writer is NULL
+ * \returns ::PKSAV_ERROR_FILE_IO if the file could not be finalized
+ */
+PKSAV_API pksav_error_t pksav_columnar_writer_close(
+    pksav_columnar_writer_t* writer
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PKSAV_COMMON_COLUMNAR_H */
@@ -0,0 +1,125 @@
+/*!
+ * @file    pksav/common/instrumentation.h
+ * @ingroup PKSav
+ * @brief   Timing each phase of loading and saving.
+ *
+ * Copyright (c) 2018 Nicholas Corgan (n.corgan@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+#ifndef PKSAV_COMMON_INSTRUMENTATION_H
+#define PKSAV_COMMON_INSTRUMENTATION_H
+
+#include <pksav/config.h>
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+/*!
+ * @brief A step in loading or saving a Game Boy Advance save.
+ *
+ * A load reports, in order, PKSAV_PHASE_READ, PKSAV_PHASE_DETECT,
+ * PKSAV_PHASE_SLOT_SELECT, PKSAV_PHASE_UNSHUFFLE, PKSAV_PHASE_POKEMON_CRYPT,
+ * and PKSAV_PHASE_ITEM_CRYPT. Strict loads verify each slot during
+ * PKSAV_PHASE_SLOT_SELECT, before PKSAV_PHASE_DETECT, since the game is only
+ * detected from the slot being loaded.
+ *
+ * A save reports, in order, PKSAV_PHASE_ITEM_CRYPT, PKSAV_PHASE_POKEMON_CRYPT,
+ * PKSAV_PHASE_CHECKSUM, PKSAV_PHASE_SHUFFLE, and PKSAV_PHASE_WRITE.
+ */
+typedef enum {
+    //! Reading the file, or copying the given buffer.
+    PKSAV_PHASE_READ = 0,
+    //! Working out which game the save is from.
+    PKSAV_PHASE_DETECT,
+    //! Finding the most recent save slot, and verifying both for strict loads.
+    PKSAV_PHASE_SLOT_SELECT,
+    //! Putting the slot's sections in order.
+    PKSAV_PHASE_UNSHUFFLE,
+    //! Decrypting or encrypting the party and PC Pokémon.
+    PKSAV_PHASE_POKEMON_CRYPT,
+    //! Decrypting or encrypting the item counts, money, and casino coins.
+    PKSAV_PHASE_ITEM_CRYPT,
+    //! Setting the section checksums.
+    PKSAV_PHASE_CHECKSUM,
+    //! Writing the sections into the save slot in their shuffled order.
+    PKSAV_PHASE_SHUFFLE,
+    //! Writing the file, or copying into the given buffer.
+    PKSAV_PHASE_WRITE
+} pksav_phase_t;
+
+//! The number of values in ::pksav_phase_t.
+#define PKSAV_NUM_PHASES 9
+
+/*!
+ * @brief Called as each phase finishes.
+ *
+ * \param phase The phase that finished
+ * \param duration_ns How long it took, in nanoseconds
+ * \param bytes_touched How many bytes of save data it read or wrote
+ * \param user_data pksav_instrumentation_t.user_data
+ */
+typedef void (*pksav_phase_fcn_t)(
+    pksav_phase_t phase,
+    uint64_t duration_ns,
+    size_t bytes_touched,
+    void* user_data
+);
+
+/*!
+ * @brief Where to report phases.
+ */
+typedef struct {
+    //! Called as each phase finishes.
+    pksav_phase_fcn_t phase_fcn;
+    //! Passed into phase_fcn.
+    void* user_data;
+} pksav_instrumentation_t;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*!
+ * @brief Whether phases are reported at all.
+ *
+ * This is only true if PKSav was built with PKSAV_ENABLE_INSTRUMENTATION.
+ * Otherwise, the timing is compiled out, and ::pksav_set_thread_instrumentation
+ * has no effect.
+ *
+ * If PKSav was built with PKSAV_ENABLE_USDT, each phase also fires the USDT
+ * probe pksav:phase, with the phase, its duration in nanoseconds, and the
+ * bytes touched as its arguments, whether or not a function is set. These
+ * can be traced with perf, bpftrace, or SystemTap with no changes to the
+ * program.
+ */
+PKSAV_API bool pksav_instrumentation_is_enabled(void);
+
+/*!
+ * @brief Set where phases are reported on this thread.
+ *
+ * This only affects the calling thread, and phase_fcn is called on the thread
+ * doing the work. The given struct is copied.
+ *
+ * \param instrumentation Where to report phases, or NULL to stop reporting them
+ */
+PKSAV_API void pksav_set_thread_instrumentation(
+    const pksav_instrumentation_t* instrumentation
+);
+
+/*!
+ * @brief Returns a short name for the given phase, such as "unshuffle".
+ *
+ * \returns "unknown" if phase is invalid
+ */
+PKSAV_API const char* pksav_phase_name(
+    pksav_phase_t phase
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PKSAV_COMMON_INSTRUMENTATION_H */
@@ -0,0 +1,139 @@
+/*!
+ * @file    pksav/common/lcrng.h
+ * @ingroup PKSav
+ * @brief   Functions for modeling the linear congruential PRNG used by the Game Boy Advance
+ *          and Nintendo DS games.
+ *
+ * Copyright (c) 2018 Nicholas Corgan (n.corgan@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+#ifndef PKSAV_COMMON_LCRNG_H
+#define PKSAV_COMMON_LCRNG_H
+
+#include <pksav/config.h>
+#include <pksav/error.h>
+
+#include <stdint.h>
+#include <stdlib.h>
+
+/*!
+ * @brief Methods the games use to generate a Pokémon's PID and IVs.
+ *
+ * Each method draws two numbers for the PID, low half first, and two for the
+ * IVs. The methods differ only in which draws are skipped.
+ */
+typedef enum {
+    //! @brief PID, PID, IVs, IVs
+    PKSAV_LCRNG32_METHOD_1 = 1,
+    //! @brief PID, PID, (skipped), IVs, IVs
+    PKSAV_LCRNG32_METHOD_2 = 2,
+    //! @brief PID, PID, IVs, (skipped), IVs
+    PKSAV_LCRNG32_METHOD_4 = 4
+} pksav_lcrng32_method_t;
+
+/*!
+ * @brief A generated PID and IV combination.
+ */
+typedef struct {
+    //! @brief The Pokémon's personality value.
+    uint32_t personality;
+    /*!
+     * @brief The Pokémon's IVs, in the format used by ::pksav_get_IV.
+     *
+     * This is in host byte order. Only the lower 30 bits are set, since the
+     * egg and ability flags that share this word in saves are not generated here.
+     */
+    uint32_t iv_data;
+} pksav_lcrng32_spread_t;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*!
+ * @brief Advance the LCRNG the given number of times.
+ *
+ * This takes O(log n) time rather than calling lcrng32_next n times.
+ *
+ * \param seed The starting seed
+ * \param num_steps How many times to advance
+ * \param seed_out Where to return the resulting seed
+ * \returns ::PKSAV_ERROR_NONE upon success
+ * \returns ::PKSAV_ERROR_NULL_POINTER if seed_out is NULL
+ */
+PKSAV_API pksav_error_t pksav_lcrng32_advance(
+    uint32_t seed,
+    uint64_t num_steps,
+    uint32_t* seed_out
+);
+
+/*!
+ * @brief Step the LCRNG backward the given number of times.
+ *
+ * This undoes ::pksav_lcrng32_advance with the same number of steps.
+ *
+ * \param seed The starting seed
+ * \param num_steps How many times to step backward
+ * \param seed_out Where to return the resulting seed
+ * \returns ::PKSAV_ERROR_NONE upon success
+ * \returns ::PKSAV_ERROR_NULL_POINTER if seed_out is NULL
+ */
+PKSAV_API pksav_error_t pksav_lcrng32_reverse(
+    uint32_t seed,
+    uint64_t num_steps,
+    uint32_t* seed_out
+);
+
+/*!
+ * @brief Generate the PID and IVs the games would for the given seed.
+ *
+ * \param seed The seed before the first draw
+ * \param method Which method to use
+ * \param spread_out Where to return the PID and IVs
+ * \returns ::PKSAV_ERROR_NONE upon success
+ * \returns ::PKSAV_ERROR_NULL_POINTER if spread_out is NULL
+ * \returns ::PKSAV_ERROR_PARAM_OUT_OF_RANGE if method is invalid
+ */
+PKSAV_API pksav_error_t pksav_lcrng32_generate(
+    uint32_t seed,
+    pksav_lcrng32_method_t method,
+    pksav_lcrng32_spread_t* spread_out
+);
+
+/*!
+ * @brief Find every seed that generates the given PID and IVs.
+ *
+ * Only the lower 30 bits of pksav_lcrng32_spread_t.iv_data are compared, so the
+ * IV word can be taken straight from a save. Seeds are returned in ascending order
+ * of the first draw, so the output doesn't depend on the number of threads.
+ *
+ * If more than max_seeds seeds are found, only the first max_seeds are stored,
+ * but num_seeds_out is set to the total.
+ *
+ * \param spread The PID and IVs to search for
+ * \param method Which method to assume
+ * \param num_threads How many threads to search with (0 and 1 both search on the
+ *                    calling thread)
+ * \param seeds_out Where to store the seeds
+ * \param max_seeds The number of seeds seeds_out can hold
+ * \param num_seeds_out Where to return the number of seeds found
+ * \returns ::PKSAV_ERROR_NONE upon success
+ * \returns ::PKSAV_ERROR_NULL_POINTER if any pointer parameter is NULL
+ * \returns ::PKSAV_ERROR_PARAM_OUT_OF_RANGE if method is invalid
+ */
+PKSAV_API pksav_error_t pksav_lcrng32_find_seeds(
+    const pksav_lcrng32_spread_t* spread,
+    pksav_lcrng32_method_t method,
+    size_t num_threads,
+    uint32_t* seeds_out,
+    size_t max_seeds,
+    size_t* num_seeds_out
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PKSAV_COMMON_LCRNG_H */
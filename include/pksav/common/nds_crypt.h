@@ -0,0 +1,104 @@
+/*!
+ * @file    pksav/common/nds_crypt.h
+ * @ingroup PKSav
+ * @brief   Encrypting and decrypting Pokémon in Nintendo DS games.
+ *
+ * In Generation IV-V saves, each Pokémon's four data blocks are shuffled
+ * based on its personality value and XORed with a keystream seeded by its
+ * checksum. Party data is XORed with a keystream seeded by the personality
+ * value. These functions work on arrays, such as an entire box, at once.
+ *
+ * Copyright (c) 2018 Nicholas Corgan (n.corgan@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+#ifndef PKSAV_COMMON_NDS_CRYPT_H
+#define PKSAV_COMMON_NDS_CRYPT_H
+
+#include <pksav/config.h>
+#include <pksav/error.h>
+
+#include <pksav/common/nds_pokemon.h>
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*!
+ * @brief Calculate the checksum of a decrypted Pokémon's data blocks.
+ *
+ * \param pc_pokemon The decrypted Pokémon
+ * \param checksum_out Where to return the checksum, in host byte order
+ * \returns ::PKSAV_ERROR_NONE upon success
+ * \returns ::PKSAV_ERROR_NULL_POINTER if either parameter is NULL
+ */
+PKSAV_API pksav_error_t pksav_nds_get_pokemon_checksum(
+    const pksav_nds_pc_pokemon_t* pc_pokemon,
+    uint16_t* checksum_out
+);
+
+/*!
+ * @brief Decrypt and unshuffle an array of Pokémon in place.
+ *
+ * \param pc_pokemon_arr The Pokémon to decrypt
+ * \param num_pokemon The number of Pokémon in the array
+ * \returns ::PKSAV_ERROR_NONE upon success
+ * \returns ::PKSAV_ERROR_NULL_POINTER if pc_pokemon_arr is NULL
+ */
+PKSAV_API pksav_error_t pksav_nds_decrypt_pc_pokemon(
+    pksav_nds_pc_pokemon_t* pc_pokemon_arr,
+    size_t num_pokemon
+);
+
+/*!
+ * @brief Shuffle and encrypt an array of Pokémon in place.
+ *
+ * Each Pokémon's checksum is recalculated first, as it seeds the encryption.
+ *
+ * \param pc_pokemon_arr The Pokémon to encrypt
+ * \param num_pokemon The number of Pokémon in the array
+ * \returns ::PKSAV_ERROR_NONE upon success
+ * \returns ::PKSAV_ERROR_NULL_POINTER if pc_pokemon_arr is NULL
+ */
+PKSAV_API pksav_error_t pksav_nds_encrypt_pc_pokemon(
+    pksav_nds_pc_pokemon_t* pc_pokemon_arr,
+    size_t num_pokemon
+);
+
+/*!
+ * @brief Decrypt an array of party Pokémon, including their party data, in place.
+ *
+ * \param party_pokemon_arr The Pokémon to decrypt
+ * \param num_pokemon The number of Pokémon in the array
+ * \returns ::PKSAV_ERROR_NONE upon success
+ * \returns ::PKSAV_ERROR_NULL_POINTER if party_pokemon_arr is NULL
+ */
+PKSAV_API pksav_error_t pksav_nds_decrypt_party_pokemon(
+    pksav_nds_party_pokemon_t* party_pokemon_arr,
+    size_t num_pokemon
+);
+
+/*!
+ * @brief Encrypt an array of party Pokémon, including their party data, in place.
+ *
+ * Each Pokémon's checksum is recalculated first, as it seeds the encryption.
+ *
+ * \param party_pokemon_arr The Pokémon to encrypt
+ * \param num_pokemon The number of Pokémon in the array
+ * \returns ::PKSAV_ERROR_NONE upon success
+ * \returns ::PKSAV_ERROR_NULL_POINTER if party_pokemon_arr is NULL
+ */
+PKSAV_API pksav_error_t pksav_nds_encrypt_party_pokemon(
+    pksav_nds_party_pokemon_t* party_pokemon_arr,
+    size_t num_pokemon
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PKSAV_COMMON_NDS_CRYPT_H */
@@ -17,13 +17,13 @@
 
 #pragma pack(push,1)
 
-#define PKSAV_NDS_ISEGG_MASK            uint32_t(1 << 30)
-#define PKSAV_NDS_ISNICKNAMED_MASK      uint32_t(1 << 31)
-#define PKSAV_NDS_FATEFULENCOUNTER_MASK uint8_t(1 << 0)
-#define PKSAV_NDS_FEMALE_MASK           uint8_t(1 << 1)
-#define PKSAV_NDS_GENDERLESS_MASK       uint8_t(1 << 2)
-#define PKSAV_NDS_LEVELMET_MASK         uint8_t(0x7F)
-#define PKSAV_NDS_OTGENDER_MASK         uint8_t(0x80)
+#define PKSAV_NDS_ISEGG_MASK            (uint32_t)(1 << 30)
+#define PKSAV_NDS_ISNICKNAMED_MASK      ((uint32_t)1 << 31)
+#define PKSAV_NDS_FATEFULENCOUNTER_MASK (uint8_t)(1 << 0)
+#define PKSAV_NDS_FEMALE_MASK           (uint8_t)(1 << 1)
+#define PKSAV_NDS_GENDERLESS_MASK       (uint8_t)(1 << 2)
+#define PKSAV_NDS_LEVELMET_MASK         (uint8_t)(0x7F)
+#define PKSAV_NDS_OTGENDER_MASK         (uint8_t)(0x80)
 #define PKSAV_NDS_OTGENDER_OFFSET       7
 
 typedef struct {
@@ -104,9 +104,9 @@ typedef union {
     };
 } pksav_nds_pokemon_blocks_t;
 
-#define PKSAV_NDS_PARTY_DATA_DECRYPTED_MASK uint32_t(1 << 31)
-#define PKSAV_NDS_PC_DATA_DECRYPTED_MASK    uint32_t(1 << 30)
-#define PKSAV_NDS_IS_EGG_MASK               uint32_t(1 << 29)
+#define PKSAV_NDS_PARTY_DATA_DECRYPTED_MASK ((uint32_t)1 << 31)
+#define PKSAV_NDS_PC_DATA_DECRYPTED_MASK    (uint32_t)(1 << 30)
+#define PKSAV_NDS_IS_EGG_MASK               (uint32_t)(1 << 29)
 
 typedef struct {
     uint32_t personality;
@@ -52,6 +52,125 @@ PKSAV_API pksav_error_t pksav_set_pokedex_bit(
     bool set
 );
 
+/*!
+ * @brief Count how many Pokémon have been seen/caught.
+ *
+ * The count covers National Pokédex numbers 1 through num_species. Any bits in
+ * the buffer past num_species are ignored.
+ *
+ * \param raw Pokédex buffer
+ * \param num_species The number of Pokémon represented in the buffer
+ * \param count_out where the count is returned
+ * \returns ::PKSAV_ERROR_NONE upon success
+ * \returns ::PKSAV_ERROR_NULL_POINTER if raw or count_out is NULL
+ */
+PKSAV_API pksav_error_t pksav_count_pokedex_bits(
+    const uint8_t* raw,
+    uint16_t num_species,
+    uint16_t* count_out
+);
+
+/*!
+ * @brief Set whether or not every Pokémon in a range has been seen/caught.
+ *
+ * \param raw Pokédex buffer
+ * \param first_pokedex_num The first Pokémon in the range
+ * \param last_pokedex_num The last Pokémon in the range (inclusive)
+ * \param set Set whether or not the Pokémon have been seen/caught
+ * \returns ::PKSAV_ERROR_NONE upon success
+ * \returns ::PKSAV_ERROR_NULL_POINTER if raw is NULL
+ * \returns ::PKSAV_ERROR_PARAM_OUT_OF_RANGE if first_pokedex_num is 0 or the
+ *          range is empty
+ */
+PKSAV_API pksav_error_t pksav_set_pokedex_bit_range(
+    uint8_t* raw,
+    uint16_t first_pokedex_num,
+    uint16_t last_pokedex_num,
+    bool set
+);
+
+/*!
+ * @brief Find the next Pokémon that has been seen/caught.
+ *
+ * This allows iterating over every set bit without checking each Pokémon in
+ * turn. Pass 0 as pokedex_num to find the first set bit, then pass each result
+ * back in to find the next one.
+ *
+ * \param raw Pokédex buffer
+ * \param num_species The number of Pokémon represented in the buffer
+ * \param pokedex_num Where to start searching (exclusive)
+ * \param next_pokedex_num_out where the next set Pokédex number is returned,
+ *                             or 0 if there are none left
+ * \returns ::PKSAV_ERROR_NONE upon success
+ * \returns ::PKSAV_ERROR_NULL_POINTER if raw or next_pokedex_num_out is NULL
+ */
+PKSAV_API pksav_error_t pksav_get_next_pokedex_bit(
+    const uint8_t* raw,
+    uint16_t num_species,
+    uint16_t pokedex_num,
+    uint16_t* next_pokedex_num_out
+);
+
+/*!
+ * @brief Combine two Pokédex buffers, marking any Pokémon set in either.
+ *
+ * The output buffer may be the same as either input buffer. Bits in the output
+ * buffer past num_species are left untouched.
+ *
+ * \param raw1 First Pokédex buffer
+ * \param raw2 Second Pokédex buffer
+ * \param num_species The number of Pokémon represented in the buffers
+ * \param output_buffer where the result is placed
+ * \returns ::PKSAV_ERROR_NONE upon success
+ * \returns ::PKSAV_ERROR_NULL_POINTER if any buffer is NULL
+ */
+PKSAV_API pksav_error_t pksav_union_pokedex_bits(
+    const uint8_t* raw1,
+    const uint8_t* raw2,
+    uint16_t num_species,
+    uint8_t* output_buffer
+);
+
+/*!
+ * @brief Combine two Pokédex buffers, marking only Pokémon set in both.
+ *
+ * The output buffer may be the same as either input buffer. Bits in the output
+ * buffer past num_species are left untouched.
+ *
+ * \param raw1 First Pokédex buffer
+ * \param raw2 Second Pokédex buffer
+ * \param num_species The number of Pokémon represented in the buffers
+ * \param output_buffer where the result is placed
+ * \returns ::PKSAV_ERROR_NONE upon success
+ * \returns ::PKSAV_ERROR_NULL_POINTER if any buffer is NULL
+ */
+PKSAV_API pksav_error_t pksav_intersect_pokedex_bits(
+    const uint8_t* raw1,
+    const uint8_t* raw2,
+    uint16_t num_species,
+    uint8_t* output_buffer
+);
+
+/*!
+ * @brief Combine two Pokédex buffers, marking Pokémon set in the first but not the second.
+ *
+ * The output buffer may be the same as either input buffer. Bits in the output
+ * buffer past num_species are left untouched.
+ *
+ * \param raw1 First Pokédex buffer
+ * \param raw2 Second Pokédex buffer
+ * \param num_species The number of Pokémon represented in the buffers
+ * \param output_buffer where the result is placed
+ * \returns ::PKSAV_ERROR_NONE upon success
+ * \returns ::PKSAV_ERROR_NULL_POINTER if any buffer is NULL
+ */
+PKSAV_API pksav_error_t pksav_subtract_pokedex_bits(
+    const uint8_t* raw1,
+    const uint8_t* raw2,
+    uint16_t num_species,
+    uint8_t* output_buffer
+);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,77 @@
+/*!
+ * @file    pksav/common/pokemon_record.h
+ * @ingroup PKSav
+ * @brief   A generation-independent view of a Pokémon.
+ *
+ * Copyright (c) 2018 Nicholas Corgan (n.corgan@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+#ifndef PKSAV_COMMON_POKEMON_RECORD_H
+#define PKSAV_COMMON_POKEMON_RECORD_H
+
+#include <stdint.h>
+
+//! The size of each name in ::pksav_pokemon_record_t, including the null terminator.
+#define PKSAV_POKEMON_RECORD_NAME_SIZE 32
+
+//! The value of pksav_pokemon_record_t.nature for Pokémon from before natures existed.
+#define PKSAV_POKEMON_RECORD_NO_NATURE 0xFF
+
+//! Set in pksav_pokemon_record_t.flags if the Pokémon is in an egg.
+#define PKSAV_POKEMON_RECORD_IS_EGG_MASK     ((uint8_t)(1 << 0))
+//! Set in pksav_pokemon_record_t.flags if the Pokémon is shiny (Generation II+).
+#define PKSAV_POKEMON_RECORD_IS_SHINY_MASK   ((uint8_t)(1 << 1))
+//! Set in pksav_pokemon_record_t.flags if the Pokémon's original trainer is female.
+#define PKSAV_POKEMON_RECORD_OT_FEMALE_MASK  ((uint8_t)(1 << 2))
+
+/*!
+ * @brief A Pokémon from any generation, in host byte order.
+ *
+ * The numeric fields come first and fit in a single 64-byte cache line, so
+ * code that scans many records without looking at names only touches that.
+ *
+ * Fields that don't exist in a given generation are 0, except for nature.
+ * Stats are in the order HP, Attack, Defense, Speed, Special Attack, Special
+ * Defense. For Generation I-II, the Special IV and EV are stored as both
+ * Special Attack and Special Defense.
+ */
+typedef struct {
+    //! @brief Personality value (Generation III+).
+    uint32_t personality;
+    //! @brief Total experience points.
+    uint32_t exp;
+    //! @brief National Pokédex number, or 0 if the species index is invalid.
+    uint16_t pokedex_num;
+    //! @brief Held item index, in the generation's own item list.
+    uint16_t held_item;
+    //! @brief Move indices.
+    uint16_t moves[4];
+    //! @brief Original trainer's public ID.
+    uint16_t ot_public_id;
+    //! @brief Original trainer's secret ID (Generation III+).
+    uint16_t ot_secret_id;
+    //! @brief EVs.
+    uint16_t EVs[6];
+    //! @brief IVs.
+    uint8_t IVs[6];
+    //! @brief Level, or 0 if the source doesn't store it (Generation III+ PC data).
+    uint8_t level;
+    //! @brief Friendship (Generation II+).
+    uint8_t friendship;
+    //! @brief Pokérus strain and duration (Generation II+).
+    uint8_t pokerus;
+    //! @brief Which generation the Pokémon came from (1-5).
+    uint8_t generation;
+    //! @brief A ::pksav_nature_t value, or ::PKSAV_POKEMON_RECORD_NO_NATURE.
+    uint8_t nature;
+    //! @brief A combination of the PKSAV_POKEMON_RECORD_*_MASK values.
+    uint8_t flags;
+    //! @brief Nickname, in UTF-8.
+    char nickname[PKSAV_POKEMON_RECORD_NAME_SIZE];
+    //! @brief Original trainer's name, in UTF-8.
+    char otname[PKSAV_POKEMON_RECORD_NAME_SIZE];
+} pksav_pokemon_record_t;
+
+#endif /* PKSAV_COMMON_POKEMON_RECORD_H */
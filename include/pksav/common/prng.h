@@ -35,14 +35,46 @@ static PKSAV_INLINE uint64_t lcrng64_next(
     return (0x5D588B656C078965UL * seed) + 0x269EC3;
 }
 
+//! The number of 32-bit words in the state of a Mersenne Twister (MT19937).
+#define PKSAV_MTRNG_STATE_SIZE 624
+
+/*!
+ * @brief The state of a Mersenne Twister (MT19937).
+ *
+ * Set up a state with ::pksav_mtrng_seed or ::pksav_mtrng_populate before
+ * using it. A state must not be used by multiple threads at once. Use
+ * ::pksav_mtrng_split to give each thread its own stream.
+ */
 typedef struct {
-    uint32_t nums[624];
+    //! @brief The last 624 words of the generator's state.
+    uint32_t nums[PKSAV_MTRNG_STATE_SIZE];
+    //! @brief The position of the oldest word in pksav_mtrng_t.nums.
     size_t index;
 } pksav_mtrng_t;
 
+/*!
+ * @brief Seed an MTRNG struct with the given value.
+ *
+ * This matches the reference MT19937 implementation's init_genrand(), so the
+ * same seed always produces the same sequence.
+ *
+ * \param mtrng MTRNG struct to seed
+ * \param seed The seed
+ * \returns PKSAV_ERROR_NONE upon success
+ * \returns PKSAV_ERROR_NULL_POINTER if mtrng is NULL
+ */
+PKSAV_API pksav_error_t pksav_mtrng_seed(
+    pksav_mtrng_t* mtrng,
+    uint32_t seed
+);
+
 /*!
  * @brief Populate an MTRNG struct's random numbers.
  *
+ * The state is seeded from the current time, the struct's address, and a
+ * process-wide counter, so states populated at the same time on different
+ * threads produce different sequences.
+ *
  * \param mtrng MTRNG struct to populate
  * \returns PKSAV_ERROR_NONE upon success
  * \returns PKSAV_ERROR_NULL_POINTER
@@ -51,11 +83,75 @@ PKSAV_API pksav_error_t pksav_mtrng_populate(
     pksav_mtrng_t* mtrng
 );
 
+/*!
+ * @brief Get the next number from an MTRNG struct.
+ *
+ * \param mtrng MTRNG struct to use
+ * \param next_out Where to return the number
+ * \returns PKSAV_ERROR_NONE upon success
+ * \returns PKSAV_ERROR_NULL_POINTER if either parameter is NULL
+ */
 PKSAV_API pksav_error_t pksav_mtrng_next(
     pksav_mtrng_t* mtrng,
     uint32_t* next_out
 );
 
+/*!
+ * @brief Fill a buffer with numbers from an MTRNG struct.
+ *
+ * This produces the same numbers as calling ::pksav_mtrng_next num_outputs
+ * times, but regenerates the state a whole block at a time where possible.
+ *
+ * \param mtrng MTRNG struct to use
+ * \param output_buffer Where to write the numbers
+ * \param num_outputs How many numbers to write
+ * \returns PKSAV_ERROR_NONE upon success
+ * \returns PKSAV_ERROR_NULL_POINTER if either pointer parameter is NULL
+ */
+PKSAV_API pksav_error_t pksav_mtrng_fill(
+    pksav_mtrng_t* mtrng,
+    uint32_t* output_buffer,
+    size_t num_outputs
+);
+
+/*!
+ * @brief Advance an MTRNG struct as if ::pksav_mtrng_next were called the given
+ *        number of times.
+ *
+ * Large jumps take O(log n) polynomial operations rather than O(n) steps. The
+ * first large jump in a process also derives the generator's characteristic
+ * polynomial, which takes a few milliseconds.
+ *
+ * \param mtrng MTRNG struct to advance
+ * \param num_steps How many numbers to skip
+ * \returns PKSAV_ERROR_NONE upon success
+ * \returns PKSAV_ERROR_NULL_POINTER if mtrng is NULL
+ */
+PKSAV_API pksav_error_t pksav_mtrng_jump(
+    pksav_mtrng_t* mtrng,
+    uint64_t num_steps
+);
+
+/*!
+ * @brief Create an independent stream from a base MTRNG struct.
+ *
+ * The output state is the base state advanced by stream_index * 2^48 steps,
+ * so streams with different indices will not overlap unless more than 2^48
+ * numbers are drawn from one of them. The base state is not modified, so one
+ * seeded state can be split into one stream per thread.
+ *
+ * \param base_mtrng MTRNG struct to split from
+ * \param stream_index Which stream to create
+ * \param mtrng_out Where to store the new stream
+ * \returns PKSAV_ERROR_NONE upon success
+ * \returns PKSAV_ERROR_NULL_POINTER if either pointer parameter is NULL
+ */
+PKSAV_API pksav_error_t pksav_mtrng_split(
+    const pksav_mtrng_t* base_mtrng,
+    uint64_t stream_index,
+    pksav_mtrng_t* mtrng_out
+);
+
 #ifdef __cplusplus
 }
 #endif
@@ -11,6 +11,7 @@
 #include <pksav/error.h>
 
 #include <stdint.h>
+#include <stdlib.h>
 
 typedef enum {
     PKSAV_STAT_NONE = 0,
@@ -23,6 +24,47 @@ typedef enum {
     PKSAV_STAT_SPECIAL = 9
 } pksav_battle_stat_t;
 
+/*!
+ * @brief Output columns for bulk stat extraction.
+ *
+ * Each non-NULL column must have room for one value per Pokémon, and NULL
+ * columns are skipped. For Generation I-II, the Special stat is written to
+ * both the spatk and spdef columns.
+ */
+typedef struct {
+    //! @brief HP values.
+    uint8_t* hp;
+    //! @brief Attack values.
+    uint8_t* attack;
+    //! @brief Defense values.
+    uint8_t* defense;
+    //! @brief Speed values.
+    uint8_t* speed;
+    //! @brief Special Attack (or Special) values.
+    uint8_t* spatk;
+    //! @brief Special Defense (or Special) values.
+    uint8_t* spdef;
+} pksav_stat_columns_t;
+
+/*!
+ * @brief Output columns for bulk Generation I-II EV extraction.
+ *
+ * Each non-NULL column must have room for one value per Pokémon, and NULL
+ * columns are skipped.
+ */
+typedef struct {
+    //! @brief HP EVs.
+    uint16_t* hp;
+    //! @brief Attack EVs.
+    uint16_t* attack;
+    //! @brief Defense EVs.
+    uint16_t* defense;
+    //! @brief Speed EVs.
+    uint16_t* speed;
+    //! @brief Special EVs.
+    uint16_t* special;
+} pksav_gb_EV_columns_t;
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -51,6 +93,90 @@ PKSAV_API pksav_error_t pksav_set_IV(
     uint8_t new_IV
 );
 
+/*!
+ * @brief Unpack the IVs of many Generation I-II Pokémon at once.
+ *
+ * The IV data is read the same way as ::pksav_get_gb_IV, and each Pokémon's
+ * IV data is expected to be stride bytes after the previous one's, so this
+ * can be pointed at the iv_data field of the first element of an array of
+ * Pokémon structs.
+ *
+ * \param first_iv_data The first Pokémon's IV data
+ * \param stride The number of bytes between each Pokémon's IV data
+ * \param num_pokemon How many Pokémon to read
+ * \param IVs_out Where to write the IVs
+ * \returns ::PKSAV_ERROR_NONE upon success
+ * \returns ::PKSAV_ERROR_NULL_POINTER if first_iv_data or IVs_out is NULL
+ */
+PKSAV_API pksav_error_t pksav_get_gb_IVs_bulk(
+    const void* first_iv_data,
+    size_t stride,
+    size_t num_pokemon,
+    const pksav_stat_columns_t* IVs_out
+);
+
+/*!
+ * @brief Unpack the IVs of many Generation III+ Pokémon at once.
+ *
+ * The IV data is read the same way as ::pksav_get_IV, and each Pokémon's
+ * IV data is expected to be stride bytes after the previous one's.
+ *
+ * \param first_iv_data The first Pokémon's IV data
+ * \param stride The number of bytes between each Pokémon's IV data
+ * \param num_pokemon How many Pokémon to read
+ * \param IVs_out Where to write the IVs
+ * \returns ::PKSAV_ERROR_NONE upon success
+ * \returns ::PKSAV_ERROR_NULL_POINTER if first_iv_data or IVs_out is NULL
+ */
+PKSAV_API pksav_error_t pksav_get_IVs_bulk(
+    const void* first_iv_data,
+    size_t stride,
+    size_t num_pokemon,
+    const pksav_stat_columns_t* IVs_out
+);
+
+/*!
+ * @brief Read the EVs of many Generation I-II Pokémon at once.
+ *
+ * Each Pokémon's EVs are expected to be five consecutive big-endian values
+ * (HP, Attack, Defense, Speed, Special) starting at the given offset, and
+ * are returned in host byte order.
+ *
+ * \param first_ev_hp The first Pokémon's HP EV
+ * \param stride The number of bytes between each Pokémon's EVs
+ * \param num_pokemon How many Pokémon to read
+ * \param EVs_out Where to write the EVs
+ * \returns ::PKSAV_ERROR_NONE upon success
+ * \returns ::PKSAV_ERROR_NULL_POINTER if first_ev_hp or EVs_out is NULL
+ */
+PKSAV_API pksav_error_t pksav_get_gb_EVs_bulk(
+    const void* first_ev_hp,
+    size_t stride,
+    size_t num_pokemon,
+    const pksav_gb_EV_columns_t* EVs_out
+);
+
+/*!
+ * @brief Read the EVs of many Generation III+ Pokémon at once.
+ *
+ * Each Pokémon's EVs are expected to be six consecutive bytes (HP, Attack,
+ * Defense, Speed, Special Attack, Special Defense) starting at the given
+ * offset.
+ *
+ * \param first_ev_hp The first Pokémon's HP EV
+ * \param stride The number of bytes between each Pokémon's EVs
+ * \param num_pokemon How many Pokémon to read
+ * \param EVs_out Where to write the EVs
+ * \returns ::PKSAV_ERROR_NONE upon success
+ * \returns ::PKSAV_ERROR_NULL_POINTER if first_ev_hp or EVs_out is NULL
+ */
+PKSAV_API pksav_error_t pksav_get_EVs_bulk(
+    const void* first_ev_hp,
+    size_t stride,
+    size_t num_pokemon,
+    const pksav_stat_columns_t* EVs_out
+);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,99 @@
+/*!
+ * @file    pksav/corpus.h
+ * @ingroup PKSav
+ * @brief   Generating synthetic saves for benchmarking and testing.
+ *
+ * Copyright (c) 2018 Nicholas Corgan (n.corgan@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+#ifndef PKSAV_CORPUS_H
+#define PKSAV_CORPUS_H
+
+#include <pksav/config.h>
+#include <pksav/error.h>
+
+#include <stdint.h>
+#include <stdlib.h>
+
+//! The largest save ::pksav_corpus_generate_save can write.
+#define PKSAV_CORPUS_MAX_SAVE_SIZE 0x20000
+
+//! Which game to generate a save for.
+typedef enum {
+    //! Red/Blue (::pksav_gen1_save_t).
+    PKSAV_CORPUS_RED_BLUE = 0,
+    //! Yellow (::pksav_gen1_save_t).
+    PKSAV_CORPUS_YELLOW,
+    //! Gold/Silver (::pksav_gen2_save_t).
+    PKSAV_CORPUS_GOLD_SILVER,
+    //! Crystal (::pksav_gen2_save_t).
+    PKSAV_CORPUS_CRYSTAL,
+    //! Ruby/Sapphire (::pksav_gba_save_t).
+    PKSAV_CORPUS_RUBY_SAPPHIRE,
+    //! Emerald (::pksav_gba_save_t).
+    PKSAV_CORPUS_EMERALD,
+    //! FireRed/LeafGreen (::pksav_gba_save_t).
+    PKSAV_CORPUS_FIRERED_LEAFGREEN
+} pksav_corpus_game_t;
+
+//! The number of values in ::pksav_corpus_game_t.
+#define PKSAV_CORPUS_NUM_GAMES 7
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*!
+ * @brief Get the size of the saves generated for the given game.
+ *
+ * \param game The game
+ * \param save_size_out Where to return the size
+ * \returns ::PKSAV_ERROR_NONE upon success
+ * \returns ::PKSAV_ERROR_NULL_POINTER if save_size_out is NULL
+ * \returns ::PKSAV_ERROR_PARAM_OUT_OF_RANGE if game is invalid
+ */
+PKSAV_API pksav_error_t pksav_corpus_get_save_size(
+    pksav_corpus_game_t game,
+    size_t* save_size_out
+);
+
+/*!
+ * @brief Generate a valid save with randomized, but plausible, contents.
+ *
+ * The save has a trainer, rival, money, and play time, a party, and a
+ * partially filled PC, along with matching Pokédex entries. Each Pokémon has
+ * a real species, a level, moves, IVs, and EVs, stats calculated from them,
+ * a nickname, and an original trainer that's usually the player. Names are
+ * drawn from a list of common ones.
+ *
+ * Every checksum is valid, and Game Boy Advance saves have both slots
+ * filled, with their sections rotated and their Pokémon encrypted, as
+ * written by the game, so the result loads with the normal load functions.
+ *
+ * The contents depend only on the game and the seed, so the same seed always
+ * produces the same bytes, on any platform.
+ *
+ * \param game The game to generate a save for
+ * \param seed The seed for the save's contents
+ * \param buffer Where to write the save
+ * \param buffer_len The size of the buffer (see ::pksav_corpus_get_save_size)
+ * \param save_size_out Where to return how many bytes were written (optional)
+ * \returns ::PKSAV_ERROR_NONE upon success
+ * \returns ::PKSAV_ERROR_NULL_POINTER if buffer is NULL
+ * \returns ::PKSAV_ERROR_PARAM_OUT_OF_RANGE if game is invalid or the buffer is too small
+ */
+PKSAV_API pksav_error_t pksav_corpus_generate_save(
+    pksav_corpus_game_t game,
+    uint32_t seed,
+    uint8_t* buffer,
+    size_t buffer_len,
+    size_t* save_size_out
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PKSAV_CORPUS_H */
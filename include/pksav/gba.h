@@ -15,9 +15,13 @@
 #include <pksav/error.h>
 
 #include <pksav/gba/items.h>
+#include <pksav/gba/patch.h>
+#include <pksav/gba/pokedex.h>
 #include <pksav/gba/pokemon.h>
+#include <pksav/gba/pokemon_record.h>
 #include <pksav/gba/save.h>
 #include <pksav/gba/save_structs.h>
+#include <pksav/gba/stats.h>
 #include <pksav/gba/text.h>
 
 #include <pksav/common/condition.h>
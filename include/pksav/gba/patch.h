@@ -0,0 +1,102 @@
+/*!
+ * @file    pksav/gba/patch.h
+ * @ingroup PKSav
+ * @brief   Functions for storing the differences between Game Boy Advance saves as patches.
+ *
+ * Copyright (c) 2018 Nicholas Corgan (n.corgan@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+#ifndef PKSAV_GBA_PATCH_H
+#define PKSAV_GBA_PATCH_H
+
+#include <pksav/config.h>
+#include <pksav/error.h>
+
+#include <pksav/gba/save.h>
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*!
+ * @brief Returns how big the patch from one save to another will be.
+ *
+ * \param old_save The save the patch will be applied to
+ * \param new_save The save the patch will turn old_save into
+ * \param patch_size_out Where to return the size, in bytes
+ * \returns ::PKSAV_ERROR_NONE upon success
+ * \returns ::PKSAV_ERROR_NULL_POINTER if any parameter is NULL
+ * \returns ::PKSAV_ERROR_INVALID_SAVE if the saves are from different games
+ */
+PKSAV_API pksav_error_t pksav_gba_save_get_patch_size(
+    const pksav_gba_save_t* old_save,
+    const pksav_gba_save_t* new_save,
+    size_t* patch_size_out
+);
+
+/*!
+ * @brief Write the differences between two saves of the same game as a patch.
+ *
+ * The saves are compared section by section for sections 0-4, and box by box
+ * for the PC, and only the changed bytes within each are stored. The decrypted
+ * contents are compared, so re-encrypting a save on its own doesn't make it
+ * differ, and section footers aren't compared at all. Compact and full saves
+ * can be compared with each other.
+ *
+ * The patch holds a checksum of each changed section or box as it was in
+ * old_save, so ::pksav_gba_save_apply_patch can check it's being applied to
+ * the same data.
+ *
+ * \param old_save The save the patch will be applied to
+ * \param new_save The save the patch will turn old_save into
+ * \param buffer Where to write the patch
+ * \param buffer_len The size of buffer, which must be at least the size given by
+ *                   ::pksav_gba_save_get_patch_size
+ * \param patch_size_out Where to return how many bytes were written
+ * \returns ::PKSAV_ERROR_NONE upon success
+ * \returns ::PKSAV_ERROR_NULL_POINTER if any pointer parameter is NULL
+ * \returns ::PKSAV_ERROR_INVALID_SAVE if the saves are from different games
+ * \returns ::PKSAV_ERROR_PARAM_OUT_OF_RANGE if buffer is too small
+ */
+PKSAV_API pksav_error_t pksav_gba_save_make_patch(
+    const pksav_gba_save_t* old_save,
+    const pksav_gba_save_t* new_save,
+    uint8_t* buffer,
+    size_t buffer_len,
+    size_t* patch_size_out
+);
+
+/*!
+ * @brief Apply a patch from ::pksav_gba_save_make_patch to a loaded save.
+ *
+ * Only the decrypted contents are changed, and each changed section is marked
+ * as dirty (see ::pksav_gba_save_get_dirty_sections). Checksums and encryption
+ * are rebuilt when the save is next saved.
+ *
+ * Nothing is changed unless the whole patch applies cleanly.
+ *
+ * \param gba_save The save to patch
+ * \param patch The patch
+ * \param patch_len The size of the patch
+ * \returns ::PKSAV_ERROR_NONE upon success
+ * \returns ::PKSAV_ERROR_NULL_POINTER if gba_save or patch is NULL
+ * \returns ::PKSAV_ERROR_PARAM_OUT_OF_RANGE if the patch is malformed
+ * \returns ::PKSAV_ERROR_INVALID_SAVE if the patch is for another game, or any
+ *          section or box it changes doesn't match the one it was made from
+ */
+PKSAV_API pksav_error_t pksav_gba_save_apply_patch(
+    pksav_gba_save_t* gba_save,
+    const uint8_t* patch,
+    size_t patch_len
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PKSAV_GBA_PATCH_H */
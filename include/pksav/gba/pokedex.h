@@ -0,0 +1,172 @@
+/*!
+ * @file    pksav/gba/pokedex.h
+ * @ingroup PKSav
+ * @brief   Functions for keeping the mirrored Pokédex data in Game Boy Advance saves in sync.
+ *
+ * Copyright (c) 2018 Nicholas Corgan (n.corgan@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+#ifndef PKSAV_GBA_POKEDEX_H
+#define PKSAV_GBA_POKEDEX_H
+
+#include <pksav/config.h>
+#include <pksav/error.h>
+
+#include <pksav/gba/save.h>
+
+#include <stdbool.h>
+#include <stdint.h>
+
+//! The number of Pokémon represented in a Game Boy Advance Pokédex buffer.
+#define PKSAV_GBA_POKEDEX_NUM_SPECIES 386
+
+//! The number of bytes used by each Game Boy Advance Pokédex buffer.
+#define PKSAV_GBA_POKEDEX_BUFFER_SIZE ((PKSAV_GBA_POKEDEX_NUM_SPECIES + 7) / 8)
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*!
+ * @brief Set whether or not a Pokémon has been seen, updating all three mirrors.
+ *
+ * pksav_gba_save_t.pokedex_seenA is treated as the canonical copy. The bit is
+ * set there, and the containing byte is copied into pksav_gba_save_t.pokedex_seenB
+ * and pksav_gba_save_t.pokedex_seenC, so the three always agree afterward.
+ *
+ * \param gba_save The save to modify
+ * \param pokedex_num Which Pokémon to set or unset
+ * \param seen Whether or not the Pokémon has been seen
+ * \returns ::PKSAV_ERROR_NONE upon success
+ * \returns ::PKSAV_ERROR_NULL_POINTER if gba_save is NULL
+ * \returns ::PKSAV_ERROR_PARAM_OUT_OF_RANGE if pokedex_num is not between 1 and
+ *          ::PKSAV_GBA_POKEDEX_NUM_SPECIES
+ */
+PKSAV_API pksav_error_t pksav_gba_save_set_pokedex_seen(
+    pksav_gba_save_t* gba_save,
+    uint16_t pokedex_num,
+    bool seen
+);
+
+/*!
+ * @brief Set whether or not a range of Pokémon have been seen, updating all three mirrors.
+ *
+ * This behaves as ::pksav_gba_save_set_pokedex_seen for every Pokémon from
+ * first_pokedex_num to last_pokedex_num, inclusive, in a single pass.
+ *
+ * \param gba_save The save to modify
+ * \param first_pokedex_num The first Pokémon in the range
+ * \param last_pokedex_num The last Pokémon in the range (inclusive)
+ * \param seen Whether or not the Pokémon have been seen
+ * \returns ::PKSAV_ERROR_NONE upon success
+ * \returns ::PKSAV_ERROR_NULL_POINTER if gba_save is NULL
+ * \returns ::PKSAV_ERROR_PARAM_OUT_OF_RANGE if the range is empty or outside of
+ *          1 to ::PKSAV_GBA_POKEDEX_NUM_SPECIES
+ */
+PKSAV_API pksav_error_t pksav_gba_save_set_pokedex_seen_range(
+    pksav_gba_save_t* gba_save,
+    uint16_t first_pokedex_num,
+    uint16_t last_pokedex_num,
+    bool seen
+);
+
+/*!
+ * @brief Copy pksav_gba_save_t.pokedex_seenA into the other two mirrors.
+ *
+ * This can be used to repair a save whose mirrors disagree, or after modifying
+ * pksav_gba_save_t.pokedex_seenA directly.
+ *
+ * \param gba_save The save to modify
+ * \returns ::PKSAV_ERROR_NONE upon success
+ * \returns ::PKSAV_ERROR_NULL_POINTER if gba_save is NULL
+ */
+PKSAV_API pksav_error_t pksav_gba_save_sync_pokedex_seen(
+    pksav_gba_save_t* gba_save
+);
+
+/*!
+ * @brief Check whether the National Pokédex is unlocked.
+ *
+ * This checks the first of the three fields, which is treated as the canonical copy.
+ *
+ * \param gba_save The save to check
+ * \param unlocked_out Where to return whether the National Pokédex is unlocked
+ * \returns ::PKSAV_ERROR_NONE upon success
+ * \returns ::PKSAV_ERROR_NULL_POINTER if gba_save or unlocked_out is NULL
+ */
+PKSAV_API pksav_error_t pksav_gba_save_get_nat_pokedex_unlocked(
+    const pksav_gba_save_t* gba_save,
+    bool* unlocked_out
+);
+
+/*!
+ * @brief Lock or unlock the National Pokédex, updating all three fields.
+ *
+ * This applies the correct mask for the save's game to each of the three
+ * fields, so the masks in pksav/gba/save.h do not need to be used directly.
+ *
+ * \param gba_save The save to modify
+ * \param unlocked Whether the National Pokédex should be unlocked
+ * \returns ::PKSAV_ERROR_NONE upon success
+ * \returns ::PKSAV_ERROR_NULL_POINTER if gba_save is NULL
+ */
+PKSAV_API pksav_error_t pksav_gba_save_set_nat_pokedex_unlocked(
+    pksav_gba_save_t* gba_save,
+    bool unlocked
+);
+
+/*!
+ * @brief Check that all mirrored Pokédex data in the save agrees.
+ *
+ * This checks that the three seen lists are identical and that the three
+ * National Pokédex fields agree on whether it is unlocked. The same check is
+ * done by ::pksav_gba_save_load, which caches the result for
+ * ::pksav_gba_save_pokedex_mirrors_matched_on_load.
+ *
+ * \param gba_save The save to check
+ * \param mirrors_match_out Where to return whether all mirrors agree
+ * \returns ::PKSAV_ERROR_NONE upon success
+ * \returns ::PKSAV_ERROR_NULL_POINTER if gba_save or mirrors_match_out is NULL
+ */
+PKSAV_API pksav_error_t pksav_gba_save_check_pokedex_mirrors(
+    const pksav_gba_save_t* gba_save,
+    bool* mirrors_match_out
+);
+
+/*!
+ * @brief Returns whether all mirrored Pokédex data agreed when the save was loaded.
+ *
+ * \param gba_save The save to check
+ * \param mirrors_matched_out Where to return the result
+ * \returns ::PKSAV_ERROR_NONE upon success
+ * \returns ::PKSAV_ERROR_NULL_POINTER if gba_save or mirrors_matched_out is NULL
+ */
+PKSAV_API pksav_error_t pksav_gba_save_pokedex_mirrors_matched_on_load(
+    const pksav_gba_save_t* gba_save,
+    bool* mirrors_matched_out
+);
+
+/*!
+ * @brief Returns which sections have been modified through this API since the
+ *        save was loaded or last saved.
+ *
+ * Bit N of the result is set if section N was modified. Changes made directly
+ * through the pointers in ::pksav_gba_save_t are not tracked.
+ *
+ * \param gba_save The save to check
+ * \param dirty_sections_out Where to return the bitmask
+ * \returns ::PKSAV_ERROR_NONE upon success
+ * \returns ::PKSAV_ERROR_NULL_POINTER if gba_save or dirty_sections_out is NULL
+ */
+PKSAV_API pksav_error_t pksav_gba_save_get_dirty_sections(
+    const pksav_gba_save_t* gba_save,
+    uint16_t* dirty_sections_out
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PKSAV_GBA_POKEDEX_H */
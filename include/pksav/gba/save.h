@@ -103,7 +103,14 @@ static const uint16_t pksav_gba_section_sizes[14] = {
  *
  * The pointers in this structure should not be used before passing it
  * into ::pksav_gba_save_load and should not be used after passing it
- * into ::pksav_gba_save_save. Doing so will result in undefined behavior.
+ * into ::pksav_gba_save_free. Doing so will result in undefined behavior.
+ *
+ * Saving with ::pksav_gba_save_save or ::pksav_gba_save_save_buffer encrypts
+ * a copy of the save and never changes the data these pointers point to, or
+ * the pointers themselves. While one thread saves, any number of other
+ * threads can read that data without locking. Anything that changes the
+ * save, including editing it, cloning or restoring it, saving it from
+ * another thread, and freeing it, needs the save to itself.
  */
 typedef struct {
     //! Information on the player character.
@@ -152,6 +159,7 @@ typedef struct {
      *
      * Any action taken on this list should also be taken on
      * pksav_gba_save_t.pokedex_seenB and pksav_gba_save_t.pokedex_seenC.
+     * ::pksav_gba_save_set_pokedex_seen does this automatically.
      */
     uint8_t* pokedex_seenA;
 
@@ -238,11 +246,52 @@ typedef struct {
     uint8_t shuffled_section_nums[14];
     bool small_save;
     bool from_first_slot;
+    bool pokedex_mirrors_matched;
+    bool compact;
+    uint16_t dirty_sections;
     pksav_gba_save_slot_t* unshuffled;
     uint8_t* raw;
+    volatile uint32_t* raw_refs;
 #endif
 } pksav_gba_save_t;
 
+/*!
+ * @brief The health of one save slot, as checked by ::pksav_gba_save_verify_buffer.
+ *
+ * Each mask has a bit for each of the 14 section IDs, with bit n for section n,
+ * so a healthy slot has 0x3FFF in each.
+ */
+typedef struct {
+    //! Whether every section passed every check, so the slot can be loaded.
+    bool valid;
+    //! The slot's save counter, which the game uses to pick the most recent slot.
+    uint32_t save_index;
+    //! Which section IDs appear exactly once in the slot.
+    uint16_t sections_present;
+    //! Which sections' checksums match their data.
+    uint16_t checksums_valid;
+    //! Which sections have the validation number the games write in each footer.
+    uint16_t validations_valid;
+    //! Which sections have the same save counter as the slot's first section.
+    uint16_t save_indices_match;
+} pksav_gba_slot_health_t;
+
+/*!
+ * @brief The health of both save slots, and which one a strict load uses.
+ */
+typedef struct {
+    //! How many slots the save has, which is 1 for 64 KB saves and 2 otherwise.
+    size_t num_slots;
+    //! The health of each slot, in the order they're stored in the save.
+    pksav_gba_slot_health_t slots[2];
+    //! Whether any slot is valid. If not, a strict load fails.
+    bool has_valid_slot;
+    //! Which slot a strict load uses, if has_valid_slot is set.
+    size_t load_slot;
+    //! Whether the most recent slot is invalid, so the older one is used instead.
+    bool is_fallback;
+} pksav_gba_save_health_t;
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -300,6 +349,136 @@ PKSAV_API pksav_error_t pksav_gba_save_load(
     pksav_gba_save_t* gba_save
 );
 
+/*!
+ * @brief Loads a save from memory, as ::pksav_gba_save_load does from a file.
+ *
+ * The buffer is copied, so it can be reused or freed as soon as this returns.
+ *
+ * \param buffer the save data
+ * \param buffer_len the length of the buffer
+ * \param gba_save pointer to save struct to populate
+ * \returns ::PKSAV_ERROR_NONE upon completion
+ * \returns ::PKSAV_ERROR_NULL_POINTER if buffer or gba_save is NULL
+ * \returns ::PKSAV_ERROR_INVALID_SAVE if the buffer is not a valid Game Boy Advance save
+ */
+PKSAV_API pksav_error_t pksav_gba_save_load_buffer(
+    const uint8_t* buffer,
+    size_t buffer_len,
+    pksav_gba_save_t* gba_save
+);
+
+/*!
+ * @brief Loads a save, keeping as little of it in memory as possible.
+ *
+ * The resulting save is used exactly as one from ::pksav_gba_save_load, but
+ * only the active slot is kept, and the PC is only held once, in
+ * pksav_gba_save_t.pokemon_pc, rather than also in its sections. This takes
+ * a loaded save from about 220 KB to about 54 KB.
+ *
+ * Since the inactive slot and anything after the slots aren't kept, saving
+ * writes the active slot over a copy of the save that's already there:
+ * ::pksav_gba_save_save reads the file it's about to overwrite, and
+ * ::pksav_gba_save_save_buffer writes into a buffer that must already hold
+ * the save. The padding and unused bytes in the PC sections are written as
+ * zeroes.
+ *
+ * \param filepath path of the file to load
+ * \param gba_save pointer to save struct to populate
+ * \returns ::PKSAV_ERROR_NONE upon completion
+ * \returns ::PKSAV_ERROR_NULL_POINTER if filepath or gba_save is NULL
+ * \returns ::PKSAV_ERROR_FILE_IO if an error occurs reading the file
+ * \returns ::PKSAV_ERROR_INVALID_SAVE if the file is not a valid Game Boy Advance save
+ */
+PKSAV_API pksav_error_t pksav_gba_save_load_compact(
+    const char* filepath,
+    pksav_gba_save_t* gba_save
+);
+
+/*!
+ * @brief Loads a save from memory, as ::pksav_gba_save_load_compact does from a file.
+ *
+ * Only the active slot is copied out of the buffer.
+ *
+ * \param buffer the save data
+ * \param buffer_len the length of the buffer
+ * \param gba_save pointer to save struct to populate
+ * \returns ::PKSAV_ERROR_NONE upon completion
+ * \returns ::PKSAV_ERROR_NULL_POINTER if buffer or gba_save is NULL
+ * \returns ::PKSAV_ERROR_INVALID_SAVE if the buffer is not a valid Game Boy Advance save
+ */
+PKSAV_API pksav_error_t pksav_gba_save_load_buffer_compact(
+    const uint8_t* buffer,
+    size_t buffer_len,
+    pksav_gba_save_t* gba_save
+);
+
+/*!
+ * @brief Checks both save slots of a save, without loading it.
+ *
+ * Each section's checksum, validation number, and save counter are checked
+ * against its footer, and each slot must have every section exactly once.
+ * This is the same check ::pksav_gba_save_load_strict makes. Only the footers
+ * and checksummed data are read, so this is much cheaper than a load.
+ *
+ * \param buffer the save data
+ * \param buffer_len the length of the buffer
+ * \param health_out where to return the health of each slot
+ * \returns ::PKSAV_ERROR_NONE upon completion, no matter the result
+ * \returns ::PKSAV_ERROR_NULL_POINTER if buffer or health_out is NULL
+ * \returns ::PKSAV_ERROR_INVALID_SAVE if the buffer is too small to be a Game Boy
+ *          Advance save
+ */
+PKSAV_API pksav_error_t pksav_gba_save_verify_buffer(
+    const uint8_t* buffer,
+    size_t buffer_len,
+    pksav_gba_save_health_t* health_out
+);
+
+/*!
+ * @brief Loads a save as ::pksav_gba_save_load does, but only from a save slot
+ *        that passes ::pksav_gba_save_verify_buffer.
+ *
+ * ::pksav_gba_save_load always loads the slot with the higher save counter, even
+ * if it was corrupted, such as by the game being turned off while saving. This
+ * loads the most recent valid slot instead, falling back to the older slot as the
+ * games do. Saving then writes over the slot that wasn't loaded.
+ *
+ * \param filepath path of the file to load
+ * \param gba_save pointer to save struct to populate
+ * \param health_out where to return the health of each slot, or NULL
+ * \returns ::PKSAV_ERROR_NONE upon completion
+ * \returns ::PKSAV_ERROR_NULL_POINTER if filepath or gba_save is NULL
+ * \returns ::PKSAV_ERROR_FILE_IO if an error occurs reading the file
+ * \returns ::PKSAV_ERROR_INVALID_SAVE if neither slot is valid, or the file is not a
+ *          valid Game Boy Advance save
+ */
+PKSAV_API pksav_error_t pksav_gba_save_load_strict(
+    const char* filepath,
+    pksav_gba_save_t* gba_save,
+    pksav_gba_save_health_t* health_out
+);
+
+/*!
+ * @brief Loads a save from memory, as ::pksav_gba_save_load_strict does from a file.
+ *
+ * The buffer is copied, so it can be reused or freed as soon as this returns.
+ *
+ * \param buffer the save data
+ * \param buffer_len the length of the buffer
+ * \param gba_save pointer to save struct to populate
+ * \param health_out where to return the health of each slot, or NULL
+ * \returns ::PKSAV_ERROR_NONE upon completion
+ * \returns ::PKSAV_ERROR_NULL_POINTER if buffer or gba_save is NULL
+ * \returns ::PKSAV_ERROR_INVALID_SAVE if neither slot is valid, or the buffer is not a
+ *          valid Game Boy Advance save
+ */
+PKSAV_API pksav_error_t pksav_gba_save_load_buffer_strict(
+    const uint8_t* buffer,
+    size_t buffer_len,
+    pksav_gba_save_t* gba_save,
+    pksav_gba_save_health_t* health_out
+);
+
 /*!
  * @brief Saves the given save file to the given path
  *
@@ -310,17 +489,88 @@ PKSAV_API pksav_error_t pksav_gba_save_load(
  * loaded, leaving the original save intact. Its save counter will be incremented, so
  * the game will load this save slot instead of the previous one.
  *
+ * The loaded data isn't changed, so other threads can keep reading it while this
+ * runs. The Pokémon checksums are only set in what's written.
+ *
  * \param filepath where to save the save file
  * \param gba_save pointer to the save struct to save
  * \returns ::PKSAV_ERROR_NONE upon completion
  * \returns ::PKSAV_ERROR_NULL_POINTER if filepath or gba_save is NULL
- * \returns ::PKSAV_ERROR_FILE_IO if an error occurs writing the file
+ * \returns ::PKSAV_ERROR_FILE_IO if an error occurs writing the file, or reading
+ *          it first for a save from ::pksav_gba_save_load_compact
+ * \returns ::PKSAV_ERROR_INVALID_SAVE if the save is from ::pksav_gba_save_load_compact
+ *          and the file being written over isn't already a save from the same game
  */
 PKSAV_API pksav_error_t pksav_gba_save_save(
     const char* filepath,
     pksav_gba_save_t* gba_save
 );
 
+/*!
+ * @brief Saves the given save into memory, as ::pksav_gba_save_save does to a file.
+ *
+ * As with ::pksav_gba_save_save, the save is written into the slot opposite the one
+ * it was loaded from, and that slot is used from then on. The loaded data isn't
+ * changed.
+ *
+ * \param buffer where the save should be written
+ * \param buffer_len the length of the buffer, which must be at least 128 KB, or 64 KB
+ *                   for saves with a single slot (pksav_gba_save_t.small_save)
+ * \param gba_save pointer to the save struct to save
+ * \returns ::PKSAV_ERROR_NONE upon completion
+ * \returns ::PKSAV_ERROR_NULL_POINTER if buffer or gba_save is NULL
+ * \returns ::PKSAV_ERROR_PARAM_OUT_OF_RANGE if the buffer is too small
+ * \returns ::PKSAV_ERROR_INVALID_SAVE if the save is from ::pksav_gba_save_load_compact
+ *          and the buffer doesn't already hold a save from the same game
+ */
+PKSAV_API pksav_error_t pksav_gba_save_save_buffer(
+    uint8_t* buffer,
+    size_t buffer_len,
+    pksav_gba_save_t* gba_save
+);
+
+/*!
+ * @brief Makes an independent copy of a loaded save, without reloading it.
+ *
+ * The decrypted data is copied as-is, so the clone can be edited and saved
+ * without affecting the original, and vice versa. The save file loaded into
+ * memory is shared until either one is saved, so a clone costs about 90 KB of
+ * copying rather than a full load (about 55 KB for compact saves).
+ *
+ * A clone also serves as a snapshot of the save, which ::pksav_gba_save_restore
+ * can roll the save back to.
+ *
+ * The clone must be freed with ::pksav_gba_save_free.
+ *
+ * \param gba_save the save to clone
+ * \param clone_out the struct to clone the save into
+ * \returns ::PKSAV_ERROR_NONE upon completion
+ * \returns ::PKSAV_ERROR_NULL_POINTER if gba_save or clone_out is NULL
+ */
+PKSAV_API pksav_error_t pksav_gba_save_clone(
+    const pksav_gba_save_t* gba_save,
+    pksav_gba_save_t* clone_out
+);
+
+/*!
+ * @brief Rolls a save back to a snapshot taken with ::pksav_gba_save_clone.
+ *
+ * The snapshot is copied into the save's existing storage, so any pointers taken
+ * from the save, such as pksav_gba_save_t.pokemon_party, remain valid. The
+ * snapshot is left as it is, so it can be restored from again.
+ *
+ * \param gba_save the save to restore
+ * \param snapshot a clone of gba_save
+ * \returns ::PKSAV_ERROR_NONE upon completion
+ * \returns ::PKSAV_ERROR_NULL_POINTER if gba_save or snapshot is NULL
+ * \returns ::PKSAV_ERROR_INVALID_SAVE if snapshot isn't from the same game or
+ *          wasn't loaded the same way
+ */
+PKSAV_API pksav_error_t pksav_gba_save_restore(
+    pksav_gba_save_t* gba_save,
+    const pksav_gba_save_t* snapshot
+);
+
 /*!
  * @brief Frees memory allocated by ::pksav_gba_save_load.
  *
@@ -0,0 +1,99 @@
+/*!
+ * @file    pksav/gba/stats.h
+ * @ingroup PKSav
+ * @brief   Calculating and validating Game Boy Advance Pokémon stats.
+ *
+ * These functions expect Pokémon to be decrypted and unshuffled, as they are
+ * in a loaded pksav_gba_save_t.
+ *
+ * Copyright (c) 2018 Nicholas Corgan (n.corgan@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+#ifndef PKSAV_GBA_STATS_H
+#define PKSAV_GBA_STATS_H
+
+#include <pksav/config.h>
+#include <pksav/error.h>
+
+#include <pksav/common/base_stats.h>
+#include <pksav/gba/pokemon.h>
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*!
+ * @brief Calculate a Pokémon's stats from its PC data.
+ *
+ * PC data doesn't store a level, so it must be given. The nature is taken
+ * from the Pokémon's personality. Empty entries (species 0) result in all
+ * stats being 0.
+ *
+ * \param pc_pokemon The Pokémon whose stats to calculate
+ * \param level The Pokémon's level (1-100)
+ * \param stats_out Where to return the stats
+ * \returns ::PKSAV_ERROR_NONE upon success
+ * \returns ::PKSAV_ERROR_NULL_POINTER if either pointer parameter is NULL
+ * \returns ::PKSAV_ERROR_PARAM_OUT_OF_RANGE if the species or level is invalid
+ */
+PKSAV_API pksav_error_t pksav_gba_pokemon_calc_stats(
+    const pksav_gba_pc_pokemon_t* pc_pokemon,
+    uint8_t level,
+    pksav_battle_stats_t* stats_out
+);
+
+/*!
+ * @brief Recalculate the stored stats of every Pokémon in a party.
+ *
+ * Each Pokémon's level is taken from pksav_gba_pokemon_party_data_t.level.
+ * No Pokémon are modified if any of them is invalid.
+ *
+ * \param party The party to update
+ * \returns ::PKSAV_ERROR_NONE upon success
+ * \returns ::PKSAV_ERROR_NULL_POINTER if party is NULL
+ * \returns ::PKSAV_ERROR_PARAM_OUT_OF_RANGE if the count or any Pokémon is invalid
+ */
+PKSAV_API pksav_error_t pksav_gba_party_update_stats(
+    pksav_gba_pokemon_party_t* party
+);
+
+/*!
+ * @brief Check the stored stats of every Pokémon in a party.
+ *
+ * \param party The party to check
+ * \param mismatches_out Where to return a bitmask of party positions whose
+ *                       stored stats don't match their calculated stats
+ * \returns ::PKSAV_ERROR_NONE upon success
+ * \returns ::PKSAV_ERROR_NULL_POINTER if either parameter is NULL
+ * \returns ::PKSAV_ERROR_PARAM_OUT_OF_RANGE if the count or any Pokémon is invalid
+ */
+PKSAV_API pksav_error_t pksav_gba_party_verify_stats(
+    const pksav_gba_pokemon_party_t* party,
+    uint8_t* mismatches_out
+);
+
+/*!
+ * @brief Calculate the stats of every Pokémon in a box.
+ *
+ * \param box The box whose Pokémon to calculate
+ * \param levels The level of each of the box's 30 entries (ignored for empty entries)
+ * \param stats_out An array of at least 30 elements
+ * \returns ::PKSAV_ERROR_NONE upon success
+ * \returns ::PKSAV_ERROR_NULL_POINTER if any parameter is NULL
+ * \returns ::PKSAV_ERROR_PARAM_OUT_OF_RANGE if any Pokémon or level is invalid
+ */
+PKSAV_API pksav_error_t pksav_gba_box_calc_stats(
+    const pksav_gba_pokemon_box_t* box,
+    const uint8_t* levels,
+    pksav_battle_stats_t* stats_out
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PKSAV_GBA_STATS_H */
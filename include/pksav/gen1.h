@@ -16,7 +16,9 @@
 
 #include <pksav/gen1/items.h>
 #include <pksav/gen1/pokemon.h>
+#include <pksav/gen1/pokemon_record.h>
 #include <pksav/gen1/save.h>
+#include <pksav/gen1/stats.h>
 #include <pksav/gen1/text.h>
 
 #include <pksav/common/condition.h>
@@ -273,6 +273,24 @@ PKSAV_API pksav_error_t pksav_gen1_save_load(
     pksav_gen1_save_t* gen1_save
 );
 
+/*!
+ * @brief Loads a save from memory, as ::pksav_gen1_save_load does from a file.
+ *
+ * The buffer is copied, so it can be reused or freed as soon as this returns.
+ *
+ * \param buffer the save data
+ * \param buffer_len the length of the buffer
+ * \param gen1_save pointer to save struct to populate
+ * \returns ::PKSAV_ERROR_NONE upon completion
+ * \returns ::PKSAV_ERROR_NULL_POINTER if buffer or gen1_save is NULL
+ * \returns ::PKSAV_ERROR_INVALID_SAVE if the buffer is not a valid Generation I save
+ */
+PKSAV_API pksav_error_t pksav_gen1_save_load_buffer(
+    const uint8_t* buffer,
+    size_t buffer_len,
+    pksav_gen1_save_t* gen1_save
+);
+
 /*!
  * @brief Saves a Generation I save file to the given path.
  *
@@ -289,6 +307,57 @@ PKSAV_API pksav_error_t pksav_gen1_save_save(
     pksav_gen1_save_t* gen1_save
 );
 
+/*!
+ * @brief Saves a Generation I save into memory, as ::pksav_gen1_save_save does to a file.
+ *
+ * \param buffer where the save should be written
+ * \param buffer_len the length of the buffer, which must be at least 32 KB
+ * \param gen1_save the save to be written
+ * \returns ::PKSAV_ERROR_NONE upon success
+ * \returns ::PKSAV_ERROR_NULL_POINTER if buffer or gen1_save is NULL
+ * \returns ::PKSAV_ERROR_PARAM_OUT_OF_RANGE if the buffer is too small
+ */
+PKSAV_API pksav_error_t pksav_gen1_save_save_buffer(
+    uint8_t* buffer,
+    size_t buffer_len,
+    pksav_gen1_save_t* gen1_save
+);
+
+/*!
+ * @brief Makes an independent copy of a loaded save, without reloading it.
+ *
+ * The clone can be edited and saved without affecting the original, and vice
+ * versa. It also serves as a snapshot that ::pksav_gen1_save_restore can roll
+ * the original back to.
+ *
+ * The clone must be freed with ::pksav_gen1_save_free.
+ *
+ * \param gen1_save the save to clone
+ * \param clone_out the struct to clone the save into
+ * \returns ::PKSAV_ERROR_NONE upon completion
+ * \returns ::PKSAV_ERROR_NULL_POINTER if gen1_save or clone_out is NULL
+ */
+PKSAV_API pksav_error_t pksav_gen1_save_clone(
+    const pksav_gen1_save_t* gen1_save,
+    pksav_gen1_save_t* clone_out
+);
+
+/*!
+ * @brief Rolls a save back to a snapshot taken with ::pksav_gen1_save_clone.
+ *
+ * The snapshot is copied into the save's existing storage, so the save's pointers
+ * remain valid, and the snapshot can be restored from again.
+ *
+ * \param gen1_save the save to restore
+ * \param snapshot a clone of gen1_save
+ * \returns ::PKSAV_ERROR_NONE upon completion
+ * \returns ::PKSAV_ERROR_NULL_POINTER if gen1_save or snapshot is NULL
+ */
+PKSAV_API pksav_error_t pksav_gen1_save_restore(
+    pksav_gen1_save_t* gen1_save,
+    const pksav_gen1_save_t* snapshot
+);
+
 /*!
  * @brief Frees memory allocated for a pksav_gen1_save_t.
  *
@@ -0,0 +1,91 @@
+/*!
+ * @file    pksav/gen1/stats.h
+ * @ingroup PKSav
+ * @brief   Calculating and validating Generation I Pokémon stats.
+ *
+ * Copyright (c) 2018 Nicholas Corgan (n.corgan@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+#ifndef PKSAV_GEN1_STATS_H
+#define PKSAV_GEN1_STATS_H
+
+#include <pksav/config.h>
+#include <pksav/error.h>
+
+#include <pksav/common/base_stats.h>
+#include <pksav/gen1/pokemon.h>
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*!
+ * @brief Calculate a Pokémon's stats from its PC data.
+ *
+ * The level is taken from pksav_gen1_pc_pokemon_t.level. Empty entries
+ * (species 0) result in all stats being 0.
+ *
+ * \param pc_pokemon The Pokémon whose stats to calculate
+ * \param stats_out Where to return the stats (Special in both spatk and spdef)
+ * \returns ::PKSAV_ERROR_NONE upon success
+ * \returns ::PKSAV_ERROR_NULL_POINTER if either parameter is NULL
+ * \returns ::PKSAV_ERROR_PARAM_OUT_OF_RANGE if the species or level is invalid
+ */
+PKSAV_API pksav_error_t pksav_gen1_pokemon_calc_stats(
+    const pksav_gen1_pc_pokemon_t* pc_pokemon,
+    pksav_battle_stats_t* stats_out
+);
+
+/*!
+ * @brief Recalculate the stored stats of every Pokémon in a party.
+ *
+ * Each Pokémon's level is taken from pksav_gen1_pokemon_party_data_t.level.
+ * No Pokémon are modified if any of them is invalid.
+ *
+ * \param party The party to update
+ * \returns ::PKSAV_ERROR_NONE upon success
+ * \returns ::PKSAV_ERROR_NULL_POINTER if party is NULL
+ * \returns ::PKSAV_ERROR_PARAM_OUT_OF_RANGE if the count or any Pokémon is invalid
+ */
+PKSAV_API pksav_error_t pksav_gen1_party_update_stats(
+    pksav_gen1_pokemon_party_t* party
+);
+
+/*!
+ * @brief Check the stored stats of every Pokémon in a party.
+ *
+ * \param party The party to check
+ * \param mismatches_out Where to return a bitmask of party positions whose
+ *                       stored stats don't match their calculated stats
+ * \returns ::PKSAV_ERROR_NONE upon success
+ * \returns ::PKSAV_ERROR_NULL_POINTER if either parameter is NULL
+ * \returns ::PKSAV_ERROR_PARAM_OUT_OF_RANGE if the count or any Pokémon is invalid
+ */
+PKSAV_API pksav_error_t pksav_gen1_party_verify_stats(
+    const pksav_gen1_pokemon_party_t* party,
+    uint8_t* mismatches_out
+);
+
+/*!
+ * @brief Calculate the stats of every Pokémon in a box.
+ *
+ * \param box The box whose Pokémon to calculate
+ * \param stats_out An array of at least pksav_gen1_pokemon_box_t.count elements
+ * \returns ::PKSAV_ERROR_NONE upon success
+ * \returns ::PKSAV_ERROR_NULL_POINTER if either parameter is NULL
+ * \returns ::PKSAV_ERROR_PARAM_OUT_OF_RANGE if the count or any Pokémon is invalid
+ */
+PKSAV_API pksav_error_t pksav_gen1_box_calc_stats(
+    const pksav_gen1_pokemon_box_t* box,
+    pksav_battle_stats_t* stats_out
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PKSAV_GEN1_STATS_H */
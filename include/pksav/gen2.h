@@ -16,7 +16,9 @@
 
 #include <pksav/gen2/items.h>
 #include <pksav/gen2/pokemon.h>
+#include <pksav/gen2/pokemon_record.h>
 #include <pksav/gen2/save.h>
+#include <pksav/gen2/stats.h>
 #include <pksav/gen2/text.h>
 #include <pksav/gen2/time.h>
 
@@ -41,6 +41,35 @@ PKSAV_API pksav_error_t pksav_text_from_gen2(
     size_t num_chars
 );
 
+//! Convert a string from Generation II format directly to UTF-8
+/*!
+ * In Generation II games, strings are stored with a proprietary character
+ * map.
+ *
+ * Unlike ::pksav_text_from_gen2, this does not depend on the current locale,
+ * and the size of the output buffer is independent of the number of characters
+ * to convert. Conversion stops at the in-game terminator, after num_chars
+ * characters, or when the output buffer is full, whichever comes first. A
+ * multi-byte character is never split, and the output is always null-terminated
+ * if output_len is non-zero.
+ *
+ * \param input_buffer Generation II string
+ * \param num_chars the maximum number of characters to convert
+ * \param output_text output buffer in which to place converted text
+ * \param output_len size of output_text, in bytes
+ * \param num_bytes_out where to return the number of bytes written, not including
+ *                      the null terminator (can be NULL)
+ * \returns PKSAV_ERROR_NONE upon success
+ * \returns PKSAV_ERROR_NULL_POINTER if input_buffer or output_text is NULL
+ */
+PKSAV_API pksav_error_t pksav_text_from_gen2_utf8(
+    const uint8_t* input_buffer,
+    size_t num_chars,
+    char* output_text,
+    size_t output_len,
+    size_t* num_bytes_out
+);
+
 //! Convert a UTF-8 C string to Generation II format
 /*!
  * In Generation II games, strings are stored with a proprietary character
@@ -0,0 +1,28 @@
+/*!
+ * @file    pksav/gen4.h
+ * @ingroup PKSav
+ * @brief   Global Generation IV include file.
+ *
+ * Copyright (c) 2018 Nicholas Corgan (n.corgan@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+#ifndef PKSAV_GEN4_H
+#define PKSAV_GEN4_H
+
+#include <pksav/config.h>
+#include <pksav/error.h>
+
+#include <pksav/gen4/pokemon.h>
+#include <pksav/gen4/pokemon_record.h>
+#include <pksav/gen4/save.h>
+#include <pksav/gen4/text.h>
+
+#include <pksav/common/nds_crypt.h>
+#include <pksav/common/nds_pokemon.h>
+#include <pksav/common/trainer_id.h>
+
+#include <pksav/math/endian.h>
+
+#endif /* PKSAV_GEN4_H */
@@ -0,0 +1,44 @@
+/*!
+ * @file    pksav/gen4/pokemon.h
+ * @ingroup PKSav
+ * @brief   Native storage for Pokémon parties and boxes in Generation IV games.
+ *
+ * Copyright (c) 2018 Nicholas Corgan (n.corgan@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+#ifndef PKSAV_GEN4_POKEMON_H
+#define PKSAV_GEN4_POKEMON_H
+
+#include <pksav/common/nds_pokemon.h>
+
+#include <stdint.h>
+
+//! The number of Pokémon boxes in Generation IV games.
+#define PKSAV_GEN4_NUM_POKEMON_BOXES 18
+
+#pragma pack(push,1)
+
+//! Native format for the trainer's Pokémon party in Generation IV.
+typedef struct {
+    /*!
+     * @brief The actual number of Pokémon in the party (0-6).
+     *
+     * This value is stored in little-endian and should be accessed and
+     * modified with ::pksav_littleendian32.
+     */
+    uint32_t count;
+    //! The actual Pokémon in the party.
+    pksav_nds_party_pokemon_t party[6];
+} pksav_gen4_pokemon_party_t;
+
+//! Native format for a Pokémon box in Generation IV.
+typedef struct {
+    //! The Pokémon in the box. Empty slots have a species of 0.
+    pksav_nds_pc_pokemon_t entries[30];
+} pksav_gen4_pokemon_box_t;
+
+#pragma pack(pop)
+
+#endif /* PKSAV_GEN4_POKEMON_H */
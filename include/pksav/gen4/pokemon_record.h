@@ -0,0 +1,64 @@
+/*!
+ * @file    pksav/gen4/pokemon_record.h
+ * @ingroup PKSav
+ * @brief   Converting Generation IV Pokémon to ::pksav_pokemon_record_t.
+ *
+ * Copyright (c) 2018 Nicholas Corgan (n.corgan@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+#ifndef PKSAV_GEN4_POKEMON_RECORD_H
+#define PKSAV_GEN4_POKEMON_RECORD_H
+
+#include <pksav/config.h>
+#include <pksav/error.h>
+
+#include <pksav/common/pokemon_record.h>
+#include <pksav/gen4/pokemon.h>
+
+#include <stdlib.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*!
+ * @brief Convert every Pokémon in a box to a normalized record.
+ *
+ * Empty slots are skipped, and the level of each record is 0, as it isn't
+ * stored in PC data.
+ *
+ * \param box The box to convert, decrypted with ::pksav_nds_decrypt_pc_pokemon
+ * \param records_out An array of at least 30 elements
+ * \param num_records_out Where to return the number of records written
+ * \returns ::PKSAV_ERROR_NONE upon success
+ * \returns ::PKSAV_ERROR_NULL_POINTER if any parameter is NULL
+ */
+PKSAV_API pksav_error_t pksav_gen4_box_to_records(
+    const pksav_gen4_pokemon_box_t* box,
+    pksav_pokemon_record_t* records_out,
+    size_t* num_records_out
+);
+
+/*!
+ * @brief Convert every Pokémon in a party to a normalized record.
+ *
+ * \param party The party to convert, decrypted with ::pksav_nds_decrypt_party_pokemon
+ * \param records_out An array of at least pksav_gen4_pokemon_party_t.count elements
+ * \param num_records_out Where to return the number of records written
+ * \returns ::PKSAV_ERROR_NONE upon success
+ * \returns ::PKSAV_ERROR_NULL_POINTER if any parameter is NULL
+ * \returns ::PKSAV_ERROR_PARAM_OUT_OF_RANGE if the count is invalid
+ */
+PKSAV_API pksav_error_t pksav_gen4_party_to_records(
+    const pksav_gen4_pokemon_party_t* party,
+    pksav_pokemon_record_t* records_out,
+    size_t* num_records_out
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PKSAV_GEN4_POKEMON_RECORD_H */
@@ -0,0 +1,223 @@
+/*!
+ * @file    pksav/gen4/save.h
+ * @ingroup PKSav
+ * @brief   Loading, editing, and saving Generation IV save files.
+ *
+ * Copyright (c) 2018 Nicholas Corgan (n.corgan@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+#ifndef PKSAV_GEN4_SAVE_H
+#define PKSAV_GEN4_SAVE_H
+
+#include <pksav/config.h>
+#include <pksav/error.h>
+
+#include <pksav/common/trainer_id.h>
+#include <pksav/gen4/pokemon.h>
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+/*!
+ * @brief An enum describing each type of Generation IV game.
+ *
+ * This enum is to be used with ::pksav_file_is_gen4_save and
+ * ::pksav_gen4_save_load.
+ */
+typedef enum {
+    //! Pokémon Diamond/Pearl
+    PKSAV_GEN4_DP = 0,
+    //! Pokémon Platinum
+    PKSAV_GEN4_PLATINUM,
+    //! Pokémon HeartGold/SoulSilver
+    PKSAV_GEN4_HGSS
+} pksav_gen4_game_t;
+
+#pragma pack(push,1)
+
+//! Native format for information on the player character in Generation IV.
+typedef struct {
+    /*!
+     * @brief The player's name.
+     *
+     * This name should be accessed with ::pksav_text_from_gen4 and modified with
+     * ::pksav_text_to_gen4, with a num_chars parameter of 7.
+     */
+    uint16_t name[8];
+    //! The player's trainer ID.
+    pksav_trainer_id_t id;
+    /*!
+     * @brief The player's money (valid values 0-999999).
+     *
+     * This value is stored in little-endian and should be accessed and
+     * modified with ::pksav_littleendian32.
+     */
+    uint32_t money;
+    //! The player's gender (0 = male, 1 = female).
+    uint8_t gender;
+    //! The game's language.
+    uint8_t language;
+    //! A bitfield of the badges the player has earned.
+    uint8_t badges;
+    //! The player's appearance in multiplayer.
+    uint8_t avatar;
+} pksav_gen4_trainer_info_t;
+
+#pragma pack(pop)
+
+/*!
+ * @brief The structure representing a Generation IV save.
+ *
+ * A Generation IV save stores two copies each of its general block (trainer
+ * and party data) and storage block (PC boxes). ::pksav_gen4_save_load picks
+ * the newest copy of each that passes its checksum, and the pointers in this
+ * struct point into those copies.
+ *
+ * The pointers in this structure should not be used before passing it
+ * into ::pksav_gen4_save_load and should not be used after passing it
+ * into ::pksav_gen4_save_save. Doing so will result in undefined behavior.
+ */
+typedef struct {
+    //! Information on the player character.
+    pksav_gen4_trainer_info_t* trainer_info;
+
+    /*!
+     * @brief The trainer's Pokémon party.
+     *
+     * Pokémon are stored encrypted, as they are in the save file, and can
+     * be decrypted with ::pksav_nds_decrypt_party_pokemon.
+     */
+    pksav_gen4_pokemon_party_t* pokemon_party;
+
+    /*!
+     * @brief Pointers to the trainer's Pokémon boxes.
+     *
+     * Pokémon are stored encrypted, as they are in the save file, and can
+     * be decrypted with ::pksav_nds_decrypt_pc_pokemon.
+     */
+    pksav_gen4_pokemon_box_t* pokemon_boxes[PKSAV_GEN4_NUM_POKEMON_BOXES];
+
+    //! @brief Which of the three game types this save corresponds to.
+    pksav_gen4_game_t gen4_game;
+
+    // Do not edit these
+#ifndef __DOXYGEN__
+    size_t raw_size;
+    uint8_t general_copy;
+    uint8_t storage_copy;
+    uint8_t* general_snapshot;
+    uint8_t* storage_snapshot;
+    uint8_t* raw;
+#endif
+} pksav_gen4_save_t;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*!
+ * @brief Checks if the given buffer is a valid Generation IV save.
+ *
+ * A buffer is valid if at least one copy of each of its general and storage
+ * blocks passes its checksum.
+ *
+ * \param buffer buffer to check
+ * \param buffer_len size of the buffer to check
+ * \param gen4_game which type of Generation IV game to test for
+ * \param result_out whether or not the buffer is a valid save
+ * \returns ::PKSAV_ERROR_NONE upon success, no matter the result
+ * \returns ::PKSAV_ERROR_NULL_POINTER if buffer or result_out is NULL
+ */
+PKSAV_API pksav_error_t pksav_buffer_is_gen4_save(
+    const uint8_t* buffer,
+    size_t buffer_len,
+    pksav_gen4_game_t gen4_game,
+    bool* result_out
+);
+
+/*!
+ * @brief Checks if the given file is a valid Generation IV save.
+ *
+ * \param filepath path of the file to check
+ * \param gen4_game which type of Generation IV game to test for
+ * \param result_out whether or not the file is a valid save
+ * \returns ::PKSAV_ERROR_NONE upon success, no matter the result
+ * \returns ::PKSAV_ERROR_NULL_POINTER if filepath or result_out is NULL
+ * \returns ::PKSAV_ERROR_FILE_IO if the file can't be read
+ */
+PKSAV_API pksav_error_t pksav_file_is_gen4_save(
+    const char* filepath,
+    pksav_gen4_game_t gen4_game,
+    bool* result_out
+);
+
+/*!
+ * @brief Loads the save file at the given path and populates the given save struct
+ *
+ * \param filepath path of the file to load
+ * \param gen4_save pointer to save struct to populate
+ * \returns ::PKSAV_ERROR_NONE upon completion
+ * \returns ::PKSAV_ERROR_NULL_POINTER if filepath or gen4_save is NULL
+ * \returns ::PKSAV_ERROR_FILE_IO if an error occurs reading the file
+ * \returns ::PKSAV_ERROR_INVALID_SAVE if the file is not a valid Generation IV save
+ */
+PKSAV_API pksav_error_t pksav_gen4_save_load(
+    const char* filepath,
+    pksav_gen4_save_t* gen4_save
+);
+
+/*!
+ * @brief Loads a save from memory, as ::pksav_gen4_save_load does from a file.
+ *
+ * The buffer is copied, so it can be reused or freed as soon as this returns.
+ *
+ * \param buffer the save data
+ * \param buffer_len the length of the buffer
+ * \param gen4_save pointer to save struct to populate
+ * \returns ::PKSAV_ERROR_NONE upon completion
+ * \returns ::PKSAV_ERROR_NULL_POINTER if buffer or gen4_save is NULL
+ * \returns ::PKSAV_ERROR_INVALID_SAVE if the buffer is not a valid Generation IV save
+ */
+PKSAV_API pksav_error_t pksav_gen4_save_load_buffer(
+    const uint8_t* buffer,
+    size_t buffer_len,
+    pksav_gen4_save_t* gen4_save
+);
+
+/*!
+ * @brief Saves the given save file to the given path
+ *
+ * Each block that was modified since it was loaded is given a new save
+ * counter and checksum and written over its older copy, leaving the previous
+ * copy intact. Unmodified blocks are left as-is.
+ *
+ * \param filepath where to save the save file
+ * \param gen4_save pointer to the save struct to save
+ * \returns ::PKSAV_ERROR_NONE upon completion
+ * \returns ::PKSAV_ERROR_NULL_POINTER if filepath or gen4_save is NULL
+ * \returns ::PKSAV_ERROR_FILE_IO if an error occurs writing the file
+ */
+PKSAV_API pksav_error_t pksav_gen4_save_save(
+    const char* filepath,
+    pksav_gen4_save_t* gen4_save
+);
+
+/*!
+ * @brief Frees memory allocated by ::pksav_gen4_save_load.
+ *
+ * \param gen4_save the save struct to free
+ * \returns ::PKSAV_ERROR_NONE upon success
+ * \returns ::PKSAV_ERROR_NULL_POINTER if gen4_save is NULL
+ */
+PKSAV_API pksav_error_t pksav_gen4_save_free(
+    pksav_gen4_save_t* gen4_save
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PKSAV_GEN4_SAVE_H */
@@ -0,0 +1,28 @@
+/*!
+ * @file    pksav/gen5.h
+ * @ingroup PKSav
+ * @brief   Global Generation V include file.
+ *
+ * Copyright (c) 2018 Nicholas Corgan (n.corgan@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+#ifndef PKSAV_GEN5_H
+#define PKSAV_GEN5_H
+
+#include <pksav/config.h>
+#include <pksav/error.h>
+
+#include <pksav/gen5/pokemon.h>
+#include <pksav/gen5/pokemon_record.h>
+#include <pksav/gen5/save.h>
+#include <pksav/gen5/text.h>
+
+#include <pksav/common/nds_crypt.h>
+#include <pksav/common/nds_pokemon.h>
+#include <pksav/common/trainer_id.h>
+
+#include <pksav/math/endian.h>
+
+#endif /* PKSAV_GEN5_H */
@@ -0,0 +1,76 @@
+/*!
+ * @file    pksav/gen5/pokemon.h
+ * @ingroup PKSav
+ * @brief   Native storage for Pokémon parties and boxes in Generation V games.
+ *
+ * Copyright (c) 2018 Nicholas Corgan (n.corgan@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+#ifndef PKSAV_GEN5_POKEMON_H
+#define PKSAV_GEN5_POKEMON_H
+
+#include <pksav/common/nds_pokemon.h>
+
+#include <stdint.h>
+
+//! The number of Pokémon boxes in Generation V games.
+#define PKSAV_GEN5_NUM_POKEMON_BOXES 24
+
+#pragma pack(push,1)
+
+/*!
+ * @brief Party data for a Pokémon in Generation V.
+ *
+ * This matches the start of pksav_nds_pokemon_party_data_t, but is shorter.
+ * Stats are stored in little-endian and should be accessed and modified
+ * with ::pksav_littleendian16.
+ */
+typedef struct {
+    uint8_t status;
+    uint8_t unknown_x89;
+    uint8_t unknown_x8A;
+    uint8_t unknown_x8B;
+    uint8_t level;
+    uint8_t capsule;
+    uint16_t current_hp;
+    uint16_t max_hp;
+    uint16_t atk;
+    uint16_t def;
+    uint16_t spd;
+    uint16_t spatk;
+    uint16_t spdef;
+    uint8_t unknown_0x9C[64];
+} pksav_gen5_pokemon_party_data_t;
+
+//! Native format for a Pokémon in the trainer's party in Generation V.
+typedef struct {
+    //! PC data.
+    pksav_nds_pc_pokemon_t pc;
+    //! Party data.
+    pksav_gen5_pokemon_party_data_t party_data;
+} pksav_gen5_party_pokemon_t;
+
+//! Native format for the trainer's Pokémon party in Generation V.
+typedef struct {
+    /*!
+     * @brief The actual number of Pokémon in the party (0-6).
+     *
+     * This value is stored in little-endian and should be accessed and
+     * modified with ::pksav_littleendian32.
+     */
+    uint32_t count;
+    //! The actual Pokémon in the party.
+    pksav_gen5_party_pokemon_t party[6];
+} pksav_gen5_pokemon_party_t;
+
+//! Native format for a Pokémon box in Generation V.
+typedef struct {
+    //! The Pokémon in the box. Empty slots are all zeroes.
+    pksav_nds_pc_pokemon_t entries[30];
+} pksav_gen5_pokemon_box_t;
+
+#pragma pack(pop)
+
+#endif /* PKSAV_GEN5_POKEMON_H */
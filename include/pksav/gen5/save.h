@@ -0,0 +1,251 @@
+/*!
+ * @file    pksav/gen5/save.h
+ * @ingroup PKSav
+ * @brief   Loading, editing, and saving Generation V save files.
+ *
+ * Copyright (c) 2018 Nicholas Corgan (n.corgan@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+#ifndef PKSAV_GEN5_SAVE_H
+#define PKSAV_GEN5_SAVE_H
+
+#include <pksav/config.h>
+#include <pksav/error.h>
+
+#include <pksav/common/trainer_id.h>
+#include <pksav/gen5/pokemon.h>
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+/*!
+ * @brief An enum describing each type of Generation V game.
+ *
+ * This enum is to be used with ::pksav_file_is_gen5_save and
+ * ::pksav_gen5_save_load.
+ */
+typedef enum {
+    //! Pokémon Black/White
+    PKSAV_GEN5_BW = 0,
+    //! Pokémon Black 2/White 2
+    PKSAV_GEN5_B2W2
+} pksav_gen5_game_t;
+
+#pragma pack(push,1)
+
+//! Native format for information on the player character in Generation V.
+typedef struct {
+    //! Unknown.
+    uint8_t unknown_0x00[4];
+    /*!
+     * @brief The player's name.
+     *
+     * This name should be accessed with ::pksav_text_from_gen5 and modified with
+     * ::pksav_text_to_gen5, with a num_chars parameter of 7.
+     */
+    uint16_t name[8];
+    //! The player's trainer ID.
+    pksav_trainer_id_t id;
+    //! Unknown.
+    uint8_t unknown_0x18[6];
+    //! The game's language.
+    uint8_t language;
+    //! Which game this save is from.
+    uint8_t game;
+    //! Unknown.
+    uint8_t unknown_0x20;
+    //! The player's gender (0 = male, 1 = female).
+    uint8_t gender;
+    //! Unknown.
+    uint8_t unknown_0x22[2];
+    /*!
+     * @brief Hours played.
+     *
+     * This value is stored in little-endian and should be accessed and
+     * modified with ::pksav_littleendian16.
+     */
+    uint16_t hours_played;
+    //! Minutes played.
+    uint8_t minutes_played;
+    //! Seconds played.
+    uint8_t seconds_played;
+} pksav_gen5_trainer_info_t;
+
+#pragma pack(pop)
+
+/*!
+ * @brief The structure representing a Generation V save.
+ *
+ * Boxes are only decrypted when first accessed with
+ * ::pksav_gen5_save_get_pokemon_box or ::pksav_gen5_save_edit_pokemon_box,
+ * and ::pksav_gen5_save_save only re-encrypts and re-checksums the blocks
+ * that were modified.
+ *
+ * The pointers in this structure should not be used before passing it
+ * into ::pksav_gen5_save_load and should not be used after passing it
+ * into ::pksav_gen5_save_free. Doing so will result in undefined behavior.
+ */
+typedef struct {
+    //! Information on the player character.
+    pksav_gen5_trainer_info_t* trainer_info;
+
+    //! The trainer's Pokémon party, decrypted.
+    pksav_gen5_pokemon_party_t* pokemon_party;
+
+    //! @brief Which of the two game types this save corresponds to.
+    pksav_gen5_game_t gen5_game;
+
+    // Do not edit these
+#ifndef __DOXYGEN__
+    size_t raw_size;
+    uint32_t dirty_boxes;
+    pksav_gen5_pokemon_box_t* pokemon_boxes[PKSAV_GEN5_NUM_POKEMON_BOXES];
+    pksav_gen5_pokemon_party_t* party_snapshot;
+    pksav_gen5_trainer_info_t* trainer_info_snapshot;
+    uint8_t* raw;
+#endif
+} pksav_gen5_save_t;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*!
+ * @brief Checks if the given buffer is a valid Generation V save.
+ *
+ * \param buffer buffer to check
+ * \param buffer_len size of the buffer to check
+ * \param gen5_game which type of Generation V game to test for
+ * \param result_out whether or not the buffer is a valid save
+ * \returns ::PKSAV_ERROR_NONE upon success, no matter the result
+ * \returns ::PKSAV_ERROR_NULL_POINTER if buffer or result_out is NULL
+ */
+PKSAV_API pksav_error_t pksav_buffer_is_gen5_save(
+    const uint8_t* buffer,
+    size_t buffer_len,
+    pksav_gen5_game_t gen5_game,
+    bool* result_out
+);
+
+/*!
+ * @brief Checks if the given file is a valid Generation V save.
+ *
+ * \param filepath path of the file to check
+ * \param gen5_game which type of Generation V game to test for
+ * \param result_out whether or not the file is a valid save
+ * \returns ::PKSAV_ERROR_NONE upon success, no matter the result
+ * \returns ::PKSAV_ERROR_NULL_POINTER if filepath or result_out is NULL
+ * \returns ::PKSAV_ERROR_FILE_IO if the file can't be read
+ */
+PKSAV_API pksav_error_t pksav_file_is_gen5_save(
+    const char* filepath,
+    pksav_gen5_game_t gen5_game,
+    bool* result_out
+);
+
+/*!
+ * @brief Loads the save file at the given path and populates the given save struct
+ *
+ * The checksum table and the trainer, party, and box blocks are validated,
+ * and the party is decrypted. Boxes are decrypted on first access.
+ *
+ * \param filepath path of the file to load
+ * \param gen5_save pointer to save struct to populate
+ * \returns ::PKSAV_ERROR_NONE upon completion
+ * \returns ::PKSAV_ERROR_NULL_POINTER if filepath or gen5_save is NULL
+ * \returns ::PKSAV_ERROR_FILE_IO if an error occurs reading the file
+ * \returns ::PKSAV_ERROR_INVALID_SAVE if the file is not a valid Generation V save
+ */
+PKSAV_API pksav_error_t pksav_gen5_save_load(
+    const char* filepath,
+    pksav_gen5_save_t* gen5_save
+);
+
+/*!
+ * @brief Loads a save from memory, as ::pksav_gen5_save_load does from a file.
+ *
+ * The buffer is copied, so it can be reused or freed as soon as this returns.
+ *
+ * \param buffer the save data
+ * \param buffer_len the length of the buffer
+ * \param gen5_save pointer to save struct to populate
+ * \returns ::PKSAV_ERROR_NONE upon completion
+ * \returns ::PKSAV_ERROR_NULL_POINTER if buffer or gen5_save is NULL
+ * \returns ::PKSAV_ERROR_INVALID_SAVE if the buffer is not a valid Generation V save
+ */
+PKSAV_API pksav_error_t pksav_gen5_save_load_buffer(
+    const uint8_t* buffer,
+    size_t buffer_len,
+    pksav_gen5_save_t* gen5_save
+);
+
+/*!
+ * @brief Get a decrypted Pokémon box for reading.
+ *
+ * \param gen5_save the save to read from
+ * \param box_num which box to get (0-23)
+ * \param box_out where to return a pointer to the decrypted box
+ * \returns ::PKSAV_ERROR_NONE upon success
+ * \returns ::PKSAV_ERROR_NULL_POINTER if gen5_save or box_out is NULL
+ * \returns ::PKSAV_ERROR_PARAM_OUT_OF_RANGE if box_num is invalid
+ */
+PKSAV_API pksav_error_t pksav_gen5_save_get_pokemon_box(
+    pksav_gen5_save_t* gen5_save,
+    uint8_t box_num,
+    const pksav_gen5_pokemon_box_t** box_out
+);
+
+/*!
+ * @brief Get a decrypted Pokémon box for modification.
+ *
+ * The box will be re-encrypted and re-checksummed by ::pksav_gen5_save_save.
+ *
+ * \param gen5_save the save to modify
+ * \param box_num which box to get (0-23)
+ * \param box_out where to return a pointer to the decrypted box
+ * \returns ::PKSAV_ERROR_NONE upon success
+ * \returns ::PKSAV_ERROR_NULL_POINTER if gen5_save or box_out is NULL
+ * \returns ::PKSAV_ERROR_PARAM_OUT_OF_RANGE if box_num is invalid
+ */
+PKSAV_API pksav_error_t pksav_gen5_save_edit_pokemon_box(
+    pksav_gen5_save_t* gen5_save,
+    uint8_t box_num,
+    pksav_gen5_pokemon_box_t** box_out
+);
+
+/*!
+ * @brief Saves the given save file to the given path
+ *
+ * Only blocks that were modified are re-encrypted and given new checksums,
+ * after which the checksum table's own checksum is updated.
+ *
+ * \param filepath where to save the save file
+ * \param gen5_save pointer to the save struct to save
+ * \returns ::PKSAV_ERROR_NONE upon completion
+ * \returns ::PKSAV_ERROR_NULL_POINTER if filepath or gen5_save is NULL
+ * \returns ::PKSAV_ERROR_FILE_IO if an error occurs writing the file
+ */
+PKSAV_API pksav_error_t pksav_gen5_save_save(
+    const char* filepath,
+    pksav_gen5_save_t* gen5_save
+);
+
+/*!
+ * @brief Frees memory allocated by ::pksav_gen5_save_load.
+ *
+ * \param gen5_save the save struct to free
+ * \returns ::PKSAV_ERROR_NONE upon success
+ * \returns ::PKSAV_ERROR_NULL_POINTER if gen5_save is NULL
+ */
+PKSAV_API pksav_error_t pksav_gen5_save_free(
+    pksav_gen5_save_t* gen5_save
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PKSAV_GEN5_SAVE_H */
@@ -40,6 +40,61 @@ PKSAV_API pksav_error_t pksav_text_from_gen5(
     size_t num_chars
 );
 
+//! Convert a string from the given generation's format directly to UTF-8
+/*!
+ * In Generation V, strings are stored in Unicode.
+ *
+ * Unlike ::pksav_text_from_gen5, this does not depend on the current locale,
+ * and the size of the output buffer is independent of the number of characters
+ * to convert. Conversion stops at the in-game terminator, after num_chars
+ * characters, or when the output buffer is full, whichever comes first. A
+ * multi-byte character is never split, and the output is always null-terminated
+ * if output_len is non-zero.
+ *
+ * \param input_buffer Generation V string
+ * \param num_chars the maximum number of characters to convert
+ * \param output_text output buffer in which to place converted text
+ * \param output_len size of output_text, in bytes
+ * \param num_bytes_out where to return the number of bytes written, not including
+ *                      the null terminator (can be NULL)
+ * \returns PKSAV_ERROR_NONE upon success
+ * \returns PKSAV_ERROR_NULL_POINTER if input_buffer or output_text is NULL
+ */
+PKSAV_API pksav_error_t pksav_text_from_gen5_utf8(
+    const uint16_t* input_buffer,
+    size_t num_chars,
+    char* output_text,
+    size_t output_len,
+    size_t* num_bytes_out
+);
+
+//! Convert a table of fixed-width strings from the given generation's format to UTF-8
+/*!
+ * In Generation V, strings are stored in Unicode.
+ *
+ * This is intended for strings embedded at the same position in each entry of
+ * an array, such as the nicknames of every Pokémon in a box. The string in
+ * each record is converted as with ::pksav_text_from_gen5_utf8 and placed in
+ * its own fixed-size slot of the output buffer.
+ *
+ * \param input_records the first string to convert
+ * \param record_stride the distance between consecutive strings, in bytes
+ * \param num_chars the maximum number of characters in each string
+ * \param num_records the number of strings to convert
+ * \param output_text output buffer, at least num_records * output_stride bytes
+ * \param output_stride the size of each string's slot in output_text, in bytes
+ * \returns PKSAV_ERROR_NONE upon success
+ * \returns PKSAV_ERROR_NULL_POINTER if input_records or output_text is NULL
+ */
+PKSAV_API pksav_error_t pksav_text_from_gen5_batch(
+    const uint16_t* input_records,
+    size_t record_stride,
+    size_t num_chars,
+    size_t num_records,
+    char* output_text,
+    size_t output_stride
+);
+
 //! Convert a string from the given generation's format to a wide-character C string
 /*!
  * In Generation V, strings are stored in Unicode.
@@ -0,0 +1,105 @@
+/*!
+ * @file    pksav/ingest.h
+ * @ingroup PKSav
+ * @brief   Reading many save files with their reads queued up ahead of time.
+ *
+ * Copyright (c) 2018 Nicholas Corgan (n.corgan@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+#ifndef PKSAV_INGEST_H
+#define PKSAV_INGEST_H
+
+#include <pksav/config.h>
+#include <pksav/error.h>
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+//! How many reads ::pksav_ingest_files keeps in flight when given 0.
+#define PKSAV_INGEST_DEFAULT_QUEUE_DEPTH 32
+
+/*!
+ * @brief Called with the contents of each file as its read completes.
+ *
+ * The buffer is only valid during the callback. It's meant to be passed into
+ * one of the buffer-based loaders, such as ::pksav_gen4_save_load_buffer,
+ * which copy what they need.
+ *
+ * \param index The position of this file in the filepath array
+ * \param filepath The file that was read
+ * \param error ::PKSAV_ERROR_FILE_IO if the file couldn't be read, or
+ *              ::PKSAV_ERROR_NULL_POINTER if its filepath was NULL
+ * \param buffer The file's contents, or NULL on error or if the file is empty
+ * \param buffer_len The size of the file
+ * \param user_data pksav_ingest_options_t.user_data
+ */
+typedef void (*pksav_ingest_fcn_t)(
+    size_t index,
+    const char* filepath,
+    pksav_error_t error,
+    const uint8_t* buffer,
+    size_t buffer_len,
+    void* user_data
+);
+
+/*!
+ * @brief Options for ::pksav_ingest_files.
+ */
+typedef struct {
+    //! How many reads to keep in flight, or 0 for ::PKSAV_INGEST_DEFAULT_QUEUE_DEPTH.
+    size_t queue_depth;
+    //! Called with each file's contents.
+    pksav_ingest_fcn_t ingest_fcn;
+    //! Passed into ingest_fcn.
+    void* user_data;
+} pksav_ingest_options_t;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*!
+ * @brief Whether ::pksav_ingest_files reads files asynchronously.
+ *
+ * This is only true if PKSav was built with PKSAV_ENABLE_IO_URING on Linux,
+ * and the running kernel allows io_uring to be used.
+ */
+PKSAV_API bool pksav_ingest_is_async(void);
+
+/*!
+ * @brief Read many save files, handing each one off as soon as it's been read.
+ *
+ * With io_uring (see ::pksav_ingest_is_async), up to options->queue_depth
+ * reads are submitted at once, and options->ingest_fcn is called on each
+ * finished file while the reads for the rest are still in flight, so parsing
+ * overlaps with I/O. Files are handed off in the order their reads complete.
+ *
+ * Otherwise, each file is read in turn with blocking I/O and handed off in
+ * order. Either way, options->ingest_fcn is called on the calling thread
+ * exactly once for each filepath.
+ *
+ * \param filepaths The files to read
+ * \param num_filepaths The number of files
+ * \param options How to read them
+ * \param num_failures_out Where to return how many files couldn't be read (optional)
+ * \returns ::PKSAV_ERROR_NONE once every file has been handed off, even if some couldn't be read
+ * \returns ::PKSAV_ERROR_NULL_POINTER if filepaths, options, or options->ingest_fcn is NULL
+ * \returns ::PKSAV_ERROR_FILE_IO if the io_uring instance stopped working partway through,
+ *          in which case the files not yet handed off are read with blocking I/O, so every
+ *          file is still handed off
+ */
+PKSAV_API pksav_error_t pksav_ingest_files(
+    const char* const* filepaths,
+    size_t num_filepaths,
+    const pksav_ingest_options_t* options,
+    size_t* num_failures_out
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PKSAV_INGEST_H */
@@ -0,0 +1,313 @@
+/*!
+ * @file    pksav/journal.h
+ * @ingroup PKSav
+ * @brief   Undoable edits to loaded saves, which can be exported as patches.
+ *
+ * Copyright (c) 2018 Nicholas Corgan (n.corgan@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+#ifndef PKSAV_JOURNAL_H
+#define PKSAV_JOURNAL_H
+
+#include <pksav/config.h>
+#include <pksav/error.h>
+
+#include <pksav/gen1/save.h>
+#include <pksav/gen2/save.h>
+#include <pksav/gba/save.h>
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+//! How many bytes of history ::pksav_journal_init keeps when given 0.
+#define PKSAV_JOURNAL_DEFAULT_CAPACITY (64 * 1024)
+
+//! The most regions of memory a journal can track.
+#define PKSAV_JOURNAL_MAX_REGIONS 4
+
+#ifndef __DOXYGEN__
+typedef struct {
+    size_t data_pos;
+    uint32_t offset;
+    uint32_t len;
+    uint8_t region;
+} pksav_journal_entry_t;
+#endif
+
+/*!
+ * @brief A history of edits made to one or more regions of memory, usually a
+ *        loaded save.
+ *
+ * Edits are only recorded if they're made with ::pksav_journal_write. Each one
+ * stores the bytes it replaced and the bytes it wrote, so undoing or redoing an
+ * edit is a single copy no matter how long the history is. Once the history is
+ * full, the oldest edits are forgotten to make room.
+ *
+ * Edits that continue the last one, such as writing a name one character at a
+ * time, are merged into it until ::pksav_journal_checkpoint is called, so they're
+ * undone together.
+ *
+ * Set up a journal with ::pksav_journal_init, tell it what it's tracking with
+ * ::pksav_journal_add_region or one of the functions for a specific kind of save,
+ * and free it with ::pksav_journal_free. A journal must not be used by multiple
+ * threads at once.
+ */
+typedef struct {
+    // Do not edit these
+#ifndef __DOXYGEN__
+    uint8_t* region_bases[PKSAV_JOURNAL_MAX_REGIONS];
+    size_t region_sizes[PKSAV_JOURNAL_MAX_REGIONS];
+    size_t num_regions;
+
+    pksav_journal_entry_t* entries;
+    size_t entry_capacity;
+    uint8_t* data;
+    size_t data_capacity;
+    size_t data_end;
+
+    size_t first_entry;
+    size_t num_applied;
+    size_t num_entries;
+    bool merge_with_last;
+#endif
+} pksav_journal_t;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*!
+ * @brief Set up an empty journal.
+ *
+ * \param journal The journal to set up
+ * \param capacity How many bytes of history to keep, or 0 for ::PKSAV_JOURNAL_DEFAULT_CAPACITY.
+ *                 Each edit takes twice its length.
+ * \returns ::PKSAV_ERROR_NONE upon success
+ * \returns ::PKSAV_ERROR_NULL_POINTER if journal is NULL
+ */
+PKSAV_API pksav_error_t pksav_journal_init(
+    pksav_journal_t* journal,
+    size_t capacity
+);
+
+/*!
+ * @brief Start tracking edits to the given region of memory.
+ *
+ * Regions are numbered in the order they're added, and patches refer to them
+ * by number, so a patch can only be applied to a journal whose regions were
+ * added in the same order.
+ *
+ * \param journal The journal to add the region to
+ * \param base The start of the region
+ * \param size The size of the region, in bytes
+ * \returns ::PKSAV_ERROR_NONE upon success
+ * \returns ::PKSAV_ERROR_NULL_POINTER if journal or base is NULL
+ * \returns ::PKSAV_ERROR_PARAM_OUT_OF_RANGE if the journal already has
+ *          ::PKSAV_JOURNAL_MAX_REGIONS regions, or size is 0
+ */
+PKSAV_API pksav_error_t pksav_journal_add_region(
+    pksav_journal_t* journal,
+    void* base,
+    size_t size
+);
+
+/*!
+ * @brief Start tracking edits to a Generation I save.
+ *
+ * Everything pointed to by the save struct is tracked.
+ *
+ * \param journal The journal to add the save to
+ * \param gen1_save A loaded save
+ * \returns ::PKSAV_ERROR_NONE upon success
+ * \returns ::PKSAV_ERROR_NULL_POINTER if journal or gen1_save is NULL
+ * \returns ::PKSAV_ERROR_PARAM_OUT_OF_RANGE if the journal has no regions left
+ */
+PKSAV_API pksav_error_t pksav_journal_add_gen1_save(
+    pksav_journal_t* journal,
+    pksav_gen1_save_t* gen1_save
+);
+
+/*!
+ * @brief Start tracking edits to a Generation II save.
+ *
+ * Everything pointed to by the save struct is tracked.
+ *
+ * \param journal The journal to add the save to
+ * \param gen2_save A loaded save
+ * \returns ::PKSAV_ERROR_NONE upon success
+ * \returns ::PKSAV_ERROR_NULL_POINTER if journal or gen2_save is NULL
+ * \returns ::PKSAV_ERROR_PARAM_OUT_OF_RANGE if the journal has no regions left
+ */
+PKSAV_API pksav_error_t pksav_journal_add_gen2_save(
+    pksav_journal_t* journal,
+    pksav_gen2_save_t* gen2_save
+);
+
+/*!
+ * @brief Start tracking edits to a Game Boy Advance save.
+ *
+ * Everything pointed to by the save struct is tracked, as two regions. Saving
+ * doesn't change anything the journal tracks, so a save can be saved, edited,
+ * and undone any number of times.
+ *
+ * \param journal The journal to add the save to
+ * \param gba_save A loaded save
+ * \returns ::PKSAV_ERROR_NONE upon success
+ * \returns ::PKSAV_ERROR_NULL_POINTER if journal or gba_save is NULL
+ * \returns ::PKSAV_ERROR_PARAM_OUT_OF_RANGE if the journal doesn't have two regions left
+ */
+PKSAV_API pksav_error_t pksav_journal_add_gba_save(
+    pksav_journal_t* journal,
+    pksav_gba_save_t* gba_save
+);
+
+/*!
+ * @brief Copy the given bytes into a tracked region, recording the edit.
+ *
+ * Any edits that were undone can no longer be redone.
+ *
+ * \param journal The journal tracking the destination
+ * \param dest Where to write, which must be entirely within one region
+ * \param src The bytes to write
+ * \param len How many bytes to write
+ * \returns ::PKSAV_ERROR_NONE upon success
+ * \returns ::PKSAV_ERROR_NULL_POINTER if any pointer parameter is NULL
+ * \returns ::PKSAV_ERROR_PARAM_OUT_OF_RANGE if dest isn't in a region, or the edit
+ *          is too big to fit in the journal, in which case nothing is written
+ */
+PKSAV_API pksav_error_t pksav_journal_write(
+    pksav_journal_t* journal,
+    void* dest,
+    const void* src,
+    size_t len
+);
+
+/*!
+ * @brief Stop the next edit from being merged with the last one.
+ *
+ * \param journal The journal
+ * \returns ::PKSAV_ERROR_NONE upon success
+ * \returns ::PKSAV_ERROR_NULL_POINTER if journal is NULL
+ */
+PKSAV_API pksav_error_t pksav_journal_checkpoint(
+    pksav_journal_t* journal
+);
+
+/*!
+ * @brief Undo the most recent edit that hasn't been undone.
+ *
+ * \param journal The journal
+ * \returns ::PKSAV_ERROR_NONE upon success
+ * \returns ::PKSAV_ERROR_NULL_POINTER if journal is NULL
+ * \returns ::PKSAV_ERROR_PARAM_OUT_OF_RANGE if there is nothing to undo
+ */
+PKSAV_API pksav_error_t pksav_journal_undo(
+    pksav_journal_t* journal
+);
+
+/*!
+ * @brief Redo the most recently undone edit.
+ *
+ * \param journal The journal
+ * \returns ::PKSAV_ERROR_NONE upon success
+ * \returns ::PKSAV_ERROR_NULL_POINTER if journal is NULL
+ * \returns ::PKSAV_ERROR_PARAM_OUT_OF_RANGE if there is nothing to redo
+ */
+PKSAV_API pksav_error_t pksav_journal_redo(
+    pksav_journal_t* journal
+);
+
+/*!
+ * @brief Returns how many edits can be undone and redone.
+ *
+ * \param journal The journal
+ * \param num_undos_out Where to return how many edits can be undone
+ * \param num_redos_out Where to return how many edits can be redone
+ * \returns ::PKSAV_ERROR_NONE upon success
+ * \returns ::PKSAV_ERROR_NULL_POINTER if any parameter is NULL
+ */
+PKSAV_API pksav_error_t pksav_journal_get_depth(
+    const pksav_journal_t* journal,
+    size_t* num_undos_out,
+    size_t* num_redos_out
+);
+
+/*!
+ * @brief Returns how big the patch written by ::pksav_journal_export_patch will be.
+ *
+ * \param journal The journal
+ * \param patch_size_out Where to return the size, in bytes
+ * \returns ::PKSAV_ERROR_NONE upon success
+ * \returns ::PKSAV_ERROR_NULL_POINTER if either parameter is NULL
+ */
+PKSAV_API pksav_error_t pksav_journal_get_patch_size(
+    const pksav_journal_t* journal,
+    size_t* patch_size_out
+);
+
+/*!
+ * @brief Write every edit that hasn't been undone as a patch.
+ *
+ * The patch holds the bytes each edit replaced as well as what it wrote, so
+ * ::pksav_journal_apply_patch can check it's being applied to the same data.
+ * Edits that the journal has already forgotten aren't included.
+ *
+ * \param journal The journal
+ * \param buffer Where to write the patch
+ * \param buffer_len The size of buffer, which must be at least the size given by
+ *                   ::pksav_journal_get_patch_size
+ * \returns ::PKSAV_ERROR_NONE upon success
+ * \returns ::PKSAV_ERROR_NULL_POINTER if journal or buffer is NULL
+ * \returns ::PKSAV_ERROR_PARAM_OUT_OF_RANGE if buffer is too small
+ */
+PKSAV_API pksav_error_t pksav_journal_export_patch(
+    const pksav_journal_t* journal,
+    uint8_t* buffer,
+    size_t buffer_len
+);
+
+/*!
+ * @brief Replay a patch from ::pksav_journal_export_patch through the given journal.
+ *
+ * This is usually used on another copy of the save the patch was made from,
+ * tracked with its regions added in the same order. Each edit in the patch is
+ * recorded as its own edit, so they can be undone.
+ *
+ * Nothing is written unless every edit applies cleanly.
+ *
+ * \param journal The journal to replay the patch through
+ * \param patch The patch
+ * \param patch_len The size of the patch
+ * \returns ::PKSAV_ERROR_NONE upon success
+ * \returns ::PKSAV_ERROR_NULL_POINTER if journal or patch is NULL
+ * \returns ::PKSAV_ERROR_PARAM_OUT_OF_RANGE if the patch is malformed or refers to
+ *          memory outside the journal's regions
+ * \returns ::PKSAV_ERROR_INVALID_SAVE if the bytes the patch replaces don't match
+ */
+PKSAV_API pksav_error_t pksav_journal_apply_patch(
+    pksav_journal_t* journal,
+    const uint8_t* patch,
+    size_t patch_len
+);
+
+/*!
+ * @brief Frees memory allocated by ::pksav_journal_init.
+ *
+ * The tracked regions aren't affected.
+ *
+ * \param journal The journal to free
+ * \returns ::PKSAV_ERROR_NONE upon success
+ * \returns ::PKSAV_ERROR_NULL_POINTER if journal is NULL
+ */
+PKSAV_API pksav_error_t pksav_journal_free(
+    pksav_journal_t* journal
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PKSAV_JOURNAL_H */
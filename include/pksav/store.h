@@ -0,0 +1,193 @@
+/*!
+ * @file    pksav/store.h
+ * @ingroup PKSav
+ * @brief   Storing many saves with each distinct section or bank only stored once.
+ *
+ * Copyright (c) 2018 Nicholas Corgan (n.corgan@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+#ifndef PKSAV_STORE_H
+#define PKSAV_STORE_H
+
+#include <pksav/config.h>
+#include <pksav/error.h>
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#ifndef __DOXYGEN__
+typedef struct {
+    uint64_t hash;
+    uint8_t* data;
+    uint32_t len;
+    uint32_t next;
+} pksav_store_chunk_t;
+#endif
+
+/*!
+ * @brief A collection of chunks of save data, each stored once no matter how
+ *        many saves contain it.
+ *
+ * Saves are split into chunks along the boundaries they're made of. Saves
+ * smaller than 64 KB are Game Boy saves, and are split into their 8 KB SRAM
+ * banks. Anything bigger is split into the 4 KB sectors Game Boy Advance saves
+ * are made of, with each sector's 12-byte footer as its own chunk. Footers hold
+ * a counter that changes with every save, so this lets the rest of the sector
+ * be shared between both slots of a save and between consecutive saves.
+ *
+ * Chunks are found by a 64-bit hash of their contents and compared in full, so
+ * hash collisions never mix up chunks.
+ *
+ * Set up a store with ::pksav_store_init, and free it with ::pksav_store_free.
+ * A store must not be used by multiple threads at once.
+ */
+typedef struct {
+    // Do not edit these
+#ifndef __DOXYGEN__
+    pksav_store_chunk_t* chunks;
+    size_t num_chunks;
+    size_t chunk_capacity;
+    size_t num_bytes;
+
+    uint32_t* buckets;
+    size_t num_buckets;
+#endif
+} pksav_store_t;
+
+/*!
+ * @brief Which chunks a save is made of.
+ *
+ * The chunk IDs only refer to chunks in the store the save was added to.
+ * Free a manifest with ::pksav_store_manifest_free.
+ */
+typedef struct {
+    //! The size of the save, in bytes.
+    size_t save_len;
+    //! How many chunks the save is made of.
+    size_t num_chunks;
+    //! The ID of each chunk, in order.
+    uint32_t* chunk_ids;
+} pksav_store_manifest_t;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*!
+ * @brief Set up an empty store.
+ *
+ * \param store The store to set up
+ * \returns ::PKSAV_ERROR_NONE upon success
+ * \returns ::PKSAV_ERROR_NULL_POINTER if store is NULL
+ */
+PKSAV_API pksav_error_t pksav_store_init(
+    pksav_store_t* store
+);
+
+/*!
+ * @brief Split a save into chunks, adding any the store doesn't have yet.
+ *
+ * The save isn't validated, so any file can be stored.
+ *
+ * \param store The store to add the save to
+ * \param buffer The save
+ * \param buffer_len The size of the save
+ * \param manifest_out Where to return which chunks the save is made of
+ * \returns ::PKSAV_ERROR_NONE upon success
+ * \returns ::PKSAV_ERROR_NULL_POINTER if any pointer parameter is NULL
+ * \returns ::PKSAV_ERROR_PARAM_OUT_OF_RANGE if buffer_len is 0, or the store can't hold
+ *          any more chunks
+ */
+PKSAV_API pksav_error_t pksav_store_add_save(
+    pksav_store_t* store,
+    const uint8_t* buffer,
+    size_t buffer_len,
+    pksav_store_manifest_t* manifest_out
+);
+
+/*!
+ * @brief Put a save back together from its chunks.
+ *
+ * \param store The store the save was added to
+ * \param manifest The save's manifest
+ * \param buffer Where to write the save
+ * \param buffer_len The size of buffer, which must be at least manifest->save_len
+ * \returns ::PKSAV_ERROR_NONE upon success
+ * \returns ::PKSAV_ERROR_NULL_POINTER if any pointer parameter is NULL
+ * \returns ::PKSAV_ERROR_PARAM_OUT_OF_RANGE if buffer is too small, or the manifest
+ *          doesn't match the store
+ */
+PKSAV_API pksav_error_t pksav_store_rebuild_save(
+    const pksav_store_t* store,
+    const pksav_store_manifest_t* manifest,
+    uint8_t* buffer,
+    size_t buffer_len
+);
+
+/*!
+ * @brief Returns the contents of one chunk, for writing the store elsewhere.
+ *
+ * Chunk IDs start at 0 and are given out in the order chunks are added.
+ *
+ * \param store The store
+ * \param chunk_id Which chunk to return
+ * \param chunk_out Where to return a pointer to the chunk's contents, which stays
+ *                  valid until the store is freed
+ * \param chunk_len_out Where to return the size of the chunk
+ * \param hash_out Where to return the chunk's hash
+ * \returns ::PKSAV_ERROR_NONE upon success
+ * \returns ::PKSAV_ERROR_NULL_POINTER if any pointer parameter is NULL
+ * \returns ::PKSAV_ERROR_PARAM_OUT_OF_RANGE if there is no such chunk
+ */
+PKSAV_API pksav_error_t pksav_store_get_chunk(
+    const pksav_store_t* store,
+    uint32_t chunk_id,
+    const uint8_t** chunk_out,
+    size_t* chunk_len_out,
+    uint64_t* hash_out
+);
+
+/*!
+ * @brief Returns how many distinct chunks the store holds, and their total size.
+ *
+ * \param store The store
+ * \param num_chunks_out Where to return how many chunks there are
+ * \param num_bytes_out Where to return their total size, in bytes
+ * \returns ::PKSAV_ERROR_NONE upon success
+ * \returns ::PKSAV_ERROR_NULL_POINTER if any parameter is NULL
+ */
+PKSAV_API pksav_error_t pksav_store_get_stats(
+    const pksav_store_t* store,
+    size_t* num_chunks_out,
+    size_t* num_bytes_out
+);
+
+/*!
+ * @brief Frees memory allocated by ::pksav_store_add_save for a manifest.
+ *
+ * \param manifest The manifest to free
+ * \returns ::PKSAV_ERROR_NONE upon success
+ * \returns ::PKSAV_ERROR_NULL_POINTER if manifest is NULL
+ */
+PKSAV_API pksav_error_t pksav_store_manifest_free(
+    pksav_store_manifest_t* manifest
+);
+
+/*!
+ * @brief Frees memory allocated by the store, including every chunk.
+ *
+ * \param store The store to free
+ * \returns ::PKSAV_ERROR_NONE upon success
+ * \returns ::PKSAV_ERROR_NULL_POINTER if store is NULL
+ */
+PKSAV_API pksav_error_t pksav_store_free(
+    pksav_store_t* store
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PKSAV_STORE_H */
@@ -0,0 +1,420 @@
+/*
+ * Copyright (c) 2018 Nicholas Corgan (n.corgan@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "common/allocator.h"
+#include "common/thread.h"
+
+#include <pksav/batch.h>
+
+#include <stdio.h>
+#include <string.h>
+
+#define PKSAV_BATCH_ARENA_ALIGNMENT 16
+
+/*
+ * A bump allocator reset after each input, so loading a save doesn't touch
+ * the global heap. Allocations that don't fit fall back to calloc.
+ */
+typedef struct {
+    uint8_t* memory;
+    size_t size;
+    size_t used;
+} pksav_batch_arena_t;
+
+// The contiguous range of inputs a worker has left to process.
+typedef struct {
+    pksav_mutex_t mutex;
+    size_t begin;
+    size_t end;
+} pksav_batch_queue_t;
+
+typedef struct {
+    const pksav_batch_input_t* inputs;
+    const pksav_batch_options_t* options;
+    pksav_batch_queue_t* queues;
+    size_t num_workers;
+    volatile uint32_t num_failures;
+} pksav_batch_context_t;
+
+typedef struct {
+    pksav_batch_context_t* context;
+    size_t index;
+    pksav_batch_arena_t arena;
+    uint8_t* file_buffer;
+    size_t file_buffer_size;
+} pksav_batch_worker_t;
+
+static void* _pksav_batch_arena_calloc(
+    size_t num,
+    size_t size,
+    void* user_data
+) {
+    pksav_batch_arena_t* arena = (pksav_batch_arena_t*)user_data;
+    size_t num_bytes = num * size;
+    size_t aligned_size = (num_bytes + (PKSAV_BATCH_ARENA_ALIGNMENT-1))
+                        & ~((size_t)PKSAV_BATCH_ARENA_ALIGNMENT-1);
+
+    if(aligned_size > (arena->size - arena->used)) {
+        return calloc(num, size);
+    }
+
+    void* ptr = arena->memory + arena->used;
+    arena->used += aligned_size;
+    memset(ptr, 0, num_bytes);
+
+    return ptr;
+}
+
+static void _pksav_batch_arena_free(
+    void* ptr,
+    void* user_data
+) {
+    pksav_batch_arena_t* arena = (pksav_batch_arena_t*)user_data;
+    uint8_t* byte_ptr = (uint8_t*)ptr;
+
+    // Arena memory is reclaimed all at once when the arena is reset.
+    if((byte_ptr < arena->memory) || (byte_ptr >= (arena->memory + arena->size))) {
+        free(ptr);
+    }
+}
+
+static bool _pksav_batch_pop(
+    pksav_batch_queue_t* queue,
+    size_t* index_out
+) {
+    bool popped = false;
+
+    _pksav_mutex_lock(&queue->mutex);
+    if(queue->begin < queue->end) {
+        *index_out = queue->begin++;
+        popped = true;
+    }
+    _pksav_mutex_unlock(&queue->mutex);
+
+    return popped;
+}
+
+// Moves the back half of another worker's remaining inputs into this worker's queue.
+static bool _pksav_batch_steal(
+    pksav_batch_worker_t* worker
+) {
+    pksav_batch_context_t* context = worker->context;
+
+    for(size_t i = 1; i < context->num_workers; ++i) {
+        pksav_batch_queue_t* victim = &context->queues[(worker->index + i) % context->num_workers];
+
+        _pksav_mutex_lock(&victim->mutex);
+        size_t num_remaining = victim->end - victim->begin;
+        size_t num_stolen = (num_remaining + 1) / 2;
+        size_t stolen_begin = victim->end - num_stolen;
+        victim->end = stolen_begin;
+        _pksav_mutex_unlock(&victim->mutex);
+
+        if(num_stolen > 0) {
+            pksav_batch_queue_t* queue = &context->queues[worker->index];
+
+            _pksav_mutex_lock(&queue->mutex);
+            queue->begin = stolen_begin;
+            queue->end = stolen_begin + num_stolen;
+            _pksav_mutex_unlock(&queue->mutex);
+
+            return true;
+        }
+    }
+
+    return false;
+}
+
+static pksav_error_t _pksav_batch_read_file(
+    pksav_batch_worker_t* worker,
+    const char* filepath,
+    size_t* num_read_out
+) {
+    FILE* file = fopen(filepath, "rb");
+    if(!file) {
+        return PKSAV_ERROR_FILE_IO;
+    }
+
+    fseek(file, 0, SEEK_END);
+    long filesize = ftell(file);
+    if(filesize < 0) {
+        fclose(file);
+        return PKSAV_ERROR_FILE_IO;
+    }
+
+    // Reused between inputs, so it only grows to fit the largest save.
+    if((size_t)filesize > worker->file_buffer_size) {
+        free(worker->file_buffer);
+        worker->file_buffer = malloc((size_t)filesize);
+        worker->file_buffer_size = worker->file_buffer ? (size_t)filesize : 0;
+        if(!worker->file_buffer) {
+            fclose(file);
+            return PKSAV_ERROR_FILE_IO;
+        }
+    }
+
+    fseek(file, 0, SEEK_SET);
+    size_t num_read = fread(worker->file_buffer, 1, (size_t)filesize, file);
+    fclose(file);
+    if(num_read != (size_t)filesize) {
+        return PKSAV_ERROR_FILE_IO;
+    }
+
+    *num_read_out = num_read;
+    return PKSAV_ERROR_NONE;
+}
+
+/*
+ * The formats with the strongest validation are tried first, since a weaker
+ * checksum (such as Generation I's single byte) can match data from another
+ * generation by chance.
+ */
+static pksav_error_t _pksav_batch_load(
+    const uint8_t* buffer,
+    size_t buffer_len,
+    pksav_batch_item_t* item
+) {
+    static const pksav_batch_save_type_t save_types[] = {
+        PKSAV_BATCH_SAVE_TYPE_GEN5,
+        PKSAV_BATCH_SAVE_TYPE_GEN4,
+        PKSAV_BATCH_SAVE_TYPE_GBA,
+        PKSAV_BATCH_SAVE_TYPE_GEN2,
+        PKSAV_BATCH_SAVE_TYPE_GEN1
+    };
+
+    pksav_error_t error = PKSAV_ERROR_INVALID_SAVE;
+    for(size_t i = 0; (i < (sizeof(save_types)/sizeof(save_types[0]))) && (error == PKSAV_ERROR_INVALID_SAVE); ++i) {
+        switch(save_types[i]) {
+            case PKSAV_BATCH_SAVE_TYPE_GEN1:
+                error = pksav_gen1_save_load_buffer(buffer, buffer_len, &item->save.gen1);
+                break;
+
+            case PKSAV_BATCH_SAVE_TYPE_GEN2:
+                error = pksav_gen2_save_load_buffer(buffer, buffer_len, &item->save.gen2);
+                break;
+
+            case PKSAV_BATCH_SAVE_TYPE_GBA:
+                error = pksav_gba_save_load_buffer(buffer, buffer_len, &item->save.gba);
+                break;
+
+            case PKSAV_BATCH_SAVE_TYPE_GEN4:
+                error = pksav_gen4_save_load_buffer(buffer, buffer_len, &item->save.gen4);
+                break;
+
+            case PKSAV_BATCH_SAVE_TYPE_GEN5:
+                error = pksav_gen5_save_load_buffer(buffer, buffer_len, &item->save.gen5);
+                break;
+
+            default:
+                break;
+        }
+
+        if(!error) {
+            item->save_type = save_types[i];
+        }
+    }
+
+    return error;
+}
+
+static pksav_error_t _pksav_batch_save(
+    pksav_batch_item_t* item,
+    const char* filepath
+) {
+    switch(item->save_type) {
+        case PKSAV_BATCH_SAVE_TYPE_GEN1:
+            return pksav_gen1_save_save(filepath, &item->save.gen1);
+
+        case PKSAV_BATCH_SAVE_TYPE_GEN2:
+            return pksav_gen2_save_save(filepath, &item->save.gen2);
+
+        case PKSAV_BATCH_SAVE_TYPE_GBA:
+            return pksav_gba_save_save(filepath, &item->save.gba);
+
+        case PKSAV_BATCH_SAVE_TYPE_GEN4:
+            return pksav_gen4_save_save(filepath, &item->save.gen4);
+
+        case PKSAV_BATCH_SAVE_TYPE_GEN5:
+            return pksav_gen5_save_save(filepath, &item->save.gen5);
+
+        default:
+            return PKSAV_ERROR_INVALID_SAVE;
+    }
+}
+
+static void _pksav_batch_free(
+    pksav_batch_item_t* item
+) {
+    switch(item->save_type) {
+        case PKSAV_BATCH_SAVE_TYPE_GEN1:
+            pksav_gen1_save_free(&item->save.gen1);
+            break;
+
+        case PKSAV_BATCH_SAVE_TYPE_GEN2:
+            pksav_gen2_save_free(&item->save.gen2);
+            break;
+
+        case PKSAV_BATCH_SAVE_TYPE_GBA:
+            pksav_gba_save_free(&item->save.gba);
+            break;
+
+        case PKSAV_BATCH_SAVE_TYPE_GEN4:
+            pksav_gen4_save_free(&item->save.gen4);
+            break;
+
+        case PKSAV_BATCH_SAVE_TYPE_GEN5:
+            pksav_gen5_save_free(&item->save.gen5);
+            break;
+
+        default:
+            break;
+    }
+}
+
+static void _pksav_batch_process_input(
+    pksav_batch_worker_t* worker,
+    size_t index
+) {
+    pksav_batch_context_t* context = worker->context;
+    const pksav_batch_options_t* options = context->options;
+    const pksav_batch_input_t* input = &context->inputs[index];
+
+    pksav_batch_item_t item;
+    memset(&item, 0, sizeof(item));
+    item.index = index;
+    item.input = input;
+    item.worker = worker->index;
+
+    const uint8_t* buffer = input->buffer;
+    size_t buffer_len = input->buffer_len;
+    pksav_error_t error = PKSAV_ERROR_NONE;
+
+    if(input->filepath) {
+        error = _pksav_batch_read_file(worker, input->filepath, &buffer_len);
+        buffer = worker->file_buffer;
+    } else if(!buffer) {
+        error = PKSAV_ERROR_NULL_POINTER;
+    }
+
+    if(!error) {
+        error = _pksav_batch_load(buffer, buffer_len, &item);
+    }
+    if(!error && options->transform_fcn) {
+        error = options->transform_fcn(&item, options->user_data);
+    }
+    if(!error && input->output_filepath) {
+        error = _pksav_batch_save(&item, input->output_filepath);
+    }
+
+    item.error = error;
+    if(options->result_fcn) {
+        options->result_fcn(&item, options->user_data);
+    }
+
+    _pksav_batch_free(&item);
+    worker->arena.used = 0;
+
+    if(error) {
+        (void)_pksav_atomic_increment(&context->num_failures);
+    }
+}
+
+static void _pksav_batch_worker_run(
+    void* arg
+) {
+    pksav_batch_worker_t* worker = (pksav_batch_worker_t*)arg;
+    pksav_batch_queue_t* queue = &worker->context->queues[worker->index];
+
+    // The calling thread is also a worker, so put back whatever it was using.
+    pksav_allocator_t previous_allocator;
+    bool had_allocator = _pksav_get_thread_allocator(&previous_allocator);
+
+    pksav_allocator_t allocator = {
+        _pksav_batch_arena_calloc,
+        _pksav_batch_arena_free,
+        &worker->arena
+    };
+    pksav_set_thread_allocator(&allocator);
+
+    size_t index = 0;
+    while(_pksav_batch_pop(queue, &index) ||
+          (_pksav_batch_steal(worker) && _pksav_batch_pop(queue, &index))) {
+        _pksav_batch_process_input(worker, index);
+    }
+
+    pksav_set_thread_allocator(had_allocator ? &previous_allocator : NULL);
+}
+
+pksav_error_t pksav_batch_process(
+    const pksav_batch_input_t* inputs,
+    size_t num_inputs,
+    const pksav_batch_options_t* options,
+    size_t* num_failures_out
+) {
+    if(!inputs || !options) {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+
+    size_t num_workers = options->num_threads ? options->num_threads : _pksav_num_cpus();
+    if(num_workers > num_inputs) {
+        num_workers = num_inputs;
+    }
+    if(num_workers == 0) {
+        num_workers = 1;
+    }
+    size_t arena_size = options->arena_size ? options->arena_size : PKSAV_BATCH_DEFAULT_ARENA_SIZE;
+
+    pksav_batch_context_t context;
+    context.inputs = inputs;
+    context.options = options;
+    context.queues = calloc(num_workers, sizeof(pksav_batch_queue_t));
+    context.num_workers = num_workers;
+    context.num_failures = 0;
+
+    pksav_batch_worker_t* workers = calloc(num_workers, sizeof(pksav_batch_worker_t));
+    pksav_thread_t* threads = calloc(num_workers, sizeof(pksav_thread_t));
+    bool* thread_started = calloc(num_workers, sizeof(bool));
+
+    // Start with an even split, and let work stealing even out the rest.
+    for(size_t i = 0; i < num_workers; ++i) {
+        _pksav_mutex_init(&context.queues[i].mutex);
+        context.queues[i].begin = (i * num_inputs) / num_workers;
+        context.queues[i].end = ((i + 1) * num_inputs) / num_workers;
+
+        workers[i].context = &context;
+        workers[i].index = i;
+        workers[i].arena.memory = malloc(arena_size);
+        workers[i].arena.size = workers[i].arena.memory ? arena_size : 0;
+    }
+
+    // If a thread can't be started, the other workers steal its inputs.
+    for(size_t i = 1; i < num_workers; ++i) {
+        thread_started[i] = _pksav_thread_create(&threads[i], _pksav_batch_worker_run, &workers[i]);
+    }
+    _pksav_batch_worker_run(&workers[0]);
+    for(size_t i = 1; i < num_workers; ++i) {
+        if(thread_started[i]) {
+            _pksav_thread_join(threads[i]);
+        }
+    }
+
+    for(size_t i = 0; i < num_workers; ++i) {
+        _pksav_mutex_destroy(&context.queues[i].mutex);
+        free(workers[i].arena.memory);
+        free(workers[i].file_buffer);
+    }
+    free(thread_started);
+    free(threads);
+    free(workers);
+    free(context.queues);
+
+    if(num_failures_out) {
+        *num_failures_out = context.num_failures;
+    }
+
+    return PKSAV_ERROR_NONE;
+}
@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) 2018 Nicholas Corgan (n.corgan@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "allocator.h"
+#include "thread.h"
+
+static PKSAV_THREAD_LOCAL bool _pksav_use_thread_allocator = false;
+static PKSAV_THREAD_LOCAL pksav_allocator_t _pksav_thread_allocator;
+
+void pksav_set_thread_allocator(
+    const pksav_allocator_t* allocator
+) {
+    if(allocator) {
+        _pksav_thread_allocator = *allocator;
+        _pksav_use_thread_allocator = true;
+    } else {
+        _pksav_use_thread_allocator = false;
+    }
+}
+
+bool _pksav_get_thread_allocator(
+    pksav_allocator_t* allocator_out
+) {
+    if(_pksav_use_thread_allocator) {
+        *allocator_out = _pksav_thread_allocator;
+    }
+
+    return _pksav_use_thread_allocator;
+}
+
+void* _pksav_calloc(
+    size_t num,
+    size_t size
+) {
+    if(_pksav_use_thread_allocator) {
+        return _pksav_thread_allocator.calloc_fcn(
+                   num,
+                   size,
+                   _pksav_thread_allocator.user_data
+               );
+    }
+
+    return calloc(num, size);
+}
+
+void _pksav_free(
+    void* ptr
+) {
+    if(_pksav_use_thread_allocator) {
+        _pksav_thread_allocator.free_fcn(ptr, _pksav_thread_allocator.user_data);
+    } else {
+        free(ptr);
+    }
+}
@@ -0,0 +1,35 @@
+/*
+ * Copyright (c) 2018 Nicholas Corgan (n.corgan@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+#ifndef PKSAV_COMMON_ALLOCATOR_INTERNAL_H
+#define PKSAV_COMMON_ALLOCATOR_INTERNAL_H
+
+#include <pksav/config.h>
+
+#include <pksav/common/allocator.h>
+
+#include <stdbool.h>
+#include <stdlib.h>
+
+/*
+ * Copies the calling thread's allocator into allocator_out. Returns false if
+ * the thread is using calloc and free.
+ */
+bool _pksav_get_thread_allocator(
+    pksav_allocator_t* allocator_out
+);
+
+// calloc and free, through the calling thread's allocator.
+void* _pksav_calloc(
+    size_t num,
+    size_t size
+);
+
+void _pksav_free(
+    void* ptr
+);
+
+#endif /* PKSAV_COMMON_ALLOCATOR_INTERNAL_H */
@@ -0,0 +1,688 @@
+/*
+ * Copyright (c) 2018 Nicholas Corgan (n.corgan@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include <pksav/common/base_stats.h>
+
+#define PKSAV_NUM_NATIONAL_SPECIES 386
+#define PKSAV_NUM_GEN1_SPECIES     151
+
+#define PKSAV_GEN1_MAX_SPECIES_INDEX 190
+
+#define PKSAV_GBA_FIRST_HOENN_INDEX 277
+#define PKSAV_GBA_LAST_HOENN_INDEX  411
+
+/*
+ * Generation III base stats, by National Pokédex number, in the order HP,
+ * Attack, Defense, Speed, Special Attack, Special Defense. Generation II
+ * values are identical for the first 251.
+ */
+static const uint8_t PKSAV_BASE_STATS[PKSAV_NUM_NATIONAL_SPECIES][6] = {
+    { 45,  49,  49,  45,  65,  65}, // 1
+    { 60,  62,  63,  60,  80,  80}, // 2
+    { 80,  82,  83,  80, 100, 100}, // 3
+    { 39,  52,  43,  65,  60,  50}, // 4
+    { 58,  64,  58,  80,  80,  65}, // 5
+    { 78,  84,  78, 100, 109,  85}, // 6
+    { 44,  48,  65,  43,  50,  64}, // 7
+    { 59,  63,  80,  58,  65,  80}, // 8
+    { 79,  83, 100,  78,  85, 105}, // 9
+    { 45,  30,  35,  45,  20,  20}, // 10
+    { 50,  20,  55,  30,  25,  25}, // 11
+    { 60,  45,  50,  70,  80,  80}, // 12
+    { 40,  35,  30,  50,  20,  20}, // 13
+    { 45,  25,  50,  35,  25,  25}, // 14
+    { 65,  80,  40,  75,  45,  80}, // 15
+    { 40,  45,  40,  56,  35,  35}, // 16
+    { 63,  60,  55,  71,  50,  50}, // 17
+    { 83,  80,  75,  91,  70,  70}, // 18
+    { 30,  56,  35,  72,  25,  35}, // 19
+    { 55,  81,  60,  97,  50,  70}, // 20
+    { 40,  60,  30,  70,  31,  31}, // 21
+    { 65,  90,  65, 100,  61,  61}, // 22
+    { 35,  60,  44,  55,  40,  54}, // 23
+    { 60,  85,  69,  80,  65,  79}, // 24
+    { 35,  55,  30,  90,  50,  40}, // 25
+    { 60,  90,  55, 100,  90,  80}, // 26
+    { 50,  75,  85,  40,  20,  30}, // 27
+    { 75, 100, 110,  65,  45,  55}, // 28
+    { 55,  47,  52,  41,  40,  40}, // 29
+    { 70,  62,  67,  56,  55,  55}, // 30
+    { 90,  82,  87,  76,  75,  85}, // 31
+    { 46,  57,  40,  50,  40,  40}, // 32
+    { 61,  72,  57,  65,  55,  55}, // 33
+    { 81,  92,  77,  85,  85,  75}, // 34
+    { 70,  45,  48,  35,  60,  65}, // 35
+    { 95,  70,  73,  60,  85,  90}, // 36
+    { 38,  41,  40,  65,  50,  65}, // 37
+    { 73,  76,  75, 100,  81, 100}, // 38
+    {115,  45,  20,  20,  45,  25}, // 39
+    {140,  70,  45,  45,  75,  50}, // 40
+    { 40,  45,  35,  55,  30,  40}, // 41
+    { 75,  80,  70,  90,  65,  75}, // 42
+    { 45,  50,  55,  30,  75,  65}, // 43
+    { 60,  65,  70,  40,  85,  75}, // 44
+    { 75,  80,  85,  50, 100,  90}, // 45
+    { 35,  70,  55,  25,  45,  55}, // 46
+    { 60,  95,  80,  30,  60,  80}, // 47
+    { 60,  55,  50,  45,  40,  55}, // 48
+    { 70,  65,  60,  90,  90,  75}, // 49
+    { 10,  55,  25,  95,  35,  45}, // 50
+    { 35,  80,  50, 120,  50,  70}, // 51
+    { 40,  45,  35,  90,  40,  40}, // 52
+    { 65,  70,  60, 115,  65,  65}, // 53
+    { 50,  52,  48,  55,  65,  50}, // 54
+    { 80,  82,  78,  85,  95,  80}, // 55
+    { 40,  80,  35,  70,  35,  45}, // 56
+    { 65, 105,  60,  95,  60,  70}, // 57
+    { 55,  70,  45,  60,  70,  50}, // 58
+    { 90, 110,  80,  95, 100,  80}, // 59
+    { 40,  50,  40,  90,  40,  40}, // 60
+    { 65,  65,  65,  90,  50,  50}, // 61
+    { 90,  85,  95,  70,  70,  90}, // 62
+    { 25,  20,  15,  90, 105,  55}, // 63
+    { 40,  35,  30, 105, 120,  70}, // 64
+    { 55,  50,  45, 120, 135,  85}, // 65
+    { 70,  80,  50,  35,  35,  35}, // 66
+    { 80, 100,  70,  45,  50,  60}, // 67
+    { 90, 130,  80,  55,  65,  85}, // 68
+    { 50,  75,  35,  40,  70,  30}, // 69
+    { 65,  90,  50,  55,  85,  45}, // 70
+    { 80, 105,  65,  70, 100,  60}, // 71
+    { 40,  40,  35,  70,  50, 100}, // 72
+    { 80,  70,  65, 100,  80, 120}, // 73
+    { 40,  80, 100,  20,  30,  30}, // 74
+    { 55,  95, 115,  35,  45,  45}, // 75
+    { 80, 110, 130,  45,  55,  65}, // 76
+    { 50,  85,  55,  90,  65,  65}, // 77
+    { 65, 100,  70, 105,  80,  80}, // 78
+    { 90,  65,  65,  15,  40,  40}, // 79
+    { 95,  75, 110,  30, 100,  80}, // 80
+    { 25,  35,  70,  45,  95,  55}, // 81
+    { 50,  60,  95,  70, 120,  70}, // 82
+    { 52,  65,  55,  60,  58,  62}, // 83
+    { 35,  85,  45,  75,  35,  35}, // 84
+    { 60, 110,  70, 100,  60,  60}, // 85
+    { 65,  45,  55,  45,  45,  70}, // 86
+    { 90,  70,  80,  70,  70,  95}, // 87
+    { 80,  80,  50,  25,  40,  50}, // 88
+    {105, 105,  75,  50,  65, 100}, // 89
+    { 30,  65, 100,  40,  45,  25}, // 90
+    { 50,  95, 180,  70,  85,  45}, // 91
+    { 30,  35,  30,  80, 100,  35}, // 92
+    { 45,  50,  45,  95, 115,  55}, // 93
+    { 60,  65,  60, 110, 130,  75}, // 94
+    { 35,  45, 160,  70,  30,  45}, // 95
+    { 60,  48,  45,  42,  43,  90}, // 96
+    { 85,  73,  70,  67,  73, 115}, // 97
+    { 30, 105,  90,  50,  25,  25}, // 98
+    { 55, 130, 115,  75,  50,  50}, // 99
+    { 40,  30,  50, 100,  55,  55}, // 100
+    { 60,  50,  70, 140,  80,  80}, // 101
+    { 60,  40,  80,  40,  60,  45}, // 102
+    { 95,  95,  85,  55, 125,  65}, // 103
+    { 50,  50,  95,  35,  40,  50}, // 104
+    { 60,  80, 110,  45,  50,  80}, // 105
+    { 50, 120,  53,  87,  35, 110}, // 106
+    { 50, 105,  79,  76,  35, 110}, // 107
+    { 90,  55,  75,  30,  60,  75}, // 108
+    { 40,  65,  95,  35,  60,  45}, // 109
+    { 65,  90, 120,  60,  85,  70}, // 110
+    { 80,  85,  95,  25,  30,  30}, // 111
+    {105, 130, 120,  40,  45,  45}, // 112
+    {250,   5,   5,  50,  35, 105}, // 113
+    { 65,  55, 115,  60, 100,  40}, // 114
+    {105,  95,  80,  90,  40,  80}, // 115
+    { 30,  40,  70,  60,  70,  25}, // 116
+    { 55,  65,  95,  85,  95,  45}, // 117
+    { 45,  67,  60,  63,  35,  50}, // 118
+    { 80,  92,  65,  68,  65,  80}, // 119
+    { 30,  45,  55,  85,  70,  55}, // 120
+    { 60,  75,  85, 115, 100,  85}, // 121
+    { 40,  45,  65,  90, 100, 120}, // 122
+    { 70, 110,  80, 105,  55,  80}, // 123
+    { 65,  50,  35,  95, 115,  95}, // 124
+    { 65,  83,  57, 105,  95,  85}, // 125
+    { 65,  95,  57,  93, 100,  85}, // 126
+    { 65, 125, 100,  85,  55,  70}, // 127
+    { 75, 100,  95, 110,  40,  70}, // 128
+    { 20,  10,  55,  80,  15,  20}, // 129
+    { 95, 125,  79,  81,  60, 100}, // 130
+    {130,  85,  80,  60,  85,  95}, // 131
+    { 48,  48,  48,  48,  48,  48}, // 132
+    { 55,  55,  50,  55,  45,  65}, // 133
+    {130,  65,  60,  65, 110,  95}, // 134
+    { 65,  65,  60, 130, 110,  95}, // 135
+    { 65, 130,  60,  65,  95, 110}, // 136
+    { 65,  60,  70,  40,  85,  75}, // 137
+    { 35,  40, 100,  35,  90,  55}, // 138
+    { 70,  60, 125,  55, 115,  70}, // 139
+    { 30,  80,  90,  55,  55,  45}, // 140
+    { 60, 115, 105,  80,  65,  70}, // 141
+    { 80, 105,  65, 130,  60,  75}, // 142
+    {160, 110,  65,  30,  65, 110}, // 143
+    { 90,  85, 100,  85,  95, 125}, // 144
+    { 90,  90,  85, 100, 125,  90}, // 145
+    { 90, 100,  90,  90, 125,  85}, // 146
+    { 41,  64,  45,  50,  50,  50}, // 147
+    { 61,  84,  65,  70,  70,  70}, // 148
+    { 91, 134,  95,  80, 100, 100}, // 149
+    {106, 110,  90, 130, 154,  90}, // 150
+    {100, 100, 100, 100, 100, 100}, // 151
+    { 45,  49,  65,  45,  49,  65}, // 152
+    { 60,  62,  80,  60,  63,  80}, // 153
+    { 80,  82, 100,  80,  83, 100}, // 154
+    { 39,  52,  43,  65,  60,  50}, // 155
+    { 58,  64,  58,  80,  80,  65}, // 156
+    { 78,  84,  78, 100, 109,  85}, // 157
+    { 50,  65,  64,  43,  44,  48}, // 158
+    { 65,  80,  80,  58,  59,  63}, // 159
+    { 85, 105, 100,  78,  79,  83}, // 160
+    { 35,  46,  34,  20,  35,  45}, // 161
+    { 85,  76,  64,  90,  45,  55}, // 162
+    { 60,  30,  30,  50,  36,  56}, // 163
+    {100,  50,  50,  70,  76,  96}, // 164
+    { 40,  20,  30,  55,  40,  80}, // 165
+    { 55,  35,  50,  85,  55, 110}, // 166
+    { 40,  60,  40,  30,  40,  40}, // 167
+    { 70,  90,  70,  40,  60,  60}, // 168
+    { 85,  90,  80, 130,  70,  80}, // 169
+    { 75,  38,  38,  67,  56,  56}, // 170
+    {125,  58,  58,  67,  76,  76}, // 171
+    { 20,  40,  15,  60,  35,  35}, // 172
+    { 50,  25,  28,  15,  45,  55}, // 173
+    { 90,  30,  15,  15,  40,  20}, // 174
+    { 35,  20,  65,  20,  40,  65}, // 175
+    { 55,  40,  85,  40,  80, 105}, // 176
+    { 40,  50,  45,  70,  70,  45}, // 177
+    { 65,  75,  70,  95,  95,  70}, // 178
+    { 55,  40,  40,  35,  65,  45}, // 179
+    { 70,  55,  55,  45,  80,  60}, // 180
+    { 90,  75,  75,  55, 115,  90}, // 181
+    { 75,  80,  85,  50,  90, 100}, // 182
+    { 70,  20,  50,  40,  20,  50}, // 183
+    {100,  50,  80,  50,  50,  80}, // 184
+    { 70, 100, 115,  30,  30,  65}, // 185
+    { 90,  75,  75,  70,  90, 100}, // 186
+    { 35,  35,  40,  50,  35,  55}, // 187
+    { 55,  45,  50,  80,  45,  65}, // 188
+    { 75,  55,  70, 110,  55,  85}, // 189
+    { 55,  70,  55,  85,  40,  55}, // 190
+    { 30,  30,  30,  30,  30,  30}, // 191
+    { 75,  75,  55,  30, 105,  85}, // 192
+    { 65,  65,  45,  95,  75,  45}, // 193
+    { 55,  45,  45,  15,  25,  25}, // 194
+    { 95,  85,  85,  35,  65,  65}, // 195
+    { 65,  65,  60, 110, 130,  95}, // 196
+    { 95,  65, 110,  65,  60, 130}, // 197
+    { 60,  85,  42,  91,  85,  42}, // 198
+    { 95,  75,  80,  30, 100, 110}, // 199
+    { 60,  60,  60,  85,  85,  85}, // 200
+    { 48,  72,  48,  48,  72,  48}, // 201
+    {190,  33,  58,  33,  33,  58}, // 202
+    { 70,  80,  65,  85,  90,  65}, // 203
+    { 50,  65,  90,  15,  35,  35}, // 204
+    { 75,  90, 140,  40,  60,  60}, // 205
+    {100,  70,  70,  45,  65,  65}, // 206
+    { 65,  75, 105,  85,  35,  65}, // 207
+    { 75,  85, 200,  30,  55,  65}, // 208
+    { 60,  80,  50,  30,  40,  40}, // 209
+    { 90, 120,  75,  45,  60,  60}, // 210
+    { 65,  95,  75,  85,  55,  55}, // 211
+    { 70, 130, 100,  65,  55,  80}, // 212
+    { 20,  10, 230,   5,  10, 230}, // 213
+    { 80, 125,  75,  85,  40,  95}, // 214
+    { 55,  95,  55, 115,  35,  75}, // 215
+    { 60,  80,  50,  40,  50,  50}, // 216
+    { 90, 130,  75,  55,  75,  75}, // 217
+    { 40,  40,  40,  20,  70,  40}, // 218
+    { 50,  50, 120,  30,  80,  80}, // 219
+    { 50,  50,  40,  50,  30,  30}, // 220
+    {100, 100,  80,  50,  60,  60}, // 221
+    { 55,  55,  85,  35,  65,  85}, // 222
+    { 35,  65,  35,  65,  65,  35}, // 223
+    { 75, 105,  75,  45, 105,  75}, // 224
+    { 45,  55,  45,  75,  65,  45}, // 225
+    { 65,  40,  70,  70,  80, 140}, // 226
+    { 65,  80, 140,  70,  40,  70}, // 227
+    { 45,  60,  30,  65,  80,  50}, // 228
+    { 75,  90,  50,  95, 110,  80}, // 229
+    { 75,  95,  95,  85,  95,  95}, // 230
+    { 90,  60,  60,  40,  40,  40}, // 231
+    { 90, 120, 120,  50,  60,  60}, // 232
+    { 85,  80,  90,  60, 105,  95}, // 233
+    { 73,  95,  62,  85,  85,  65}, // 234
+    { 55,  20,  35,  75,  20,  45}, // 235
+    { 35,  35,  35,  35,  35,  35}, // 236
+    { 50,  95,  95,  70,  35, 110}, // 237
+    { 45,  30,  15,  65,  85,  65}, // 238
+    { 45,  63,  37,  95,  65,  55}, // 239
+    { 45,  75,  37,  83,  70,  55}, // 240
+    { 95,  80, 105, 100,  40,  70}, // 241
+    {255,  10,  10,  55,  75, 135}, // 242
+    { 90,  85,  75, 115, 115, 100}, // 243
+    {115, 115,  85, 100,  90,  75}, // 244
+    {100,  75, 115,  85,  90, 115}, // 245
+    { 50,  64,  50,  41,  45,  50}, // 246
+    { 70,  84,  70,  51,  65,  70}, // 247
+    {100, 134, 110,  61,  95, 100}, // 248
+    {106,  90, 130, 110,  90, 154}, // 249
+    {106, 130,  90,  90, 110, 154}, // 250
+    {100, 100, 100, 100, 100, 100}, // 251
+    { 40,  45,  35,  70,  65,  55}, // 252
+    { 50,  65,  45,  95,  85,  65}, // 253
+    { 70,  85,  65, 120, 105,  85}, // 254
+    { 45,  60,  40,  45,  70,  50}, // 255
+    { 60,  85,  60,  55,  85,  60}, // 256
+    { 80, 120,  70,  80, 110,  70}, // 257
+    { 50,  70,  50,  40,  50,  50}, // 258
+    { 70,  85,  70,  50,  60,  70}, // 259
+    {100, 110,  90,  60,  85,  90}, // 260
+    { 35,  55,  35,  35,  30,  30}, // 261
+    { 70,  90,  70,  70,  60,  60}, // 262
+    { 38,  30,  41,  60,  30,  41}, // 263
+    { 78,  70,  61, 100,  50,  61}, // 264
+    { 45,  45,  35,  20,  20,  30}, // 265
+    { 50,  35,  55,  15,  25,  25}, // 266
+    { 60,  70,  50,  65,  90,  50}, // 267
+    { 50,  35,  55,  15,  25,  25}, // 268
+    { 60,  50,  70,  65,  50,  90}, // 269
+    { 40,  30,  30,  30,  40,  50}, // 270
+    { 60,  50,  50,  50,  60,  70}, // 271
+    { 80,  70,  70,  70,  90, 100}, // 272
+    { 40,  40,  50,  30,  30,  30}, // 273
+    { 70,  70,  40,  60,  60,  40}, // 274
+    { 90, 100,  60,  80,  90,  60}, // 275
+    { 40,  55,  30,  85,  30,  30}, // 276
+    { 60,  85,  60, 125,  50,  50}, // 277
+    { 40,  30,  30,  85,  55,  30}, // 278
+    { 60,  50, 100,  65,  85,  70}, // 279
+    { 28,  25,  25,  40,  45,  35}, // 280
+    { 38,  35,  35,  50,  65,  55}, // 281
+    { 68,  65,  65,  80, 125, 115}, // 282
+    { 40,  30,  32,  65,  50,  52}, // 283
+    { 70,  60,  62,  60,  80,  82}, // 284
+    { 60,  40,  60,  35,  40,  60}, // 285
+    { 60, 130,  80,  70,  60,  60}, // 286
+    { 60,  60,  60,  30,  35,  35}, // 287
+    { 80,  80,  80,  90,  55,  55}, // 288
+    {150, 160, 100, 100,  95,  65}, // 289
+    { 31,  45,  90,  40,  30,  30}, // 290
+    { 61,  90,  45, 160,  50,  50}, // 291
+    {  1,  90,  45,  40,  30,  30}, // 292
+    { 64,  51,  23,  28,  51,  23}, // 293
+    { 84,  71,  43,  48,  71,  43}, // 294
+    {104,  91,  63,  68,  91,  63}, // 295
+    { 72,  60,  30,  25,  20,  30}, // 296
+    {144, 120,  60,  50,  40,  60}, // 297
+    { 50,  20,  40,  20,  20,  40}, // 298
+    { 30,  45, 135,  30,  45,  90}, // 299
+    { 50,  45,  45,  50,  35,  35}, // 300
+    { 70,  65,  65,  70,  55,  55}, // 301
+    { 50,  75,  75,  50,  65,  65}, // 302
+    { 50,  85,  85,  50,  55,  55}, // 303
+    { 50,  70, 100,  30,  40,  40}, // 304
+    { 60,  90, 140,  40,  50,  50}, // 305
+    { 70, 110, 180,  50,  60,  60}, // 306
+    { 30,  40,  55,  60,  40,  55}, // 307
+    { 60,  60,  75,  80,  60,  75}, // 308
+    { 40,  45,  40,  65,  65,  40}, // 309
+    { 70,  75,  60, 105, 105,  60}, // 310
+    { 60,  50,  40,  95,  85,  75}, // 311
+    { 60,  40,  50,  95,  75,  85}, // 312
+    { 65,  73,  55,  85,  47,  75}, // 313
+    { 65,  47,  55,  85,  73,  75}, // 314
+    { 50,  60,  45,  65, 100,  80}, // 315
+    { 70,  43,  53,  40,  43,  53}, // 316
+    {100,  73,  83,  55,  73,  83}, // 317
+    { 45,  90,  20,  65,  65,  20}, // 318
+    { 70, 120,  40,  95,  95,  40}, // 319
+    {130,  70,  35,  60,  70,  35}, // 320
+    {170,  90,  45,  60,  90,  45}, // 321
+    { 60,  60,  40,  35,  65,  45}, // 322
+    { 70, 100,  70,  40, 105,  75}, // 323
+    { 70,  85, 140,  20,  85,  70}, // 324
+    { 60,  25,  35,  60,  70,  80}, // 325
+    { 80,  45,  65,  80,  90, 110}, // 326
+    { 60,  60,  60,  60,  60,  60}, // 327
+    { 45, 100,  45,  10,  45,  45}, // 328
+    { 50,  70,  50,  70,  50,  50}, // 329
+    { 80, 100,  80, 100,  80,  80}, // 330
+    { 50,  85,  40,  35,  85,  40}, // 331
+    { 70, 115,  60,  55, 115,  60}, // 332
+    { 45,  40,  60,  50,  40,  75}, // 333
+    { 75,  70,  90,  80,  70, 105}, // 334
+    { 73, 115,  60,  90,  60,  60}, // 335
+    { 73, 100,  60,  65, 100,  60}, // 336
+    { 70,  55,  65,  70,  95,  85}, // 337
+    { 70,  95,  85,  70,  55,  65}, // 338
+    { 50,  48,  43,  60,  46,  41}, // 339
+    {110,  78,  73,  60,  76,  71}, // 340
+    { 43,  80,  65,  35,  50,  35}, // 341
+    { 63, 120,  85,  55,  90,  55}, // 342
+    { 40,  40,  55,  55,  40,  70}, // 343
+    { 60,  70, 105,  75,  70, 120}, // 344
+    { 66,  41,  77,  23,  61,  87}, // 345
+    { 86,  81,  97,  43,  81, 107}, // 346
+    { 45,  95,  50,  75,  40,  50}, // 347
+    { 75, 125, 100,  45,  70,  80}, // 348
+    { 20,  15,  20,  80,  10,  55}, // 349
+    { 95,  60,  79,  81, 100, 125}, // 350
+    { 70,  70,  70,  70,  70,  70}, // 351
+    { 60,  90,  70,  40,  60, 120}, // 352
+    { 44,  75,  35,  45,  63,  33}, // 353
+    { 64, 115,  65,  65,  83,  63}, // 354
+    { 20,  40,  90,  25,  30,  90}, // 355
+    { 40,  70, 130,  25,  60, 130}, // 356
+    { 99,  68,  83,  51,  72,  87}, // 357
+    { 65,  50,  70,  65,  95,  80}, // 358
+    { 65, 130,  60,  75,  75,  60}, // 359
+    { 95,  23,  48,  23,  23,  48}, // 360
+    { 50,  50,  50,  50,  50,  50}, // 361
+    { 80,  80,  80,  80,  80,  80}, // 362
+    { 70,  40,  50,  25,  55,  50}, // 363
+    { 90,  60,  70,  45,  75,  70}, // 364
+    {110,  80,  90,  65,  95,  90}, // 365
+    { 35,  64,  85,  32,  74,  55}, // 366
+    { 55, 104, 105,  52,  94,  75}, // 367
+    { 55,  84, 105,  52, 114,  75}, // 368
+    {100,  90, 130,  55,  45,  65}, // 369
+    { 43,  30,  55,  97,  40,  65}, // 370
+    { 45,  75,  60,  50,  40,  30}, // 371
+    { 65,  95, 100,  50,  60,  50}, // 372
+    { 95, 135,  80, 100, 110,  80}, // 373
+    { 40,  55,  80,  30,  35,  60}, // 374
+    { 60,  75, 100,  50,  55,  80}, // 375
+    { 80, 135, 130,  70,  95,  90}, // 376
+    { 80, 100, 200,  50,  50, 100}, // 377
+    { 80,  50, 100,  50, 100, 200}, // 378
+    { 80,  75, 150,  50,  75, 150}, // 379
+    { 80,  80,  90, 110, 110, 130}, // 380
+    { 80,  90,  80, 110, 130, 110}, // 381
+    {100, 100,  90,  90, 150, 140}, // 382
+    {100, 150, 140,  90, 100,  90}, // 383
+    {105, 150,  90,  95, 150,  90}, // 384
+    {100, 100, 100, 100, 100, 100}, // 385
+    { 50, 150,  50, 150, 150,  50}  // 386
+};
+
+// Generation I had a single Special stat, which was split in Generation II.
+static const uint8_t PKSAV_GEN1_BASE_SPECIAL[PKSAV_NUM_GEN1_SPECIES] = {
+     65,  80, 100,  50,  65,  85,  50,  65,  85,  20,
+     25,  80,  20,  25,  45,  35,  50,  70,  25,  50,
+     31,  61,  40,  65,  50,  90,  30,  55,  40,  55,
+     75,  40,  55,  75,  60,  85,  65, 100,  25,  50,
+     40,  75,  75,  85, 100,  55,  80,  40,  90,  45,
+     70,  40,  65,  50,  80,  35,  60,  50,  80,  40,
+     50,  70, 105, 120, 135,  35,  50,  65,  70,  85,
+    100, 100, 120,  30,  45,  55,  65,  80,  40,  80,
+     95, 120,  58,  35,  60,  70,  95,  40,  65,  45,
+     85, 100, 115, 130,  30,  90, 115,  25,  50,  55,
+     80,  60, 125,  40,  50,  35,  35,  60,  60,  85,
+     30,  45, 105, 100,  40,  70,  95,  50,  80,  70,
+    100, 100,  55,  95,  85,  85,  55,  70,  20, 100,
+     95,  48,  65, 110, 110, 110,  75,  90, 115,  45,
+     70,  60,  65, 125, 125, 125,  50,  70, 100, 154,
+    100
+};
+
+// Generation I species index -> National Pokédex number (0 = MissingNo.)
+static const uint8_t PKSAV_GEN1_POKEDEX_NUMS[PKSAV_GEN1_MAX_SPECIES_INDEX+1] = {
+      0, 112, 115,  32,  35,  21, 100,  34,  80,   2,
+    103, 108, 102,  88,  94,  29,  31, 104, 111, 131,
+     59, 151, 130,  90,  72,  92, 123, 120,   9, 127,
+    114,   0,   0,  58,  95,  22,  16,  79,  64,  75,
+    113,  67, 122, 106, 107,  24,  47,  54,  96,  76,
+      0, 126,   0, 125,  82, 109,   0,  56,  86,  50,
+    128,   0,   0,   0,  83,  48, 149,   0,   0,   0,
+     84,  60, 124, 146, 144, 145, 132,  52,  98,   0,
+      0,   0,  37,  38,  25,  26,   0,   0, 147, 148,
+    140, 141, 116, 117,   0,   0,  27,  28, 138, 139,
+     39,  40, 133, 136, 135, 134,  66,  41,  23,  46,
+     61,  62,  13,  14,  15,   0,  85,  57,  51,  49,
+     87,   0,   0,  10,  11,  12,  68,   0,  55,  97,
+     42, 150, 143, 129,   0,   0,  89,   0,  99,  91,
+      0, 101,  36, 110,  53, 105,   0,  93,  63,  65,
+     17,  18, 121,   1,   3,  73,   0, 118, 119,   0,
+      0,   0,   0,  77,  78,  19,  20,  33,  30,  74,
+    137, 142,   0,  81,   0,   0,   4,   7,   5,   8,
+      6,   0,   0,   0,   0,  43,  44,  45,  69,  70,
+     71
+};
+
+// Game Boy Advance species index -> National Pokédex number, for Hoenn Pokémon
+static const uint16_t PKSAV_GBA_HOENN_POKEDEX_NUMS[] = {
+    252, 253, 254, 255, 256, 257, 258, 259, 260, 261,
+    262, 263, 264, 265, 266, 267, 268, 269, 270, 271,
+    272, 273, 274, 275, 290, 291, 292, 276, 277, 285,
+    286, 327, 278, 279, 283, 284, 320, 321, 300, 301,
+    352, 343, 344, 299, 324, 302, 339, 340, 370, 341,
+    342, 349, 350, 318, 319, 328, 329, 330, 296, 297,
+    309, 310, 322, 323, 363, 364, 365, 331, 332, 361,
+    362, 337, 338, 298, 325, 326, 311, 312, 303, 307,
+    308, 333, 334, 360, 355, 356, 315, 287, 288, 289,
+    316, 317, 357, 293, 294, 295, 366, 367, 368, 359,
+    353, 354, 336, 335, 369, 304, 305, 306, 351, 313,
+    314, 345, 346, 347, 348, 280, 281, 282, 371, 372,
+    373, 374, 375, 376, 377, 378, 379, 382, 383, 384,
+    380, 381, 385, 386, 358
+};
+/*
+ * The stat each nature raises and lowers. Natures are ordered so that these
+ * are nature / 5 and nature % 5 into this list.
+ */
+static const pksav_battle_stat_t PKSAV_NATURE_STATS[5] = {
+    PKSAV_STAT_ATTACK,
+    PKSAV_STAT_DEFENSE,
+    PKSAV_STAT_SPEED,
+    PKSAV_STAT_SPATK,
+    PKSAV_STAT_SPDEF
+};
+
+#define PKSAV_NUM_NATURES 25
+
+pksav_error_t pksav_get_base_stats(
+    uint16_t pokedex_num,
+    pksav_base_stats_t* base_stats_out
+) {
+    if(!base_stats_out) {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+    if((pokedex_num == 0) || (pokedex_num > PKSAV_NUM_NATIONAL_SPECIES)) {
+        return PKSAV_ERROR_PARAM_OUT_OF_RANGE;
+    }
+
+    const uint8_t* base_stats = PKSAV_BASE_STATS[pokedex_num-1];
+    base_stats_out->hp      = base_stats[0];
+    base_stats_out->attack  = base_stats[1];
+    base_stats_out->defense = base_stats[2];
+    base_stats_out->speed   = base_stats[3];
+    base_stats_out->spatk   = base_stats[4];
+    base_stats_out->spdef   = base_stats[5];
+
+    return PKSAV_ERROR_NONE;
+}
+
+pksav_error_t pksav_get_gen1_base_stats(
+    uint16_t pokedex_num,
+    pksav_base_stats_t* base_stats_out
+) {
+    if(!base_stats_out) {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+    if((pokedex_num == 0) || (pokedex_num > PKSAV_NUM_GEN1_SPECIES)) {
+        return PKSAV_ERROR_PARAM_OUT_OF_RANGE;
+    }
+
+    (void)pksav_get_base_stats(pokedex_num, base_stats_out);
+    base_stats_out->spatk = PKSAV_GEN1_BASE_SPECIAL[pokedex_num-1];
+    base_stats_out->spdef = PKSAV_GEN1_BASE_SPECIAL[pokedex_num-1];
+
+    return PKSAV_ERROR_NONE;
+}
+
+pksav_error_t pksav_gen1_species_to_pokedex_num(
+    uint8_t species_index,
+    uint16_t* pokedex_num_out
+) {
+    if(!pokedex_num_out) {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+    if((species_index > PKSAV_GEN1_MAX_SPECIES_INDEX) || !PKSAV_GEN1_POKEDEX_NUMS[species_index]) {
+        return PKSAV_ERROR_PARAM_OUT_OF_RANGE;
+    }
+
+    *pokedex_num_out = PKSAV_GEN1_POKEDEX_NUMS[species_index];
+
+    return PKSAV_ERROR_NONE;
+}
+
+pksav_error_t pksav_gba_species_to_pokedex_num(
+    uint16_t species_index,
+    uint16_t* pokedex_num_out
+) {
+    if(!pokedex_num_out) {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+
+    if((species_index >= 1) && (species_index <= 251)) {
+        *pokedex_num_out = species_index;
+    } else if((species_index >= PKSAV_GBA_FIRST_HOENN_INDEX) && (species_index <= PKSAV_GBA_LAST_HOENN_INDEX)) {
+        *pokedex_num_out = PKSAV_GBA_HOENN_POKEDEX_NUMS[species_index - PKSAV_GBA_FIRST_HOENN_INDEX];
+    } else {
+        return PKSAV_ERROR_PARAM_OUT_OF_RANGE;
+    }
+
+    return PKSAV_ERROR_NONE;
+}
+
+pksav_error_t pksav_get_nature_stat_modifiers(
+    pksav_nature_t nature,
+    pksav_battle_stat_t* increased_stat_out,
+    pksav_battle_stat_t* decreased_stat_out
+) {
+    if(!increased_stat_out || !decreased_stat_out) {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+    if((unsigned int)nature >= PKSAV_NUM_NATURES) {
+        return PKSAV_ERROR_PARAM_OUT_OF_RANGE;
+    }
+
+    size_t increased = (size_t)nature / 5;
+    size_t decreased = (size_t)nature % 5;
+    if(increased == decreased) {
+        *increased_stat_out = PKSAV_STAT_NONE;
+        *decreased_stat_out = PKSAV_STAT_NONE;
+    } else {
+        *increased_stat_out = PKSAV_NATURE_STATS[increased];
+        *decreased_stat_out = PKSAV_NATURE_STATS[decreased];
+    }
+
+    return PKSAV_ERROR_NONE;
+}
+
+// ceil(sqrt(value)), capped at 255, as the Game Boy games compute it
+static PKSAV_INLINE uint32_t _pksav_gb_stat_exp_bonus(
+    uint16_t value
+) {
+    uint32_t root = 0;
+    for(uint32_t bit = (1U << 7); bit; bit >>= 1) {
+        uint32_t candidate = root | bit;
+        root = ((candidate * candidate) <= value) ? candidate : root;
+    }
+    root += ((root * root) < value);
+    root -= (root > 255);
+
+    return root / 4;
+}
+
+static PKSAV_INLINE uint16_t _pksav_gb_stat(
+    uint32_t base,
+    uint32_t IV,
+    uint16_t EV,
+    uint32_t level,
+    uint32_t offset
+) {
+    return (uint16_t)(((((base + IV) * 2) + _pksav_gb_stat_exp_bonus(EV)) * level) / 100 + offset);
+}
+
+pksav_error_t pksav_calc_gb_stats(
+    const pksav_base_stats_t* base_stats,
+    uint8_t level,
+    uint16_t iv_data,
+    const uint16_t* EVs,
+    pksav_battle_stats_t* stats_out
+) {
+    if(!base_stats || !EVs || !stats_out) {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+    if((level == 0) || (level > 100)) {
+        return PKSAV_ERROR_PARAM_OUT_OF_RANGE;
+    }
+
+    uint32_t atk_IV  = (iv_data >> 12) & 0x0F;
+    uint32_t def_IV  = (iv_data >> 8) & 0x0F;
+    uint32_t spd_IV  = (iv_data >> 4) & 0x0F;
+    uint32_t spcl_IV = iv_data & 0x0F;
+    uint32_t hp_IV   = ((atk_IV & 1) << 3) | ((def_IV & 1) << 2)
+                     | ((spd_IV & 1) << 1) |  (spcl_IV & 1);
+
+    stats_out->hp      = _pksav_gb_stat(base_stats->hp,      hp_IV,   EVs[0], level, level + 10);
+    stats_out->attack  = _pksav_gb_stat(base_stats->attack,  atk_IV,  EVs[1], level, 5);
+    stats_out->defense = _pksav_gb_stat(base_stats->defense, def_IV,  EVs[2], level, 5);
+    stats_out->speed   = _pksav_gb_stat(base_stats->speed,   spd_IV,  EVs[3], level, 5);
+    stats_out->spatk   = _pksav_gb_stat(base_stats->spatk,   spcl_IV, EVs[4], level, 5);
+    stats_out->spdef   = _pksav_gb_stat(base_stats->spdef,   spcl_IV, EVs[4], level, 5);
+
+    return PKSAV_ERROR_NONE;
+}
+
+/*
+ * The nature multiplier is applied in tenths. For each stat, the multiplier
+ * is 10, plus 1 if the nature raises it, minus 1 if it lowers it. Neutral
+ * natures raise and lower the same stat, which cancels out.
+ */
+static PKSAV_INLINE uint16_t _pksav_stat(
+    uint32_t base,
+    uint32_t IV,
+    uint32_t EV,
+    uint32_t level,
+    uint32_t nature_tenths
+) {
+    return (uint16_t)(((((2 * base) + IV + (EV / 4)) * level / 100) + 5) * nature_tenths / 10);
+}
+
+pksav_error_t pksav_calc_stats(
+    const pksav_base_stats_t* base_stats,
+    uint8_t level,
+    uint32_t iv_data,
+    const uint8_t* EVs,
+    pksav_nature_t nature,
+    pksav_battle_stats_t* stats_out
+) {
+    if(!base_stats || !EVs || !stats_out) {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+    if((level == 0) || (level > 100) || ((unsigned int)nature >= PKSAV_NUM_NATURES)) {
+        return PKSAV_ERROR_PARAM_OUT_OF_RANGE;
+    }
+
+    // Indexed by position in PKSAV_NATURE_STATS
+    uint32_t tenths[5] = {10, 10, 10, 10, 10};
+    tenths[(size_t)nature / 5] += 1;
+    tenths[(size_t)nature % 5] -= 1;
+
+    uint32_t hp = ((((2 * base_stats->hp) + (iv_data & 0x1F) + (EVs[0] / 4)) * level) / 100) + level + 10;
+    stats_out->hp = (uint16_t)((base_stats->hp == 1) ? 1 : hp);
+
+    stats_out->attack  = _pksav_stat(base_stats->attack,  (iv_data >> 5)  & 0x1F, EVs[1], level, tenths[0]);
+    stats_out->defense = _pksav_stat(base_stats->defense, (iv_data >> 10) & 0x1F, EVs[2], level, tenths[1]);
+    stats_out->speed   = _pksav_stat(base_stats->speed,   (iv_data >> 15) & 0x1F, EVs[3], level, tenths[2]);
+    stats_out->spatk   = _pksav_stat(base_stats->spatk,   (iv_data >> 20) & 0x1F, EVs[4], level, tenths[3]);
+    stats_out->spdef   = _pksav_stat(base_stats->spdef,   (iv_data >> 25) & 0x1F, EVs[5], level, tenths[4]);
+
+    return PKSAV_ERROR_NONE;
+}
@@ -0,0 +1,308 @@
+/*
+ * Copyright (c) 2018 Nicholas Corgan (n.corgan@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include <pksav/common/columnar.h>
+
+#include <pksav/math/endian.h>
+
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+
+// Columns that don't come from the record itself
+#define PKSAV_COLUMNAR_NOT_IN_RECORD ((size_t)-1)
+
+typedef struct {
+    const char* name;
+    uint32_t element_size;
+    uint32_t width;
+    size_t record_offset;
+} pksav_columnar_column_info_t;
+
+static const pksav_columnar_column_info_t PKSAV_COLUMNAR_COLUMNS[PKSAV_COLUMNAR_NUM_COLUMNS] = {
+    {"save_index",   4, 1, PKSAV_COLUMNAR_NOT_IN_RECORD},
+    {"personality",  4, 1, offsetof(pksav_pokemon_record_t, personality)},
+    {"exp",          4, 1, offsetof(pksav_pokemon_record_t, exp)},
+    {"pokedex_num",  2, 1, offsetof(pksav_pokemon_record_t, pokedex_num)},
+    {"held_item",    2, 1, offsetof(pksav_pokemon_record_t, held_item)},
+    {"moves",        2, 4, offsetof(pksav_pokemon_record_t, moves)},
+    {"ot_public_id", 2, 1, offsetof(pksav_pokemon_record_t, ot_public_id)},
+    {"ot_secret_id", 2, 1, offsetof(pksav_pokemon_record_t, ot_secret_id)},
+    {"EVs",          2, 6, offsetof(pksav_pokemon_record_t, EVs)},
+    {"IVs",          1, 6, offsetof(pksav_pokemon_record_t, IVs)},
+    {"location",     1, 1, PKSAV_COLUMNAR_NOT_IN_RECORD},
+    {"level",        1, 1, offsetof(pksav_pokemon_record_t, level)},
+    {"friendship",   1, 1, offsetof(pksav_pokemon_record_t, friendship)},
+    {"pokerus",      1, 1, offsetof(pksav_pokemon_record_t, pokerus)},
+    {"generation",   1, 1, offsetof(pksav_pokemon_record_t, generation)},
+    {"nature",       1, 1, offsetof(pksav_pokemon_record_t, nature)},
+    {"flags",        1, 1, offsetof(pksav_pokemon_record_t, flags)}
+};
+
+static PKSAV_INLINE size_t _pksav_columnar_row_size(
+    size_t column
+) {
+    return PKSAV_COLUMNAR_COLUMNS[column].element_size * PKSAV_COLUMNAR_COLUMNS[column].width;
+}
+
+static PKSAV_INLINE size_t _pksav_columnar_padded_size(
+    size_t num_bytes
+) {
+    return (num_bytes + 7) & ~((size_t)7);
+}
+
+/*
+ * Copy one field from each record into a column's buffer, converting each
+ * element to little-endian.
+ */
+static void _pksav_columnar_gather(
+    size_t column,
+    const pksav_pokemon_record_t* records,
+    size_t num_records,
+    uint8_t* column_out
+) {
+    const pksav_columnar_column_info_t* info = &PKSAV_COLUMNAR_COLUMNS[column];
+    size_t num_elements = info->width;
+
+    for(size_t i = 0; i < num_records; ++i) {
+        const uint8_t* field = (const uint8_t*)&records[i] + info->record_offset;
+
+        switch(info->element_size) {
+            case 4:
+                for(size_t j = 0; j < num_elements; ++j) {
+                    uint32_t value;
+                    memcpy(&value, field + (j * 4), 4);
+                    value = pksav_littleendian32(value);
+                    memcpy(column_out, &value, 4);
+                    column_out += 4;
+                }
+                break;
+
+            case 2:
+                for(size_t j = 0; j < num_elements; ++j) {
+                    uint16_t value;
+                    memcpy(&value, field + (j * 2), 2);
+                    value = pksav_littleendian16(value);
+                    memcpy(column_out, &value, 2);
+                    column_out += 2;
+                }
+                break;
+
+            default:
+                memcpy(column_out, field, num_elements);
+                column_out += num_elements;
+                break;
+        }
+    }
+}
+
+static pksav_error_t _pksav_columnar_write_header(
+    pksav_columnar_writer_t* writer
+) {
+    FILE* file = (FILE*)writer->file;
+
+    pksav_columnar_header_t header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, PKSAV_COLUMNAR_MAGIC, sizeof(header.magic));
+    header.version        = pksav_littleendian32(PKSAV_COLUMNAR_VERSION);
+    header.num_columns    = pksav_littleendian32(PKSAV_COLUMNAR_NUM_COLUMNS);
+    header.max_chunk_rows = pksav_littleendian32((uint32_t)writer->max_chunk_rows);
+    header.num_chunks     = pksav_littleendian32(writer->num_chunks);
+
+    uint64_t num_rows = writer->num_rows;
+    for(size_t i = 0; i < sizeof(header.num_rows); ++i) {
+        ((uint8_t*)&header.num_rows)[i] = (uint8_t)(num_rows >> (8 * i));
+    }
+
+    if(fwrite(&header, sizeof(header), 1, file) != 1) {
+        return PKSAV_ERROR_FILE_IO;
+    }
+
+    return PKSAV_ERROR_NONE;
+}
+
+pksav_error_t pksav_columnar_writer_open(
+    const char* filepath,
+    size_t max_chunk_rows,
+    pksav_columnar_writer_t* writer_out
+) {
+    if(!filepath || !writer_out) {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+    if(max_chunk_rows == 0) {
+        max_chunk_rows = PKSAV_COLUMNAR_DEFAULT_CHUNK_ROWS;
+    }
+    if(max_chunk_rows > PKSAV_COLUMNAR_MAX_CHUNK_ROWS) {
+        return PKSAV_ERROR_PARAM_OUT_OF_RANGE;
+    }
+
+    FILE* file = fopen(filepath, "wb");
+    if(!file) {
+        return PKSAV_ERROR_FILE_IO;
+    }
+
+    memset(writer_out, 0, sizeof(*writer_out));
+    writer_out->max_chunk_rows = max_chunk_rows;
+    writer_out->file = file;
+
+    pksav_error_t error = _pksav_columnar_write_header(writer_out);
+    for(size_t i = 0; (i < PKSAV_COLUMNAR_NUM_COLUMNS) && !error; ++i) {
+        pksav_columnar_column_t column;
+        memset(&column, 0, sizeof(column));
+        strncpy(column.name, PKSAV_COLUMNAR_COLUMNS[i].name, sizeof(column.name)-1);
+        column.element_size = pksav_littleendian32(PKSAV_COLUMNAR_COLUMNS[i].element_size);
+        column.width        = pksav_littleendian32(PKSAV_COLUMNAR_COLUMNS[i].width);
+
+        if(fwrite(&column, sizeof(column), 1, file) != 1) {
+            error = PKSAV_ERROR_FILE_IO;
+        }
+    }
+    if(error) {
+        fclose(file);
+        writer_out->file = NULL;
+        return error;
+    }
+
+    // Padded so a full chunk can be written straight from each buffer.
+    for(size_t i = 0; i < PKSAV_COLUMNAR_NUM_COLUMNS; ++i) {
+        writer_out->columns[i] = calloc(
+                                     _pksav_columnar_padded_size(
+                                         max_chunk_rows * _pksav_columnar_row_size(i)
+                                     ),
+                                     1
+                                 );
+    }
+
+    return PKSAV_ERROR_NONE;
+}
+
+pksav_error_t pksav_columnar_writer_append(
+    pksav_columnar_writer_t* writer,
+    const pksav_pokemon_record_t* records,
+    size_t num_records,
+    uint32_t save_index,
+    uint8_t location
+) {
+    if(!writer || !records) {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+
+    uint32_t save_index_le = pksav_littleendian32(save_index);
+
+    while(num_records > 0) {
+        size_t row = writer->num_buffered_rows;
+        size_t num_to_copy = writer->max_chunk_rows - row;
+        if(num_to_copy > num_records) {
+            num_to_copy = num_records;
+        }
+
+        for(size_t i = 0; i < PKSAV_COLUMNAR_NUM_COLUMNS; ++i) {
+            uint8_t* column_out = writer->columns[i] + (row * _pksav_columnar_row_size(i));
+
+            if(i == PKSAV_COLUMNAR_SAVE_INDEX) {
+                for(size_t j = 0; j < num_to_copy; ++j) {
+                    memcpy(column_out + (j * 4), &save_index_le, 4);
+                }
+            } else if(i == PKSAV_COLUMNAR_LOCATION) {
+                memset(column_out, location, num_to_copy);
+            } else {
+                _pksav_columnar_gather(i, records, num_to_copy, column_out);
+            }
+        }
+
+        writer->num_buffered_rows += num_to_copy;
+        writer->num_rows += num_to_copy;
+        records += num_to_copy;
+        num_records -= num_to_copy;
+
+        if(writer->num_buffered_rows == writer->max_chunk_rows) {
+            pksav_error_t error = pksav_columnar_writer_flush(writer);
+            if(error) {
+                return error;
+            }
+        }
+    }
+
+    return PKSAV_ERROR_NONE;
+}
+
+pksav_error_t pksav_columnar_writer_flush(
+    pksav_columnar_writer_t* writer
+) {
+    if(!writer) {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+    if(writer->num_buffered_rows == 0) {
+        return PKSAV_ERROR_NONE;
+    }
+
+    FILE* file = (FILE*)writer->file;
+    size_t num_rows = writer->num_buffered_rows;
+
+    size_t padded_sizes[PKSAV_COLUMNAR_NUM_COLUMNS];
+    size_t num_bytes = 0;
+    for(size_t i = 0; i < PKSAV_COLUMNAR_NUM_COLUMNS; ++i) {
+        size_t column_size = num_rows * _pksav_columnar_row_size(i);
+        padded_sizes[i] = _pksav_columnar_padded_size(column_size);
+        num_bytes += padded_sizes[i];
+
+        // The buffer may hold padding bytes left over from a larger chunk.
+        memset(writer->columns[i] + column_size, 0, padded_sizes[i] - column_size);
+    }
+
+    pksav_columnar_chunk_header_t chunk_header;
+    memcpy(chunk_header.magic, PKSAV_COLUMNAR_CHUNK_MAGIC, sizeof(chunk_header.magic));
+    chunk_header.num_rows  = pksav_littleendian32((uint32_t)num_rows);
+    chunk_header.num_bytes = pksav_littleendian32((uint32_t)num_bytes);
+
+    if(fwrite(&chunk_header, sizeof(chunk_header), 1, file) != 1) {
+        return PKSAV_ERROR_FILE_IO;
+    }
+    for(size_t i = 0; i < PKSAV_COLUMNAR_NUM_COLUMNS; ++i) {
+        if(fwrite(writer->columns[i], 1, padded_sizes[i], file) != padded_sizes[i]) {
+            return PKSAV_ERROR_FILE_IO;
+        }
+    }
+
+    writer->num_buffered_rows = 0;
+    ++writer->num_chunks;
+
+    return PKSAV_ERROR_NONE;
+}
+
+pksav_error_t pksav_columnar_writer_close(
+    pksav_columnar_writer_t* writer
+) {
+    if(!writer) {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+
+    FILE* file = (FILE*)writer->file;
+    pksav_error_t error = PKSAV_ERROR_NONE;
+
+    if(file) {
+        error = pksav_columnar_writer_flush(writer);
+        if(!error) {
+            if(fseek(file, 0, SEEK_SET)) {
+                error = PKSAV_ERROR_FILE_IO;
+            } else {
+                error = _pksav_columnar_write_header(writer);
+            }
+        }
+        if(fclose(file) && !error) {
+            error = PKSAV_ERROR_FILE_IO;
+        }
+    }
+
+    for(size_t i = 0; i < PKSAV_COLUMNAR_NUM_COLUMNS; ++i) {
+        free(writer->columns[i]);
+        writer->columns[i] = NULL;
+    }
+    writer->file = NULL;
+
+    return error;
+}
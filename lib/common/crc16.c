@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2018 Nicholas Corgan (n.corgan@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "crc16.h"
+#include "thread.h"
+
+#include <pksav/config.h>
+
+#define PKSAV_CRC16_CCITT_POLY 0x1021
+
+/*
+ * Slicing-by-8 tables. Table 0 is the usual byte-at-a-time table, and
+ * table k gives the CRC contribution of a byte followed by k zero bytes,
+ * which lets eight input bytes be folded in with independent lookups.
+ */
+static uint16_t pksav_crc16_tables[8][256];
+static pksav_once_t pksav_crc16_tables_once = PKSAV_ONCE_INIT;
+
+static void _pksav_crc16_build_tables(void) {
+    for(uint32_t i = 0; i < 256; ++i) {
+        uint16_t crc = (uint16_t)(i << 8);
+        for(size_t bit = 0; bit < 8; ++bit) {
+            crc = (uint16_t)((crc << 1) ^ ((crc & 0x8000) ? PKSAV_CRC16_CCITT_POLY : 0));
+        }
+        pksav_crc16_tables[0][i] = crc;
+    }
+
+    for(size_t table = 1; table < 8; ++table) {
+        for(size_t i = 0; i < 256; ++i) {
+            uint16_t prev = pksav_crc16_tables[table-1][i];
+            pksav_crc16_tables[table][i] = (uint16_t)((prev << 8) ^ pksav_crc16_tables[0][prev >> 8]);
+        }
+    }
+}
+
+uint16_t pksav_crc16_ccitt(
+    const uint8_t* buffer,
+    size_t len
+) {
+    _pksav_call_once(&pksav_crc16_tables_once, _pksav_crc16_build_tables);
+
+    const uint16_t (*tables)[256] = (const uint16_t (*)[256])pksav_crc16_tables;
+    uint16_t crc = 0xFFFF;
+
+    for(; len >= 8; len -= 8, buffer += 8) {
+        crc = tables[7][(buffer[0] ^ (crc >> 8)) & 0xFF]
+            ^ tables[6][(buffer[1] ^ crc) & 0xFF]
+            ^ tables[5][buffer[2]]
+            ^ tables[4][buffer[3]]
+            ^ tables[3][buffer[4]]
+            ^ tables[2][buffer[5]]
+            ^ tables[1][buffer[6]]
+            ^ tables[0][buffer[7]];
+    }
+    for(; len > 0; --len, ++buffer) {
+        crc = (uint16_t)((crc << 8) ^ tables[0][((crc >> 8) ^ *buffer) & 0xFF]);
+    }
+
+    return crc;
+}
@@ -0,0 +1,23 @@
+/*
+ * Copyright (c) 2018 Nicholas Corgan (n.corgan@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+
+#ifndef PKSAV_COMMON_CRC16_H
+#define PKSAV_COMMON_CRC16_H
+
+#include <stdint.h>
+#include <stdlib.h>
+
+/*
+ * CRC16-CCITT (polynomial 0x1021, initial value 0xFFFF, no reflection or
+ * final XOR), as used for Nintendo DS save blocks.
+ */
+uint16_t pksav_crc16_ccitt(
+    const uint8_t* buffer,
+    size_t len
+);
+
+#endif /* PKSAV_COMMON_CRC16_H */
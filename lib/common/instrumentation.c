@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2018 Nicholas Corgan (n.corgan@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "instrumentation.h"
+#include "thread.h"
+
+#ifdef PKSAV_ENABLE_USDT
+#    include <sys/sdt.h>
+#endif
+
+#if defined(PKSAV_PLATFORM_MINGW) || defined(PKSAV_PLATFORM_WIN32)
+#    include <windows.h>
+#else
+#    include <time.h>
+#endif
+
+static const char* pksav_phase_names[] = {
+    "read",
+    "detect",
+    "slot_select",
+    "unshuffle",
+    "pokemon_crypt",
+    "item_crypt",
+    "checksum",
+    "shuffle",
+    "write"
+};
+
+#ifdef PKSAV_ENABLE_INSTRUMENTATION
+
+static PKSAV_THREAD_LOCAL bool _pksav_use_thread_instrumentation = false;
+static PKSAV_THREAD_LOCAL pksav_instrumentation_t _pksav_thread_instrumentation;
+
+static uint64_t _pksav_now_ns(void) {
+#if defined(PKSAV_PLATFORM_MINGW) || defined(PKSAV_PLATFORM_WIN32)
+    LARGE_INTEGER frequency;
+    LARGE_INTEGER counter;
+    QueryPerformanceFrequency(&frequency);
+    QueryPerformanceCounter(&counter);
+
+    return (uint64_t)((double)counter.QuadPart * (1e9 / (double)frequency.QuadPart));
+#else
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return ((uint64_t)now.tv_sec * 1000000000ULL) + (uint64_t)now.tv_nsec;
+#endif
+}
+
+uint64_t _pksav_phase_begin(void) {
+#ifdef PKSAV_ENABLE_USDT
+    // The probe is always there to be attached to.
+    return _pksav_now_ns();
+#else
+    return _pksav_use_thread_instrumentation ? _pksav_now_ns() : 0;
+#endif
+}
+
+void _pksav_phase_end(
+    pksav_phase_t phase,
+    uint64_t start_ns,
+    size_t bytes_touched
+) {
+    if(!start_ns) {
+        return;
+    }
+
+    uint64_t duration_ns = _pksav_now_ns() - start_ns;
+
+#ifdef PKSAV_ENABLE_USDT
+    DTRACE_PROBE3(pksav, phase, (int)phase, duration_ns, bytes_touched);
+#endif
+
+    if(_pksav_use_thread_instrumentation) {
+        _pksav_thread_instrumentation.phase_fcn(
+            phase,
+            duration_ns,
+            bytes_touched,
+            _pksav_thread_instrumentation.user_data
+        );
+    }
+}
+
+#endif /* PKSAV_ENABLE_INSTRUMENTATION */
+
+bool pksav_instrumentation_is_enabled(void) {
+#ifdef PKSAV_ENABLE_INSTRUMENTATION
+    return true;
+#else
+    return false;
+#endif
+}
+
+void pksav_set_thread_instrumentation(
+    const pksav_instrumentation_t* instrumentation
+) {
+#ifdef PKSAV_ENABLE_INSTRUMENTATION
+    if(instrumentation && instrumentation->phase_fcn) {
+        _pksav_thread_instrumentation = *instrumentation;
+        _pksav_use_thread_instrumentation = true;
+    } else {
+        _pksav_use_thread_instrumentation = false;
+    }
+#else
+    (void)instrumentation;
+#endif
+}
+
+const char* pksav_phase_name(
+    pksav_phase_t phase
+) {
+    if((unsigned int)phase >= PKSAV_NUM_PHASES) {
+        return "unknown";
+    }
+
+    return pksav_phase_names[phase];
+}
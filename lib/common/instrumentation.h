@@ -0,0 +1,46 @@
+/*
+ * Copyright (c) 2018 Nicholas Corgan (n.corgan@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+#ifndef PKSAV_COMMON_INSTRUMENTATION_INTERNAL_H
+#define PKSAV_COMMON_INSTRUMENTATION_INTERNAL_H
+
+#include <pksav/config.h>
+
+#include <pksav/common/instrumentation.h>
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#ifdef PKSAV_ENABLE_INSTRUMENTATION
+
+/*
+ * Returns the current time, or 0 if nothing is listening, in which case the
+ * matching _pksav_phase_end does nothing.
+ */
+uint64_t _pksav_phase_begin(void);
+
+void _pksav_phase_end(
+    pksav_phase_t phase,
+    uint64_t start_ns,
+    size_t bytes_touched
+);
+
+#    define PKSAV_PHASE_BEGIN(start_var) \
+         uint64_t start_var = _pksav_phase_begin()
+
+#    define PKSAV_PHASE_END(phase,start_var,bytes_touched) \
+         _pksav_phase_end((phase), (start_var), (bytes_touched))
+
+#else
+
+// Compiled out, only keeping whatever counted the bytes from looking unused
+#    define PKSAV_PHASE_BEGIN(start_var)
+#    define PKSAV_PHASE_END(phase,start_var,bytes_touched) \
+         ((void)(bytes_touched))
+
+#endif /* PKSAV_ENABLE_INSTRUMENTATION */
+
+#endif /* PKSAV_COMMON_INSTRUMENTATION_INTERNAL_H */
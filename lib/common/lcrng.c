@@ -0,0 +1,241 @@
+/*
+ * Copyright (c) 2018 Nicholas Corgan (n.corgan@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "thread.h"
+
+#include <pksav/common/lcrng.h>
+#include <pksav/common/prng.h>
+
+#include <stdbool.h>
+#include <stdlib.h>
+
+#define PKSAV_LCRNG32_MULT         0x41C64E6DU
+#define PKSAV_LCRNG32_ADD          0x00006073U
+#define PKSAV_LCRNG32_REVERSE_MULT 0xEEB9EB65U
+#define PKSAV_LCRNG32_REVERSE_ADD  0x0A3561A1U
+
+#define PKSAV_LCRNG32_IV_MASK  0x3FFFFFFFU
+#define PKSAV_LCRNG32_MAX_THREADS 64
+
+// The search tries every possible lower half of the first draw.
+#define PKSAV_LCRNG32_NUM_CANDIDATES 0x10000U
+
+/*
+ * Applies x -> (mult * x) + add num_steps times by repeatedly squaring the
+ * map, since composing two affine maps is another affine map.
+ */
+static uint32_t _pksav_lcrng32_jump(
+    uint32_t seed,
+    uint64_t num_steps,
+    uint32_t mult,
+    uint32_t add
+) {
+    uint32_t total_mult = 1;
+    uint32_t total_add = 0;
+
+    while(num_steps) {
+        if(num_steps & 1) {
+            total_mult *= mult;
+            total_add = (total_add * mult) + add;
+        }
+        add *= (mult + 1);
+        mult *= mult;
+        num_steps >>= 1;
+    }
+
+    return (seed * total_mult) + total_add;
+}
+
+static PKSAV_INLINE uint32_t _pksav_lcrng32_prev(
+    uint32_t seed
+) {
+    return (PKSAV_LCRNG32_REVERSE_MULT * seed) + PKSAV_LCRNG32_REVERSE_ADD;
+}
+
+static PKSAV_INLINE bool _pksav_lcrng32_method_is_valid(
+    pksav_lcrng32_method_t method
+) {
+    return (method == PKSAV_LCRNG32_METHOD_1) ||
+           (method == PKSAV_LCRNG32_METHOD_2) ||
+           (method == PKSAV_LCRNG32_METHOD_4);
+}
+
+// Given the PID's second draw, generate the IVs.
+static uint32_t _pksav_lcrng32_generate_ivs(
+    uint32_t seed,
+    pksav_lcrng32_method_t method
+) {
+    seed = lcrng32_next(seed);
+    if(method == PKSAV_LCRNG32_METHOD_2) {
+        seed = lcrng32_next(seed);
+    }
+    uint32_t iv1 = seed >> 16;
+
+    seed = lcrng32_next(seed);
+    if(method == PKSAV_LCRNG32_METHOD_4) {
+        seed = lcrng32_next(seed);
+    }
+    uint32_t iv2 = seed >> 16;
+
+    return (iv1 & 0x7FFF) | ((iv2 & 0x7FFF) << 15);
+}
+
+pksav_error_t pksav_lcrng32_advance(
+    uint32_t seed,
+    uint64_t num_steps,
+    uint32_t* seed_out
+) {
+    if(!seed_out) {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+
+    *seed_out = _pksav_lcrng32_jump(
+                    seed,
+                    num_steps,
+                    PKSAV_LCRNG32_MULT,
+                    PKSAV_LCRNG32_ADD
+                );
+
+    return PKSAV_ERROR_NONE;
+}
+
+pksav_error_t pksav_lcrng32_reverse(
+    uint32_t seed,
+    uint64_t num_steps,
+    uint32_t* seed_out
+) {
+    if(!seed_out) {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+
+    *seed_out = _pksav_lcrng32_jump(
+                    seed,
+                    num_steps,
+                    PKSAV_LCRNG32_REVERSE_MULT,
+                    PKSAV_LCRNG32_REVERSE_ADD
+                );
+
+    return PKSAV_ERROR_NONE;
+}
+
+pksav_error_t pksav_lcrng32_generate(
+    uint32_t seed,
+    pksav_lcrng32_method_t method,
+    pksav_lcrng32_spread_t* spread_out
+) {
+    if(!spread_out) {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+    if(!_pksav_lcrng32_method_is_valid(method)) {
+        return PKSAV_ERROR_PARAM_OUT_OF_RANGE;
+    }
+
+    uint32_t first = lcrng32_next(seed);
+    uint32_t second = lcrng32_next(first);
+
+    spread_out->personality = (second & 0xFFFF0000) | (first >> 16);
+    spread_out->iv_data = _pksav_lcrng32_generate_ivs(second, method);
+
+    return PKSAV_ERROR_NONE;
+}
+
+typedef struct {
+    uint32_t personality;
+    uint32_t iv_data;
+    pksav_lcrng32_method_t method;
+
+    uint32_t first_candidate;
+    uint32_t end_candidate;
+
+    // Each search writes into its own slice, indexed by candidate.
+    uint32_t* seeds;
+    size_t num_seeds;
+} pksav_lcrng32_search_t;
+
+static void _pksav_lcrng32_search(
+    void* arg
+) {
+    pksav_lcrng32_search_t* search = arg;
+    uint32_t first_high = search->personality << 16;
+    uint32_t second_high = search->personality & 0xFFFF0000;
+
+    for(uint32_t candidate = search->first_candidate; candidate < search->end_candidate; ++candidate) {
+        uint32_t first = first_high | candidate;
+        uint32_t second = lcrng32_next(first);
+
+        if(((second & 0xFFFF0000) == second_high) &&
+           (_pksav_lcrng32_generate_ivs(second, search->method) == search->iv_data)) {
+            search->seeds[search->num_seeds++] = _pksav_lcrng32_prev(first);
+        }
+    }
+}
+
+pksav_error_t pksav_lcrng32_find_seeds(
+    const pksav_lcrng32_spread_t* spread,
+    pksav_lcrng32_method_t method,
+    size_t num_threads,
+    uint32_t* seeds_out,
+    size_t max_seeds,
+    size_t* num_seeds_out
+) {
+    if(!spread || !seeds_out || !num_seeds_out) {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+    if(!_pksav_lcrng32_method_is_valid(method)) {
+        return PKSAV_ERROR_PARAM_OUT_OF_RANGE;
+    }
+
+    if(num_threads == 0) {
+        num_threads = 1;
+    } else if(num_threads > PKSAV_LCRNG32_MAX_THREADS) {
+        num_threads = PKSAV_LCRNG32_MAX_THREADS;
+    }
+
+    uint32_t* seeds = calloc(PKSAV_LCRNG32_NUM_CANDIDATES, sizeof(uint32_t));
+
+    pksav_lcrng32_search_t searches[PKSAV_LCRNG32_MAX_THREADS];
+    pksav_thread_t threads[PKSAV_LCRNG32_MAX_THREADS];
+    bool thread_started[PKSAV_LCRNG32_MAX_THREADS] = {false};
+
+    for(size_t i = 0; i < num_threads; ++i) {
+        searches[i].personality = spread->personality;
+        searches[i].iv_data = spread->iv_data & PKSAV_LCRNG32_IV_MASK;
+        searches[i].method = method;
+        searches[i].first_candidate = (uint32_t)((PKSAV_LCRNG32_NUM_CANDIDATES * i) / num_threads);
+        searches[i].end_candidate = (uint32_t)((PKSAV_LCRNG32_NUM_CANDIDATES * (i+1)) / num_threads);
+        searches[i].seeds = &seeds[searches[i].first_candidate];
+        searches[i].num_seeds = 0;
+    }
+
+    // The calling thread takes the first slice, and any that fail to start.
+    for(size_t i = 1; i < num_threads; ++i) {
+        thread_started[i] = _pksav_thread_create(&threads[i], _pksav_lcrng32_search, &searches[i]);
+    }
+    _pksav_lcrng32_search(&searches[0]);
+    for(size_t i = 1; i < num_threads; ++i) {
+        if(thread_started[i]) {
+            _pksav_thread_join(threads[i]);
+        } else {
+            _pksav_lcrng32_search(&searches[i]);
+        }
+    }
+
+    size_t num_seeds = 0;
+    for(size_t i = 0; i < num_threads; ++i) {
+        for(size_t j = 0; j < searches[i].num_seeds; ++j) {
+            if(num_seeds < max_seeds) {
+                seeds_out[num_seeds] = searches[i].seeds[j];
+            }
+            ++num_seeds;
+        }
+    }
+    *num_seeds_out = num_seeds;
+
+    free(seeds);
+
+    return PKSAV_ERROR_NONE;
+}
@@ -0,0 +1,211 @@
+/*
+ * Copyright (c) 2018 Nicholas Corgan (n.corgan@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "nds_crypt.h"
+
+#include <pksav/common/nds_crypt.h>
+
+#include <pksav/math/endian.h>
+
+#include <stdbool.h>
+#include <string.h>
+
+#define PKSAV_NDS_BLOCKS_NUM_WORDS     64
+#define PKSAV_NDS_PARTY_DATA_NUM_WORDS (sizeof(pksav_nds_pokemon_party_data_t) / 2)
+#define PKSAV_NDS_BLOCK_SIZE           32
+
+/*
+ * The keystream is the upper half of each successive LCRNG output. It is
+ * generated in eight interleaved lanes: lane j starts j+1 steps ahead of
+ * the seed, and every lane then jumps eight steps at a time. The lanes
+ * don't depend on each other, so the compiler can vectorize the loop.
+ */
+#define PKSAV_NDS_NUM_LANES 8
+
+// x -> (mult * x) + add, applied j+1 times
+static const uint32_t PKSAV_NDS_LANE_MULTS[PKSAV_NDS_NUM_LANES] = {
+    0x41C64E6DU, 0xC2A29A69U, 0x807DBCB5U, 0xEE067F11U,
+    0xEBA1483DU, 0xD3DC57F9U, 0x9B355305U, 0xCFDDDF21U
+};
+static const uint32_t PKSAV_NDS_LANE_ADDS[PKSAV_NDS_NUM_LANES] = {
+    0x00006073U, 0xE97E7B6AU, 0x52713895U, 0x31B0DDE4U,
+    0x8E425287U, 0xE2CCA5EEU, 0xAFC58AC9U, 0x67DBB608U
+};
+
+// Applied eight times, to step every lane at once
+#define PKSAV_NDS_LANE_STEP_MULT 0xCFDDDF21U
+#define PKSAV_NDS_LANE_STEP_ADD  0x67DBB608U
+
+/*
+ * For each of the 24 block orders, where in the stored data blocks A-D
+ * are found. The order is ((personality & 0x3E000) >> 13) % 24.
+ */
+static const uint8_t PKSAV_NDS_BLOCK_POSITIONS[24][4] = {
+    {0, 1, 2, 3}, {0, 1, 3, 2}, {0, 2, 1, 3}, {0, 3, 1, 2},
+    {0, 2, 3, 1}, {0, 3, 2, 1}, {1, 0, 2, 3}, {1, 0, 3, 2},
+    {2, 0, 1, 3}, {3, 0, 1, 2}, {2, 0, 3, 1}, {3, 0, 2, 1},
+    {1, 2, 0, 3}, {1, 3, 0, 2}, {2, 1, 0, 3}, {3, 1, 0, 2},
+    {2, 3, 0, 1}, {3, 2, 0, 1}, {1, 2, 3, 0}, {1, 3, 2, 0},
+    {2, 1, 3, 0}, {3, 1, 2, 0}, {2, 3, 1, 0}, {3, 2, 1, 0}
+};
+
+void _pksav_nds_crypt_words(
+    uint8_t* buffer,
+    size_t num_words,
+    uint32_t seed
+) {
+    uint16_t keystream[PKSAV_NDS_BLOCKS_NUM_WORDS];
+    uint32_t lanes[PKSAV_NDS_NUM_LANES];
+
+    for(size_t lane = 0; lane < PKSAV_NDS_NUM_LANES; ++lane) {
+        lanes[lane] = (PKSAV_NDS_LANE_MULTS[lane] * seed) + PKSAV_NDS_LANE_ADDS[lane];
+    }
+    for(size_t i = 0; i < num_words; i += PKSAV_NDS_NUM_LANES) {
+        for(size_t lane = 0; lane < PKSAV_NDS_NUM_LANES; ++lane) {
+            keystream[i + lane] = (uint16_t)(lanes[lane] >> 16);
+            lanes[lane] = (lanes[lane] * PKSAV_NDS_LANE_STEP_MULT) + PKSAV_NDS_LANE_STEP_ADD;
+        }
+    }
+
+    for(size_t i = 0; i < num_words; ++i) {
+        buffer[(2*i)]   ^= (uint8_t)(keystream[i] & 0xFF);
+        buffer[(2*i)+1] ^= (uint8_t)(keystream[i] >> 8);
+    }
+}
+
+static PKSAV_INLINE size_t _pksav_nds_block_order(
+    uint32_t personality
+) {
+    return ((personality & 0x3E000) >> 13) % 24;
+}
+
+static uint16_t _pksav_nds_blocks_checksum(
+    const pksav_nds_pokemon_blocks_t* blocks
+) {
+    uint16_t checksum = 0;
+    for(size_t i = 0; i < PKSAV_NDS_BLOCKS_NUM_WORDS; ++i) {
+        checksum += (uint16_t)(blocks->blocks8[(2*i)] | (blocks->blocks8[(2*i)+1] << 8));
+    }
+
+    return checksum;
+}
+
+void _pksav_nds_crypt_pc_pokemon(
+    pksav_nds_pc_pokemon_t* pc_pokemon,
+    bool encrypt
+) {
+    uint32_t personality = pksav_littleendian32(pc_pokemon->personality);
+    const uint8_t* positions = PKSAV_NDS_BLOCK_POSITIONS[_pksav_nds_block_order(personality)];
+
+    pksav_nds_pokemon_blocks_t blocks;
+    if(encrypt) {
+        uint16_t checksum = _pksav_nds_blocks_checksum(&pc_pokemon->blocks);
+        pc_pokemon->checksum = pksav_littleendian16(checksum);
+
+        for(size_t block = 0; block < 4; ++block) {
+            memcpy(blocks.blocks[positions[block]], pc_pokemon->blocks.blocks[block], PKSAV_NDS_BLOCK_SIZE);
+        }
+        _pksav_nds_crypt_words(blocks.blocks8, PKSAV_NDS_BLOCKS_NUM_WORDS, checksum);
+    } else {
+        _pksav_nds_crypt_words(
+            pc_pokemon->blocks.blocks8,
+            PKSAV_NDS_BLOCKS_NUM_WORDS,
+            pksav_littleendian16(pc_pokemon->checksum)
+        );
+
+        for(size_t block = 0; block < 4; ++block) {
+            memcpy(blocks.blocks[block], pc_pokemon->blocks.blocks[positions[block]], PKSAV_NDS_BLOCK_SIZE);
+        }
+    }
+
+    pc_pokemon->blocks = blocks;
+}
+
+static void _pksav_nds_crypt_party_data(
+    pksav_nds_party_pokemon_t* party_pokemon
+) {
+    _pksav_nds_crypt_words(
+        (uint8_t*)&party_pokemon->party_data,
+        PKSAV_NDS_PARTY_DATA_NUM_WORDS,
+        pksav_littleendian32(party_pokemon->pc.personality)
+    );
+}
+
+pksav_error_t pksav_nds_get_pokemon_checksum(
+    const pksav_nds_pc_pokemon_t* pc_pokemon,
+    uint16_t* checksum_out
+) {
+    if(!pc_pokemon || !checksum_out) {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+
+    *checksum_out = _pksav_nds_blocks_checksum(&pc_pokemon->blocks);
+
+    return PKSAV_ERROR_NONE;
+}
+
+pksav_error_t pksav_nds_decrypt_pc_pokemon(
+    pksav_nds_pc_pokemon_t* pc_pokemon_arr,
+    size_t num_pokemon
+) {
+    if(!pc_pokemon_arr) {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+
+    for(size_t i = 0; i < num_pokemon; ++i) {
+        _pksav_nds_crypt_pc_pokemon(&pc_pokemon_arr[i], false);
+    }
+
+    return PKSAV_ERROR_NONE;
+}
+
+pksav_error_t pksav_nds_encrypt_pc_pokemon(
+    pksav_nds_pc_pokemon_t* pc_pokemon_arr,
+    size_t num_pokemon
+) {
+    if(!pc_pokemon_arr) {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+
+    for(size_t i = 0; i < num_pokemon; ++i) {
+        _pksav_nds_crypt_pc_pokemon(&pc_pokemon_arr[i], true);
+    }
+
+    return PKSAV_ERROR_NONE;
+}
+
+pksav_error_t pksav_nds_decrypt_party_pokemon(
+    pksav_nds_party_pokemon_t* party_pokemon_arr,
+    size_t num_pokemon
+) {
+    if(!party_pokemon_arr) {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+
+    for(size_t i = 0; i < num_pokemon; ++i) {
+        _pksav_nds_crypt_pc_pokemon(&party_pokemon_arr[i].pc, false);
+        _pksav_nds_crypt_party_data(&party_pokemon_arr[i]);
+    }
+
+    return PKSAV_ERROR_NONE;
+}
+
+pksav_error_t pksav_nds_encrypt_party_pokemon(
+    pksav_nds_party_pokemon_t* party_pokemon_arr,
+    size_t num_pokemon
+) {
+    if(!party_pokemon_arr) {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+
+    for(size_t i = 0; i < num_pokemon; ++i) {
+        _pksav_nds_crypt_pc_pokemon(&party_pokemon_arr[i].pc, true);
+        _pksav_nds_crypt_party_data(&party_pokemon_arr[i]);
+    }
+
+    return PKSAV_ERROR_NONE;
+}
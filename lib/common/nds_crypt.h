@@ -0,0 +1,36 @@
+/*
+ * Copyright (c) 2018 Nicholas Corgan (n.corgan@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+
+#ifndef PKSAV_COMMON_NDS_CRYPT_INTERNAL_H
+#define PKSAV_COMMON_NDS_CRYPT_INTERNAL_H
+
+#include <pksav/common/nds_pokemon.h>
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+/*
+ * XORs the keystream for the given seed into num_words little-endian
+ * words (at most 64).
+ */
+void _pksav_nds_crypt_words(
+    uint8_t* buffer,
+    size_t num_words,
+    uint32_t seed
+);
+
+/*
+ * Decrypts and unshuffles, or recalculates the checksum, shuffles, and
+ * encrypts, a single Pokémon.
+ */
+void _pksav_nds_crypt_pc_pokemon(
+    pksav_nds_pc_pokemon_t* pc_pokemon,
+    bool encrypt
+);
+
+#endif /* PKSAV_COMMON_NDS_CRYPT_INTERNAL_H */
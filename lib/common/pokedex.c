@@ -7,15 +7,56 @@
 
 #include <pksav/common/pokedex.h>
 
-#include <math.h>
+#include <string.h>
+
+#if defined(__GNUC__) || defined(__clang__)
+#    define PKSAV_POPCOUNT64(x) ((size_t)__builtin_popcountll(x))
+#    define PKSAV_CTZ64(x)      ((size_t)__builtin_ctzll(x))
+#else
+static PKSAV_INLINE size_t PKSAV_POPCOUNT64(uint64_t x) {
+    x = x - ((x >> 1) & 0x5555555555555555ULL);
+    x = (x & 0x3333333333333333ULL) + ((x >> 2) & 0x3333333333333333ULL);
+    x = (x + (x >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+    return (size_t)((x * 0x0101010101010101ULL) >> 56);
+}
+static PKSAV_INLINE size_t PKSAV_CTZ64(uint64_t x) {
+    size_t count = 0;
+    while(!(x & 1)) {
+        x >>= 1;
+        ++count;
+    }
+    return count;
+}
+#endif
 
 static PKSAV_INLINE void _pksav_get_pokedex_bit_pos(
     uint16_t pokedex_num,
-    uint8_t* index,
+    uint16_t* index,
     uint8_t* mask
 ) {
-    *index = (uint8_t)((pokedex_num-1)/8);
-    *mask  = (uint8_t)(pow(2.0, ((pokedex_num-1)%8)));
+    *index = (uint16_t)((pokedex_num-1) / 8);
+    *mask  = (uint8_t)(1 << ((pokedex_num-1) % 8));
+}
+
+/*
+ * Bit N of the buffer (Pokédex number N+1) is bit N%8 of byte N/8, so
+ * loading bytes in little-endian order keeps Pokédex numbers in ascending
+ * bit order on any host.
+ */
+static PKSAV_INLINE uint64_t _pksav_load64le(
+    const uint8_t* bytes
+) {
+    return  (uint64_t)bytes[0]        | ((uint64_t)bytes[1] << 8)  |
+           ((uint64_t)bytes[2] << 16) | ((uint64_t)bytes[3] << 24) |
+           ((uint64_t)bytes[4] << 32) | ((uint64_t)bytes[5] << 40) |
+           ((uint64_t)bytes[6] << 48) | ((uint64_t)bytes[7] << 56);
+}
+
+// Mask for the valid bits in the last byte of a num_species-bit buffer
+static PKSAV_INLINE uint8_t _pksav_pokedex_tail_mask(
+    uint16_t num_species
+) {
+    return (uint8_t)((num_species % 8) ? ((1 << (num_species % 8)) - 1) : 0xFF);
 }
 
 pksav_error_t pksav_get_pokedex_bit(
@@ -26,8 +67,12 @@ pksav_error_t pksav_get_pokedex_bit(
     if(!raw || !result_out) {
         return PKSAV_ERROR_NULL_POINTER;
     }
+    if(pokedex_num == 0) {
+        return PKSAV_ERROR_PARAM_OUT_OF_RANGE;
+    }
 
-    uint8_t index, mask;
+    uint16_t index;
+    uint8_t mask;
     _pksav_get_pokedex_bit_pos(pokedex_num, &index, &mask);
     *result_out = (bool)(raw[index] & mask);
 
@@ -42,8 +87,12 @@ pksav_error_t pksav_set_pokedex_bit(
     if(!raw) {
         return PKSAV_ERROR_NULL_POINTER;
     }
+    if(pokedex_num == 0) {
+        return PKSAV_ERROR_PARAM_OUT_OF_RANGE;
+    }
 
-    uint8_t index, mask;
+    uint16_t index;
+    uint8_t mask;
     _pksav_get_pokedex_bit_pos(pokedex_num, &index, &mask);
     if(set) {
         raw[index] |= mask;
@@ -53,3 +102,222 @@ pksav_error_t pksav_set_pokedex_bit(
 
     return PKSAV_ERROR_NONE;
 }
+
+pksav_error_t pksav_count_pokedex_bits(
+    const uint8_t* raw,
+    uint16_t num_species,
+    uint16_t* count_out
+) {
+    if(!raw || !count_out) {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+
+    size_t num_full_bytes = num_species / 8;
+    size_t count = 0;
+    size_t i = 0;
+
+    for(; (i + 8) <= num_full_bytes; i += 8) {
+        count += PKSAV_POPCOUNT64(_pksav_load64le(&raw[i]));
+    }
+    for(; i < num_full_bytes; ++i) {
+        count += PKSAV_POPCOUNT64(raw[i]);
+    }
+    if(num_species % 8) {
+        count += PKSAV_POPCOUNT64(raw[i] & _pksav_pokedex_tail_mask(num_species));
+    }
+
+    *count_out = (uint16_t)count;
+
+    return PKSAV_ERROR_NONE;
+}
+
+pksav_error_t pksav_set_pokedex_bit_range(
+    uint8_t* raw,
+    uint16_t first_pokedex_num,
+    uint16_t last_pokedex_num,
+    bool set
+) {
+    if(!raw) {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+    if((first_pokedex_num == 0) || (last_pokedex_num < first_pokedex_num)) {
+        return PKSAV_ERROR_PARAM_OUT_OF_RANGE;
+    }
+
+    size_t first_bit = first_pokedex_num - 1;
+    size_t last_bit = last_pokedex_num - 1;
+    size_t first_byte = first_bit / 8;
+    size_t last_byte = last_bit / 8;
+
+    uint8_t first_mask = (uint8_t)(0xFF << (first_bit % 8));
+    uint8_t last_mask = (uint8_t)(0xFF >> (7 - (last_bit % 8)));
+
+    if(first_byte == last_byte) {
+        first_mask &= last_mask;
+    }
+
+    if(set) {
+        raw[first_byte] |= first_mask;
+    } else {
+        raw[first_byte] &= ~first_mask;
+    }
+
+    if(last_byte > first_byte) {
+        memset(
+            &raw[first_byte+1],
+            set ? 0xFF : 0x00,
+            last_byte - first_byte - 1
+        );
+
+        if(set) {
+            raw[last_byte] |= last_mask;
+        } else {
+            raw[last_byte] &= ~last_mask;
+        }
+    }
+
+    return PKSAV_ERROR_NONE;
+}
+
+pksav_error_t pksav_get_next_pokedex_bit(
+    const uint8_t* raw,
+    uint16_t num_species,
+    uint16_t pokedex_num,
+    uint16_t* next_pokedex_num_out
+) {
+    if(!raw || !next_pokedex_num_out) {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+
+    *next_pokedex_num_out = 0;
+
+    // Bit positions are zero-based, so the next candidate bit is pokedex_num.
+    size_t bit = pokedex_num;
+    if(bit >= num_species) {
+        return PKSAV_ERROR_NONE;
+    }
+
+    size_t num_bytes = (num_species + 7) / 8;
+    size_t byte_index = bit / 8;
+
+    // Finish the current byte first, then skip empty words.
+    uint64_t word = (uint64_t)(raw[byte_index] & (uint8_t)(0xFF << (bit % 8)));
+    size_t word_base = byte_index * 8;
+    ++byte_index;
+
+    while(!word && (byte_index < num_bytes)) {
+        word_base = byte_index * 8;
+        if((byte_index + 8) <= num_bytes) {
+            word = _pksav_load64le(&raw[byte_index]);
+            byte_index += 8;
+        } else {
+            word = raw[byte_index];
+            ++byte_index;
+        }
+    }
+
+    if(word) {
+        size_t found = word_base + PKSAV_CTZ64(word);
+        if(found < num_species) {
+            *next_pokedex_num_out = (uint16_t)(found + 1);
+        }
+    }
+
+    return PKSAV_ERROR_NONE;
+}
+
+typedef enum {
+    PKSAV_POKEDEX_UNION,
+    PKSAV_POKEDEX_INTERSECTION,
+    PKSAV_POKEDEX_DIFFERENCE
+} pksav_pokedex_op_t;
+
+/*
+ * Simple byte loops, which compilers vectorize well. The last byte is
+ * merged so bits past num_species, which may belong to other save data,
+ * are left alone.
+ */
+static void _pksav_pokedex_set_op(
+    const uint8_t* raw1,
+    const uint8_t* raw2,
+    uint16_t num_species,
+    uint8_t* output_buffer,
+    pksav_pokedex_op_t op
+) {
+    size_t num_full_bytes = num_species / 8;
+
+    switch(op) {
+        case PKSAV_POKEDEX_UNION:
+            for(size_t i = 0; i < num_full_bytes; ++i) {
+                output_buffer[i] = raw1[i] | raw2[i];
+            }
+            break;
+
+        case PKSAV_POKEDEX_INTERSECTION:
+            for(size_t i = 0; i < num_full_bytes; ++i) {
+                output_buffer[i] = raw1[i] & raw2[i];
+            }
+            break;
+
+        default:
+            for(size_t i = 0; i < num_full_bytes; ++i) {
+                output_buffer[i] = raw1[i] & ~raw2[i];
+            }
+            break;
+    }
+
+    if(num_species % 8) {
+        size_t i = num_full_bytes;
+        uint8_t mask = _pksav_pokedex_tail_mask(num_species);
+        uint8_t tail = (op == PKSAV_POKEDEX_UNION)        ? (raw1[i] | raw2[i]) :
+                       (op == PKSAV_POKEDEX_INTERSECTION) ? (raw1[i] & raw2[i]) :
+                                                            (raw1[i] & ~raw2[i]);
+
+        output_buffer[i] = (output_buffer[i] & ~mask) | (tail & mask);
+    }
+}
+
+pksav_error_t pksav_union_pokedex_bits(
+    const uint8_t* raw1,
+    const uint8_t* raw2,
+    uint16_t num_species,
+    uint8_t* output_buffer
+) {
+    if(!raw1 || !raw2 || !output_buffer) {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+
+    _pksav_pokedex_set_op(raw1, raw2, num_species, output_buffer, PKSAV_POKEDEX_UNION);
+
+    return PKSAV_ERROR_NONE;
+}
+
+pksav_error_t pksav_intersect_pokedex_bits(
+    const uint8_t* raw1,
+    const uint8_t* raw2,
+    uint16_t num_species,
+    uint8_t* output_buffer
+) {
+    if(!raw1 || !raw2 || !output_buffer) {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+
+    _pksav_pokedex_set_op(raw1, raw2, num_species, output_buffer, PKSAV_POKEDEX_INTERSECTION);
+
+    return PKSAV_ERROR_NONE;
+}
+
+pksav_error_t pksav_subtract_pokedex_bits(
+    const uint8_t* raw1,
+    const uint8_t* raw2,
+    uint16_t num_species,
+    uint8_t* output_buffer
+) {
+    if(!raw1 || !raw2 || !output_buffer) {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+
+    _pksav_pokedex_set_op(raw1, raw2, num_species, output_buffer, PKSAV_POKEDEX_DIFFERENCE);
+
+    return PKSAV_ERROR_NONE;
+}
@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2018 Nicholas Corgan (n.corgan@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "pokemon_record.h"
+
+#include <pksav/gen4/text.h>
+#include <pksav/gen5/text.h>
+
+#include <pksav/math/endian.h>
+
+#include <string.h>
+
+// The HP IV is made of the lowest bit of each other IV.
+void _pksav_record_set_gb_IVs(
+    pksav_pokemon_record_t* record,
+    uint16_t iv_data
+) {
+    uint8_t special = (uint8_t)(iv_data & 0x0F);
+
+    record->IVs[0] = (uint8_t)(((iv_data >> 9) & 0x08) | ((iv_data >> 6) & 0x04)
+                             | ((iv_data >> 3) & 0x02) |  (iv_data & 0x01));
+    record->IVs[1] = (uint8_t)((iv_data >> 12) & 0x0F);
+    record->IVs[2] = (uint8_t)((iv_data >> 8) & 0x0F);
+    record->IVs[3] = (uint8_t)((iv_data >> 4) & 0x0F);
+    record->IVs[4] = special;
+    record->IVs[5] = special;
+}
+
+void _pksav_record_set_IVs(
+    pksav_pokemon_record_t* record,
+    uint32_t iv_data
+) {
+    for(size_t i = 0; i < 6; ++i) {
+        record->IVs[i] = (uint8_t)((iv_data >> (5 * i)) & 0x1F);
+    }
+}
+
+void _pksav_nds_pc_pokemon_to_record(
+    const pksav_nds_pc_pokemon_t* pc_pokemon,
+    uint8_t generation,
+    pksav_pokemon_record_t* record_out
+) {
+    const pksav_nds_pokemon_blockA_t* blockA = &pc_pokemon->blocks.blockA;
+    const pksav_nds_pokemon_blockB_t* blockB = &pc_pokemon->blocks.blockB;
+    const pksav_nds_pokemon_blockC_t* blockC = &pc_pokemon->blocks.blockC;
+    const pksav_nds_pokemon_blockD_t* blockD = &pc_pokemon->blocks.blockD;
+
+    memset(record_out, 0, sizeof(*record_out));
+
+    record_out->personality  = pksav_littleendian32(pc_pokemon->personality);
+    record_out->exp          = pksav_littleendian32(blockA->exp);
+    record_out->pokedex_num  = pksav_littleendian16(blockA->species);
+    record_out->held_item    = pksav_littleendian16(blockA->held_item);
+    record_out->ot_public_id = pksav_littleendian16(blockA->ot_id.pid);
+    record_out->ot_secret_id = pksav_littleendian16(blockA->ot_id.sid);
+    for(size_t i = 0; i < 4; ++i) {
+        record_out->moves[i] = pksav_littleendian16(blockB->moves[i]);
+    }
+
+    record_out->EVs[0] = blockA->ev_hp;
+    record_out->EVs[1] = blockA->ev_atk;
+    record_out->EVs[2] = blockA->ev_def;
+    record_out->EVs[3] = blockA->ev_spd;
+    record_out->EVs[4] = blockA->ev_spatk;
+    record_out->EVs[5] = blockA->ev_spdef;
+
+    uint32_t iv_isegg_isnicknamed = pksav_littleendian32(blockB->iv_isegg_isnicknamed);
+    _pksav_record_set_IVs(record_out, iv_isegg_isnicknamed);
+
+    record_out->friendship = blockA->friendship;
+    record_out->pokerus    = blockD->pokerus;
+    record_out->generation = generation;
+
+    // Generation V stores the nature separately from the personality.
+    record_out->nature = (generation == 5) ? blockB->nature
+                                           : (uint8_t)(record_out->personality % 25);
+
+    if(iv_isegg_isnicknamed & PKSAV_NDS_ISEGG_MASK) {
+        record_out->flags |= PKSAV_POKEMON_RECORD_IS_EGG_MASK;
+    }
+    if(_pksav_record_is_shiny(record_out)) {
+        record_out->flags |= PKSAV_POKEMON_RECORD_IS_SHINY_MASK;
+    }
+    if(blockD->metlevel_otgender & PKSAV_NDS_OTGENDER_MASK) {
+        record_out->flags |= PKSAV_POKEMON_RECORD_OT_FEMALE_MASK;
+    }
+
+    if(generation == 5) {
+        pksav_text_from_gen5_utf8(blockC->nickname, 10, record_out->nickname, PKSAV_POKEMON_RECORD_NAME_SIZE, NULL);
+        pksav_text_from_gen5_utf8(blockD->otname, 7, record_out->otname, PKSAV_POKEMON_RECORD_NAME_SIZE, NULL);
+    } else {
+        pksav_text_from_gen4_utf8(blockC->nickname, 10, record_out->nickname, PKSAV_POKEMON_RECORD_NAME_SIZE, NULL);
+        pksav_text_from_gen4_utf8(blockD->otname, 7, record_out->otname, PKSAV_POKEMON_RECORD_NAME_SIZE, NULL);
+    }
+}
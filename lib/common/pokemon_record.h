@@ -0,0 +1,51 @@
+/*
+ * Copyright (c) 2018 Nicholas Corgan (n.corgan@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+
+#ifndef PKSAV_COMMON_POKEMON_RECORD_INTERNAL_H
+#define PKSAV_COMMON_POKEMON_RECORD_INTERNAL_H
+
+#include <pksav/config.h>
+
+#include <pksav/common/nds_pokemon.h>
+#include <pksav/common/pokemon_record.h>
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Unpacks Generation I-II IV data, in host byte order.
+void _pksav_record_set_gb_IVs(
+    pksav_pokemon_record_t* record,
+    uint16_t iv_data
+);
+
+// Unpacks Generation III+ IV data, in host byte order.
+void _pksav_record_set_IVs(
+    pksav_pokemon_record_t* record,
+    uint32_t iv_data
+);
+
+static PKSAV_INLINE bool _pksav_record_is_shiny(
+    const pksav_pokemon_record_t* record
+) {
+    uint16_t value = record->ot_public_id ^ record->ot_secret_id
+                   ^ (uint16_t)(record->personality >> 16)
+                   ^ (uint16_t)(record->personality & 0xFFFF);
+
+    return (value < 8);
+}
+
+/*
+ * Fills in everything stored in a decrypted Nintendo DS Pokémon's PC data.
+ * The level is set to 0.
+ */
+void _pksav_nds_pc_pokemon_to_record(
+    const pksav_nds_pc_pokemon_t* pc_pokemon,
+    uint8_t generation,
+    pksav_pokemon_record_t* record_out
+);
+
+#endif /* PKSAV_COMMON_POKEMON_RECORD_INTERNAL_H */
@@ -5,23 +5,504 @@
  * or copy at http://opensource.org/licenses/MIT)
  */
 
+#include "thread.h"
+
 #include <pksav/common/prng.h>
 
-#include <math.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
 #include <time.h>
 
-pksav_error_t pksav_mtrng_populate(
+/*
+ * MT19937, as described in Matsumoto and Nishimura's reference
+ * implementation.
+ *
+ * Rather than regenerating all 624 words at once, pksav_mtrng_t.index points
+ * to the oldest word, which is replaced each time a number is drawn. This
+ * produces the same sequence as the reference implementation, but every
+ * state is exactly one step after the previous one, which the jump-ahead
+ * below relies on.
+ */
+
+#define PKSAV_MT_N          PKSAV_MTRNG_STATE_SIZE
+#define PKSAV_MT_M          397
+#define PKSAV_MT_MATRIX_A   0x9908B0DFU
+#define PKSAV_MT_UPPER_MASK 0x80000000U
+#define PKSAV_MT_LOWER_MASK 0x7FFFFFFFU
+
+static PKSAV_INLINE uint32_t _pksav_mt_twist(
+    uint32_t oldest,
+    uint32_t next,
+    uint32_t middle
+) {
+    uint32_t y = (oldest & PKSAV_MT_UPPER_MASK) | (next & PKSAV_MT_LOWER_MASK);
+
+    return middle ^ (y >> 1) ^ ((0U - (y & 1U)) & PKSAV_MT_MATRIX_A);
+}
+
+static PKSAV_INLINE uint32_t _pksav_mt_temper(
+    uint32_t y
+) {
+    y ^= (y >> 11);
+    y ^= (y << 7) & 0x9D2C5680U;
+    y ^= (y << 15) & 0xEFC60000U;
+    y ^= (y >> 18);
+
+    return y;
+}
+
+// Replaces the oldest word and returns it, untempered.
+static PKSAV_INLINE uint32_t _pksav_mtrng_step(
     pksav_mtrng_t* mtrng
+) {
+    size_t i = mtrng->index;
+    size_t next = (i == (PKSAV_MT_N - 1)) ? 0 : (i + 1);
+    size_t middle = (i >= (PKSAV_MT_N - PKSAV_MT_M)) ? (i + PKSAV_MT_M - PKSAV_MT_N)
+                                                      : (i + PKSAV_MT_M);
+
+    mtrng->nums[i] = _pksav_mt_twist(
+                         mtrng->nums[i],
+                         mtrng->nums[next],
+                         mtrng->nums[middle]
+                     );
+    mtrng->index = next;
+
+    return mtrng->nums[i];
+}
+
+// Equivalent to 624 steps, but only valid when index is 0.
+static void _pksav_mtrng_regenerate(
+    pksav_mtrng_t* mtrng
+) {
+    uint32_t* mt = mtrng->nums;
+    size_t kk = 0;
+
+    for(; kk < (PKSAV_MT_N - PKSAV_MT_M); ++kk) {
+        mt[kk] = _pksav_mt_twist(mt[kk], mt[kk+1], mt[kk+PKSAV_MT_M]);
+    }
+    for(; kk < (PKSAV_MT_N - 1); ++kk) {
+        mt[kk] = _pksav_mt_twist(mt[kk], mt[kk+1], mt[kk+PKSAV_MT_M-PKSAV_MT_N]);
+    }
+    mt[PKSAV_MT_N-1] = _pksav_mt_twist(mt[PKSAV_MT_N-1], mt[0], mt[PKSAV_MT_M-1]);
+}
+
+static void _pksav_mtrng_init_genrand(
+    pksav_mtrng_t* mtrng,
+    uint32_t seed
+) {
+    mtrng->nums[0] = seed;
+    for(size_t i = 1; i < PKSAV_MT_N; ++i) {
+        mtrng->nums[i] = (1812433253U * (mtrng->nums[i-1] ^ (mtrng->nums[i-1] >> 30)))
+                       + (uint32_t)i;
+    }
+    mtrng->index = 0;
+}
+
+static void _pksav_mtrng_init_by_array(
+    pksav_mtrng_t* mtrng,
+    const uint32_t* key,
+    size_t key_length
+) {
+    uint32_t* mt = mtrng->nums;
+    size_t i = 1;
+    size_t j = 0;
+
+    _pksav_mtrng_init_genrand(mtrng, 19650218U);
+
+    for(size_t k = (PKSAV_MT_N > key_length) ? PKSAV_MT_N : key_length; k > 0; --k) {
+        mt[i] = (mt[i] ^ ((mt[i-1] ^ (mt[i-1] >> 30)) * 1664525U)) + key[j] + (uint32_t)j;
+        ++i;
+        ++j;
+        if(i >= PKSAV_MT_N) {
+            mt[0] = mt[PKSAV_MT_N-1];
+            i = 1;
+        }
+        if(j >= key_length) {
+            j = 0;
+        }
+    }
+    for(size_t k = PKSAV_MT_N - 1; k > 0; --k) {
+        mt[i] = (mt[i] ^ ((mt[i-1] ^ (mt[i-1] >> 30)) * 1566083941U)) - (uint32_t)i;
+        ++i;
+        if(i >= PKSAV_MT_N) {
+            mt[0] = mt[PKSAV_MT_N-1];
+            i = 1;
+        }
+    }
+
+    // Guarantees a non-zero state
+    mt[0] = 0x80000000U;
+    mtrng->index = 0;
+}
+
+/*
+ * Jump-ahead
+ *
+ * MT19937's transition is linear over GF(2), so its state after n steps is
+ * p(T) applied to the current state, where p(x) = x^n mod phi(x) and phi is
+ * the transition's characteristic polynomial (degree 19937). x^n mod phi is
+ * computed by square-and-multiply, and p(T) is applied with Horner's method,
+ * which only needs single steps and state additions.
+ *
+ * Rather than shipping phi as a table, it's recovered once per process with
+ * Berlekamp-Massey from 2 * 19968 output bits of a fixed seed.
+ */
+
+#define PKSAV_MT_DEGREE 19937
+#define PKSAV_MT_POLY_WORDS ((PKSAV_MT_DEGREE + 63) / 64)
+#define PKSAV_MT_PRODUCT_WORDS (PKSAV_MT_POLY_WORDS * 2)
+
+// Two full states' worth of bits, which is more than the 2 * 19937 needed
+#define PKSAV_MT_BM_BITS  (PKSAV_MT_N * 32 * 2)
+#define PKSAV_MT_BM_WORDS (PKSAV_MT_BM_BITS / 64)
+
+// Below this, just stepping is faster than polynomial arithmetic.
+#define PKSAV_MT_DIRECT_JUMP_THRESHOLD (1ULL << 20)
+
+#define PKSAV_MT_STREAM_SPACING_BITS 48
+
+// phi(x) - x^19937
+static uint64_t _pksav_mt_phi_low[PKSAV_MT_POLY_WORDS];
+
+// For each byte b, b(x) * x^19937 mod phi(x), for reducing 8 bits at a time
+static uint64_t _pksav_mt_reduction_table[256][PKSAV_MT_POLY_WORDS];
+
+static pksav_once_t _pksav_mt_poly_once = PKSAV_ONCE_INIT;
+
+static PKSAV_INLINE bool _pksav_poly_get_bit(
+    const uint64_t* poly,
+    size_t bit
+) {
+    return (poly[bit >> 6] >> (bit & 63)) & 1;
+}
+
+// Returns 64 bits starting at the given bit. The word after the last one read must exist.
+static PKSAV_INLINE uint64_t _pksav_poly_get_word(
+    const uint64_t* poly,
+    size_t bit
+) {
+    size_t word = bit >> 6;
+    unsigned int shift = (unsigned int)(bit & 63);
+
+    return shift ? ((poly[word] >> shift) | (poly[word+1] << (64 - shift)))
+                 : poly[word];
+}
+
+// dst ^= src * x^shift, dropping anything past dst_words
+static void _pksav_poly_xor_shifted(
+    uint64_t* dst,
+    size_t dst_words,
+    const uint64_t* src,
+    size_t src_words,
+    size_t shift
+) {
+    size_t word_shift = shift >> 6;
+    unsigned int bit_shift = (unsigned int)(shift & 63);
+
+    for(size_t i = 0; (i < src_words) && ((i + word_shift) < dst_words); ++i) {
+        size_t d = i + word_shift;
+        if(bit_shift) {
+            dst[d] ^= (src[i] << bit_shift);
+            if((d + 1) < dst_words) {
+                dst[d+1] ^= (src[i] >> (64 - bit_shift));
+            }
+        } else {
+            dst[d] ^= src[i];
+        }
+    }
+}
+
+// poly *= x, mod phi
+static void _pksav_mt_poly_mulx(
+    uint64_t* poly
+) {
+    uint64_t carry = 0;
+    for(size_t i = 0; i < PKSAV_MT_POLY_WORDS; ++i) {
+        uint64_t next_carry = poly[i] >> 63;
+        poly[i] = (poly[i] << 1) | carry;
+        carry = next_carry;
+    }
+
+    if(_pksav_poly_get_bit(poly, PKSAV_MT_DEGREE)) {
+        poly[PKSAV_MT_DEGREE >> 6] ^= (1ULL << (PKSAV_MT_DEGREE & 63));
+        for(size_t i = 0; i < PKSAV_MT_POLY_WORDS; ++i) {
+            poly[i] ^= _pksav_mt_phi_low[i];
+        }
+    }
+}
+
+static PKSAV_INLINE uint64_t _pksav_spread32(
+    uint32_t input
+) {
+    uint64_t value = input;
+    value = (value | (value << 16)) & 0x0000FFFF0000FFFFULL;
+    value = (value | (value << 8))  & 0x00FF00FF00FF00FFULL;
+    value = (value | (value << 4))  & 0x0F0F0F0F0F0F0F0FULL;
+    value = (value | (value << 2))  & 0x3333333333333333ULL;
+    value = (value | (value << 1))  & 0x5555555555555555ULL;
+
+    return value;
+}
+
+// poly = poly^2 mod phi
+static void _pksav_mt_poly_square(
+    uint64_t* poly
+) {
+    uint64_t product[PKSAV_MT_PRODUCT_WORDS];
+
+    // Squaring over GF(2) just spreads the bits out.
+    for(size_t i = 0; i < PKSAV_MT_POLY_WORDS; ++i) {
+        product[2*i]   = _pksav_spread32((uint32_t)poly[i]);
+        product[2*i+1] = _pksav_spread32((uint32_t)(poly[i] >> 32));
+    }
+
+    // Clear the top 8 bits at a time, from the highest possible degree down.
+    for(size_t chunk = ((PKSAV_MT_DEGREE - 2) / 8) + 1; chunk > 0; --chunk) {
+        size_t shift = (chunk - 1) * 8;
+        size_t bit = PKSAV_MT_DEGREE + shift;
+        uint64_t byte = _pksav_poly_get_word(product, bit) & 0xFF;
+
+        if(byte) {
+            _pksav_poly_xor_shifted(product, PKSAV_MT_PRODUCT_WORDS, &byte, 1, bit);
+            _pksav_poly_xor_shifted(
+                product,
+                PKSAV_MT_PRODUCT_WORDS,
+                _pksav_mt_reduction_table[byte],
+                PKSAV_MT_POLY_WORDS,
+                shift
+            );
+        }
+    }
+
+    memcpy(poly, product, sizeof(uint64_t) * PKSAV_MT_POLY_WORDS);
+}
+
+/*
+ * Returns the length of the shortest linear recurrence generating the
+ * sequence, whose connection polynomial is stored in connection. The
+ * sequence is given in reverse, so each window is contiguous.
+ */
+static size_t _pksav_berlekamp_massey(
+    const uint64_t* reversed_sequence,
+    size_t num_bits,
+    uint64_t* connection,
+    size_t num_words
+) {
+    uint64_t* prev = calloc(num_words, sizeof(uint64_t));
+    uint64_t* temp = calloc(num_words, sizeof(uint64_t));
+    size_t length = 0;
+    size_t prev_length = 0;
+    size_t shift = 1;
+
+    memset(connection, 0, sizeof(uint64_t) * num_words);
+    connection[0] = 1;
+    prev[0] = 1;
+
+    for(size_t n = 0; n < num_bits; ++n) {
+        size_t offset = num_bits - 1 - n;
+        uint64_t discrepancy = 0;
+        for(size_t w = 0; w <= (length >> 6); ++w) {
+            discrepancy ^= connection[w] & _pksav_poly_get_word(reversed_sequence, offset + (w << 6));
+        }
+        discrepancy ^= (discrepancy >> 32);
+        discrepancy ^= (discrepancy >> 16);
+        discrepancy ^= (discrepancy >> 8);
+        discrepancy ^= (discrepancy >> 4);
+        discrepancy ^= (discrepancy >> 2);
+        discrepancy ^= (discrepancy >> 1);
+
+        if(!(discrepancy & 1)) {
+            ++shift;
+        } else if((2 * length) <= n) {
+            size_t copy_words = (length >> 6) + 1;
+            memcpy(temp, connection, sizeof(uint64_t) * copy_words);
+            _pksav_poly_xor_shifted(connection, num_words, prev, (prev_length >> 6) + 1, shift);
+
+            prev_length = length;
+            length = n + 1 - length;
+            memset(prev, 0, sizeof(uint64_t) * num_words);
+            memcpy(prev, temp, sizeof(uint64_t) * copy_words);
+            shift = 1;
+        } else {
+            _pksav_poly_xor_shifted(connection, num_words, prev, (prev_length >> 6) + 1, shift);
+            ++shift;
+        }
+    }
+
+    free(temp);
+    free(prev);
+
+    return length;
+}
+
+static void _pksav_mt_init_poly(void) {
+    // Extra padding words so windows can read past the end
+    uint64_t* reversed_sequence = calloc(PKSAV_MT_BM_WORDS + 2, sizeof(uint64_t));
+    uint64_t* connection = calloc(PKSAV_MT_BM_WORDS + 2, sizeof(uint64_t));
+    pksav_mtrng_t mtrng;
+
+    _pksav_mtrng_init_genrand(&mtrng, 5489U);
+    for(size_t n = 0; n < PKSAV_MT_BM_BITS; ++n) {
+        if(_pksav_mt_temper(_pksav_mtrng_step(&mtrng)) & 1) {
+            size_t bit = PKSAV_MT_BM_BITS - 1 - n;
+            reversed_sequence[bit >> 6] |= (1ULL << (bit & 63));
+        }
+    }
+
+    /*
+     * MT19937's characteristic polynomial is primitive, so any non-zero output
+     * sequence has it as its minimal polynomial. This always finds a length of
+     * 19937 for this seed, and phi is the connection polynomial reversed.
+     */
+    size_t length = _pksav_berlekamp_massey(
+                        reversed_sequence,
+                        PKSAV_MT_BM_BITS,
+                        connection,
+                        PKSAV_MT_BM_WORDS + 2
+                    );
+    (void)length;
+
+    for(size_t i = 1; i <= PKSAV_MT_DEGREE; ++i) {
+        if(_pksav_poly_get_bit(connection, i)) {
+            size_t bit = PKSAV_MT_DEGREE - i;
+            _pksav_mt_phi_low[bit >> 6] |= (1ULL << (bit & 63));
+        }
+    }
+
+    // x^(19937+j) mod phi for each bit j of a byte, then every combination
+    uint64_t powers[8][PKSAV_MT_POLY_WORDS];
+    memcpy(powers[0], _pksav_mt_phi_low, sizeof(powers[0]));
+    for(size_t j = 1; j < 8; ++j) {
+        memcpy(powers[j], powers[j-1], sizeof(powers[j]));
+        _pksav_mt_poly_mulx(powers[j]);
+    }
+    for(size_t b = 1; b < 256; ++b) {
+        size_t lowest_bit = 0;
+        while(!(b & (1U << lowest_bit))) {
+            ++lowest_bit;
+        }
+        for(size_t i = 0; i < PKSAV_MT_POLY_WORDS; ++i) {
+            _pksav_mt_reduction_table[b][i] = _pksav_mt_reduction_table[b & (b - 1)][i]
+                                            ^ powers[lowest_bit][i];
+        }
+    }
+
+    free(connection);
+    free(reversed_sequence);
+}
+
+// dst += src, where each state's words are taken from its oldest onward
+static void _pksav_mtrng_add_state(
+    pksav_mtrng_t* dst,
+    const pksav_mtrng_t* src
+) {
+    size_t dst_index = dst->index;
+    size_t src_index = src->index;
+
+    for(size_t i = 0; i < PKSAV_MT_N; ++i) {
+        dst->nums[dst_index] ^= src->nums[src_index];
+        if(++dst_index == PKSAV_MT_N) {
+            dst_index = 0;
+        }
+        if(++src_index == PKSAV_MT_N) {
+            src_index = 0;
+        }
+    }
+}
+
+/*
+ * Advances the state by exponent * 2^extra_squarings steps.
+ *
+ * The only bits that may differ from stepping are the unused lower 31 bits
+ * of the oldest word, which never affect any output.
+ */
+static void _pksav_mtrng_jump(
+    pksav_mtrng_t* mtrng,
+    uint64_t exponent,
+    size_t extra_squarings
+) {
+    if((extra_squarings == 0) && (exponent < PKSAV_MT_DIRECT_JUMP_THRESHOLD)) {
+        for(uint64_t i = 0; i < exponent; ++i) {
+            (void)_pksav_mtrng_step(mtrng);
+        }
+        return;
+    }
+
+    _pksav_call_once(&_pksav_mt_poly_once, _pksav_mt_init_poly);
+
+    uint64_t jump_poly[PKSAV_MT_POLY_WORDS] = {0};
+    bool started = false;
+
+    jump_poly[0] = 1;
+    for(int bit = 63; bit >= 0; --bit) {
+        if(started) {
+            _pksav_mt_poly_square(jump_poly);
+        }
+        if((exponent >> bit) & 1) {
+            _pksav_mt_poly_mulx(jump_poly);
+            started = true;
+        }
+    }
+    for(size_t i = 0; i < extra_squarings; ++i) {
+        _pksav_mt_poly_square(jump_poly);
+    }
+
+    pksav_mtrng_t result;
+    memset(&result, 0, sizeof(result));
+
+    started = false;
+    for(size_t i = PKSAV_MT_DEGREE; i > 0; --i) {
+        if(started) {
+            (void)_pksav_mtrng_step(&result);
+        }
+        if(_pksav_poly_get_bit(jump_poly, i - 1)) {
+            _pksav_mtrng_add_state(&result, mtrng);
+            started = true;
+        }
+    }
+
+    *mtrng = result;
+}
+
+pksav_error_t pksav_mtrng_seed(
+    pksav_mtrng_t* mtrng,
+    uint32_t seed
 ) {
     if(!mtrng) {
         return PKSAV_ERROR_NULL_POINTER;
     }
 
-    srand((unsigned int)time(NULL));
-    for(size_t i = 0; i < 624; ++i) {
-        mtrng->nums[i] = (uint32_t)rand();
+    _pksav_mtrng_init_genrand(mtrng, seed);
+
+    return PKSAV_ERROR_NONE;
+}
+
+static volatile uint32_t _pksav_mtrng_populate_counter = 0;
+
+pksav_error_t pksav_mtrng_populate(
+    pksav_mtrng_t* mtrng
+) {
+    if(!mtrng) {
+        return PKSAV_ERROR_NULL_POINTER;
     }
-    mtrng->index = 0;
+
+    uint64_t now = (uint64_t)time(NULL);
+    uint64_t address = (uint64_t)(uintptr_t)mtrng;
+    uint32_t key[] = {
+        (uint32_t)now,
+        (uint32_t)(now >> 32),
+        (uint32_t)clock(),
+        (uint32_t)address,
+        (uint32_t)(address >> 32),
+        _pksav_atomic_increment(&_pksav_mtrng_populate_counter)
+    };
+
+    _pksav_mtrng_init_by_array(
+        mtrng,
+        key,
+        sizeof(key) / sizeof(key[0])
+    );
 
     return PKSAV_ERROR_NONE;
 }
@@ -34,14 +515,68 @@ pksav_error_t pksav_mtrng_next(
         return PKSAV_ERROR_NULL_POINTER;
     }
 
-    uint32_t ret = mtrng->nums[mtrng->index];
-    if(mtrng->index == 623) {
-        (void)pksav_mtrng_populate(mtrng);
-    } else {
-        ++mtrng->index;
+    *next_out = _pksav_mt_temper(_pksav_mtrng_step(mtrng));
+
+    return PKSAV_ERROR_NONE;
+}
+
+pksav_error_t pksav_mtrng_fill(
+    pksav_mtrng_t* mtrng,
+    uint32_t* output_buffer,
+    size_t num_outputs
+) {
+    if(!mtrng || !output_buffer) {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+
+    size_t pos = 0;
+
+    // Step until we're at a block boundary.
+    while((pos < num_outputs) && (mtrng->index != 0)) {
+        output_buffer[pos++] = _pksav_mt_temper(_pksav_mtrng_step(mtrng));
+    }
+
+    while((num_outputs - pos) >= PKSAV_MT_N) {
+        _pksav_mtrng_regenerate(mtrng);
+        for(size_t i = 0; i < PKSAV_MT_N; ++i) {
+            output_buffer[pos+i] = _pksav_mt_temper(mtrng->nums[i]);
+        }
+        pos += PKSAV_MT_N;
+    }
+
+    while(pos < num_outputs) {
+        output_buffer[pos++] = _pksav_mt_temper(_pksav_mtrng_step(mtrng));
+    }
+
+    return PKSAV_ERROR_NONE;
+}
+
+pksav_error_t pksav_mtrng_jump(
+    pksav_mtrng_t* mtrng,
+    uint64_t num_steps
+) {
+    if(!mtrng) {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+
+    _pksav_mtrng_jump(mtrng, num_steps, 0);
+
+    return PKSAV_ERROR_NONE;
+}
+
+pksav_error_t pksav_mtrng_split(
+    const pksav_mtrng_t* base_mtrng,
+    uint64_t stream_index,
+    pksav_mtrng_t* mtrng_out
+) {
+    if(!base_mtrng || !mtrng_out) {
+        return PKSAV_ERROR_NULL_POINTER;
     }
 
-    *next_out = ret;
+    *mtrng_out = *base_mtrng;
+    if(stream_index > 0) {
+        _pksav_mtrng_jump(mtrng_out, stream_index, PKSAV_MT_STREAM_SPACING_BITS);
+    }
 
     return PKSAV_ERROR_NONE;
 }
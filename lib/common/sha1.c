@@ -158,7 +158,7 @@ void SHAPrintContext(SHA1_CTX *context, char *msg)
 
 /* Hash a single 512-bit block. This is the core of the algorithm. */
 
-static inline void SHA1Transform(u32 state[5], const u8 buffer[64])
+static inline void SHA1Transform(u32 state[5], const u8 *buffer)
 {
 	u32 a, b, c, d, e;
 	u32 l[16];
@@ -10,12 +10,21 @@
 #include <pksav/common/stats.h>
 
 #include <math.h>
+#include <string.h>
 
 #define PKSAV_GB_ATK_IV_MASK  ((uint16_t)0xF000)
 #define PKSAV_GB_DEF_IV_MASK  ((uint16_t)0x0F00)
 #define PKSAV_GB_SPD_IV_MASK  ((uint16_t)0x00F0)
 #define PKSAV_GB_SPCL_IV_MASK ((uint16_t)0x000F)
 
+// The HP IV is made of the lowest bit of each other IV.
+static PKSAV_INLINE uint8_t _pksav_gb_hp_IV(
+    uint32_t raw
+) {
+    return (uint8_t)(((raw >> 9) & 0x08) | ((raw >> 6) & 0x04)
+                   | ((raw >> 3) & 0x02) |  (raw & 0x01));
+}
+
 pksav_error_t pksav_get_gb_IV(
     const uint16_t* raw,
     pksav_battle_stat_t stat,
@@ -26,16 +35,9 @@ pksav_error_t pksav_get_gb_IV(
     }
 
     switch(stat) {
-        case PKSAV_STAT_HP: {
-            uint8_t atk, def, spd, spcl;
-            (void)pksav_get_gb_IV(raw, PKSAV_STAT_ATTACK,  &atk);
-            (void)pksav_get_gb_IV(raw, PKSAV_STAT_DEFENSE, &def);
-            (void)pksav_get_gb_IV(raw, PKSAV_STAT_SPEED,   &spd);
-            (void)pksav_get_gb_IV(raw, PKSAV_STAT_SPECIAL, &spcl);
-            *IV_out = ((atk & 0x01) << 3) | ((def & 0x01) << 2)
-                    | ((spd & 0x01) << 1) | (spcl & 0x01);
+        case PKSAV_STAT_HP:
+            *IV_out = _pksav_gb_hp_IV(*raw);
             break;
-        }
 
         case PKSAV_STAT_ATTACK:
             *IV_out = ((*raw) & PKSAV_GB_ATK_IV_MASK) >> 12;
@@ -200,3 +202,163 @@ pksav_error_t pksav_set_IV(
 
     return PKSAV_ERROR_NONE;
 }
+
+/*
+ * The bulk functions gather each chunk of strided input into a contiguous
+ * array, then unpack each column from it in a separate loop, which the
+ * compiler can vectorize.
+ */
+#define PKSAV_BULK_CHUNK_SIZE 64
+
+static void _pksav_unpack_column(
+    const uint32_t* raw,
+    size_t count,
+    unsigned int shift,
+    uint32_t mask,
+    uint8_t* column
+) {
+    if(column) {
+        for(size_t i = 0; i < count; ++i) {
+            column[i] = (uint8_t)((raw[i] >> shift) & mask);
+        }
+    }
+}
+
+pksav_error_t pksav_get_gb_IVs_bulk(
+    const void* first_iv_data,
+    size_t stride,
+    size_t num_pokemon,
+    const pksav_stat_columns_t* IVs_out
+) {
+    if(!first_iv_data || !IVs_out) {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+
+    const uint8_t* input = first_iv_data;
+    uint32_t raw[PKSAV_BULK_CHUNK_SIZE];
+
+    for(size_t start = 0; start < num_pokemon; start += PKSAV_BULK_CHUNK_SIZE) {
+        size_t count = num_pokemon - start;
+        if(count > PKSAV_BULK_CHUNK_SIZE) {
+            count = PKSAV_BULK_CHUNK_SIZE;
+        }
+
+        for(size_t i = 0; i < count; ++i) {
+            uint16_t iv_data;
+            memcpy(&iv_data, &input[(start + i) * stride], sizeof(iv_data));
+            raw[i] = iv_data;
+        }
+
+        if(IVs_out->hp) {
+            for(size_t i = 0; i < count; ++i) {
+                IVs_out->hp[start + i] = _pksav_gb_hp_IV(raw[i]);
+            }
+        }
+        _pksav_unpack_column(raw, count, 12, 0x0F, IVs_out->attack  ? &IVs_out->attack[start]  : NULL);
+        _pksav_unpack_column(raw, count, 8,  0x0F, IVs_out->defense ? &IVs_out->defense[start] : NULL);
+        _pksav_unpack_column(raw, count, 4,  0x0F, IVs_out->speed   ? &IVs_out->speed[start]   : NULL);
+        _pksav_unpack_column(raw, count, 0,  0x0F, IVs_out->spatk   ? &IVs_out->spatk[start]   : NULL);
+        _pksav_unpack_column(raw, count, 0,  0x0F, IVs_out->spdef   ? &IVs_out->spdef[start]   : NULL);
+    }
+
+    return PKSAV_ERROR_NONE;
+}
+
+pksav_error_t pksav_get_IVs_bulk(
+    const void* first_iv_data,
+    size_t stride,
+    size_t num_pokemon,
+    const pksav_stat_columns_t* IVs_out
+) {
+    if(!first_iv_data || !IVs_out) {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+
+    const uint8_t* input = first_iv_data;
+    uint32_t raw[PKSAV_BULK_CHUNK_SIZE];
+
+    for(size_t start = 0; start < num_pokemon; start += PKSAV_BULK_CHUNK_SIZE) {
+        size_t count = num_pokemon - start;
+        if(count > PKSAV_BULK_CHUNK_SIZE) {
+            count = PKSAV_BULK_CHUNK_SIZE;
+        }
+
+        for(size_t i = 0; i < count; ++i) {
+            memcpy(&raw[i], &input[(start + i) * stride], sizeof(uint32_t));
+        }
+
+        _pksav_unpack_column(raw, count, 0,  0x1F, IVs_out->hp      ? &IVs_out->hp[start]      : NULL);
+        _pksav_unpack_column(raw, count, 5,  0x1F, IVs_out->attack  ? &IVs_out->attack[start]  : NULL);
+        _pksav_unpack_column(raw, count, 10, 0x1F, IVs_out->defense ? &IVs_out->defense[start] : NULL);
+        _pksav_unpack_column(raw, count, 15, 0x1F, IVs_out->speed   ? &IVs_out->speed[start]   : NULL);
+        _pksav_unpack_column(raw, count, 20, 0x1F, IVs_out->spatk   ? &IVs_out->spatk[start]   : NULL);
+        _pksav_unpack_column(raw, count, 25, 0x1F, IVs_out->spdef   ? &IVs_out->spdef[start]   : NULL);
+    }
+
+    return PKSAV_ERROR_NONE;
+}
+
+pksav_error_t pksav_get_gb_EVs_bulk(
+    const void* first_ev_hp,
+    size_t stride,
+    size_t num_pokemon,
+    const pksav_gb_EV_columns_t* EVs_out
+) {
+    if(!first_ev_hp || !EVs_out) {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+
+    const uint8_t* input = first_ev_hp;
+    uint16_t* columns[] = {
+        EVs_out->hp,
+        EVs_out->attack,
+        EVs_out->defense,
+        EVs_out->speed,
+        EVs_out->special
+    };
+
+    for(size_t stat = 0; stat < (sizeof(columns) / sizeof(columns[0])); ++stat) {
+        uint16_t* column = columns[stat];
+        if(column) {
+            const uint8_t* ev = &input[stat * sizeof(uint16_t)];
+            for(size_t i = 0; i < num_pokemon; ++i) {
+                column[i] = (uint16_t)((ev[i * stride] << 8) | ev[(i * stride) + 1]);
+            }
+        }
+    }
+
+    return PKSAV_ERROR_NONE;
+}
+
+pksav_error_t pksav_get_EVs_bulk(
+    const void* first_ev_hp,
+    size_t stride,
+    size_t num_pokemon,
+    const pksav_stat_columns_t* EVs_out
+) {
+    if(!first_ev_hp || !EVs_out) {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+
+    const uint8_t* input = first_ev_hp;
+    uint8_t* columns[] = {
+        EVs_out->hp,
+        EVs_out->attack,
+        EVs_out->defense,
+        EVs_out->speed,
+        EVs_out->spatk,
+        EVs_out->spdef
+    };
+
+    for(size_t stat = 0; stat < (sizeof(columns) / sizeof(columns[0])); ++stat) {
+        uint8_t* column = columns[stat];
+        if(column) {
+            const uint8_t* ev = &input[stat];
+            for(size_t i = 0; i < num_pokemon; ++i) {
+                column[i] = ev[i * stride];
+            }
+        }
+    }
+
+    return PKSAV_ERROR_NONE;
+}
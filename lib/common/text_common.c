@@ -91,3 +91,53 @@ ssize_t wchar_map_index(
     return -1;
 }
 
+
+size_t pksav_utf8_decode(
+    const char* input,
+    uint32_t* code_point_out
+) {
+    const uint8_t* in = (const uint8_t*)input;
+
+    if(in[0] == 0) {
+        return 0;
+    } else if(in[0] < 0x80) {
+        *code_point_out = in[0];
+        return 1;
+    }
+
+    size_t num_bytes = 0;
+    uint32_t code_point = 0;
+    uint32_t min_code_point = 0;
+    if((in[0] & 0xE0) == 0xC0) {
+        num_bytes = 2;
+        code_point = in[0] & 0x1F;
+        min_code_point = 0x80;
+    } else if((in[0] & 0xF0) == 0xE0) {
+        num_bytes = 3;
+        code_point = in[0] & 0x0F;
+        min_code_point = 0x800;
+    } else if((in[0] & 0xF8) == 0xF0) {
+        num_bytes = 4;
+        code_point = in[0] & 0x07;
+        min_code_point = 0x10000;
+    } else {
+        *code_point_out = PKSAV_UNICODE_REPLACEMENT_CHAR;
+        return 1;
+    }
+
+    for(size_t i = 1; i < num_bytes; ++i) {
+        // This also stops at the null terminator.
+        if((in[i] & 0xC0) != 0x80) {
+            *code_point_out = PKSAV_UNICODE_REPLACEMENT_CHAR;
+            return 1;
+        }
+        code_point = (code_point << 6) | (in[i] & 0x3F);
+    }
+
+    if((code_point < min_code_point) || (code_point > 0x10FFFF)) {
+        code_point = PKSAV_UNICODE_REPLACEMENT_CHAR;
+    }
+    *code_point_out = code_point;
+
+    return num_bytes;
+}
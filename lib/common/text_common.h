@@ -9,6 +9,8 @@
 
 #include <pksav/config.h>
 
+#include <stdbool.h>
+#include <stdint.h>
 #include <stdlib.h>
 
 #ifdef HAVE_UNISTD_H
@@ -33,4 +35,71 @@ ssize_t wchar_map_index(
     wchar_t to_find
 );
 
+/*
+ * Locale-independent UTF-8 conversion, used by the generations whose
+ * in-game text maps onto 16-bit code points.
+ */
+
+#define PKSAV_UTF8_MAX_BYTES 4
+#define PKSAV_UNICODE_REPLACEMENT_CHAR 0xFFFD
+
+/*
+ * Appends the given code point to a UTF-8 buffer of output_len bytes,
+ * starting at *pos. One byte is always left free for a null terminator.
+ * Returns false without writing anything if the full sequence does not
+ * fit, so multi-byte characters are never split.
+ */
+static PKSAV_INLINE bool pksav_utf8_append(
+    uint32_t code_point,
+    char* output,
+    size_t output_len,
+    size_t* pos
+) {
+    size_t num_bytes = (code_point < 0x80)    ? 1 :
+                       (code_point < 0x800)   ? 2 :
+                       (code_point < 0x10000) ? 3 : 4;
+
+    if((*pos + num_bytes) >= output_len) {
+        return false;
+    }
+
+    char* out = output + *pos;
+    switch(num_bytes) {
+        case 1:
+            out[0] = (char)code_point;
+            break;
+
+        case 2:
+            out[0] = (char)(0xC0 | (code_point >> 6));
+            out[1] = (char)(0x80 | (code_point & 0x3F));
+            break;
+
+        case 3:
+            out[0] = (char)(0xE0 | (code_point >> 12));
+            out[1] = (char)(0x80 | ((code_point >> 6) & 0x3F));
+            out[2] = (char)(0x80 | (code_point & 0x3F));
+            break;
+
+        default:
+            out[0] = (char)(0xF0 | (code_point >> 18));
+            out[1] = (char)(0x80 | ((code_point >> 12) & 0x3F));
+            out[2] = (char)(0x80 | ((code_point >> 6) & 0x3F));
+            out[3] = (char)(0x80 | (code_point & 0x3F));
+            break;
+    }
+    *pos += num_bytes;
+
+    return true;
+}
+
+/*
+ * Decodes a single code point from a null-terminated UTF-8 string.
+ * Returns the number of bytes consumed, or 0 at the end of the string.
+ * Malformed sequences consume one byte and decode to U+FFFD.
+ */
+size_t pksav_utf8_decode(
+    const char* input,
+    uint32_t* code_point_out
+);
+
 #endif /* PKSAV_COMMON_TEXT_COMMON_H */
@@ -0,0 +1,228 @@
+/*
+ * Copyright (c) 2018 Nicholas Corgan (n.corgan@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "thread.h"
+
+#include <stdlib.h>
+
+#if !defined(PKSAV_PLATFORM_MINGW) && !defined(PKSAV_PLATFORM_WIN32)
+#    include <unistd.h>
+#endif
+
+// Thread entry points differ between platforms, so wrap the real function.
+typedef struct {
+    void (*thread_fcn)(void*);
+    void* arg;
+} pksav_thread_start_t;
+
+static pksav_thread_start_t* _pksav_thread_start_new(
+    void (*thread_fcn)(void*),
+    void* arg
+) {
+    pksav_thread_start_t* start = malloc(sizeof(pksav_thread_start_t));
+    if(start) {
+        start->thread_fcn = thread_fcn;
+        start->arg = arg;
+    }
+
+    return start;
+}
+
+static void _pksav_thread_start_run(
+    void* parameter
+) {
+    pksav_thread_start_t start = *(pksav_thread_start_t*)parameter;
+    free(parameter);
+
+    start.thread_fcn(start.arg);
+}
+
+#if defined(PKSAV_PLATFORM_MINGW) || defined(PKSAV_PLATFORM_WIN32)
+
+static BOOL CALLBACK _pksav_once_trampoline(
+    PINIT_ONCE once,
+    PVOID parameter,
+    PVOID* context
+) {
+    (void)once;
+    (void)context;
+
+    void (*init_fcn)(void) = *(void (**)(void))parameter;
+    init_fcn();
+
+    return TRUE;
+}
+
+void _pksav_call_once(
+    pksav_once_t* once,
+    void (*init_fcn)(void)
+) {
+    InitOnceExecuteOnce(once, _pksav_once_trampoline, &init_fcn, NULL);
+}
+
+static DWORD WINAPI _pksav_thread_trampoline(
+    LPVOID parameter
+) {
+    _pksav_thread_start_run(parameter);
+
+    return 0;
+}
+
+bool _pksav_thread_create(
+    pksav_thread_t* thread,
+    void (*thread_fcn)(void*),
+    void* arg
+) {
+    pksav_thread_start_t* start = _pksav_thread_start_new(thread_fcn, arg);
+    if(!start) {
+        return false;
+    }
+
+    *thread = CreateThread(NULL, 0, _pksav_thread_trampoline, start, 0, NULL);
+    if(!(*thread)) {
+        free(start);
+        return false;
+    }
+
+    return true;
+}
+
+void _pksav_thread_join(
+    pksav_thread_t thread
+) {
+    (void)WaitForSingleObject(thread, INFINITE);
+    (void)CloseHandle(thread);
+}
+
+void _pksav_mutex_init(
+    pksav_mutex_t* mutex
+) {
+    InitializeCriticalSection(mutex);
+}
+
+void _pksav_mutex_destroy(
+    pksav_mutex_t* mutex
+) {
+    DeleteCriticalSection(mutex);
+}
+
+void _pksav_mutex_lock(
+    pksav_mutex_t* mutex
+) {
+    EnterCriticalSection(mutex);
+}
+
+void _pksav_mutex_unlock(
+    pksav_mutex_t* mutex
+) {
+    LeaveCriticalSection(mutex);
+}
+
+size_t _pksav_num_cpus(void) {
+    SYSTEM_INFO system_info;
+    GetSystemInfo(&system_info);
+
+    return (system_info.dwNumberOfProcessors > 0) ? (size_t)system_info.dwNumberOfProcessors : 1;
+}
+
+uint32_t _pksav_atomic_increment(
+    volatile uint32_t* counter
+) {
+    return (uint32_t)InterlockedIncrement((volatile LONG*)counter);
+}
+
+uint32_t _pksav_atomic_decrement(
+    volatile uint32_t* counter
+) {
+    return (uint32_t)InterlockedDecrement((volatile LONG*)counter);
+}
+
+#else
+
+void _pksav_call_once(
+    pksav_once_t* once,
+    void (*init_fcn)(void)
+) {
+    (void)pthread_once(once, init_fcn);
+}
+
+static void* _pksav_thread_trampoline(
+    void* parameter
+) {
+    _pksav_thread_start_run(parameter);
+
+    return NULL;
+}
+
+bool _pksav_thread_create(
+    pksav_thread_t* thread,
+    void (*thread_fcn)(void*),
+    void* arg
+) {
+    pksav_thread_start_t* start = _pksav_thread_start_new(thread_fcn, arg);
+    if(!start) {
+        return false;
+    }
+
+    if(pthread_create(thread, NULL, _pksav_thread_trampoline, start)) {
+        free(start);
+        return false;
+    }
+
+    return true;
+}
+
+void _pksav_thread_join(
+    pksav_thread_t thread
+) {
+    (void)pthread_join(thread, NULL);
+}
+
+void _pksav_mutex_init(
+    pksav_mutex_t* mutex
+) {
+    (void)pthread_mutex_init(mutex, NULL);
+}
+
+void _pksav_mutex_destroy(
+    pksav_mutex_t* mutex
+) {
+    (void)pthread_mutex_destroy(mutex);
+}
+
+void _pksav_mutex_lock(
+    pksav_mutex_t* mutex
+) {
+    (void)pthread_mutex_lock(mutex);
+}
+
+void _pksav_mutex_unlock(
+    pksav_mutex_t* mutex
+) {
+    (void)pthread_mutex_unlock(mutex);
+}
+
+size_t _pksav_num_cpus(void) {
+    long num_cpus = sysconf(_SC_NPROCESSORS_ONLN);
+
+    return (num_cpus > 0) ? (size_t)num_cpus : 1;
+}
+
+uint32_t _pksav_atomic_increment(
+    volatile uint32_t* counter
+) {
+    return __atomic_add_fetch(counter, 1, __ATOMIC_RELAXED);
+}
+
+uint32_t _pksav_atomic_decrement(
+    volatile uint32_t* counter
+) {
+    // Whoever takes this to zero frees what it counts, so it must see every other use.
+    return __atomic_sub_fetch(counter, 1, __ATOMIC_ACQ_REL);
+}
+
+#endif
@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2018 Nicholas Corgan (n.corgan@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+#ifndef PKSAV_COMMON_THREAD_H
+#define PKSAV_COMMON_THREAD_H
+
+#include <pksav/config.h>
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#if defined(PKSAV_PLATFORM_MINGW) || defined(PKSAV_PLATFORM_WIN32)
+
+#include <windows.h>
+
+typedef INIT_ONCE pksav_once_t;
+#define PKSAV_ONCE_INIT INIT_ONCE_STATIC_INIT
+
+typedef HANDLE pksav_thread_t;
+
+typedef CRITICAL_SECTION pksav_mutex_t;
+
+#define PKSAV_THREAD_LOCAL __declspec(thread)
+
+#else
+
+#include <pthread.h>
+
+typedef pthread_once_t pksav_once_t;
+#define PKSAV_ONCE_INIT PTHREAD_ONCE_INIT
+
+typedef pthread_t pksav_thread_t;
+
+typedef pthread_mutex_t pksav_mutex_t;
+
+#define PKSAV_THREAD_LOCAL __thread
+
+#endif
+
+/*
+ * Runs the given function exactly once across all threads, no matter
+ * how many threads call this at the same time. Used for lazily building
+ * lookup tables.
+ */
+void _pksav_call_once(
+    pksav_once_t* once,
+    void (*init_fcn)(void)
+);
+
+/*
+ * Starts a thread running thread_fcn(arg). Returns false if the thread
+ * couldn't be started, in which case callers should do the work themselves.
+ */
+bool _pksav_thread_create(
+    pksav_thread_t* thread,
+    void (*thread_fcn)(void*),
+    void* arg
+);
+
+// Waits for a thread started by _pksav_thread_create to finish.
+void _pksav_thread_join(
+    pksav_thread_t thread
+);
+
+void _pksav_mutex_init(
+    pksav_mutex_t* mutex
+);
+
+void _pksav_mutex_destroy(
+    pksav_mutex_t* mutex
+);
+
+void _pksav_mutex_lock(
+    pksav_mutex_t* mutex
+);
+
+void _pksav_mutex_unlock(
+    pksav_mutex_t* mutex
+);
+
+// Returns the number of processors available, or 1 if it can't be determined.
+size_t _pksav_num_cpus(void);
+
+/*
+ * Atomically increments the given counter and returns the new value.
+ */
+uint32_t _pksav_atomic_increment(
+    volatile uint32_t* counter
+);
+
+/*
+ * Atomically decrements the given counter and returns the new value.
+ */
+uint32_t _pksav_atomic_decrement(
+    volatile uint32_t* counter
+);
+
+#endif /* PKSAV_COMMON_THREAD_H */
@@ -5,12 +5,49 @@
  * or copy at http://opensource.org/licenses/MIT)
  */
 
+#include "text_common.h"
 #include "xds_common.h"
 
 #include <string.h>
 
 #define PKSAV_XDS_TERMINATOR 0xFFFF
 
+#define PKSAV_IS_HIGH_SURROGATE(c) (((c) & 0xFC00) == 0xD800)
+#define PKSAV_IS_LOW_SURROGATE(c)  (((c) & 0xFC00) == 0xDC00)
+
+size_t _pksav_xds_to_utf8(
+    const uint16_t* input_buffer,
+    size_t num_chars,
+    char* output_text,
+    size_t output_len,
+    bool null_terminate
+) {
+    size_t capacity = null_terminate ? output_len : (output_len + 1);
+    size_t pos = 0;
+
+    for(size_t i = 0; i < num_chars; ++i) {
+        uint32_t code_point = input_buffer[i];
+        if(code_point == PKSAV_XDS_TERMINATOR) {
+            break;
+        } else if(PKSAV_IS_HIGH_SURROGATE(code_point) && ((i+1) < num_chars) &&
+                  PKSAV_IS_LOW_SURROGATE(input_buffer[i+1])) {
+            code_point = 0x10000 + (((code_point & 0x3FF) << 10) | (input_buffer[i+1] & 0x3FF));
+            ++i;
+        } else if(PKSAV_IS_HIGH_SURROGATE(code_point) || PKSAV_IS_LOW_SURROGATE(code_point)) {
+            code_point = PKSAV_UNICODE_REPLACEMENT_CHAR;
+        }
+
+        if(!pksav_utf8_append(code_point, output_text, capacity, &pos)) {
+            break;
+        }
+    }
+    if(pos < output_len) {
+        output_text[pos] = '\0';
+    }
+
+    return pos;
+}
+
 pksav_error_t _pksav_text_from_xds(
     const uint16_t* input_buffer,
     char* output_text,
@@ -20,14 +57,11 @@ pksav_error_t _pksav_text_from_xds(
         return PKSAV_ERROR_NULL_POINTER;
     }
 
-    wchar_t* widetext = calloc(num_chars, sizeof(wchar_t));
-    _pksav_widetext_from_xds(
-        input_buffer, widetext, num_chars
-    );
-
+    // As with wcstombs, a string that fills the buffer isn't null-terminated.
     memset(output_text, 0, num_chars);
-    wcstombs(output_text, widetext, num_chars);
-    free(widetext);
+    (void)_pksav_xds_to_utf8(
+              input_buffer, num_chars, output_text, num_chars, false
+          );
 
     return PKSAV_ERROR_NONE;
 }
@@ -41,14 +75,12 @@ pksav_error_t _pksav_widetext_from_xds(
         return PKSAV_ERROR_NULL_POINTER;
     }
 
-    memset(output_text, 0, sizeof(wchar_t)*num_chars);
-
-    for(size_t i = 0; i < num_chars; ++i) {
-        if(input_buffer[i] == PKSAV_XDS_TERMINATOR) {
-            break;
-        } else {
-            output_text[i] = input_buffer[i];
-        }
+    size_t i = 0;
+    for(; (i < num_chars) && (input_buffer[i] != PKSAV_XDS_TERMINATOR); ++i) {
+        output_text[i] = input_buffer[i];
+    }
+    if(i < num_chars) {
+        output_text[i] = 0;
     }
 
     return PKSAV_ERROR_NONE;
@@ -63,14 +95,26 @@ pksav_error_t _pksav_text_to_xds(
         return PKSAV_ERROR_NULL_POINTER;
     }
 
-    wchar_t* widetext = calloc(num_chars, sizeof(wchar_t));
-    mbstowcs(widetext, input_text, num_chars);
-
-    _pksav_widetext_to_xds(
-        widetext, output_buffer, num_chars
-    );
-
-    free(widetext);
+    size_t pos = 0;
+    uint32_t code_point = 0;
+    size_t num_bytes = 0;
+    while((pos < num_chars) && (num_bytes = pksav_utf8_decode(input_text, &code_point)) > 0) {
+        if(code_point >= 0x10000) {
+            // Never split a surrogate pair.
+            if((pos + 2) > num_chars) {
+                break;
+            }
+            code_point -= 0x10000;
+            output_buffer[pos++] = (uint16_t)(0xD800 | (code_point >> 10));
+            output_buffer[pos++] = (uint16_t)(0xDC00 | (code_point & 0x3FF));
+        } else {
+            output_buffer[pos++] = (uint16_t)code_point;
+        }
+        input_text += num_bytes;
+    }
+    if(pos < num_chars) {
+        output_buffer[pos] = PKSAV_XDS_TERMINATOR;
+    }
 
     return PKSAV_ERROR_NONE;
 }
@@ -84,14 +128,12 @@ pksav_error_t _pksav_widetext_to_xds(
         return PKSAV_ERROR_NULL_POINTER;
     }
 
-    memset(output_buffer, 0xFF, sizeof(wchar_t)*num_chars);
-
-    for(size_t i = 0; i < num_chars; ++i) {
-        if(input_text[i] == 0) {
-            break;
-        } else {
-            output_buffer[i] = (uint16_t)input_text[i];
-        }
+    size_t i = 0;
+    for(; (i < num_chars) && (input_text[i] != 0); ++i) {
+        output_buffer[i] = (uint16_t)input_text[i];
+    }
+    if(i < num_chars) {
+        output_buffer[i] = PKSAV_XDS_TERMINATOR;
     }
 
     return PKSAV_ERROR_NONE;
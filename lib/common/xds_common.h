@@ -9,6 +9,7 @@
 
 #include <pksav/error.h>
 
+#include <stdbool.h>
 #include <stdint.h>
 #include <stdlib.h>
 
@@ -17,6 +18,21 @@
  * functions will not be built if support for at least one of these
  * is not built.
  */
+/*
+ * Decodes a run of in-game Unicode straight into UTF-8, stopping at the
+ * terminator, at num_chars, or when the output buffer is full. If
+ * null_terminate is set, the output is always null-terminated if
+ * output_len > 0. Otherwise, characters can fill the whole buffer, and the
+ * terminator is only added if there's room for it. Returns the number of
+ * bytes written, not including the null terminator.
+ */
+size_t _pksav_xds_to_utf8(
+    const uint16_t* input_buffer,
+    size_t num_chars,
+    char* output_text,
+    size_t output_len,
+    bool null_terminate
+);
 
 //! Convert a string from in-game Unicode to a multi-byte C string.
 pksav_error_t _pksav_text_from_xds(
@@ -0,0 +1,834 @@
+/*
+ * Copyright (c) 2018 Nicholas Corgan (n.corgan@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include <pksav/corpus.h>
+
+#include <pksav/common/base_stats.h>
+#include <pksav/common/pokedex.h>
+#include <pksav/common/prng.h>
+
+#include <pksav/gen1/save.h>
+#include <pksav/gen1/text.h>
+#include <pksav/gen2/save.h>
+#include <pksav/gen2/text.h>
+#include <pksav/gba/pokedex.h>
+#include <pksav/gba/save.h>
+#include <pksav/gba/text.h>
+
+#include <pksav/math/base256.h>
+#include <pksav/math/endian.h>
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+#define PKSAV_CORPUS_GB_SAVE_SIZE  0x8000
+#define PKSAV_CORPUS_GBA_SAVE_SIZE 0x20000
+
+/*
+ * Each generated save is built by loading a blank save, filling it in through
+ * the normal save struct, and saving it into the output buffer, so only what's
+ * needed for a blank save to be detected is hardcoded here.
+ */
+#define PKSAV_CORPUS_GEN1_CHECKSUM    0x3523
+#define PKSAV_CORPUS_GS_CHECKSUM2     0x7E6D
+
+#define PKSAV_CORPUS_GBA_SLOT_SIZE    0xE000
+#define PKSAV_CORPUS_GBA_VALIDATION   0x08012025
+#define PKSAV_CORPUS_GBA_GAME_CODE    0x00AC
+#define PKSAV_CORPUS_EMERALD_KEY2     0x01F4
+#define PKSAV_CORPUS_FRLG_KEY1        0x0AF8
+#define PKSAV_CORPUS_FRLG_KEY2        0x0F20
+
+static const char* pksav_corpus_trainer_names[] = {
+    "ASH",   "RED",    "GOLD",  "KRIS",   "MAY",   "BRENDAN", "LEAF",
+    "ETHAN", "LYRA",   "DAWN",  "ALEX",   "SAM",   "JORDAN",  "TAYLOR",
+    "CASEY", "RILEY",  "MORGAN","JAMIE",  "ROBIN", "KAI",     "NOAH",
+    "EMMA",  "LIAM",   "MIA",   "ZOE",    "LEO",   "NINA",    "OMAR",
+    "YUKI",  "PABLO",  "IVAN",  "SOFIA",  "HANA",  "BEN",     "CHLOE",
+    "DEV",   "ELENA",  "FINN",  "GRACE",  "HUGO"
+};
+
+static const char* pksav_corpus_rival_names[] = {
+    "BLUE", "GARY", "SILVER", "WALLY", "JOHN", "JACK", "RIVAL", "TERRY"
+};
+
+static const char* pksav_corpus_nicknames[] = {
+    "SPARKY", "FLUFFY", "BUBBLES", "CHOMP",  "ZIGGY",   "PEBBLE",
+    "BLAZE",  "SHADOW", "MOCHI",   "BISCUIT","NUGGET",  "PICKLE",
+    "TITAN",  "ROCKY",  "LUNA",    "SUNNY",  "BOLT",    "COCO",
+    "PIPPIN", "WASABI", "MAX",     "BELLA",  "CHARLIE", "DAISY",
+    "BUSTER", "GIZMO",  "JUNIOR",  "KIWI",   "MILO",    "OREO"
+};
+
+#define PKSAV_CORPUS_ARRAY_LEN(arr) (sizeof(arr)/sizeof((arr)[0]))
+
+typedef struct {
+    pksav_mtrng_t mtrng;
+    // From 0.0-1.0, how far along the player is, which scales levels and PC use.
+    double progress;
+    const char* trainer_name;
+    uint32_t trainer_id;
+} pksav_corpus_state_t;
+
+static uint32_t _pksav_corpus_rand(
+    pksav_corpus_state_t* state
+) {
+    uint32_t num = 0;
+    pksav_mtrng_next(&state->mtrng, &num);
+
+    return num;
+}
+
+// Inclusive on both ends
+static uint32_t _pksav_corpus_rand_range(
+    pksav_corpus_state_t* state,
+    uint32_t min,
+    uint32_t max
+) {
+    return min + (_pksav_corpus_rand(state) % (max - min + 1));
+}
+
+static bool _pksav_corpus_chance(
+    pksav_corpus_state_t* state,
+    uint32_t percent
+) {
+    return (_pksav_corpus_rand(state) % 100) < percent;
+}
+
+static const char* _pksav_corpus_pick(
+    pksav_corpus_state_t* state,
+    const char** names,
+    size_t num_names
+) {
+    return names[_pksav_corpus_rand(state) % num_names];
+}
+
+static void _pksav_corpus_init(
+    pksav_corpus_state_t* state,
+    uint32_t seed
+) {
+    pksav_mtrng_seed(&state->mtrng, seed);
+
+    state->progress = (double)_pksav_corpus_rand_range(state, 0, 1000) / 1000.0;
+    state->trainer_name = _pksav_corpus_pick(
+                              state,
+                              pksav_corpus_trainer_names,
+                              PKSAV_CORPUS_ARRAY_LEN(pksav_corpus_trainer_names)
+                          );
+    state->trainer_id = _pksav_corpus_rand(state);
+}
+
+static uint8_t _pksav_corpus_level(
+    pksav_corpus_state_t* state
+) {
+    uint32_t max_level = 5 + (uint32_t)(state->progress * 95.0);
+    uint32_t min_level = (max_level > 20) ? (max_level - 20) : 2;
+
+    return (uint8_t)_pksav_corpus_rand_range(state, min_level, max_level);
+}
+
+// The party grows as the player progresses, and the PC fills up after it.
+static size_t _pksav_corpus_party_size(
+    pksav_corpus_state_t* state
+) {
+    uint32_t max_size = 1 + (uint32_t)(state->progress * 10.0);
+    if(max_size > 6) {
+        max_size = 6;
+    }
+
+    return (size_t)_pksav_corpus_rand_range(state, (max_size + 1) / 2, max_size);
+}
+
+static size_t _pksav_corpus_pc_size(
+    pksav_corpus_state_t* state,
+    size_t capacity
+) {
+    uint32_t max_size = (uint32_t)(state->progress * (double)capacity * 0.5);
+
+    return (size_t)_pksav_corpus_rand_range(state, 0, max_size);
+}
+
+// Most Pokémon belong to the player, and the rest were traded in.
+static void _pksav_corpus_original_trainer(
+    pksav_corpus_state_t* state,
+    const char** name_out,
+    uint32_t* id_out
+) {
+    if(_pksav_corpus_chance(state, 90)) {
+        *name_out = state->trainer_name;
+        *id_out = state->trainer_id;
+    } else {
+        *name_out = _pksav_corpus_pick(
+                        state,
+                        pksav_corpus_trainer_names,
+                        PKSAV_CORPUS_ARRAY_LEN(pksav_corpus_trainer_names)
+                    );
+        *id_out = _pksav_corpus_rand(state);
+    }
+}
+
+static const char* _pksav_corpus_nickname(
+    pksav_corpus_state_t* state
+) {
+    return _pksav_corpus_pick(
+               state,
+               pksav_corpus_nicknames,
+               PKSAV_CORPUS_ARRAY_LEN(pksav_corpus_nicknames)
+           );
+}
+
+// Stored as three big-endian BCD bytes
+static void _pksav_corpus_set_gb_money(
+    uint8_t* money,
+    uint32_t amount
+) {
+    for(int i = 2; i >= 0; --i) {
+        money[i] = (uint8_t)((((amount / 10) % 10) << 4) | (amount % 10));
+        amount /= 100;
+    }
+}
+
+/*
+ * Generation I
+ */
+
+static void _pksav_corpus_gen1_pokemon(
+    pksav_corpus_state_t* state,
+    pksav_gen1_pc_pokemon_t* pc,
+    pksav_gen1_pokemon_party_data_t* party_data,
+    uint8_t* otname,
+    uint8_t* nickname,
+    uint8_t* species_list_entry,
+    pksav_gen1_save_t* gen1_save
+) {
+    uint8_t species = 0;
+    uint16_t pokedex_num = 0;
+    do {
+        species = (uint8_t)_pksav_corpus_rand_range(state, 1, 190);
+    } while(pksav_gen1_species_to_pokedex_num(species, &pokedex_num));
+
+    uint8_t level = _pksav_corpus_level(state);
+
+    const char* ot_name = NULL;
+    uint32_t ot_id = 0;
+    _pksav_corpus_original_trainer(state, &ot_name, &ot_id);
+
+    memset(pc, 0, sizeof(*pc));
+    pc->species = species;
+    pc->level = level;
+    pc->ot_id = pksav_bigendian16((uint16_t)(ot_id & 0xFFFF));
+    pc->iv_data = (uint16_t)(_pksav_corpus_rand(state) & 0xFFFF);
+    pksav_to_base256((uint32_t)level * level * level, pc->exp, 3);
+
+    size_t num_moves = (size_t)_pksav_corpus_rand_range(state, 1, (level < 10) ? 2 : 4);
+    for(size_t i = 0; i < num_moves; ++i) {
+        pc->moves[i] = (uint8_t)_pksav_corpus_rand_range(state, 1, 165);
+        pc->move_pps[i] = (uint8_t)_pksav_corpus_rand_range(state, 5, 35);
+    }
+
+    uint16_t EVs[5];
+    for(size_t i = 0; i < 5; ++i) {
+        EVs[i] = (uint16_t)_pksav_corpus_rand_range(state, 0, (uint32_t)level * 600);
+    }
+    pc->ev_hp   = pksav_bigendian16(EVs[0]);
+    pc->ev_atk  = pksav_bigendian16(EVs[1]);
+    pc->ev_def  = pksav_bigendian16(EVs[2]);
+    pc->ev_spd  = pksav_bigendian16(EVs[3]);
+    pc->ev_spcl = pksav_bigendian16(EVs[4]);
+
+    pksav_base_stats_t base_stats;
+    pksav_battle_stats_t stats;
+    pksav_get_gen1_base_stats(pokedex_num, &base_stats);
+    pksav_calc_gb_stats(&base_stats, level, pc->iv_data, EVs, &stats);
+
+    pc->current_hp = pksav_bigendian16(stats.hp);
+    if(party_data) {
+        party_data->level  = level;
+        party_data->max_hp = pksav_bigendian16(stats.hp);
+        party_data->atk    = pksav_bigendian16(stats.attack);
+        party_data->def    = pksav_bigendian16(stats.defense);
+        party_data->spd    = pksav_bigendian16(stats.speed);
+        party_data->spcl   = pksav_bigendian16(stats.spatk);
+    }
+
+    pksav_text_to_gen1(ot_name, otname, 11);
+    pksav_text_to_gen1(_pksav_corpus_nickname(state), nickname, 11);
+    *species_list_entry = species;
+
+    pksav_set_pokedex_bit(gen1_save->pokedex_seen, pokedex_num, true);
+    pksav_set_pokedex_bit(gen1_save->pokedex_owned, pokedex_num, true);
+}
+
+static void _pksav_corpus_gen1_box(
+    pksav_corpus_state_t* state,
+    pksav_gen1_pokemon_box_t* box,
+    size_t count,
+    pksav_gen1_save_t* gen1_save
+) {
+    memset(box, 0, sizeof(*box));
+    box->count = (uint8_t)count;
+    for(size_t i = 0; i < count; ++i) {
+        _pksav_corpus_gen1_pokemon(
+            state,
+            &box->entries[i],
+            NULL,
+            box->otnames[i],
+            box->nicknames[i],
+            &box->species[i],
+            gen1_save
+        );
+    }
+    box->species[count] = 0xFF;
+}
+
+static pksav_error_t _pksav_corpus_generate_gen1(
+    pksav_corpus_state_t* state,
+    bool yellow,
+    uint8_t* buffer
+) {
+    // A blank save's checksum is 255 minus nothing.
+    memset(buffer, 0, PKSAV_CORPUS_GB_SAVE_SIZE);
+    buffer[PKSAV_CORPUS_GEN1_CHECKSUM] = 0xFF;
+
+    pksav_gen1_save_t gen1_save;
+    pksav_error_t error = pksav_gen1_save_load_buffer(buffer, PKSAV_CORPUS_GB_SAVE_SIZE, &gen1_save);
+    if(error) {
+        return error;
+    }
+
+    pksav_text_to_gen1(state->trainer_name, gen1_save.trainer_name, 11);
+    pksav_text_to_gen1(
+        _pksav_corpus_pick(state, pksav_corpus_rival_names, PKSAV_CORPUS_ARRAY_LEN(pksav_corpus_rival_names)),
+        gen1_save.rival_name,
+        11
+    );
+    *gen1_save.trainer_id = pksav_bigendian16((uint16_t)(state->trainer_id & 0xFFFF));
+    _pksav_corpus_set_gb_money(gen1_save.money, _pksav_corpus_rand_range(state, 0, (uint32_t)(state->progress * 999999)));
+    *gen1_save.badges = (uint8_t)((1U << (uint32_t)(state->progress * 8.0)) - 1);
+    gen1_save.time_played->hours = pksav_littleendian16((uint16_t)(state->progress * 150.0));
+    gen1_save.time_played->minutes = (uint8_t)_pksav_corpus_rand_range(state, 0, 59);
+    gen1_save.time_played->seconds = (uint8_t)_pksav_corpus_rand_range(state, 0, 59);
+    if(yellow) {
+        *gen1_save.pikachu_friendship = (uint8_t)_pksav_corpus_rand_range(state, 90, 255);
+    }
+
+    pksav_gen1_pokemon_party_t* party = gen1_save.pokemon_party;
+    size_t party_size = _pksav_corpus_party_size(state);
+    memset(party, 0, sizeof(*party));
+    party->count = (uint8_t)party_size;
+    for(size_t i = 0; i < party_size; ++i) {
+        _pksav_corpus_gen1_pokemon(
+            state,
+            &party->party[i].pc,
+            &party->party[i].party_data,
+            party->otnames[i],
+            party->nicknames[i],
+            &party->species[i],
+            &gen1_save
+        );
+    }
+    party->species[party_size] = 0xFF;
+
+    // Boxes are filled in order, and the current box's contents live in a separate copy.
+    size_t num_pc_pokemon = _pksav_corpus_pc_size(state, 12 * 20);
+    uint8_t current_box = (uint8_t)_pksav_corpus_rand_range(state, 0, 11);
+    for(uint8_t box = 0; box < 12; ++box) {
+        size_t count = (num_pc_pokemon > 20) ? 20 : num_pc_pokemon;
+        num_pc_pokemon -= count;
+
+        _pksav_corpus_gen1_box(state, gen1_save.pokemon_boxes[box], count, &gen1_save);
+    }
+    *gen1_save.current_pokemon_box_num = current_box;
+    memcpy(gen1_save.current_pokemon_box, gen1_save.pokemon_boxes[current_box], sizeof(pksav_gen1_pokemon_box_t));
+
+    error = pksav_gen1_save_save_buffer(buffer, PKSAV_CORPUS_GB_SAVE_SIZE, &gen1_save);
+    pksav_gen1_save_free(&gen1_save);
+
+    return error;
+}
+
+/*
+ * Generation II
+ */
+
+static void _pksav_corpus_gen2_pokemon(
+    pksav_corpus_state_t* state,
+    pksav_gen2_pc_pokemon_t* pc,
+    pksav_gen2_pokemon_party_data_t* party_data,
+    uint8_t* otname,
+    uint8_t* nickname,
+    uint8_t* species_list_entry,
+    pksav_gen2_save_t* gen2_save
+) {
+    uint16_t pokedex_num = (uint16_t)_pksav_corpus_rand_range(state, 1, 251);
+    uint8_t level = _pksav_corpus_level(state);
+
+    const char* ot_name = NULL;
+    uint32_t ot_id = 0;
+    _pksav_corpus_original_trainer(state, &ot_name, &ot_id);
+
+    memset(pc, 0, sizeof(*pc));
+    pc->species = (uint8_t)pokedex_num;
+    pc->level = level;
+    pc->ot_id = pksav_bigendian16((uint16_t)(ot_id & 0xFFFF));
+    pc->iv_data = (uint16_t)(_pksav_corpus_rand(state) & 0xFFFF);
+    pc->friendship = (uint8_t)_pksav_corpus_rand_range(state, 70, 255);
+    pksav_to_base256((uint32_t)level * level * level, pc->exp, 3);
+    if(_pksav_corpus_chance(state, 20)) {
+        pc->held_item = (uint8_t)_pksav_corpus_rand_range(state, 1, 0xB3);
+    }
+
+    size_t num_moves = (size_t)_pksav_corpus_rand_range(state, 1, (level < 10) ? 2 : 4);
+    for(size_t i = 0; i < num_moves; ++i) {
+        pc->moves[i] = (uint8_t)_pksav_corpus_rand_range(state, 1, 251);
+        pc->move_pps[i] = (uint8_t)_pksav_corpus_rand_range(state, 5, 35);
+    }
+
+    uint16_t EVs[5];
+    for(size_t i = 0; i < 5; ++i) {
+        EVs[i] = (uint16_t)_pksav_corpus_rand_range(state, 0, (uint32_t)level * 600);
+    }
+    pc->ev_hp   = pksav_bigendian16(EVs[0]);
+    pc->ev_atk  = pksav_bigendian16(EVs[1]);
+    pc->ev_def  = pksav_bigendian16(EVs[2]);
+    pc->ev_spd  = pksav_bigendian16(EVs[3]);
+    pc->ev_spcl = pksav_bigendian16(EVs[4]);
+
+    if(party_data) {
+        pksav_base_stats_t base_stats;
+        pksav_battle_stats_t stats;
+        pksav_get_base_stats(pokedex_num, &base_stats);
+        pksav_calc_gb_stats(&base_stats, level, pc->iv_data, EVs, &stats);
+
+        memset(party_data, 0, sizeof(*party_data));
+        party_data->current_hp = pksav_bigendian16(stats.hp);
+        party_data->max_hp     = pksav_bigendian16(stats.hp);
+        party_data->atk        = pksav_bigendian16(stats.attack);
+        party_data->def        = pksav_bigendian16(stats.defense);
+        party_data->spd        = pksav_bigendian16(stats.speed);
+        party_data->spatk      = pksav_bigendian16(stats.spatk);
+        party_data->spdef      = pksav_bigendian16(stats.spdef);
+    }
+
+    pksav_text_to_gen2(ot_name, otname, 11);
+    pksav_text_to_gen2(_pksav_corpus_nickname(state), nickname, 11);
+    *species_list_entry = (uint8_t)pokedex_num;
+
+    pksav_set_pokedex_bit(gen2_save->pokedex_seen, pokedex_num, true);
+    pksav_set_pokedex_bit(gen2_save->pokedex_owned, pokedex_num, true);
+}
+
+static void _pksav_corpus_gen2_box(
+    pksav_corpus_state_t* state,
+    pksav_gen2_pokemon_box_t* box,
+    size_t count,
+    pksav_gen2_save_t* gen2_save
+) {
+    memset(box, 0, sizeof(*box));
+    box->count = (uint8_t)count;
+    for(size_t i = 0; i < count; ++i) {
+        _pksav_corpus_gen2_pokemon(
+            state,
+            &box->entries[i],
+            NULL,
+            box->otnames[i],
+            box->nicknames[i],
+            &box->species[i],
+            gen2_save
+        );
+    }
+    box->species[count] = 0xFF;
+}
+
+static pksav_error_t _pksav_corpus_generate_gen2(
+    pksav_corpus_state_t* state,
+    bool crystal,
+    uint8_t* buffer
+) {
+    /*
+     * A blank save is valid for both Gold/Silver and Crystal, and Gold/Silver
+     * is checked first, so a blank Crystal save needs a Gold/Silver checksum
+     * that doesn't match. Crystal doesn't checksum that byte.
+     */
+    memset(buffer, 0, PKSAV_CORPUS_GB_SAVE_SIZE);
+    if(crystal) {
+        buffer[PKSAV_CORPUS_GS_CHECKSUM2] = 0xFF;
+    }
+
+    pksav_gen2_save_t gen2_save;
+    pksav_error_t error = pksav_gen2_save_load_buffer(buffer, PKSAV_CORPUS_GB_SAVE_SIZE, &gen2_save);
+    if(error) {
+        return error;
+    }
+
+    pksav_text_to_gen2(state->trainer_name, gen2_save.trainer_name, 11);
+    pksav_text_to_gen2(
+        _pksav_corpus_pick(state, pksav_corpus_rival_names, PKSAV_CORPUS_ARRAY_LEN(pksav_corpus_rival_names)),
+        gen2_save.rival_name,
+        11
+    );
+    *gen2_save.trainer_id = pksav_bigendian16((uint16_t)(state->trainer_id & 0xFFFF));
+    if(gen2_save.trainer_gender) {
+        *gen2_save.trainer_gender = (uint8_t)_pksav_corpus_rand_range(state, 0, 1);
+    }
+    _pksav_corpus_set_gb_money(gen2_save.money, _pksav_corpus_rand_range(state, 0, (uint32_t)(state->progress * 999999)));
+    gen2_save.time_played->hours = (uint8_t)(state->progress * 150.0);
+    gen2_save.time_played->minutes = (uint8_t)_pksav_corpus_rand_range(state, 0, 59);
+    gen2_save.time_played->seconds = (uint8_t)_pksav_corpus_rand_range(state, 0, 59);
+    gen2_save.time_played->frames = (uint8_t)_pksav_corpus_rand_range(state, 0, 59);
+
+    pksav_gen2_pokemon_party_t* party = gen2_save.pokemon_party;
+    size_t party_size = _pksav_corpus_party_size(state);
+    memset(party, 0, sizeof(*party));
+    party->count = (uint8_t)party_size;
+    for(size_t i = 0; i < party_size; ++i) {
+        _pksav_corpus_gen2_pokemon(
+            state,
+            &party->party[i].pc,
+            &party->party[i].party_data,
+            party->otnames[i],
+            party->nicknames[i],
+            &party->species[i],
+            &gen2_save
+        );
+    }
+    party->species[party_size] = 0xFF;
+
+    for(uint8_t box = 0; box < 14; ++box) {
+        char box_name[9] = {0};
+        snprintf(box_name, sizeof(box_name), "BOX%d", (box + 1));
+        pksav_text_to_gen2(box_name, gen2_save.pokemon_box_names->names[box], 9);
+    }
+
+    size_t num_pc_pokemon = _pksav_corpus_pc_size(state, 14 * 20);
+    uint8_t current_box = (uint8_t)_pksav_corpus_rand_range(state, 0, 13);
+    for(uint8_t box = 0; box < 14; ++box) {
+        size_t count = (num_pc_pokemon > 20) ? 20 : num_pc_pokemon;
+        num_pc_pokemon -= count;
+
+        _pksav_corpus_gen2_box(state, gen2_save.pokemon_boxes[box], count, &gen2_save);
+    }
+    *gen2_save.current_pokemon_box_num = current_box;
+    memcpy(gen2_save.current_pokemon_box, gen2_save.pokemon_boxes[current_box], sizeof(pksav_gen2_pokemon_box_t));
+
+    error = pksav_gen2_save_save_buffer(buffer, PKSAV_CORPUS_GB_SAVE_SIZE, &gen2_save);
+    pksav_gen2_save_free(&gen2_save);
+
+    return error;
+}
+
+/*
+ * Game Boy Advance
+ */
+
+static void _pksav_corpus_gba_pokemon(
+    pksav_corpus_state_t* state,
+    pksav_gba_game_t gba_game,
+    pksav_gba_pc_pokemon_t* pc,
+    pksav_gba_pokemon_party_data_t* party_data,
+    pksav_gba_save_t* gba_save
+) {
+    uint16_t species = 0;
+    uint16_t pokedex_num = 0;
+    do {
+        species = (uint16_t)_pksav_corpus_rand_range(state, 1, 411);
+    } while(pksav_gba_species_to_pokedex_num(species, &pokedex_num));
+
+    uint8_t level = _pksav_corpus_level(state);
+
+    const char* ot_name = NULL;
+    uint32_t ot_id = 0;
+    _pksav_corpus_original_trainer(state, &ot_name, &ot_id);
+
+    memset(pc, 0, sizeof(*pc));
+    pc->personality = pksav_littleendian32(_pksav_corpus_rand(state));
+    pc->ot_id.id = pksav_littleendian32(ot_id);
+    pc->language = pksav_littleendian16(0x0202);
+    pksav_text_to_gba(_pksav_corpus_nickname(state), pc->nickname, 10);
+    pksav_text_to_gba(ot_name, pc->otname, 7);
+
+    pksav_gba_pokemon_blocks_t* blocks = &pc->blocks;
+    blocks->growth.species = pksav_littleendian16(species);
+    blocks->growth.exp = pksav_littleendian32((uint32_t)level * level * level);
+    blocks->growth.friendship = (uint8_t)_pksav_corpus_rand_range(state, 70, 255);
+    if(_pksav_corpus_chance(state, 20)) {
+        blocks->growth.held_item = pksav_littleendian16((uint16_t)_pksav_corpus_rand_range(state, 1, 376));
+    }
+
+    size_t num_moves = (size_t)_pksav_corpus_rand_range(state, 1, (level < 10) ? 2 : 4);
+    for(size_t i = 0; i < num_moves; ++i) {
+        blocks->attacks.moves[i] = pksav_littleendian16((uint16_t)_pksav_corpus_rand_range(state, 1, 354));
+        blocks->attacks.move_pps[i] = (uint8_t)_pksav_corpus_rand_range(state, 5, 35);
+    }
+
+    // At most 510 in total
+    uint8_t* EVs = &blocks->effort.ev_hp;
+    for(size_t i = 0; i < 6; ++i) {
+        EVs[i] = (uint8_t)_pksav_corpus_rand_range(state, 0, 85);
+    }
+
+    // Met in this game, in a Poké Ball
+    static const uint16_t origin_games[] = {2, 3, 4};
+    blocks->misc.met_location = (uint8_t)_pksav_corpus_rand_range(state, 0, 87);
+    blocks->misc.origin_info = pksav_littleendian16(
+                                   (uint16_t)(_pksav_corpus_rand_range(state, 2, level) |
+                                              (origin_games[gba_game] << PKSAV_GBA_ORIGIN_GAME_OFFSET) |
+                                              (4 << PKSAV_GBA_BALL_OFFSET))
+                               );
+    blocks->misc.iv_egg_ability = pksav_littleendian32(
+                                      (_pksav_corpus_rand(state) & 0x3FFFFFFF) |
+                                      ((_pksav_corpus_rand(state) & 1) ? PKSAV_GBA_ABILITY_MASK : 0)
+                                  );
+
+    if(party_data) {
+        pksav_base_stats_t base_stats;
+        pksav_battle_stats_t stats;
+        pksav_get_base_stats(pokedex_num, &base_stats);
+        pksav_calc_stats(
+            &base_stats,
+            level,
+            blocks->misc.iv_egg_ability,
+            EVs,
+            (pksav_nature_t)(pksav_littleendian32(pc->personality) % 25),
+            &stats
+        );
+
+        memset(party_data, 0, sizeof(*party_data));
+        party_data->level      = level;
+        party_data->current_hp = pksav_littleendian16(stats.hp);
+        party_data->max_hp     = pksav_littleendian16(stats.hp);
+        party_data->atk        = pksav_littleendian16(stats.attack);
+        party_data->def        = pksav_littleendian16(stats.defense);
+        party_data->spd        = pksav_littleendian16(stats.speed);
+        party_data->spatk      = pksav_littleendian16(stats.spatk);
+        party_data->spdef      = pksav_littleendian16(stats.spdef);
+    }
+
+    pksav_gba_save_set_pokedex_seen(gba_save, pokedex_num, true);
+    pksav_set_pokedex_bit(gba_save->pokedex_owned, pokedex_num, true);
+}
+
+// A blank slot, with its sections rotated as the game does on each save
+static void _pksav_corpus_gba_blank_slot(
+    pksav_corpus_state_t* state,
+    pksav_gba_game_t gba_game,
+    uint32_t save_index,
+    pksav_gba_save_slot_t* slot
+) {
+    uint32_t rotation = _pksav_corpus_rand_range(state, 0, 13);
+    uint32_t security_key = _pksav_corpus_rand_range(state, 2, 0xFFFFFFFE);
+
+    memset(slot, 0, sizeof(*slot));
+    for(uint8_t i = 0; i < 14; ++i) {
+        pksav_gba_save_section_t* section = &slot->sections_arr[i];
+        uint8_t section_id = (uint8_t)((i + rotation) % 14);
+
+        // Ruby/Sapphire have no security key, and its game code is 0.
+        if(section_id == 0) {
+            if(gba_game == PKSAV_GBA_EMERALD) {
+                section->data32[PKSAV_CORPUS_GBA_GAME_CODE/4] = pksav_littleendian32(security_key);
+                section->data32[PKSAV_CORPUS_EMERALD_KEY2/4] = pksav_littleendian32(security_key);
+            } else if(gba_game == PKSAV_GBA_FRLG) {
+                section->data32[PKSAV_CORPUS_GBA_GAME_CODE/4] = pksav_littleendian32(1);
+                section->data32[PKSAV_CORPUS_FRLG_KEY1/4] = pksav_littleendian32(security_key);
+                section->data32[PKSAV_CORPUS_FRLG_KEY2/4] = pksav_littleendian32(security_key);
+            }
+        }
+
+        section->footer.section_id = section_id;
+        section->footer.validation = pksav_littleendian32(PKSAV_CORPUS_GBA_VALIDATION);
+        section->footer.save_index = pksav_littleendian32(save_index);
+    }
+}
+
+static pksav_error_t _pksav_corpus_generate_gba(
+    pksav_corpus_state_t* state,
+    pksav_gba_game_t gba_game,
+    uint8_t* buffer
+) {
+    memset(buffer, 0, PKSAV_CORPUS_GBA_SAVE_SIZE);
+    _pksav_corpus_gba_blank_slot(
+        state,
+        gba_game,
+        _pksav_corpus_rand_range(state, 1, 5000),
+        (pksav_gba_save_slot_t*)buffer
+    );
+
+    pksav_gba_save_t gba_save;
+    pksav_error_t error = pksav_gba_save_load_buffer(buffer, PKSAV_CORPUS_GBA_SAVE_SIZE, &gba_save);
+    if(error) {
+        return error;
+    }
+
+    pksav_gba_trainer_info_t* trainer_info = gba_save.trainer_info;
+    pksav_text_to_gba(state->trainer_name, trainer_info->name, 7);
+    trainer_info->gender = (uint8_t)_pksav_corpus_rand_range(state, 0, 1);
+    trainer_info->trainer_id.id = pksav_littleendian32(state->trainer_id);
+    trainer_info->time_played.hours = pksav_littleendian16((uint16_t)(state->progress * 150.0));
+    trainer_info->time_played.minutes = (uint8_t)_pksav_corpus_rand_range(state, 0, 59);
+    trainer_info->time_played.seconds = (uint8_t)_pksav_corpus_rand_range(state, 0, 59);
+    trainer_info->time_played.frames = (uint8_t)_pksav_corpus_rand_range(state, 0, 59);
+    if(gba_save.rival_name) {
+        pksav_text_to_gba(
+            _pksav_corpus_pick(state, pksav_corpus_rival_names, PKSAV_CORPUS_ARRAY_LEN(pksav_corpus_rival_names)),
+            gba_save.rival_name,
+            7
+        );
+    }
+    *gba_save.money = pksav_littleendian32(_pksav_corpus_rand_range(state, 0, (uint32_t)(state->progress * 999999)));
+
+    // Decrypting a blank save leaves the security key in the item counts and coins.
+    switch(gba_game) {
+        case PKSAV_GBA_RS:
+            memset(&gba_save.item_storage->rs, 0, sizeof(pksav_rs_item_storage_t));
+            break;
+
+        case PKSAV_GBA_EMERALD:
+            memset(&gba_save.item_storage->emerald, 0, sizeof(pksav_emerald_item_storage_t));
+            break;
+
+        default:
+            memset(&gba_save.item_storage->frlg, 0, sizeof(pksav_frlg_item_storage_t));
+            break;
+    }
+    *gba_save.casino_coins = 0;
+
+    pksav_gba_pokemon_party_t* party = gba_save.pokemon_party;
+    size_t party_size = _pksav_corpus_party_size(state);
+    memset(party, 0, sizeof(*party));
+    party->count = pksav_littleendian32((uint32_t)party_size);
+    for(size_t i = 0; i < party_size; ++i) {
+        _pksav_corpus_gba_pokemon(
+            state,
+            gba_game,
+            &party->party[i].pc,
+            &party->party[i].party_data,
+            &gba_save
+        );
+    }
+
+    pksav_gba_pokemon_pc_t* pokemon_pc = gba_save.pokemon_pc;
+    size_t num_pc_pokemon = _pksav_corpus_pc_size(state, 14 * 30);
+    pokemon_pc->current_box = pksav_littleendian32(_pksav_corpus_rand_range(state, 0, 13));
+    for(uint8_t box = 0; box < 14; ++box) {
+        char box_name[9] = {0};
+        snprintf(box_name, sizeof(box_name), "BOX %d", (box + 1));
+        pksav_text_to_gba(box_name, pokemon_pc->box_names[box], 9);
+        pokemon_pc->wallpapers[box] = (uint8_t)(box % 12);
+
+        size_t count = (num_pc_pokemon > 30) ? 30 : num_pc_pokemon;
+        num_pc_pokemon -= count;
+        for(size_t i = 0; i < count; ++i) {
+            _pksav_corpus_gba_pokemon(
+                state,
+                gba_game,
+                &pokemon_pc->boxes[box].entries[i],
+                NULL,
+                &gba_save
+            );
+        }
+    }
+
+    /*
+     * Save twice, so both slots hold the save, with the older one a few
+     * minutes behind. Each save re-encrypts everything, then decrypts it again
+     * when the new slot is reloaded.
+     */
+    error = pksav_gba_save_save_buffer(buffer, PKSAV_CORPUS_GBA_SAVE_SIZE, &gba_save);
+    if(!error) {
+        trainer_info = gba_save.trainer_info;
+        trainer_info->time_played.minutes = (uint8_t)((trainer_info->time_played.minutes + 5) % 60);
+        error = pksav_gba_save_save_buffer(buffer, PKSAV_CORPUS_GBA_SAVE_SIZE, &gba_save);
+    }
+    pksav_gba_save_free(&gba_save);
+
+    return error;
+}
+
+pksav_error_t pksav_corpus_get_save_size(
+    pksav_corpus_game_t game,
+    size_t* save_size_out
+) {
+    if(!save_size_out) {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+
+    switch(game) {
+        case PKSAV_CORPUS_RED_BLUE:
+        case PKSAV_CORPUS_YELLOW:
+        case PKSAV_CORPUS_GOLD_SILVER:
+        case PKSAV_CORPUS_CRYSTAL:
+            *save_size_out = PKSAV_CORPUS_GB_SAVE_SIZE;
+            return PKSAV_ERROR_NONE;
+
+        case PKSAV_CORPUS_RUBY_SAPPHIRE:
+        case PKSAV_CORPUS_EMERALD:
+        case PKSAV_CORPUS_FIRERED_LEAFGREEN:
+            *save_size_out = PKSAV_CORPUS_GBA_SAVE_SIZE;
+            return PKSAV_ERROR_NONE;
+
+        default:
+            return PKSAV_ERROR_PARAM_OUT_OF_RANGE;
+    }
+}
+
+pksav_error_t pksav_corpus_generate_save(
+    pksav_corpus_game_t game,
+    uint32_t seed,
+    uint8_t* buffer,
+    size_t buffer_len,
+    size_t* save_size_out
+) {
+    if(!buffer) {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+
+    size_t save_size = 0;
+    pksav_error_t error = pksav_corpus_get_save_size(game, &save_size);
+    if(error) {
+        return error;
+    }
+    if(buffer_len < save_size) {
+        return PKSAV_ERROR_PARAM_OUT_OF_RANGE;
+    }
+
+    // The Mersenne Twister's state is too large to comfortably keep on the stack.
+    pksav_corpus_state_t* state = calloc(1, sizeof(pksav_corpus_state_t));
+    _pksav_corpus_init(state, seed);
+
+    switch(game) {
+        case PKSAV_CORPUS_RED_BLUE:
+        case PKSAV_CORPUS_YELLOW:
+            error = _pksav_corpus_generate_gen1(state, (game == PKSAV_CORPUS_YELLOW), buffer);
+            break;
+
+        case PKSAV_CORPUS_GOLD_SILVER:
+        case PKSAV_CORPUS_CRYSTAL:
+            error = _pksav_corpus_generate_gen2(state, (game == PKSAV_CORPUS_CRYSTAL), buffer);
+            break;
+
+        case PKSAV_CORPUS_RUBY_SAPPHIRE:
+            error = _pksav_corpus_generate_gba(state, PKSAV_GBA_RS, buffer);
+            break;
+
+        case PKSAV_CORPUS_EMERALD:
+            error = _pksav_corpus_generate_gba(state, PKSAV_GBA_EMERALD, buffer);
+            break;
+
+        default:
+            error = _pksav_corpus_generate_gba(state, PKSAV_GBA_FRLG, buffer);
+            break;
+    }
+
+    free(state);
+    if(!error && save_size_out) {
+        *save_size_out = save_size;
+    }
+
+    return error;
+}
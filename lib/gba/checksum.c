@@ -24,11 +24,10 @@ uint16_t pksav_get_gba_section_checksum(
     uint8_t section_num
 ) {
     uint32_t checksum = 0;
-    uint16_t* checksum_ptr = (uint16_t*)&checksum;
 
     for(int i = 0; i < (pksav_gba_section_sizes[section_num]/4); i++) {
         checksum += section->data32[i];
     }
 
-    return (checksum_ptr[0] + checksum_ptr[1]);
+    return (uint16_t)((checksum >> 16) + (checksum & 0xFFFF));
 }
@@ -0,0 +1,387 @@
+/*
+ * Copyright (c) 2018 Nicholas Corgan (n.corgan@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "../common/crc16.h"
+
+#include <pksav/gba/patch.h>
+#include <pksav/math/endian.h>
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+
+// Sections 5-13 are the PC, which is compared box by box instead.
+#define PKSAV_GBA_PATCH_NUM_SECTIONS 5
+#define PKSAV_GBA_PATCH_NUM_BOXES    14
+
+// The sections, the current box, each box, then the box names and wallpapers
+#define PKSAV_GBA_PATCH_CURRENT_BOX_UNIT PKSAV_GBA_PATCH_NUM_SECTIONS
+#define PKSAV_GBA_PATCH_FIRST_BOX_UNIT   (PKSAV_GBA_PATCH_CURRENT_BOX_UNIT + 1)
+#define PKSAV_GBA_PATCH_BOX_INFO_UNIT    (PKSAV_GBA_PATCH_FIRST_BOX_UNIT + PKSAV_GBA_PATCH_NUM_BOXES)
+#define PKSAV_GBA_PATCH_NUM_UNITS        (PKSAV_GBA_PATCH_BOX_INFO_UNIT + 1)
+
+/*
+ * Patches are a header followed by each changed unit in order, all
+ * little-endian:
+ *
+ * Header: "PKSG", game (1 byte), number of units (1 byte), padding (2 bytes)
+ * Unit:   unit (1 byte), padding (1 byte), CRC16 of the old unit (2 bytes),
+ *         number of ranges (2 bytes)
+ * Range:  offset into the unit (2 bytes), length (2 bytes), the new bytes
+ */
+static const uint8_t pksav_gba_patch_magic[4] = {'P','K','S','G'};
+
+#define PKSAV_GBA_PATCH_HEADER_SIZE       8
+#define PKSAV_GBA_PATCH_UNIT_HEADER_SIZE  6
+#define PKSAV_GBA_PATCH_RANGE_HEADER_SIZE 4
+
+// A section or part of the PC that's compared on its own.
+typedef struct {
+    uint8_t* data;
+    size_t size;
+    // The section the unit is in, or 5 for the PC, and where in the PC it starts
+    uint8_t section;
+    size_t pc_offset;
+} pksav_gba_patch_unit_t;
+
+static void _pksav_gba_patch_get_units(
+    const pksav_gba_save_t* gba_save,
+    pksav_gba_patch_unit_t* units_out
+) {
+    for(uint8_t i = 0; i < PKSAV_GBA_PATCH_NUM_SECTIONS; ++i) {
+        units_out[i].data = gba_save->unshuffled->sections_arr[i].data8;
+        units_out[i].size = pksav_gba_section_sizes[i];
+        units_out[i].section = i;
+        units_out[i].pc_offset = 0;
+    }
+
+    pksav_gba_pokemon_pc_t* pokemon_pc = gba_save->pokemon_pc;
+
+    units_out[PKSAV_GBA_PATCH_CURRENT_BOX_UNIT].data = (uint8_t*)&pokemon_pc->current_box;
+    units_out[PKSAV_GBA_PATCH_CURRENT_BOX_UNIT].size = sizeof(pokemon_pc->current_box);
+    units_out[PKSAV_GBA_PATCH_CURRENT_BOX_UNIT].pc_offset = offsetof(pksav_gba_pokemon_pc_t, current_box);
+
+    for(size_t i = 0; i < PKSAV_GBA_PATCH_NUM_BOXES; ++i) {
+        pksav_gba_patch_unit_t* unit = &units_out[PKSAV_GBA_PATCH_FIRST_BOX_UNIT + i];
+        unit->data = (uint8_t*)&pokemon_pc->boxes[i];
+        unit->size = sizeof(pokemon_pc->boxes[i]);
+        unit->pc_offset = offsetof(pksav_gba_pokemon_pc_t, boxes) + (i * sizeof(pokemon_pc->boxes[i]));
+    }
+
+    units_out[PKSAV_GBA_PATCH_BOX_INFO_UNIT].data = &pokemon_pc->box_names[0][0];
+    units_out[PKSAV_GBA_PATCH_BOX_INFO_UNIT].size = sizeof(pksav_gba_pokemon_pc_t) -
+                                                    offsetof(pksav_gba_pokemon_pc_t, box_names);
+    units_out[PKSAV_GBA_PATCH_BOX_INFO_UNIT].pc_offset = offsetof(pksav_gba_pokemon_pc_t, box_names);
+
+    for(size_t i = PKSAV_GBA_PATCH_NUM_SECTIONS; i < PKSAV_GBA_PATCH_NUM_UNITS; ++i) {
+        units_out[i].section = 5;
+    }
+}
+
+// Which sections the given bytes of a unit end up in when saved.
+static uint16_t _pksav_gba_patch_dirty_sections(
+    const pksav_gba_patch_unit_t* unit,
+    size_t offset,
+    size_t len
+) {
+    if(unit->section < PKSAV_GBA_PATCH_NUM_SECTIONS) {
+        return (uint16_t)(1 << unit->section);
+    }
+
+    size_t first_byte = unit->pc_offset + offset;
+    size_t end_byte = first_byte + len;
+
+    uint16_t dirty_sections = 0;
+    size_t section_start = 0;
+    for(uint8_t i = 5; i < 14; ++i) {
+        size_t section_end = section_start + pksav_gba_section_sizes[i];
+        if((first_byte < section_end) && (end_byte > section_start)) {
+            dirty_sections |= (uint16_t)(1 << i);
+        }
+        section_start = section_end;
+    }
+
+    return dirty_sections;
+}
+
+static PKSAV_INLINE void _pksav_gba_patch_write16(
+    uint8_t* buffer,
+    uint16_t value
+) {
+    value = pksav_littleendian16(value);
+    memcpy(buffer, &value, sizeof(value));
+}
+
+static PKSAV_INLINE uint16_t _pksav_gba_patch_read16(
+    const uint8_t* buffer
+) {
+    uint16_t value = 0;
+    memcpy(&value, buffer, sizeof(value));
+
+    return pksav_littleendian16(value);
+}
+
+/*
+ * Finds the ranges of bytes that differ between two copies of a unit, writing
+ * them to buffer if it isn't NULL. Ranges separated by fewer equal bytes than
+ * a range header are combined, since that's smaller. Returns how many bytes
+ * the ranges take.
+ */
+static size_t _pksav_gba_patch_diff_unit(
+    const uint8_t* old_data,
+    const uint8_t* new_data,
+    size_t size,
+    uint8_t* buffer,
+    uint16_t* num_ranges_out
+) {
+    size_t ranges_size = 0;
+    uint16_t num_ranges = 0;
+
+    size_t i = 0;
+    while(i < size) {
+        if(old_data[i] == new_data[i]) {
+            ++i;
+            continue;
+        }
+
+        size_t start = i;
+        size_t end = i + 1;
+        for(size_t j = end; (j < size) && ((j - end) < PKSAV_GBA_PATCH_RANGE_HEADER_SIZE); ++j) {
+            if(old_data[j] != new_data[j]) {
+                end = j + 1;
+            }
+        }
+
+        if(buffer) {
+            _pksav_gba_patch_write16(&buffer[ranges_size], (uint16_t)start);
+            _pksav_gba_patch_write16(&buffer[ranges_size + 2], (uint16_t)(end - start));
+            memcpy(&buffer[ranges_size + PKSAV_GBA_PATCH_RANGE_HEADER_SIZE], &new_data[start], end - start);
+        }
+
+        ranges_size += PKSAV_GBA_PATCH_RANGE_HEADER_SIZE + (end - start);
+        ++num_ranges;
+        i = end;
+    }
+
+    *num_ranges_out = num_ranges;
+
+    return ranges_size;
+}
+
+pksav_error_t pksav_gba_save_get_patch_size(
+    const pksav_gba_save_t* old_save,
+    const pksav_gba_save_t* new_save,
+    size_t* patch_size_out
+) {
+    if(!old_save || !new_save || !patch_size_out) {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+    if(old_save->gba_game != new_save->gba_game) {
+        return PKSAV_ERROR_INVALID_SAVE;
+    }
+
+    pksav_gba_patch_unit_t old_units[PKSAV_GBA_PATCH_NUM_UNITS];
+    pksav_gba_patch_unit_t new_units[PKSAV_GBA_PATCH_NUM_UNITS];
+    _pksav_gba_patch_get_units(old_save, old_units);
+    _pksav_gba_patch_get_units(new_save, new_units);
+
+    size_t patch_size = PKSAV_GBA_PATCH_HEADER_SIZE;
+    for(size_t i = 0; i < PKSAV_GBA_PATCH_NUM_UNITS; ++i) {
+        if(!memcmp(old_units[i].data, new_units[i].data, old_units[i].size)) {
+            continue;
+        }
+
+        uint16_t num_ranges = 0;
+        patch_size += PKSAV_GBA_PATCH_UNIT_HEADER_SIZE +
+                      _pksav_gba_patch_diff_unit(
+                          old_units[i].data,
+                          new_units[i].data,
+                          old_units[i].size,
+                          NULL,
+                          &num_ranges
+                      );
+    }
+    *patch_size_out = patch_size;
+
+    return PKSAV_ERROR_NONE;
+}
+
+pksav_error_t pksav_gba_save_make_patch(
+    const pksav_gba_save_t* old_save,
+    const pksav_gba_save_t* new_save,
+    uint8_t* buffer,
+    size_t buffer_len,
+    size_t* patch_size_out
+) {
+    if(!old_save || !new_save || !buffer || !patch_size_out) {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+
+    size_t patch_size = 0;
+    pksav_error_t error = pksav_gba_save_get_patch_size(
+                              old_save,
+                              new_save,
+                              &patch_size
+                          );
+    if(error) {
+        return error;
+    }
+    if(buffer_len < patch_size) {
+        return PKSAV_ERROR_PARAM_OUT_OF_RANGE;
+    }
+
+    pksav_gba_patch_unit_t old_units[PKSAV_GBA_PATCH_NUM_UNITS];
+    pksav_gba_patch_unit_t new_units[PKSAV_GBA_PATCH_NUM_UNITS];
+    _pksav_gba_patch_get_units(old_save, old_units);
+    _pksav_gba_patch_get_units(new_save, new_units);
+
+    uint8_t num_units = 0;
+    size_t pos = PKSAV_GBA_PATCH_HEADER_SIZE;
+    for(uint8_t i = 0; i < PKSAV_GBA_PATCH_NUM_UNITS; ++i) {
+        if(!memcmp(old_units[i].data, new_units[i].data, old_units[i].size)) {
+            continue;
+        }
+
+        uint16_t num_ranges = 0;
+        size_t ranges_size = _pksav_gba_patch_diff_unit(
+                                 old_units[i].data,
+                                 new_units[i].data,
+                                 old_units[i].size,
+                                 &buffer[pos + PKSAV_GBA_PATCH_UNIT_HEADER_SIZE],
+                                 &num_ranges
+                             );
+
+        buffer[pos] = i;
+        buffer[pos + 1] = 0;
+        _pksav_gba_patch_write16(
+            &buffer[pos + 2],
+            pksav_crc16_ccitt(old_units[i].data, old_units[i].size)
+        );
+        _pksav_gba_patch_write16(&buffer[pos + 4], num_ranges);
+
+        pos += PKSAV_GBA_PATCH_UNIT_HEADER_SIZE + ranges_size;
+        ++num_units;
+    }
+
+    memcpy(buffer, pksav_gba_patch_magic, sizeof(pksav_gba_patch_magic));
+    buffer[4] = (uint8_t)old_save->gba_game;
+    buffer[5] = num_units;
+    buffer[6] = 0;
+    buffer[7] = 0;
+
+    *patch_size_out = pos;
+
+    return PKSAV_ERROR_NONE;
+}
+
+/*
+ * Checks one unit of a patch against the save, returning how big it is in the
+ * patch, or 0 with error_out set if it doesn't fit.
+ */
+static size_t _pksav_gba_patch_check_unit(
+    const pksav_gba_patch_unit_t* units,
+    const uint8_t* patch_unit,
+    size_t remaining_len,
+    int previous_unit,
+    pksav_error_t* error_out
+) {
+    *error_out = PKSAV_ERROR_PARAM_OUT_OF_RANGE;
+
+    // Each unit is only in a patch once, in order.
+    if((remaining_len < PKSAV_GBA_PATCH_UNIT_HEADER_SIZE) ||
+       (patch_unit[0] >= PKSAV_GBA_PATCH_NUM_UNITS) ||
+       ((int)patch_unit[0] <= previous_unit)) {
+        return 0;
+    }
+
+    const pksav_gba_patch_unit_t* unit = &units[patch_unit[0]];
+    uint16_t num_ranges = _pksav_gba_patch_read16(&patch_unit[4]);
+
+    size_t pos = PKSAV_GBA_PATCH_UNIT_HEADER_SIZE;
+    for(uint16_t i = 0; i < num_ranges; ++i) {
+        if((remaining_len - pos) < PKSAV_GBA_PATCH_RANGE_HEADER_SIZE) {
+            return 0;
+        }
+
+        size_t offset = _pksav_gba_patch_read16(&patch_unit[pos]);
+        size_t len = _pksav_gba_patch_read16(&patch_unit[pos + 2]);
+        pos += PKSAV_GBA_PATCH_RANGE_HEADER_SIZE;
+        if((offset >= unit->size) || (len > (unit->size - offset)) || (len > (remaining_len - pos))) {
+            return 0;
+        }
+        pos += len;
+    }
+
+    if(pksav_crc16_ccitt(unit->data, unit->size) != _pksav_gba_patch_read16(&patch_unit[2])) {
+        *error_out = PKSAV_ERROR_INVALID_SAVE;
+        return 0;
+    }
+
+    *error_out = PKSAV_ERROR_NONE;
+
+    return pos;
+}
+
+pksav_error_t pksav_gba_save_apply_patch(
+    pksav_gba_save_t* gba_save,
+    const uint8_t* patch,
+    size_t patch_len
+) {
+    if(!gba_save || !patch) {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+    if((patch_len < PKSAV_GBA_PATCH_HEADER_SIZE) ||
+       memcmp(patch, pksav_gba_patch_magic, sizeof(pksav_gba_patch_magic))) {
+        return PKSAV_ERROR_PARAM_OUT_OF_RANGE;
+    }
+    if(patch[4] != (uint8_t)gba_save->gba_game) {
+        return PKSAV_ERROR_INVALID_SAVE;
+    }
+
+    pksav_gba_patch_unit_t units[PKSAV_GBA_PATCH_NUM_UNITS];
+    _pksav_gba_patch_get_units(gba_save, units);
+
+    // Make sure everything applies before changing anything.
+    uint8_t num_units = patch[5];
+    size_t pos = PKSAV_GBA_PATCH_HEADER_SIZE;
+    int previous_unit = -1;
+    for(uint8_t i = 0; i < num_units; ++i) {
+        pksav_error_t error = PKSAV_ERROR_NONE;
+        size_t unit_len = _pksav_gba_patch_check_unit(
+                              units,
+                              &patch[pos],
+                              patch_len - pos,
+                              previous_unit,
+                              &error
+                          );
+        if(error) {
+            return error;
+        }
+
+        previous_unit = patch[pos];
+        pos += unit_len;
+    }
+
+    pos = PKSAV_GBA_PATCH_HEADER_SIZE;
+    for(uint8_t i = 0; i < num_units; ++i) {
+        const pksav_gba_patch_unit_t* unit = &units[patch[pos]];
+        uint16_t num_ranges = _pksav_gba_patch_read16(&patch[pos + 4]);
+        pos += PKSAV_GBA_PATCH_UNIT_HEADER_SIZE;
+
+        for(uint16_t j = 0; j < num_ranges; ++j) {
+            size_t offset = _pksav_gba_patch_read16(&patch[pos]);
+            size_t len = _pksav_gba_patch_read16(&patch[pos + 2]);
+            pos += PKSAV_GBA_PATCH_RANGE_HEADER_SIZE;
+
+            memcpy(&unit->data[offset], &patch[pos], len);
+            gba_save->dirty_sections |= _pksav_gba_patch_dirty_sections(unit, offset, len);
+            pos += len;
+        }
+    }
+
+    return PKSAV_ERROR_NONE;
+}
@@ -0,0 +1,237 @@
+/*
+ * Copyright (c) 2018 Nicholas Corgan (n.corgan@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "pokedex.h"
+
+#include <pksav/common/pokedex.h>
+#include <pksav/gba/pokedex.h>
+#include <pksav/math/endian.h>
+
+#include <string.h>
+
+// Which section each mirror lives in
+#define PKSAV_GBA_POKEDEX_SEEN_A_SECTION 0
+#define PKSAV_GBA_POKEDEX_SEEN_B_SECTION 1
+#define PKSAV_GBA_POKEDEX_SEEN_C_SECTION 4
+#define PKSAV_GBA_NAT_POKEDEX_A_SECTION  0
+#define PKSAV_GBA_NAT_POKEDEX_BC_SECTION 2
+
+#define PKSAV_GBA_SEEN_DIRTY_MASK ((1 << PKSAV_GBA_POKEDEX_SEEN_A_SECTION) | \
+                                   (1 << PKSAV_GBA_POKEDEX_SEEN_B_SECTION) | \
+                                   (1 << PKSAV_GBA_POKEDEX_SEEN_C_SECTION))
+
+#define PKSAV_GBA_NAT_DIRTY_MASK ((1 << PKSAV_GBA_NAT_POKEDEX_A_SECTION) | \
+                                  (1 << PKSAV_GBA_NAT_POKEDEX_BC_SECTION))
+
+// Copy the given bytes of the canonical seen list into the other mirrors.
+static PKSAV_INLINE void _pksav_gba_mirror_pokedex_seen(
+    pksav_gba_save_t* gba_save,
+    size_t first_byte,
+    size_t num_bytes
+) {
+    memcpy(&gba_save->pokedex_seenB[first_byte], &gba_save->pokedex_seenA[first_byte], num_bytes);
+    memcpy(&gba_save->pokedex_seenC[first_byte], &gba_save->pokedex_seenA[first_byte], num_bytes);
+
+    gba_save->dirty_sections |= PKSAV_GBA_SEEN_DIRTY_MASK;
+}
+
+pksav_error_t pksav_gba_save_set_pokedex_seen(
+    pksav_gba_save_t* gba_save,
+    uint16_t pokedex_num,
+    bool seen
+) {
+    return pksav_gba_save_set_pokedex_seen_range(
+               gba_save,
+               pokedex_num,
+               pokedex_num,
+               seen
+           );
+}
+
+pksav_error_t pksav_gba_save_set_pokedex_seen_range(
+    pksav_gba_save_t* gba_save,
+    uint16_t first_pokedex_num,
+    uint16_t last_pokedex_num,
+    bool seen
+) {
+    if(!gba_save) {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+    if((first_pokedex_num == 0) || (last_pokedex_num < first_pokedex_num) ||
+       (last_pokedex_num > PKSAV_GBA_POKEDEX_NUM_SPECIES)) {
+        return PKSAV_ERROR_PARAM_OUT_OF_RANGE;
+    }
+
+    pksav_error_t error = pksav_set_pokedex_bit_range(
+                              gba_save->pokedex_seenA,
+                              first_pokedex_num,
+                              last_pokedex_num,
+                              seen
+                          );
+    if(!error) {
+        size_t first_byte = (first_pokedex_num - 1) / 8;
+        size_t last_byte = (last_pokedex_num - 1) / 8;
+        _pksav_gba_mirror_pokedex_seen(gba_save, first_byte, last_byte - first_byte + 1);
+    }
+
+    return error;
+}
+
+pksav_error_t pksav_gba_save_sync_pokedex_seen(
+    pksav_gba_save_t* gba_save
+) {
+    if(!gba_save) {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+
+    _pksav_gba_mirror_pokedex_seen(gba_save, 0, PKSAV_GBA_POKEDEX_BUFFER_SIZE);
+
+    return PKSAV_ERROR_NONE;
+}
+
+/*
+ * Each field holds its mask when the National Pokédex is unlocked. The
+ * first field is one byte in FireRed/LeafGreen and two in the others.
+ */
+static bool _pksav_gba_nat_pokedex_a_unlocked(
+    const pksav_gba_save_t* gba_save
+) {
+    if(gba_save->gba_game == PKSAV_GBA_FRLG) {
+        return (*gba_save->frlg_nat_pokedex_unlockedA & PKSAV_GBA_FRLG_NAT_POKEDEX_UNLOCKED_MASK_A)
+               == PKSAV_GBA_FRLG_NAT_POKEDEX_UNLOCKED_MASK_A;
+    } else {
+        return (pksav_littleendian16(*gba_save->rse_nat_pokedex_unlockedA) & PKSAV_GBA_RSE_NAT_POKEDEX_UNLOCKED_MASK_A)
+               == PKSAV_GBA_RSE_NAT_POKEDEX_UNLOCKED_MASK_A;
+    }
+}
+
+static bool _pksav_gba_nat_pokedex_b_unlocked(
+    const pksav_gba_save_t* gba_save
+) {
+    uint8_t mask = (gba_save->gba_game == PKSAV_GBA_FRLG) ? PKSAV_GBA_FRLG_NAT_POKEDEX_UNLOCKED_MASK_B
+                                                          : PKSAV_GBA_RSE_NAT_POKEDEX_UNLOCKED_MASK_B;
+
+    return (*gba_save->nat_pokedex_unlockedB & mask) == mask;
+}
+
+static bool _pksav_gba_nat_pokedex_c_unlocked(
+    const pksav_gba_save_t* gba_save
+) {
+    uint16_t mask = (gba_save->gba_game == PKSAV_GBA_FRLG) ? PKSAV_GBA_FRLG_NAT_POKEDEX_UNLOCKED_MASK_C
+                                                           : PKSAV_GBA_RSE_NAT_POKEDEX_UNLOCKED_MASK_C;
+
+    return (pksav_littleendian16(*gba_save->nat_pokedex_unlockedC) & mask) == mask;
+}
+
+pksav_error_t pksav_gba_save_get_nat_pokedex_unlocked(
+    const pksav_gba_save_t* gba_save,
+    bool* unlocked_out
+) {
+    if(!gba_save || !unlocked_out) {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+
+    *unlocked_out = _pksav_gba_nat_pokedex_a_unlocked(gba_save);
+
+    return PKSAV_ERROR_NONE;
+}
+
+pksav_error_t pksav_gba_save_set_nat_pokedex_unlocked(
+    pksav_gba_save_t* gba_save,
+    bool unlocked
+) {
+    if(!gba_save) {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+
+    uint8_t mask_b = 0;
+    uint16_t mask_c = 0;
+
+    if(gba_save->gba_game == PKSAV_GBA_FRLG) {
+        if(unlocked) {
+            *gba_save->frlg_nat_pokedex_unlockedA |= PKSAV_GBA_FRLG_NAT_POKEDEX_UNLOCKED_MASK_A;
+        } else {
+            *gba_save->frlg_nat_pokedex_unlockedA &= (uint8_t)~PKSAV_GBA_FRLG_NAT_POKEDEX_UNLOCKED_MASK_A;
+        }
+
+        mask_b = PKSAV_GBA_FRLG_NAT_POKEDEX_UNLOCKED_MASK_B;
+        mask_c = PKSAV_GBA_FRLG_NAT_POKEDEX_UNLOCKED_MASK_C;
+    } else {
+        uint16_t mask_a = pksav_littleendian16(PKSAV_GBA_RSE_NAT_POKEDEX_UNLOCKED_MASK_A);
+        if(unlocked) {
+            *gba_save->rse_nat_pokedex_unlockedA |= mask_a;
+        } else {
+            *gba_save->rse_nat_pokedex_unlockedA &= (uint16_t)~mask_a;
+        }
+
+        mask_b = PKSAV_GBA_RSE_NAT_POKEDEX_UNLOCKED_MASK_B;
+        mask_c = PKSAV_GBA_RSE_NAT_POKEDEX_UNLOCKED_MASK_C;
+    }
+
+    mask_c = pksav_littleendian16(mask_c);
+    if(unlocked) {
+        *gba_save->nat_pokedex_unlockedB |= mask_b;
+        *gba_save->nat_pokedex_unlockedC |= mask_c;
+    } else {
+        *gba_save->nat_pokedex_unlockedB &= (uint8_t)~mask_b;
+        *gba_save->nat_pokedex_unlockedC &= (uint16_t)~mask_c;
+    }
+
+    gba_save->dirty_sections |= PKSAV_GBA_NAT_DIRTY_MASK;
+
+    return PKSAV_ERROR_NONE;
+}
+
+bool _pksav_gba_save_pokedex_mirrors_match(
+    const pksav_gba_save_t* gba_save
+) {
+    bool nat_pokedex_unlocked = _pksav_gba_nat_pokedex_a_unlocked(gba_save);
+
+    return !memcmp(gba_save->pokedex_seenA, gba_save->pokedex_seenB, PKSAV_GBA_POKEDEX_BUFFER_SIZE) &&
+           !memcmp(gba_save->pokedex_seenA, gba_save->pokedex_seenC, PKSAV_GBA_POKEDEX_BUFFER_SIZE) &&
+           (_pksav_gba_nat_pokedex_b_unlocked(gba_save) == nat_pokedex_unlocked) &&
+           (_pksav_gba_nat_pokedex_c_unlocked(gba_save) == nat_pokedex_unlocked);
+}
+
+pksav_error_t pksav_gba_save_check_pokedex_mirrors(
+    const pksav_gba_save_t* gba_save,
+    bool* mirrors_match_out
+) {
+    if(!gba_save || !mirrors_match_out) {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+
+    *mirrors_match_out = _pksav_gba_save_pokedex_mirrors_match(gba_save);
+
+    return PKSAV_ERROR_NONE;
+}
+
+pksav_error_t pksav_gba_save_pokedex_mirrors_matched_on_load(
+    const pksav_gba_save_t* gba_save,
+    bool* mirrors_matched_out
+) {
+    if(!gba_save || !mirrors_matched_out) {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+
+    *mirrors_matched_out = gba_save->pokedex_mirrors_matched;
+
+    return PKSAV_ERROR_NONE;
+}
+
+pksav_error_t pksav_gba_save_get_dirty_sections(
+    const pksav_gba_save_t* gba_save,
+    uint16_t* dirty_sections_out
+) {
+    if(!gba_save || !dirty_sections_out) {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+
+    *dirty_sections_out = gba_save->dirty_sections;
+
+    return PKSAV_ERROR_NONE;
+}
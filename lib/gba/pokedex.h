@@ -0,0 +1,19 @@
+/*
+ * Copyright (c) 2018 Nicholas Corgan (n.corgan@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+#ifndef PKSAV_GBA_POKEDEX_INTERNAL_H
+#define PKSAV_GBA_POKEDEX_INTERNAL_H
+
+#include <pksav/gba/save.h>
+
+#include <stdbool.h>
+
+// Assumes all of the save's pointers have been set.
+bool _pksav_gba_save_pokedex_mirrors_match(
+    const pksav_gba_save_t* gba_save
+);
+
+#endif /* PKSAV_GBA_POKEDEX_INTERNAL_H */
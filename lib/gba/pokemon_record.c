@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2018 Nicholas Corgan (n.corgan@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "../common/pokemon_record.h"
+
+#include <pksav/common/base_stats.h>
+#include <pksav/gba/pokemon_record.h>
+#include <pksav/gba/text.h>
+
+#include <pksav/math/endian.h>
+
+#include <string.h>
+
+static void _pksav_gba_pc_pokemon_to_record(
+    const pksav_gba_pc_pokemon_t* pc_pokemon,
+    uint8_t level,
+    pksav_pokemon_record_t* record_out
+) {
+    const pksav_gba_pokemon_growth_t* growth = &pc_pokemon->blocks.growth;
+    const pksav_gba_pokemon_attacks_t* attacks = &pc_pokemon->blocks.attacks;
+    const pksav_gba_pokemon_effort_t* effort = &pc_pokemon->blocks.effort;
+    const pksav_gba_pokemon_misc_t* misc = &pc_pokemon->blocks.misc;
+
+    memset(record_out, 0, sizeof(*record_out));
+
+    // Invalid species indices are left as 0.
+    (void)pksav_gba_species_to_pokedex_num(
+              pksav_littleendian16(growth->species),
+              &record_out->pokedex_num
+          );
+
+    record_out->personality  = pksav_littleendian32(pc_pokemon->personality);
+    record_out->exp          = pksav_littleendian32(growth->exp);
+    record_out->held_item    = pksav_littleendian16(growth->held_item);
+    record_out->ot_public_id = pksav_littleendian16(pc_pokemon->ot_id.pid);
+    record_out->ot_secret_id = pksav_littleendian16(pc_pokemon->ot_id.sid);
+    for(size_t i = 0; i < 4; ++i) {
+        record_out->moves[i] = pksav_littleendian16(attacks->moves[i]);
+    }
+
+    record_out->EVs[0] = effort->ev_hp;
+    record_out->EVs[1] = effort->ev_atk;
+    record_out->EVs[2] = effort->ev_def;
+    record_out->EVs[3] = effort->ev_spd;
+    record_out->EVs[4] = effort->ev_spatk;
+    record_out->EVs[5] = effort->ev_spdef;
+
+    uint32_t iv_egg_ability = pksav_littleendian32(misc->iv_egg_ability);
+    _pksav_record_set_IVs(record_out, iv_egg_ability);
+
+    record_out->level      = level;
+    record_out->friendship = growth->friendship;
+    record_out->pokerus    = misc->pokerus;
+    record_out->generation = 3;
+    record_out->nature     = (uint8_t)(record_out->personality % 25);
+
+    if(iv_egg_ability & PKSAV_GBA_EGG_MASK) {
+        record_out->flags |= PKSAV_POKEMON_RECORD_IS_EGG_MASK;
+    }
+    if(_pksav_record_is_shiny(record_out)) {
+        record_out->flags |= PKSAV_POKEMON_RECORD_IS_SHINY_MASK;
+    }
+    if(pksav_littleendian16(misc->origin_info) & PKSAV_GBA_OTGENDER_MASK) {
+        record_out->flags |= PKSAV_POKEMON_RECORD_OT_FEMALE_MASK;
+    }
+
+    pksav_text_from_gba_utf8(pc_pokemon->nickname, 10, record_out->nickname, PKSAV_POKEMON_RECORD_NAME_SIZE, NULL);
+    pksav_text_from_gba_utf8(pc_pokemon->otname, 7, record_out->otname, PKSAV_POKEMON_RECORD_NAME_SIZE, NULL);
+}
+
+pksav_error_t pksav_gba_box_to_records(
+    const pksav_gba_pokemon_box_t* box,
+    pksav_pokemon_record_t* records_out,
+    size_t* num_records_out
+) {
+    if(!box || !records_out || !num_records_out) {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+
+    size_t num_records = 0;
+    for(size_t i = 0; i < 30; ++i) {
+        if(box->entries[i].blocks.growth.species) {
+            _pksav_gba_pc_pokemon_to_record(
+                &box->entries[i],
+                0,
+                &records_out[num_records++]
+            );
+        }
+    }
+    *num_records_out = num_records;
+
+    return PKSAV_ERROR_NONE;
+}
+
+pksav_error_t pksav_gba_party_to_records(
+    const pksav_gba_pokemon_party_t* party,
+    pksav_pokemon_record_t* records_out,
+    size_t* num_records_out
+) {
+    if(!party || !records_out || !num_records_out) {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+
+    uint32_t count = pksav_littleendian32(party->count);
+    if(count > 6) {
+        return PKSAV_ERROR_PARAM_OUT_OF_RANGE;
+    }
+
+    for(uint32_t i = 0; i < count; ++i) {
+        _pksav_gba_pc_pokemon_to_record(
+            &party->party[i].pc,
+            party->party[i].party_data.level,
+            &records_out[i]
+        );
+    }
+    *num_records_out = count;
+
+    return PKSAV_ERROR_NONE;
+}
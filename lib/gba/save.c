@@ -5,8 +5,13 @@
  * or copy at http://opensource.org/licenses/MIT)
  */
 
+#include "../common/allocator.h"
+#include "../common/instrumentation.h"
+#include "../common/thread.h"
+
 #include "checksum.h"
 #include "crypt.h"
+#include "pokedex.h"
 #include "shuffle.h"
 
 #include <pksav/config.h>
@@ -18,6 +23,7 @@
 #include <pksav/math/endian.h>
 
 #include <stdio.h>
+#include <string.h>
 
 #define SECURITY_KEY1(sections,game) (sections)->section0.data32[pksav_gba_section0_offsets[PKSAV_GBA_SECURITY_KEY1][game]/4]
 #define SECURITY_KEY2(sections,game) (sections)->section0.data32[pksav_gba_section0_offsets[PKSAV_GBA_SECURITY_KEY2][game]/4]
@@ -65,6 +71,12 @@
 
 #define PKSAV_GBA_VALIDATION 0x08012025
 
+// One bit for each section ID
+#define PKSAV_GBA_ALL_SECTIONS 0x3FFF
+
+// Compact saves only keep the sections before the PC.
+#define PKSAV_GBA_COMPACT_NUM_SECTIONS 5
+
 typedef enum {
     PKSAV_GBA_SAVE_A = 0x0000,
     PKSAV_GBA_SAVE_B = 0xE000
@@ -124,47 +136,36 @@ static const uint16_t pksav_gba_section4_offsets[][4] = {
     {0x0000,0x0000,0x0BCC}  // Rival Name (FR/LG only)
 };
 
-pksav_error_t pksav_buffer_is_gba_save(
-    const uint8_t* buffer,
-    size_t buffer_len,
-    pksav_gba_game_t gba_game,
-    bool* result_out
+// Returns whichever slot in raw has the higher save counter.
+static const pksav_gba_save_slot_t* _pksav_gba_save_newest_slot(
+    const uint8_t* raw,
+    bool small_save
 ) {
-    if(!buffer || !result_out) {
-        return PKSAV_ERROR_NULL_POINTER;
-    }
-
-    if(buffer_len < PKSAV_GBA_SMALL_SAVE_SIZE) {
-        *result_out = false;
-        return PKSAV_ERROR_NONE;
-    }
-
-    /*
-     * If the save is not a small save, we need to find the most recent save slot first.
-     *
-     * Once the proper save slot has been found, it needs to be unshuffled. Sadly, that
-     * means more memory allocation.
-     */
-    const pksav_gba_save_slot_t* sections_pair = (const pksav_gba_save_slot_t*)buffer;
-    const pksav_gba_save_slot_t* save_slot;
-    if(buffer_len < PKSAV_GBA_SAVE_SIZE) {
-        save_slot = sections_pair;
-    } else if(SAVE_INDEX(&sections_pair[0]) > SAVE_INDEX(&sections_pair[1])) {
-        save_slot = &sections_pair[0];
+    const pksav_gba_save_slot_t* sections_pair = (const pksav_gba_save_slot_t*)raw;
+    if(small_save || (SAVE_INDEX(&sections_pair[0]) > SAVE_INDEX(&sections_pair[1]))) {
+        return &sections_pair[0];
     } else {
-        save_slot = &sections_pair[1];
+        return &sections_pair[1];
     }
+}
 
+static bool _pksav_gba_save_slot_is_game(
+    const pksav_gba_save_slot_t* save_slot,
+    pksav_gba_game_t gba_game
+) {
     // Make sure the section IDs are valid to avoid a crash.
     for(size_t section_index = 0; section_index < 14; ++section_index)
     {
         if(save_slot->sections_arr[section_index].footer.section_id > 13)
         {
-            *result_out = false;
-            return PKSAV_ERROR_NONE;
+            return false;
         }
     }
 
+    /*
+     * Once the proper save slot has been found, it needs to be unshuffled. Sadly, that
+     * means more memory allocation.
+     */
     pksav_gba_save_slot_t unshuffled;
     uint8_t section_nums[14];
     pksav_gba_save_unshuffle_sections(
@@ -178,12 +179,34 @@ pksav_error_t pksav_buffer_is_gba_save(
     uint32_t security_key2 = pksav_littleendian32(SECURITY_KEY2((&unshuffled), gba_game));
 
     if(gba_game == PKSAV_GBA_RS) {
-        *result_out = (game_code == 0) && (security_key1 == security_key2);
+        return (game_code == 0) && (security_key1 == security_key2);
     } else if(gba_game == PKSAV_GBA_FRLG) {
-        *result_out = (game_code == 1) && (security_key1 == security_key2);
+        return (game_code == 1) && (security_key1 == security_key2);
     } else {
-        *result_out = (security_key1 == security_key2);
+        return (security_key1 == security_key2);
     }
+}
+
+pksav_error_t pksav_buffer_is_gba_save(
+    const uint8_t* buffer,
+    size_t buffer_len,
+    pksav_gba_game_t gba_game,
+    bool* result_out
+) {
+    if(!buffer || !result_out) {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+
+    if(buffer_len < PKSAV_GBA_SMALL_SAVE_SIZE) {
+        *result_out = false;
+        return PKSAV_ERROR_NONE;
+    }
+
+    // If the save is not a small save, we need to find the most recent save slot first.
+    *result_out = _pksav_gba_save_slot_is_game(
+                      _pksav_gba_save_newest_slot(buffer, (buffer_len < PKSAV_GBA_SAVE_SIZE)),
+                      gba_game
+                  );
 
     return PKSAV_ERROR_NONE;
 }
@@ -211,7 +234,7 @@ pksav_error_t pksav_file_is_gba_save(
         return false;
     }
 
-    uint8_t* gba_save_data = calloc(filesize, 1);
+    uint8_t* gba_save_data = _pksav_calloc(filesize, 1);
     fseek(gba_save, 0, SEEK_SET);
     size_t num_read = fread((void*)gba_save_data, 1, filesize, gba_save);
     fclose(gba_save);
@@ -226,38 +249,159 @@ pksav_error_t pksav_file_is_gba_save(
         );
     }
 
-    free(gba_save_data);
+    _pksav_free(gba_save_data);
     *result_out = ret;
     return PKSAV_ERROR_NONE;
 }
 
-// Assumes all dynamically allocated memory has already been allocated
-static void _pksav_gba_save_set_pointers(
-    pksav_gba_save_t* gba_save
+// Finds the most recent save slot in raw, noting which one it was.
+static const pksav_gba_save_slot_t* _pksav_gba_save_most_recent_slot(
+    pksav_gba_save_t* gba_save,
+    const uint8_t* raw
 ) {
-    // Find the most recent save slot
-    const pksav_gba_save_slot_t* sections_pair = (const pksav_gba_save_slot_t*)gba_save->raw;
-    const pksav_gba_save_slot_t* most_recent;
+    PKSAV_PHASE_BEGIN(slot_select_start);
+    const pksav_gba_save_slot_t* most_recent = _pksav_gba_save_newest_slot(
+                                                   raw,
+                                                   gba_save->small_save
+                                               );
+    gba_save->from_first_slot = (most_recent == (const pksav_gba_save_slot_t*)raw);
+    PKSAV_PHASE_END(
+        PKSAV_PHASE_SLOT_SELECT,
+        slot_select_start,
+        (gba_save->small_save ? 1 : 2) * sizeof(pksav_gba_section_footer_t)
+    );
 
-    if(gba_save->small_save) {
-        most_recent = sections_pair;
-        gba_save->from_first_slot = true;
-    } else {
-        if(SAVE_INDEX(&sections_pair[0]) > SAVE_INDEX(&sections_pair[1])) {
-            most_recent = &sections_pair[0];
-            gba_save->from_first_slot = true;
-        } else {
-            most_recent = &sections_pair[1];
-            gba_save->from_first_slot = false;
+    return most_recent;
+}
+
+/*
+ * Checks every section of a slot against its footer. Each mask has a bit per
+ * section ID, so a section with an ID out of range, or one another section
+ * also has, doesn't count as any section.
+ */
+static void _pksav_gba_save_verify_slot(
+    const pksav_gba_save_slot_t* save_slot,
+    pksav_gba_slot_health_t* health_out
+) {
+    memset(health_out, 0, sizeof(*health_out));
+    health_out->save_index = SAVE_INDEX(save_slot);
+
+    uint16_t duplicated = 0;
+    for(uint8_t i = 0; i < 14; ++i) {
+        const pksav_gba_save_section_t* section = &save_slot->sections_arr[i];
+        uint8_t section_id = section->footer.section_id;
+        if(section_id > 13) {
+            continue;
+        }
+
+        uint16_t section_mask = (uint16_t)(1 << section_id);
+        if(health_out->sections_present & section_mask) {
+            duplicated |= section_mask;
+        }
+        health_out->sections_present |= section_mask;
+
+        if(section->footer.checksum == pksav_get_gba_section_checksum(section, section_id)) {
+            health_out->checksums_valid |= section_mask;
+        }
+        if(pksav_littleendian32(section->footer.validation) == PKSAV_GBA_VALIDATION) {
+            health_out->validations_valid |= section_mask;
         }
+        if(pksav_littleendian32(section->footer.save_index) == health_out->save_index) {
+            health_out->save_indices_match |= section_mask;
+        }
+    }
+
+    health_out->sections_present &= (uint16_t)~duplicated;
+    health_out->checksums_valid &= health_out->sections_present;
+    health_out->validations_valid &= health_out->sections_present;
+    health_out->save_indices_match &= health_out->sections_present;
+
+    health_out->valid = (health_out->sections_present == PKSAV_GBA_ALL_SECTIONS) &&
+                        (health_out->checksums_valid == PKSAV_GBA_ALL_SECTIONS) &&
+                        (health_out->validations_valid == PKSAV_GBA_ALL_SECTIONS) &&
+                        (health_out->save_indices_match == PKSAV_GBA_ALL_SECTIONS);
+}
+
+/*
+ * Verifies each slot in raw and picks the one to load, which is the most
+ * recent valid one. Slots are picked between as in
+ * _pksav_gba_save_newest_slot when both are valid.
+ */
+static void _pksav_gba_save_verify(
+    const uint8_t* raw,
+    bool small_save,
+    pksav_gba_save_health_t* health_out
+) {
+    const pksav_gba_save_slot_t* sections_pair = (const pksav_gba_save_slot_t*)raw;
+
+    memset(health_out, 0, sizeof(*health_out));
+    health_out->num_slots = small_save ? 1 : 2;
+    for(size_t i = 0; i < health_out->num_slots; ++i) {
+        _pksav_gba_save_verify_slot(
+            &sections_pair[i],
+            &health_out->slots[i]
+        );
+    }
+
+    size_t newest_slot = (_pksav_gba_save_newest_slot(raw, small_save) == sections_pair) ? 0 : 1;
+    if(health_out->slots[newest_slot].valid) {
+        health_out->has_valid_slot = true;
+        health_out->load_slot = newest_slot;
+    } else if(!small_save && health_out->slots[1 - newest_slot].valid) {
+        health_out->has_valid_slot = true;
+        health_out->load_slot = 1 - newest_slot;
+        health_out->is_fallback = true;
+    }
+}
+
+/*
+ * Finds the most recent valid save slot in raw, noting which one it was.
+ * Returns NULL if neither slot is valid.
+ */
+static const pksav_gba_save_slot_t* _pksav_gba_save_most_recent_valid_slot(
+    pksav_gba_save_t* gba_save,
+    const uint8_t* raw,
+    pksav_gba_save_health_t* health_out
+) {
+    PKSAV_PHASE_BEGIN(slot_select_start);
+    _pksav_gba_save_verify(
+        raw,
+        gba_save->small_save,
+        health_out
+    );
+    PKSAV_PHASE_END(
+        PKSAV_PHASE_SLOT_SELECT,
+        slot_select_start,
+        health_out->num_slots * sizeof(pksav_gba_save_slot_t)
+    );
+
+    if(!health_out->has_valid_slot) {
+        return NULL;
     }
 
-    // Set pointers
+    gba_save->from_first_slot = (health_out->load_slot == 0);
+
+    return &((const pksav_gba_save_slot_t*)raw)[health_out->load_slot];
+}
+
+static void _pksav_gba_save_unshuffle(
+    pksav_gba_save_t* gba_save,
+    const pksav_gba_save_slot_t* save_slot,
+    pksav_gba_save_slot_t* unshuffled_out
+) {
+    PKSAV_PHASE_BEGIN(unshuffle_start);
     pksav_gba_save_unshuffle_sections(
-        most_recent,
-        gba_save->unshuffled,
+        save_slot,
+        unshuffled_out,
         gba_save->shuffled_section_nums
     );
+    PKSAV_PHASE_END(PKSAV_PHASE_UNSHUFFLE, unshuffle_start, sizeof(pksav_gba_save_slot_t));
+}
+
+// Points everything into gba_save->unshuffled, which is all that clones need.
+static void _pksav_gba_save_set_section_pointers(
+    pksav_gba_save_t* gba_save
+) {
     gba_save->trainer_info = &gba_save->unshuffled->trainer_info;
     if(gba_save->gba_game == PKSAV_GBA_FRLG) {
         gba_save->rival_name = &SECTION4_DATA8(
@@ -273,42 +417,22 @@ static void _pksav_gba_save_set_pointers(
                                                               gba_save->gba_game,
                                                               PKSAV_GBA_POKEMON_PARTY
                                                           );
-    for(uint8_t i = 0; i < 6; ++i) {
-        pksav_gba_crypt_pokemon(
-            &gba_save->pokemon_party->party[i].pc,
-            false
-        );
-    }
-
-    pksav_gba_save_load_pokemon_pc(
-        gba_save->unshuffled,
-        gba_save->pokemon_pc
-    );
 
     gba_save->item_storage = (pksav_gba_item_storage_t*)&SECTION1_DATA8(
                                                             gba_save->unshuffled,
                                                             gba_save->gba_game,
                                                             PKSAV_GBA_ITEM_STORAGE
                                                         );
-    pksav_gba_save_crypt_items(
-        gba_save->item_storage,
-        SECURITY_KEY1(gba_save->unshuffled, gba_save->gba_game),
-        gba_save->gba_game
-    );
-
     gba_save->money = &SECTION1_DATA32(
                           gba_save->unshuffled,
                           gba_save->gba_game,
                           PKSAV_GBA_MONEY
                       );
-    *gba_save->money ^= SECURITY_KEY1(gba_save->unshuffled, gba_save->gba_game);
-
     gba_save->casino_coins = &SECTION1_DATA16(
                                  gba_save->unshuffled,
                                  gba_save->gba_game,
                                  PKSAV_GBA_CASINO_COINS
                              );
-    *gba_save->casino_coins ^= (uint16_t)(SECURITY_KEY1(gba_save->unshuffled, gba_save->gba_game) & 0xFFFF);
 
     gba_save->pokedex_owned = &SECTION0_DATA8(
                                   gba_save->unshuffled,
@@ -364,15 +488,197 @@ static void _pksav_gba_save_set_pointers(
                                       );
 }
 
-pksav_error_t pksav_gba_save_load(
-    const char* filepath,
-    pksav_gba_save_t* gba_save
+/*
+ * Decrypts everything in gba_save->unshuffled and sets the pointers into it.
+ * The PC is loaded from full_slot, since compact saves don't keep the PC
+ * sections in gba_save->unshuffled.
+ */
+static void _pksav_gba_save_decrypt(
+    pksav_gba_save_t* gba_save,
+    const pksav_gba_save_slot_t* full_slot
 ) {
-    if(!filepath || !gba_save) {
-        return PKSAV_ERROR_NULL_POINTER;
+    _pksav_gba_save_set_section_pointers(
+        gba_save
+    );
+
+    PKSAV_PHASE_BEGIN(pokemon_crypt_start);
+    for(uint8_t i = 0; i < 6; ++i) {
+        pksav_gba_crypt_pokemon(
+            &gba_save->pokemon_party->party[i].pc,
+            false
+        );
     }
 
-    // Read the file and make sure it's valid
+    pksav_gba_save_load_pokemon_pc(
+        full_slot,
+        gba_save->pokemon_pc
+    );
+    PKSAV_PHASE_END(
+        PKSAV_PHASE_POKEMON_CRYPT,
+        pokemon_crypt_start,
+        sizeof(pksav_gba_pokemon_party_t) + sizeof(pksav_gba_pokemon_pc_t)
+    );
+
+    PKSAV_PHASE_BEGIN(item_crypt_start);
+    pksav_gba_save_crypt_items(
+        gba_save->item_storage,
+        SECURITY_KEY1(gba_save->unshuffled, gba_save->gba_game),
+        gba_save->gba_game
+    );
+    *gba_save->money ^= SECURITY_KEY1(gba_save->unshuffled, gba_save->gba_game);
+    *gba_save->casino_coins ^= (uint16_t)(SECURITY_KEY1(gba_save->unshuffled, gba_save->gba_game) & 0xFFFF);
+    PKSAV_PHASE_END(
+        PKSAV_PHASE_ITEM_CRYPT,
+        item_crypt_start,
+        sizeof(pksav_gba_item_storage_t) + sizeof(uint32_t) + sizeof(uint16_t)
+    );
+
+    gba_save->pokedex_mirrors_matched = _pksav_gba_save_pokedex_mirrors_match(gba_save);
+}
+
+// Assumes all dynamically allocated memory has already been allocated
+static void _pksav_gba_save_set_pointers(
+    pksav_gba_save_t* gba_save,
+    const pksav_gba_save_slot_t* save_slot
+) {
+    _pksav_gba_save_unshuffle(
+        gba_save,
+        save_slot,
+        gba_save->unshuffled
+    );
+    _pksav_gba_save_decrypt(
+        gba_save,
+        gba_save->unshuffled
+    );
+}
+
+// Works out which game the given slot is from.
+static bool _pksav_gba_save_detect(
+    pksav_gba_save_t* gba_save,
+    const pksav_gba_save_slot_t* save_slot
+) {
+    PKSAV_PHASE_BEGIN(detect_start);
+    bool found = false;
+    size_t num_games_checked = 0;
+    for(pksav_gba_game_t i = PKSAV_GBA_RS; i <= PKSAV_GBA_FRLG; ++i) {
+        ++num_games_checked;
+        found = _pksav_gba_save_slot_is_game(
+                    save_slot,
+                    i
+                );
+        if(found) {
+            gba_save->gba_game = i;
+            break;
+        }
+    }
+    PKSAV_PHASE_END(
+        PKSAV_PHASE_DETECT,
+        detect_start,
+        num_games_checked * sizeof(pksav_gba_save_slot_t)
+    );
+
+    return found;
+}
+
+/*
+ * Validates the save in gba_save->raw and sets its pointers, freeing it on failure.
+ * Strict loads only load a slot that passes verification, and report each
+ * slot's health in health_out.
+ */
+static pksav_error_t _pksav_gba_save_load_raw(
+    pksav_gba_save_t* gba_save,
+    size_t filesize,
+    pksav_gba_save_health_t* health_out
+) {
+    gba_save->small_save = (filesize < PKSAV_GBA_SAVE_SIZE);
+    gba_save->compact = false;
+
+    // Detect what kind of save this is
+    const pksav_gba_save_slot_t* save_slot = NULL;
+    if(health_out) {
+        save_slot = _pksav_gba_save_most_recent_valid_slot(
+                        gba_save,
+                        gba_save->raw,
+                        health_out
+                    );
+        if(save_slot && !_pksav_gba_save_detect(gba_save, save_slot)) {
+            save_slot = NULL;
+        }
+    } else if(_pksav_gba_save_detect(gba_save, _pksav_gba_save_newest_slot(gba_save->raw, gba_save->small_save))) {
+        save_slot = _pksav_gba_save_most_recent_slot(
+                        gba_save,
+                        gba_save->raw
+                    );
+    }
+    if(!save_slot) {
+        _pksav_free(gba_save->raw);
+        return PKSAV_ERROR_INVALID_SAVE;
+    }
+
+    // Allocate memory as needed and set pointers
+    gba_save->raw_refs = _pksav_calloc(sizeof(uint32_t), 1);
+    *gba_save->raw_refs = 1;
+    gba_save->unshuffled = _pksav_calloc(sizeof(pksav_gba_save_slot_t), 1);
+    gba_save->pokemon_pc = _pksav_calloc(sizeof(pksav_gba_pokemon_pc_t), 1);
+    gba_save->dirty_sections = 0;
+    _pksav_gba_save_set_pointers(
+        gba_save,
+        save_slot
+    );
+
+    return PKSAV_ERROR_NONE;
+}
+
+/*
+ * Validates the save in raw and sets its pointers, keeping only the sections
+ * before the PC. The PC sections are only ever held in gba_save->pokemon_pc,
+ * and raw isn't kept at all.
+ */
+static pksav_error_t _pksav_gba_save_load_compact(
+    pksav_gba_save_t* gba_save,
+    const uint8_t* raw,
+    size_t filesize
+) {
+    gba_save->small_save = (filesize < PKSAV_GBA_SAVE_SIZE);
+    gba_save->compact = true;
+    gba_save->raw = NULL;
+    gba_save->raw_refs = NULL;
+
+    if(!_pksav_gba_save_detect(gba_save, _pksav_gba_save_newest_slot(raw, gba_save->small_save))) {
+        return PKSAV_ERROR_INVALID_SAVE;
+    }
+
+    pksav_gba_save_slot_t* full_slot = _pksav_calloc(sizeof(pksav_gba_save_slot_t), 1);
+    _pksav_gba_save_unshuffle(
+        gba_save,
+        _pksav_gba_save_most_recent_slot(gba_save, raw),
+        full_slot
+    );
+
+    gba_save->unshuffled = _pksav_calloc(PKSAV_GBA_COMPACT_NUM_SECTIONS, sizeof(pksav_gba_save_section_t));
+    memcpy(
+        gba_save->unshuffled,
+        full_slot,
+        (PKSAV_GBA_COMPACT_NUM_SECTIONS * sizeof(pksav_gba_save_section_t))
+    );
+    gba_save->pokemon_pc = _pksav_calloc(sizeof(pksav_gba_pokemon_pc_t), 1);
+    gba_save->dirty_sections = 0;
+    _pksav_gba_save_decrypt(
+        gba_save,
+        full_slot
+    );
+
+    _pksav_free(full_slot);
+
+    return PKSAV_ERROR_NONE;
+}
+
+// Reads the whole file into a newly allocated buffer.
+static pksav_error_t _pksav_gba_save_read_file(
+    const char* filepath,
+    uint8_t** raw_out,
+    size_t* filesize_out
+) {
     FILE* gba_save_file = fopen(filepath, "rb");
     if(!gba_save_file) {
         return PKSAV_ERROR_FILE_IO;
@@ -386,60 +692,204 @@ pksav_error_t pksav_gba_save_load(
         return PKSAV_ERROR_INVALID_SAVE;
     }
 
-    gba_save->raw = calloc(filesize, 1);
+    PKSAV_PHASE_BEGIN(read_start);
+    uint8_t* raw = _pksav_calloc(filesize, 1);
     fseek(gba_save_file, 0, SEEK_SET);
-    size_t num_read = fread((void*)gba_save->raw, 1, filesize, gba_save_file);
+    size_t num_read = fread((void*)raw, 1, filesize, gba_save_file);
     fclose(gba_save_file);
+    PKSAV_PHASE_END(PKSAV_PHASE_READ, read_start, num_read);
     if(num_read != filesize) {
+        _pksav_free(raw);
         return PKSAV_ERROR_FILE_IO;
     }
 
-    gba_save->small_save = (filesize < PKSAV_GBA_SAVE_SIZE);
+    *raw_out = raw;
+    *filesize_out = filesize;
 
-    // Detect what kind of save this is
-    bool found = false;
-    for(pksav_gba_game_t i = PKSAV_GBA_RS; i <= PKSAV_GBA_FRLG; ++i) {
-        pksav_buffer_is_gba_save(
-            gba_save->raw,
-            filesize,
-            i,
-            &found
-        );
-        if(found) {
-            gba_save->gba_game = i;
-            break;
-        }
+    return PKSAV_ERROR_NONE;
+}
+
+pksav_error_t pksav_gba_save_load(
+    const char* filepath,
+    pksav_gba_save_t* gba_save
+) {
+    if(!filepath || !gba_save) {
+        return PKSAV_ERROR_NULL_POINTER;
     }
 
-    if(!found) {
-        free(gba_save->raw);
+    // Read the file and make sure it's valid
+    size_t filesize = 0;
+    pksav_error_t error = _pksav_gba_save_read_file(
+                              filepath,
+                              &gba_save->raw,
+                              &filesize
+                          );
+    if(error) {
+        return error;
+    }
+
+    return _pksav_gba_save_load_raw(
+               gba_save,
+               filesize,
+               NULL
+           );
+}
+
+pksav_error_t pksav_gba_save_load_buffer(
+    const uint8_t* buffer,
+    size_t buffer_len,
+    pksav_gba_save_t* gba_save
+) {
+    if(!buffer || !gba_save) {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+    if(buffer_len < PKSAV_GBA_SMALL_SAVE_SIZE) {
         return PKSAV_ERROR_INVALID_SAVE;
     }
 
-    // Allocate memory as needed and set pointers
-    gba_save->unshuffled = calloc(sizeof(pksav_gba_save_slot_t), 1);
-    gba_save->pokemon_pc = calloc(sizeof(pksav_gba_pokemon_pc_t), 1);
-    _pksav_gba_save_set_pointers(
-        gba_save
+    PKSAV_PHASE_BEGIN(read_start);
+    gba_save->raw = _pksav_calloc(buffer_len, 1);
+    memcpy(gba_save->raw, buffer, buffer_len);
+    PKSAV_PHASE_END(PKSAV_PHASE_READ, read_start, buffer_len);
+
+    return _pksav_gba_save_load_raw(
+               gba_save,
+               buffer_len,
+               NULL
+           );
+}
+
+pksav_error_t pksav_gba_save_load_compact(
+    const char* filepath,
+    pksav_gba_save_t* gba_save
+) {
+    if(!filepath || !gba_save) {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+
+    uint8_t* raw = NULL;
+    size_t filesize = 0;
+    pksav_error_t error = _pksav_gba_save_read_file(
+                              filepath,
+                              &raw,
+                              &filesize
+                          );
+    if(!error) {
+        error = _pksav_gba_save_load_compact(
+                    gba_save,
+                    raw,
+                    filesize
+                );
+        _pksav_free(raw);
+    }
+
+    return error;
+}
+
+pksav_error_t pksav_gba_save_load_buffer_compact(
+    const uint8_t* buffer,
+    size_t buffer_len,
+    pksav_gba_save_t* gba_save
+) {
+    if(!buffer || !gba_save) {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+    if(buffer_len < PKSAV_GBA_SMALL_SAVE_SIZE) {
+        return PKSAV_ERROR_INVALID_SAVE;
+    }
+
+    // Nothing is copied up front, since only the active slot is kept.
+    return _pksav_gba_save_load_compact(
+               gba_save,
+               buffer,
+               buffer_len
+           );
+}
+
+pksav_error_t pksav_gba_save_verify_buffer(
+    const uint8_t* buffer,
+    size_t buffer_len,
+    pksav_gba_save_health_t* health_out
+) {
+    if(!buffer || !health_out) {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+    if(buffer_len < PKSAV_GBA_SMALL_SAVE_SIZE) {
+        return PKSAV_ERROR_INVALID_SAVE;
+    }
+
+    _pksav_gba_save_verify(
+        buffer,
+        (buffer_len < PKSAV_GBA_SAVE_SIZE),
+        health_out
     );
 
     return PKSAV_ERROR_NONE;
 }
 
-pksav_error_t pksav_gba_save_save(
+pksav_error_t pksav_gba_save_load_strict(
     const char* filepath,
-    pksav_gba_save_t* gba_save
+    pksav_gba_save_t* gba_save,
+    pksav_gba_save_health_t* health_out
 ) {
     if(!filepath || !gba_save) {
         return PKSAV_ERROR_NULL_POINTER;
     }
 
-    // Make sure we can write to this file
-    FILE* gba_save_file = fopen(filepath, "wb");
-    if(!gba_save_file) {
-        return PKSAV_ERROR_FILE_IO;
+    size_t filesize = 0;
+    pksav_error_t error = _pksav_gba_save_read_file(
+                              filepath,
+                              &gba_save->raw,
+                              &filesize
+                          );
+    if(error) {
+        return error;
     }
 
+    pksav_gba_save_health_t health;
+    return _pksav_gba_save_load_raw(
+               gba_save,
+               filesize,
+               health_out ? health_out : &health
+           );
+}
+
+pksav_error_t pksav_gba_save_load_buffer_strict(
+    const uint8_t* buffer,
+    size_t buffer_len,
+    pksav_gba_save_t* gba_save,
+    pksav_gba_save_health_t* health_out
+) {
+    if(!buffer || !gba_save) {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+    if(buffer_len < PKSAV_GBA_SMALL_SAVE_SIZE) {
+        return PKSAV_ERROR_INVALID_SAVE;
+    }
+
+    PKSAV_PHASE_BEGIN(read_start);
+    gba_save->raw = _pksav_calloc(buffer_len, 1);
+    memcpy(gba_save->raw, buffer, buffer_len);
+    PKSAV_PHASE_END(PKSAV_PHASE_READ, read_start, buffer_len);
+
+    pksav_gba_save_health_t health;
+    return _pksav_gba_save_load_raw(
+               gba_save,
+               buffer_len,
+               health_out ? health_out : &health
+           );
+}
+
+/*
+ * Re-encrypts everything in gba_save->unshuffled, setting each Pokémon's
+ * checksum first, and puts the PC back into full_slot. This is only ever
+ * done to a copy of the loaded save.
+ */
+static void _pksav_gba_save_encrypt(
+    pksav_gba_save_t* gba_save,
+    pksav_gba_save_slot_t* full_slot
+) {
+    PKSAV_PHASE_BEGIN(item_crypt_start);
     *gba_save->money ^= SECURITY_KEY1(gba_save->unshuffled, gba_save->gba_game);
     *gba_save->casino_coins ^= (uint16_t)(SECURITY_KEY1(gba_save->unshuffled, gba_save->gba_game) & 0xFFFF);
 
@@ -448,57 +898,357 @@ pksav_error_t pksav_gba_save_save(
         SECURITY_KEY1(gba_save->unshuffled, gba_save->gba_game),
         gba_save->gba_game
     );
+    PKSAV_PHASE_END(
+        PKSAV_PHASE_ITEM_CRYPT,
+        item_crypt_start,
+        sizeof(pksav_gba_item_storage_t) + sizeof(uint32_t) + sizeof(uint16_t)
+    );
 
+    PKSAV_PHASE_BEGIN(pokemon_crypt_start);
     pksav_gba_save_save_pokemon_pc(
         gba_save->pokemon_pc,
-        gba_save->unshuffled
+        full_slot
     );
 
     for(uint8_t i = 0; i < 6; ++i) {
+        pksav_set_gba_pokemon_checksum(
+            &gba_save->pokemon_party->party[i].pc
+        );
         pksav_gba_crypt_pokemon(
             &gba_save->pokemon_party->party[i].pc,
             true
         );
     }
+    PKSAV_PHASE_END(
+        PKSAV_PHASE_POKEMON_CRYPT,
+        pokemon_crypt_start,
+        sizeof(pksav_gba_pokemon_party_t) + sizeof(pksav_gba_pokemon_pc_t)
+    );
+}
 
-    // Find the least recent save slot, increment the save index, save into that
-    uint32_t save_index = pksav_littleendian32(SAVE_INDEX(gba_save->unshuffled) + 1);
-    for(uint8_t i = 0; i < 14; ++i) {
-        gba_save->unshuffled->sections_arr[i].footer.save_index = save_index;
-    }
-
+// Returns the slot in raw to save into, which is the one not loaded from.
+static pksav_gba_save_slot_t* _pksav_gba_save_next_slot(
+    pksav_gba_save_t* gba_save,
+    uint8_t* raw
+) {
     pksav_gba_save_slot_t* save_into = NULL;
     if(!gba_save->small_save) {
-        pksav_gba_save_slot_t* sections_pair = (pksav_gba_save_slot_t*)gba_save->raw;
+        pksav_gba_save_slot_t* sections_pair = (pksav_gba_save_slot_t*)raw;
         save_into = gba_save->from_first_slot ? &sections_pair[1] : &sections_pair[0];
         gba_save->from_first_slot = !gba_save->from_first_slot;
     } else {
-        save_into = (pksav_gba_save_slot_t*)gba_save->raw;
+        save_into = (pksav_gba_save_slot_t*)raw;
     }
 
+    return save_into;
+}
+
+static void _pksav_gba_save_checksum_and_shuffle(
+    pksav_gba_save_t* gba_save,
+    pksav_gba_save_slot_t* full_slot,
+    pksav_gba_save_slot_t* save_into
+) {
+    PKSAV_PHASE_BEGIN(checksum_start);
     pksav_set_gba_section_checksums(
-        gba_save->unshuffled
+        full_slot
     );
+    PKSAV_PHASE_END(PKSAV_PHASE_CHECKSUM, checksum_start, sizeof(pksav_gba_save_slot_t));
+
+    PKSAV_PHASE_BEGIN(shuffle_start);
     pksav_gba_save_shuffle_sections(
-        gba_save->unshuffled,
+        full_slot,
         save_into,
         gba_save->shuffled_section_nums
     );
+    PKSAV_PHASE_END(PKSAV_PHASE_SHUFFLE, shuffle_start, sizeof(pksav_gba_save_slot_t));
+}
 
-    // With everything saved to the new slot, reload it
-    _pksav_gba_save_set_pointers(
-        gba_save
+// Drops this save's reference to raw, freeing it if no clones still share it.
+static void _pksav_gba_save_release_raw(
+    pksav_gba_save_t* gba_save
+) {
+    if(!gba_save->raw_refs) {
+        _pksav_free(gba_save->raw);
+    } else if(_pksav_atomic_decrement(gba_save->raw_refs) == 0) {
+        _pksav_free((void*)gba_save->raw_refs);
+        _pksav_free(gba_save->raw);
+    }
+
+    gba_save->raw = NULL;
+    gba_save->raw_refs = NULL;
+}
+
+// Gives this save its own copy of raw if any clones share it, since saving writes into it.
+static void _pksav_gba_save_unshare_raw(
+    pksav_gba_save_t* gba_save
+) {
+    if(!gba_save->raw_refs || (*gba_save->raw_refs == 1)) {
+        return;
+    }
+
+    size_t save_size = gba_save->small_save ? PKSAV_GBA_SMALL_SAVE_SIZE : PKSAV_GBA_SAVE_SIZE;
+    uint8_t* raw = _pksav_calloc(save_size, 1);
+    memcpy(raw, gba_save->raw, save_size);
+
+    _pksav_gba_save_release_raw(gba_save);
+    gba_save->raw = raw;
+    gba_save->raw_refs = _pksav_calloc(sizeof(uint32_t), 1);
+    *gba_save->raw_refs = 1;
+}
+
+static size_t _pksav_gba_save_unshuffled_size(
+    const pksav_gba_save_t* gba_save
+) {
+    return gba_save->compact ? (PKSAV_GBA_COMPACT_NUM_SECTIONS * sizeof(pksav_gba_save_section_t))
+                             : sizeof(pksav_gba_save_slot_t);
+}
+
+/*
+ * Writes the save into the opposite slot of raw, which must already hold the
+ * save. Everything is encrypted and checksummed in a copy, so nothing the
+ * caller can see changes, and the loaded data doesn't need to be reloaded.
+ * Compact saves don't have the PC sections, so their footers are recreated
+ * from section 0's.
+ */
+static void _pksav_gba_save_write_slot(
+    pksav_gba_save_t* gba_save,
+    uint8_t* raw
+) {
+    size_t unshuffled_size = _pksav_gba_save_unshuffled_size(gba_save);
+    size_t num_sections = unshuffled_size / sizeof(pksav_gba_save_section_t);
+
+    pksav_gba_save_t output = *gba_save;
+    output.unshuffled = _pksav_calloc(sizeof(pksav_gba_save_slot_t), 1);
+    output.pokemon_pc = _pksav_calloc(sizeof(pksav_gba_pokemon_pc_t), 1);
+    memcpy(output.unshuffled, gba_save->unshuffled, unshuffled_size);
+    memcpy(output.pokemon_pc, gba_save->pokemon_pc, sizeof(pksav_gba_pokemon_pc_t));
+    for(size_t i = num_sections; i < 14; ++i) {
+        output.unshuffled->sections_arr[i].footer = gba_save->unshuffled->section0.footer;
+        output.unshuffled->sections_arr[i].footer.section_id = (uint8_t)i;
+    }
+    _pksav_gba_save_set_section_pointers(
+        &output
     );
 
-    // Write to file
-    fwrite(
-        (void*)gba_save->raw,
-        1,
-        (gba_save->small_save ? PKSAV_GBA_SMALL_SAVE_SIZE : PKSAV_GBA_SAVE_SIZE),
-        gba_save_file
+    _pksav_gba_save_encrypt(
+        &output,
+        output.unshuffled
+    );
+
+    // Find the least recent save slot, increment the save index, save into that
+    uint32_t save_index = pksav_littleendian32(SAVE_INDEX(gba_save->unshuffled) + 1);
+    for(uint8_t i = 0; i < 14; ++i) {
+        output.unshuffled->sections_arr[i].footer.save_index = save_index;
+    }
+
+    _pksav_gba_save_checksum_and_shuffle(
+        &output,
+        output.unshuffled,
+        _pksav_gba_save_next_slot(gba_save, raw)
+    );
+
+    // Only the footers are kept, for the next save.
+    for(size_t i = 0; i < num_sections; ++i) {
+        gba_save->unshuffled->sections_arr[i].footer.save_index = save_index;
+    }
+    gba_save->dirty_sections = 0;
+
+    _pksav_free(output.pokemon_pc);
+    _pksav_free(output.unshuffled);
+}
+
+pksav_error_t pksav_gba_save_save(
+    const char* filepath,
+    pksav_gba_save_t* gba_save
+) {
+    if(!filepath || !gba_save) {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+
+    size_t save_size = gba_save->small_save ? PKSAV_GBA_SMALL_SAVE_SIZE : PKSAV_GBA_SAVE_SIZE;
+    uint8_t* raw = gba_save->raw;
+
+    // A compact save only has its active slot, so the rest comes from the file.
+    if(gba_save->compact) {
+        size_t filesize = 0;
+        pksav_error_t error = _pksav_gba_save_read_file(
+                                  filepath,
+                                  &raw,
+                                  &filesize
+                              );
+        if(error) {
+            return error;
+        }
+        bool is_same_game = false;
+        if(filesize >= save_size) {
+            pksav_buffer_is_gba_save(
+                raw,
+                save_size,
+                gba_save->gba_game,
+                &is_same_game
+            );
+        }
+        if(!is_same_game) {
+            _pksav_free(raw);
+            return PKSAV_ERROR_INVALID_SAVE;
+        }
+    }
+
+    // Make sure we can write to this file
+    FILE* gba_save_file = fopen(filepath, "wb");
+    if(!gba_save_file) {
+        if(gba_save->compact) {
+            _pksav_free(raw);
+        }
+        return PKSAV_ERROR_FILE_IO;
+    }
+
+    if(!gba_save->compact) {
+        _pksav_gba_save_unshare_raw(
+            gba_save
+        );
+        raw = gba_save->raw;
+    }
+    _pksav_gba_save_write_slot(
+        gba_save,
+        raw
     );
 
+    // Write to file
+    PKSAV_PHASE_BEGIN(write_start);
+    size_t num_written = fwrite(
+                             (void*)raw,
+                             1,
+                             save_size,
+                             gba_save_file
+                         );
+
     fclose(gba_save_file);
+    PKSAV_PHASE_END(PKSAV_PHASE_WRITE, write_start, num_written);
+
+    if(gba_save->compact) {
+        _pksav_free(raw);
+    }
+
+    return PKSAV_ERROR_NONE;
+}
+
+pksav_error_t pksav_gba_save_save_buffer(
+    uint8_t* buffer,
+    size_t buffer_len,
+    pksav_gba_save_t* gba_save
+) {
+    if(!buffer || !gba_save) {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+
+    size_t save_size = gba_save->small_save ? PKSAV_GBA_SMALL_SAVE_SIZE : PKSAV_GBA_SAVE_SIZE;
+    if(buffer_len < save_size) {
+        return PKSAV_ERROR_PARAM_OUT_OF_RANGE;
+    }
+
+    // A compact save is written over the copy of the save already in the buffer.
+    if(gba_save->compact) {
+        bool is_same_game = false;
+        pksav_buffer_is_gba_save(
+            buffer,
+            save_size,
+            gba_save->gba_game,
+            &is_same_game
+        );
+        if(!is_same_game) {
+            return PKSAV_ERROR_INVALID_SAVE;
+        }
+
+        _pksav_gba_save_write_slot(
+            gba_save,
+            buffer
+        );
+
+        return PKSAV_ERROR_NONE;
+    }
+
+    _pksav_gba_save_unshare_raw(
+        gba_save
+    );
+    _pksav_gba_save_write_slot(
+        gba_save,
+        gba_save->raw
+    );
+    PKSAV_PHASE_BEGIN(write_start);
+    memcpy(buffer, gba_save->raw, save_size);
+    PKSAV_PHASE_END(PKSAV_PHASE_WRITE, write_start, save_size);
+
+    return PKSAV_ERROR_NONE;
+}
+
+pksav_error_t pksav_gba_save_clone(
+    const pksav_gba_save_t* gba_save,
+    pksav_gba_save_t* clone_out
+) {
+    if(!gba_save || !clone_out) {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+
+    size_t unshuffled_size = _pksav_gba_save_unshuffled_size(gba_save);
+
+    *clone_out = *gba_save;
+
+    /*
+     * Everything that can be edited is already decrypted, so it's copied as-is
+     * rather than reloaded. The file itself is only ever written by saving, so
+     * it's shared until then.
+     */
+    clone_out->unshuffled = _pksav_calloc(unshuffled_size, 1);
+    memcpy(clone_out->unshuffled, gba_save->unshuffled, unshuffled_size);
+    clone_out->pokemon_pc = _pksav_calloc(sizeof(pksav_gba_pokemon_pc_t), 1);
+    memcpy(clone_out->pokemon_pc, gba_save->pokemon_pc, sizeof(pksav_gba_pokemon_pc_t));
+    if(clone_out->raw_refs) {
+        (void)_pksav_atomic_increment(clone_out->raw_refs);
+    }
+
+    _pksav_gba_save_set_section_pointers(
+        clone_out
+    );
+
+    return PKSAV_ERROR_NONE;
+}
+
+pksav_error_t pksav_gba_save_restore(
+    pksav_gba_save_t* gba_save,
+    const pksav_gba_save_t* snapshot
+) {
+    if(!gba_save || !snapshot) {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+    if((gba_save->gba_game != snapshot->gba_game) ||
+       (gba_save->small_save != snapshot->small_save) ||
+       (gba_save->compact != snapshot->compact)) {
+        return PKSAV_ERROR_INVALID_SAVE;
+    }
+
+    // Copying into the existing buffers keeps the caller's pointers valid.
+    memcpy(gba_save->unshuffled, snapshot->unshuffled, _pksav_gba_save_unshuffled_size(gba_save));
+    memcpy(gba_save->pokemon_pc, snapshot->pokemon_pc, sizeof(pksav_gba_pokemon_pc_t));
+
+    if(gba_save->raw != snapshot->raw) {
+        _pksav_gba_save_release_raw(gba_save);
+        gba_save->raw = snapshot->raw;
+        gba_save->raw_refs = snapshot->raw_refs;
+        if(gba_save->raw_refs) {
+            (void)_pksav_atomic_increment(gba_save->raw_refs);
+        }
+    }
+
+    gba_save->security_key = snapshot->security_key;
+    memcpy(
+        gba_save->shuffled_section_nums,
+        snapshot->shuffled_section_nums,
+        sizeof(gba_save->shuffled_section_nums)
+    );
+    gba_save->from_first_slot = snapshot->from_first_slot;
+    gba_save->pokedex_mirrors_matched = snapshot->pokedex_mirrors_matched;
+    gba_save->dirty_sections = snapshot->dirty_sections;
 
     return PKSAV_ERROR_NONE;
 }
@@ -510,9 +1260,9 @@ pksav_error_t pksav_gba_save_free(
         return PKSAV_ERROR_NULL_POINTER;
     }
 
-    free(gba_save->pokemon_pc);
-    free(gba_save->unshuffled);
-    free(gba_save->raw);
+    _pksav_free(gba_save->pokemon_pc);
+    _pksav_free(gba_save->unshuffled);
+    _pksav_gba_save_release_raw(gba_save);
 
     return PKSAV_ERROR_NONE;
 }
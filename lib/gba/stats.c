@@ -0,0 +1,174 @@
+/*
+ * Copyright (c) 2018 Nicholas Corgan (n.corgan@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include <pksav/gba/stats.h>
+#include <pksav/math/endian.h>
+
+#include <stdbool.h>
+#include <string.h>
+
+#define PKSAV_GBA_IV_MASK ((uint32_t)0x3FFFFFFF)
+
+static pksav_error_t _pksav_gba_calc_stats(
+    const pksav_gba_pc_pokemon_t* pc_pokemon,
+    uint8_t level,
+    pksav_battle_stats_t* stats_out
+) {
+    uint16_t species = pksav_littleendian16(pc_pokemon->blocks.growth.species);
+    if(species == 0) {
+        memset(stats_out, 0, sizeof(*stats_out));
+        return PKSAV_ERROR_NONE;
+    }
+
+    uint16_t pokedex_num = 0;
+    pksav_base_stats_t base_stats;
+    pksav_error_t error = pksav_gba_species_to_pokedex_num(species, &pokedex_num);
+    if(!error) {
+        error = pksav_get_base_stats(pokedex_num, &base_stats);
+    }
+    if(!error) {
+        const pksav_gba_pokemon_effort_t* effort = &pc_pokemon->blocks.effort;
+        const uint8_t EVs[6] = {
+            effort->ev_hp,
+            effort->ev_atk,
+            effort->ev_def,
+            effort->ev_spd,
+            effort->ev_spatk,
+            effort->ev_spdef
+        };
+        uint32_t iv_data = pksav_littleendian32(pc_pokemon->blocks.misc.iv_egg_ability);
+        pksav_nature_t nature = (pksav_nature_t)(pksav_littleendian32(pc_pokemon->personality) % 25);
+
+        error = pksav_calc_stats(
+                    &base_stats,
+                    level,
+                    (iv_data & PKSAV_GBA_IV_MASK),
+                    EVs,
+                    nature,
+                    stats_out
+                );
+    }
+
+    return error;
+}
+
+static PKSAV_INLINE bool _pksav_gba_party_data_matches(
+    const pksav_gba_pokemon_party_data_t* party_data,
+    const pksav_battle_stats_t* stats
+) {
+    return (pksav_littleendian16(party_data->max_hp) == stats->hp)
+         & (pksav_littleendian16(party_data->atk)    == stats->attack)
+         & (pksav_littleendian16(party_data->def)    == stats->defense)
+         & (pksav_littleendian16(party_data->spd)    == stats->speed)
+         & (pksav_littleendian16(party_data->spatk)  == stats->spatk)
+         & (pksav_littleendian16(party_data->spdef)  == stats->spdef);
+}
+
+pksav_error_t pksav_gba_pokemon_calc_stats(
+    const pksav_gba_pc_pokemon_t* pc_pokemon,
+    uint8_t level,
+    pksav_battle_stats_t* stats_out
+) {
+    if(!pc_pokemon || !stats_out) {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+
+    return _pksav_gba_calc_stats(pc_pokemon, level, stats_out);
+}
+
+pksav_error_t pksav_gba_party_update_stats(
+    pksav_gba_pokemon_party_t* party
+) {
+    if(!party) {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+
+    uint32_t count = pksav_littleendian32(party->count);
+    if(count > 6) {
+        return PKSAV_ERROR_PARAM_OUT_OF_RANGE;
+    }
+
+    pksav_battle_stats_t stats[6];
+    for(uint32_t i = 0; i < count; ++i) {
+        pksav_error_t error = _pksav_gba_calc_stats(
+                                  &party->party[i].pc,
+                                  party->party[i].party_data.level,
+                                  &stats[i]
+                              );
+        if(error) {
+            return error;
+        }
+    }
+
+    for(uint32_t i = 0; i < count; ++i) {
+        pksav_gba_pokemon_party_data_t* party_data = &party->party[i].party_data;
+        party_data->max_hp = pksav_littleendian16(stats[i].hp);
+        party_data->atk    = pksav_littleendian16(stats[i].attack);
+        party_data->def    = pksav_littleendian16(stats[i].defense);
+        party_data->spd    = pksav_littleendian16(stats[i].speed);
+        party_data->spatk  = pksav_littleendian16(stats[i].spatk);
+        party_data->spdef  = pksav_littleendian16(stats[i].spdef);
+    }
+
+    return PKSAV_ERROR_NONE;
+}
+
+pksav_error_t pksav_gba_party_verify_stats(
+    const pksav_gba_pokemon_party_t* party,
+    uint8_t* mismatches_out
+) {
+    if(!party || !mismatches_out) {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+
+    uint32_t count = pksav_littleendian32(party->count);
+    if(count > 6) {
+        return PKSAV_ERROR_PARAM_OUT_OF_RANGE;
+    }
+
+    uint8_t mismatches = 0;
+    for(uint32_t i = 0; i < count; ++i) {
+        pksav_battle_stats_t stats;
+        pksav_error_t error = _pksav_gba_calc_stats(
+                                  &party->party[i].pc,
+                                  party->party[i].party_data.level,
+                                  &stats
+                              );
+        if(error) {
+            return error;
+        }
+
+        mismatches |= (uint8_t)(!_pksav_gba_party_data_matches(&party->party[i].party_data, &stats) << i);
+    }
+
+    *mismatches_out = mismatches;
+
+    return PKSAV_ERROR_NONE;
+}
+
+pksav_error_t pksav_gba_box_calc_stats(
+    const pksav_gba_pokemon_box_t* box,
+    const uint8_t* levels,
+    pksav_battle_stats_t* stats_out
+) {
+    if(!box || !levels || !stats_out) {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+
+    for(size_t i = 0; i < 30; ++i) {
+        pksav_error_t error = _pksav_gba_calc_stats(
+                                  &box->entries[i],
+                                  levels[i],
+                                  &stats_out[i]
+                              );
+        if(error) {
+            return error;
+        }
+    }
+
+    return PKSAV_ERROR_NONE;
+}
@@ -115,6 +115,40 @@ pksav_error_t pksav_text_from_gba(
     return PKSAV_ERROR_NONE;
 }
 
+pksav_error_t pksav_text_from_gba_utf8(
+    const uint8_t* input_buffer,
+    size_t num_chars,
+    char* output_text,
+    size_t output_len,
+    size_t* num_bytes_out
+) {
+    if(!input_buffer || !output_text) {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+
+    // Characters with no Unicode equivalent end the string, as in pksav_text_from_gba.
+    size_t pos = 0;
+    for(size_t i = 0; i < num_chars; ++i) {
+        if(input_buffer[i] > PKSAV_GBA_LAST_CHAR) {
+            break;
+        }
+
+        uint32_t code_point = (uint32_t)pksav_gba_char_map[input_buffer[i]];
+        if((code_point == 0) ||
+           !pksav_utf8_append(code_point, output_text, output_len, &pos)) {
+            break;
+        }
+    }
+    if(output_len > 0) {
+        output_text[pos] = '\0';
+    }
+    if(num_bytes_out) {
+        *num_bytes_out = pos;
+    }
+
+    return PKSAV_ERROR_NONE;
+}
+
 pksav_error_t pksav_text_to_gba(
     const char* input_text,
     uint8_t* output_buffer,
@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2018 Nicholas Corgan (n.corgan@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "../common/pokemon_record.h"
+
+#include <pksav/common/base_stats.h>
+#include <pksav/gen1/pokemon_record.h>
+#include <pksav/gen1/text.h>
+
+#include <pksav/math/base256.h>
+#include <pksav/math/endian.h>
+
+#include <string.h>
+
+static void _pksav_gen1_pc_pokemon_to_record(
+    const pksav_gen1_pc_pokemon_t* pc_pokemon,
+    const uint8_t* nickname,
+    const uint8_t* otname,
+    pksav_pokemon_record_t* record_out
+) {
+    memset(record_out, 0, sizeof(*record_out));
+
+    // Invalid species indices are left as 0.
+    (void)pksav_gen1_species_to_pokedex_num(pc_pokemon->species, &record_out->pokedex_num);
+
+    pksav_from_base256(pc_pokemon->exp, 3, &record_out->exp);
+    record_out->ot_public_id = pksav_bigendian16(pc_pokemon->ot_id);
+    for(size_t i = 0; i < 4; ++i) {
+        record_out->moves[i] = pc_pokemon->moves[i];
+    }
+
+    uint16_t special_EV = pksav_bigendian16(pc_pokemon->ev_spcl);
+    record_out->EVs[0] = pksav_bigendian16(pc_pokemon->ev_hp);
+    record_out->EVs[1] = pksav_bigendian16(pc_pokemon->ev_atk);
+    record_out->EVs[2] = pksav_bigendian16(pc_pokemon->ev_def);
+    record_out->EVs[3] = pksav_bigendian16(pc_pokemon->ev_spd);
+    record_out->EVs[4] = special_EV;
+    record_out->EVs[5] = special_EV;
+    _pksav_record_set_gb_IVs(record_out, pksav_bigendian16(pc_pokemon->iv_data));
+
+    record_out->level      = pc_pokemon->level;
+    record_out->generation = 1;
+    record_out->nature     = PKSAV_POKEMON_RECORD_NO_NATURE;
+
+    pksav_text_from_gen1_utf8(nickname, 10, record_out->nickname, PKSAV_POKEMON_RECORD_NAME_SIZE, NULL);
+    pksav_text_from_gen1_utf8(otname, 10, record_out->otname, PKSAV_POKEMON_RECORD_NAME_SIZE, NULL);
+}
+
+pksav_error_t pksav_gen1_box_to_records(
+    const pksav_gen1_pokemon_box_t* box,
+    pksav_pokemon_record_t* records_out,
+    size_t* num_records_out
+) {
+    if(!box || !records_out || !num_records_out) {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+    if(box->count > 20) {
+        return PKSAV_ERROR_PARAM_OUT_OF_RANGE;
+    }
+
+    for(uint8_t i = 0; i < box->count; ++i) {
+        _pksav_gen1_pc_pokemon_to_record(
+            &box->entries[i],
+            box->nicknames[i],
+            box->otnames[i],
+            &records_out[i]
+        );
+    }
+    *num_records_out = box->count;
+
+    return PKSAV_ERROR_NONE;
+}
+
+pksav_error_t pksav_gen1_party_to_records(
+    const pksav_gen1_pokemon_party_t* party,
+    pksav_pokemon_record_t* records_out,
+    size_t* num_records_out
+) {
+    if(!party || !records_out || !num_records_out) {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+    if(party->count > 6) {
+        return PKSAV_ERROR_PARAM_OUT_OF_RANGE;
+    }
+
+    for(uint8_t i = 0; i < party->count; ++i) {
+        _pksav_gen1_pc_pokemon_to_record(
+            &party->party[i].pc,
+            party->nicknames[i],
+            party->otnames[i],
+            &records_out[i]
+        );
+    }
+    *num_records_out = party->count;
+
+    return PKSAV_ERROR_NONE;
+}
@@ -5,6 +5,8 @@
  * or copy at http://opensource.org/licenses/MIT)
  */
 
+#include "../common/allocator.h"
+
 #include <pksav/gen1/save.h>
 
 #include <stdio.h>
@@ -90,7 +92,7 @@ pksav_error_t pksav_file_is_gen1_save(
         return PKSAV_ERROR_NONE;
     }
 
-    uint8_t* gen1_save_data = calloc(PKSAV_GEN1_SAVE_SIZE, 1);
+    uint8_t* gen1_save_data = _pksav_calloc(PKSAV_GEN1_SAVE_SIZE, 1);
     fseek(gen1_save, 0, SEEK_SET);
     size_t num_read = fread((void*)gen1_save_data, 1, PKSAV_GEN1_SAVE_SIZE, gen1_save);
     fclose(gen1_save);
@@ -103,16 +105,79 @@ pksav_error_t pksav_file_is_gen1_save(
                                    &ret
                                );
         if(status) {
-            free(gen1_save_data);
+            _pksav_free(gen1_save_data);
             return status;
         }
     }
 
-    free(gen1_save_data);
+    _pksav_free(gen1_save_data);
     *result_out = ret;
     return PKSAV_ERROR_NONE;
 }
 
+// Points everything into gen1_save->raw.
+static void _pksav_gen1_save_set_pointers(
+    pksav_gen1_save_t* gen1_save
+) {
+    gen1_save->pokemon_party = (pksav_gen1_pokemon_party_t*)&gen1_save->raw[PKSAV_GEN1_POKEMON_PARTY];
+
+    gen1_save->current_pokemon_box_num = &gen1_save->raw[PKSAV_GEN1_CURRENT_POKEMON_BOX_NUM];
+    gen1_save->current_pokemon_box = (pksav_gen1_pokemon_box_t*)&gen1_save->raw[PKSAV_GEN1_CURRENT_POKEMON_BOX];
+
+    for(uint8_t i = 0; i < 6; ++i) {
+        uint16_t offset = PKSAV_GEN1_POKEMON_PC_FIRST_HALF + (sizeof(pksav_gen1_pokemon_box_t)*i);
+        gen1_save->pokemon_boxes[i] = (pksav_gen1_pokemon_box_t*)&gen1_save->raw[offset];
+    }
+    for(uint8_t i = 6; i < 12; ++i) {
+        uint16_t offset = PKSAV_GEN1_POKEMON_PC_SECOND_HALF + (sizeof(pksav_gen1_pokemon_box_t)*(i-6));
+        gen1_save->pokemon_boxes[i] = (pksav_gen1_pokemon_box_t*)&gen1_save->raw[offset];
+    }
+
+    gen1_save->pokedex_seen = &gen1_save->raw[PKSAV_GEN1_POKEDEX_SEEN];
+    gen1_save->pokedex_owned = &gen1_save->raw[PKSAV_GEN1_POKEDEX_OWNED];
+    gen1_save->item_bag = (pksav_gen1_item_bag_t*)&gen1_save->raw[PKSAV_GEN1_ITEM_BAG];
+    gen1_save->item_pc = (pksav_gen1_item_pc_t*)&gen1_save->raw[PKSAV_GEN1_ITEM_PC];
+    gen1_save->time_played = (pksav_gen1_time_t*)&gen1_save->raw[PKSAV_GEN1_TIME_PLAYED];
+    gen1_save->money = &gen1_save->raw[PKSAV_GEN1_MONEY];
+    gen1_save->casino_coins = &gen1_save->raw[PKSAV_GEN1_CASINO_COINS];
+    gen1_save->trainer_id = (uint16_t*)&gen1_save->raw[PKSAV_GEN1_PLAYER_ID];
+    gen1_save->trainer_name = &gen1_save->raw[PKSAV_GEN1_PLAYER_NAME];
+    gen1_save->rival_name = &gen1_save->raw[PKSAV_GEN1_RIVAL_NAME];
+    gen1_save->badges = &gen1_save->raw[PKSAV_GEN1_BADGES];
+    gen1_save->pikachu_friendship = &gen1_save->raw[PKSAV_GEN1_PIKACHU_FRIENDSHIP];
+}
+
+// Validates the save in gen1_save->raw and sets its pointers, freeing it on failure.
+static pksav_error_t _pksav_gen1_save_load_raw(
+    pksav_gen1_save_t* gen1_save
+) {
+    bool buffer_is_valid = false;
+    pksav_buffer_is_gen1_save(
+        gen1_save->raw,
+        PKSAV_GEN1_SAVE_SIZE,
+        &buffer_is_valid
+    );
+
+    if(!buffer_is_valid) {
+        _pksav_free(gen1_save->raw);
+        return PKSAV_ERROR_INVALID_SAVE;
+    }
+
+    /*
+     * Check if this save is for the Yellow version. The only way to check this is to check the
+     * Pikachu Friendship field, which isn't used in Red/Blue. This is usually fine but will fail
+     * if the trainer's Pikachu despises the trainer enough to have a friendship value of 0, which
+     * is unlikely but technically possible.
+     */
+    gen1_save->yellow = (gen1_save->raw[PKSAV_GEN1_PIKACHU_FRIENDSHIP] > 0);
+
+    _pksav_gen1_save_set_pointers(
+        gen1_save
+    );
+
+    return PKSAV_ERROR_NONE;
+}
+
 pksav_error_t pksav_gen1_save_load(
     const char* filepath,
     pksav_gen1_save_t* gen1_save
@@ -134,63 +199,38 @@ pksav_error_t pksav_gen1_save_load(
         return PKSAV_ERROR_INVALID_SAVE;
     }
 
-    gen1_save->raw = calloc(PKSAV_GEN1_SAVE_SIZE, 1);
+    gen1_save->raw = _pksav_calloc(PKSAV_GEN1_SAVE_SIZE, 1);
     fseek(gen1_save_file, 0, SEEK_SET);
     size_t num_read = fread((void*)gen1_save->raw, 1, PKSAV_GEN1_SAVE_SIZE, gen1_save_file);
     fclose(gen1_save_file);
     if(num_read != PKSAV_GEN1_SAVE_SIZE) {
+        _pksav_free(gen1_save->raw);
         return PKSAV_ERROR_FILE_IO;
     }
 
-    bool buffer_is_valid = false;
-    pksav_buffer_is_gen1_save(
-        gen1_save->raw,
-        PKSAV_GEN1_SAVE_SIZE,
-        &buffer_is_valid
-    );
-
-    if(!buffer_is_valid) {
-        free(gen1_save->raw);
-        return PKSAV_ERROR_INVALID_SAVE;
-    }
-
-    /*
-     * Check if this save is for the Yellow version. The only way to check this is to check the
-     * Pikachu Friendship field, which isn't used in Red/Blue. This is usually fine but will fail
-     * if the trainer's Pikachu despises the trainer enough to have a friendship value of 0, which
-     * is unlikely but technically possible.
-     */
-    gen1_save->yellow = (gen1_save->raw[PKSAV_GEN1_PIKACHU_FRIENDSHIP] > 0);
-
-    // Set pointers
-    gen1_save->pokemon_party = (pksav_gen1_pokemon_party_t*)&gen1_save->raw[PKSAV_GEN1_POKEMON_PARTY];
-
-    gen1_save->current_pokemon_box_num = &gen1_save->raw[PKSAV_GEN1_CURRENT_POKEMON_BOX_NUM];
-    gen1_save->current_pokemon_box = (pksav_gen1_pokemon_box_t*)&gen1_save->raw[PKSAV_GEN1_CURRENT_POKEMON_BOX];
+    return _pksav_gen1_save_load_raw(
+               gen1_save
+           );
+}
 
-    for(uint8_t i = 0; i < 6; ++i) {
-        uint16_t offset = PKSAV_GEN1_POKEMON_PC_FIRST_HALF + (sizeof(pksav_gen1_pokemon_box_t)*i);
-        gen1_save->pokemon_boxes[i] = (pksav_gen1_pokemon_box_t*)&gen1_save->raw[offset];
+pksav_error_t pksav_gen1_save_load_buffer(
+    const uint8_t* buffer,
+    size_t buffer_len,
+    pksav_gen1_save_t* gen1_save
+) {
+    if(!buffer || !gen1_save) {
+        return PKSAV_ERROR_NULL_POINTER;
     }
-    for(uint8_t i = 6; i < 12; ++i) {
-        uint16_t offset = PKSAV_GEN1_POKEMON_PC_SECOND_HALF + (sizeof(pksav_gen1_pokemon_box_t)*(i-6));
-        gen1_save->pokemon_boxes[i] = (pksav_gen1_pokemon_box_t*)&gen1_save->raw[offset];
+    if(buffer_len < PKSAV_GEN1_SAVE_SIZE) {
+        return PKSAV_ERROR_INVALID_SAVE;
     }
 
-    gen1_save->pokedex_seen = &gen1_save->raw[PKSAV_GEN1_POKEDEX_SEEN];
-    gen1_save->pokedex_owned = &gen1_save->raw[PKSAV_GEN1_POKEDEX_OWNED];
-    gen1_save->item_bag = (pksav_gen1_item_bag_t*)&gen1_save->raw[PKSAV_GEN1_ITEM_BAG];
-    gen1_save->item_pc = (pksav_gen1_item_pc_t*)&gen1_save->raw[PKSAV_GEN1_ITEM_PC];
-    gen1_save->time_played = (pksav_gen1_time_t*)&gen1_save->raw[PKSAV_GEN1_TIME_PLAYED];
-    gen1_save->money = &gen1_save->raw[PKSAV_GEN1_MONEY];
-    gen1_save->casino_coins = &gen1_save->raw[PKSAV_GEN1_CASINO_COINS];
-    gen1_save->trainer_id = (uint16_t*)&gen1_save->raw[PKSAV_GEN1_PLAYER_ID];
-    gen1_save->trainer_name = &gen1_save->raw[PKSAV_GEN1_PLAYER_NAME];
-    gen1_save->rival_name = &gen1_save->raw[PKSAV_GEN1_RIVAL_NAME];
-    gen1_save->badges = &gen1_save->raw[PKSAV_GEN1_BADGES];
-    gen1_save->pikachu_friendship = &gen1_save->raw[PKSAV_GEN1_PIKACHU_FRIENDSHIP];
+    gen1_save->raw = _pksav_calloc(PKSAV_GEN1_SAVE_SIZE, 1);
+    memcpy(gen1_save->raw, buffer, PKSAV_GEN1_SAVE_SIZE);
 
-    return PKSAV_ERROR_NONE;
+    return _pksav_gen1_save_load_raw(
+               gen1_save
+           );
 }
 
 pksav_error_t pksav_gen1_save_save(
@@ -217,6 +257,62 @@ pksav_error_t pksav_gen1_save_save(
     return PKSAV_ERROR_NONE;
 }
 
+pksav_error_t pksav_gen1_save_save_buffer(
+    uint8_t* buffer,
+    size_t buffer_len,
+    pksav_gen1_save_t* gen1_save
+) {
+    if(!buffer || !gen1_save) {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+    if(buffer_len < PKSAV_GEN1_SAVE_SIZE) {
+        return PKSAV_ERROR_PARAM_OUT_OF_RANGE;
+    }
+
+    gen1_save->raw[PKSAV_GEN1_CHECKSUM] = _pksav_get_gen1_save_checksum(gen1_save->raw);
+    memcpy(buffer, gen1_save->raw, PKSAV_GEN1_SAVE_SIZE);
+
+    return PKSAV_ERROR_NONE;
+}
+
+pksav_error_t pksav_gen1_save_clone(
+    const pksav_gen1_save_t* gen1_save,
+    pksav_gen1_save_t* clone_out
+) {
+    if(!gen1_save || !gen1_save->raw || !clone_out) {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+
+    // Everything is in raw, so only the pointers need to be moved over.
+    *clone_out = *gen1_save;
+    clone_out->raw = _pksav_calloc(PKSAV_GEN1_SAVE_SIZE, 1);
+    memcpy(clone_out->raw, gen1_save->raw, PKSAV_GEN1_SAVE_SIZE);
+
+    _pksav_gen1_save_set_pointers(
+        clone_out
+    );
+
+    return PKSAV_ERROR_NONE;
+}
+
+pksav_error_t pksav_gen1_save_restore(
+    pksav_gen1_save_t* gen1_save,
+    const pksav_gen1_save_t* snapshot
+) {
+    if(!gen1_save || !gen1_save->raw || !snapshot || !snapshot->raw) {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+
+    memcpy(gen1_save->raw, snapshot->raw, PKSAV_GEN1_SAVE_SIZE);
+    gen1_save->yellow = snapshot->yellow;
+
+    _pksav_gen1_save_set_pointers(
+        gen1_save
+    );
+
+    return PKSAV_ERROR_NONE;
+}
+
 pksav_error_t pksav_gen1_save_free(
     pksav_gen1_save_t* gen1_save
 ) {
@@ -224,7 +320,7 @@ pksav_error_t pksav_gen1_save_free(
         return PKSAV_ERROR_NULL_POINTER;
     }
 
-    free(gen1_save->raw);
+    _pksav_free(gen1_save->raw);
 
     return PKSAV_ERROR_NONE;
 }
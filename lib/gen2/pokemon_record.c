@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) 2018 Nicholas Corgan (n.corgan@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "../common/pokemon_record.h"
+
+#include <pksav/gen2/pokemon_record.h>
+#include <pksav/gen2/text.h>
+
+#include <pksav/math/base256.h>
+#include <pksav/math/endian.h>
+
+#include <string.h>
+
+#define PKSAV_GEN2_EGG_SPECIES 0xFD
+
+/*
+ * A Pokémon is shiny if its Defense, Speed, and Special IVs are 10 and its
+ * Attack IV is 2, 3, 6, 7, 10, 11, 14, or 15.
+ */
+static PKSAV_INLINE bool _pksav_gen2_is_shiny(
+    const pksav_pokemon_record_t* record
+) {
+    return (record->IVs[2] == 10) && (record->IVs[3] == 10) &&
+           (record->IVs[4] == 10) && (record->IVs[1] & 0x02);
+}
+
+static void _pksav_gen2_pc_pokemon_to_record(
+    const pksav_gen2_pc_pokemon_t* pc_pokemon,
+    uint8_t list_species,
+    const uint8_t* nickname,
+    const uint8_t* otname,
+    pksav_pokemon_record_t* record_out
+) {
+    memset(record_out, 0, sizeof(*record_out));
+
+    // Generation II species indices match the National Pokédex.
+    if((pc_pokemon->species >= 1) && (pc_pokemon->species <= 251)) {
+        record_out->pokedex_num = pc_pokemon->species;
+    }
+
+    pksav_from_base256(pc_pokemon->exp, 3, &record_out->exp);
+    record_out->held_item    = pc_pokemon->held_item;
+    record_out->ot_public_id = pksav_bigendian16(pc_pokemon->ot_id);
+    for(size_t i = 0; i < 4; ++i) {
+        record_out->moves[i] = pc_pokemon->moves[i];
+    }
+
+    uint16_t special_EV = pksav_bigendian16(pc_pokemon->ev_spcl);
+    record_out->EVs[0] = pksav_bigendian16(pc_pokemon->ev_hp);
+    record_out->EVs[1] = pksav_bigendian16(pc_pokemon->ev_atk);
+    record_out->EVs[2] = pksav_bigendian16(pc_pokemon->ev_def);
+    record_out->EVs[3] = pksav_bigendian16(pc_pokemon->ev_spd);
+    record_out->EVs[4] = special_EV;
+    record_out->EVs[5] = special_EV;
+    _pksav_record_set_gb_IVs(record_out, pksav_bigendian16(pc_pokemon->iv_data));
+
+    record_out->level      = pc_pokemon->level;
+    record_out->friendship = pc_pokemon->friendship;
+    record_out->pokerus    = pc_pokemon->pokerus;
+    record_out->generation = 2;
+    record_out->nature     = PKSAV_POKEMON_RECORD_NO_NATURE;
+
+    // Only the species list shows whether a Pokémon is in an egg.
+    if(list_species == PKSAV_GEN2_EGG_SPECIES) {
+        record_out->flags |= PKSAV_POKEMON_RECORD_IS_EGG_MASK;
+    }
+    if(_pksav_gen2_is_shiny(record_out)) {
+        record_out->flags |= PKSAV_POKEMON_RECORD_IS_SHINY_MASK;
+    }
+    // Only set in Crystal.
+    if(pksav_bigendian16(pc_pokemon->caught_data) & PKSAV_GEN2_OT_GENDER_MASK) {
+        record_out->flags |= PKSAV_POKEMON_RECORD_OT_FEMALE_MASK;
+    }
+
+    pksav_text_from_gen2_utf8(nickname, 10, record_out->nickname, PKSAV_POKEMON_RECORD_NAME_SIZE, NULL);
+    pksav_text_from_gen2_utf8(otname, 10, record_out->otname, PKSAV_POKEMON_RECORD_NAME_SIZE, NULL);
+}
+
+pksav_error_t pksav_gen2_box_to_records(
+    const pksav_gen2_pokemon_box_t* box,
+    pksav_pokemon_record_t* records_out,
+    size_t* num_records_out
+) {
+    if(!box || !records_out || !num_records_out) {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+    if(box->count > 20) {
+        return PKSAV_ERROR_PARAM_OUT_OF_RANGE;
+    }
+
+    for(uint8_t i = 0; i < box->count; ++i) {
+        _pksav_gen2_pc_pokemon_to_record(
+            &box->entries[i],
+            box->species[i],
+            box->nicknames[i],
+            box->otnames[i],
+            &records_out[i]
+        );
+    }
+    *num_records_out = box->count;
+
+    return PKSAV_ERROR_NONE;
+}
+
+pksav_error_t pksav_gen2_party_to_records(
+    const pksav_gen2_pokemon_party_t* party,
+    pksav_pokemon_record_t* records_out,
+    size_t* num_records_out
+) {
+    if(!party || !records_out || !num_records_out) {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+    if(party->count > 6) {
+        return PKSAV_ERROR_PARAM_OUT_OF_RANGE;
+    }
+
+    for(uint8_t i = 0; i < party->count; ++i) {
+        _pksav_gen2_pc_pokemon_to_record(
+            &party->party[i].pc,
+            party->species[i],
+            party->nicknames[i],
+            party->otnames[i],
+            &records_out[i]
+        );
+    }
+    *num_records_out = party->count;
+
+    return PKSAV_ERROR_NONE;
+}
@@ -5,6 +5,8 @@
  * or copy at http://opensource.org/licenses/MIT)
  */
 
+#include "../common/allocator.h"
+
 #include <pksav/gen2/save.h>
 
 #include <stdio.h>
@@ -192,7 +194,7 @@ pksav_error_t pksav_file_is_gen2_save(
         return PKSAV_ERROR_NONE;
     }
 
-    uint8_t* gen2_save_data = calloc(PKSAV_GEN2_SAVE_SIZE, 1);
+    uint8_t* gen2_save_data = _pksav_calloc(PKSAV_GEN2_SAVE_SIZE, 1);
     fseek(gen2_save, 0, SEEK_SET);
     size_t num_read = fread((void*)gen2_save_data, 1, PKSAV_GEN2_SAVE_SIZE, gen2_save);
     fclose(gen2_save);
@@ -207,45 +209,56 @@ pksav_error_t pksav_file_is_gen2_save(
                          &ret
                      );
         if(error_code) {
-            free(gen2_save_data);
+            _pksav_free(gen2_save_data);
             return error_code;
         }
     }
 
     *result_out = ret;
-    free(gen2_save_data);
+    _pksav_free(gen2_save_data);
     return PKSAV_ERROR_NONE;
 }
 
-pksav_error_t pksav_gen2_save_load(
-    const char* filepath,
+// Points everything into gen2_save->raw.
+static void _pksav_gen2_save_set_pointers(
     pksav_gen2_save_t* gen2_save
 ) {
-    if(!filepath || !gen2_save) {
-        return PKSAV_ERROR_NULL_POINTER;
-    }
+    gen2_save->pokemon_party = (pksav_gen2_pokemon_party_t*)&PKSAV_GEN2_DATA(gen2_save,PKSAV_GEN2_POKEMON_PARTY);
+    gen2_save->current_pokemon_box_num = &PKSAV_GEN2_DATA(gen2_save,PKSAV_GEN2_CURRENT_POKEMON_BOX_NUM);
+    gen2_save->current_pokemon_box = (pksav_gen2_pokemon_box_t*)&PKSAV_GEN2_DATA(gen2_save,PKSAV_GEN2_CURRENT_POKEMON_BOX);
 
-    // Read the file and make sure it's valid
-    FILE* gen2_save_file = fopen(filepath, "rb");
-    if(!gen2_save_file) {
-        return PKSAV_ERROR_FILE_IO;
+    for(uint8_t i = 0; i < 7; ++i) {
+        uint16_t offset = pksav_gen2_offsets[PKSAV_GEN2_POKEMON_PC_FIRST_HALF][0] + (sizeof(pksav_gen2_pokemon_box_t)*i);
+        gen2_save->pokemon_boxes[i] = (pksav_gen2_pokemon_box_t*)&gen2_save->raw[offset];
     }
-
-    fseek(gen2_save_file, 0, SEEK_END);
-
-    if(ftell(gen2_save_file) < PKSAV_GEN2_SAVE_SIZE) {
-        fclose(gen2_save_file);
-        return PKSAV_ERROR_INVALID_SAVE;
+    for(uint8_t i = 7; i < 14; ++i) {
+        uint16_t offset = pksav_gen2_offsets[PKSAV_GEN2_POKEMON_PC_SECOND_HALF][0] + (sizeof(pksav_gen2_pokemon_box_t)*(i-7));
+        gen2_save->pokemon_boxes[i] = (pksav_gen2_pokemon_box_t*)&gen2_save->raw[offset];
     }
 
-    gen2_save->raw = calloc(PKSAV_GEN2_SAVE_SIZE, 1);
-    fseek(gen2_save_file, 0, SEEK_SET);
-    size_t num_read = fread((void*)gen2_save->raw, 1, PKSAV_GEN2_SAVE_SIZE, gen2_save_file);
-    fclose(gen2_save_file);
-    if(num_read != PKSAV_GEN2_SAVE_SIZE) {
-        return PKSAV_ERROR_FILE_IO;
+    gen2_save->pokemon_box_names = (pksav_gen2_pokemon_box_names_t*)&PKSAV_GEN2_DATA(gen2_save, PKSAV_GEN2_PC_BOX_NAMES);
+    gen2_save->item_bag = (pksav_gen2_item_bag_t*)&PKSAV_GEN2_DATA(gen2_save,PKSAV_GEN2_ITEM_BAG);
+    gen2_save->item_pc = (pksav_gen2_item_pc_t*)&PKSAV_GEN2_DATA(gen2_save,PKSAV_GEN2_ITEM_PC);
+    gen2_save->pokedex_seen = &PKSAV_GEN2_DATA(gen2_save,PKSAV_GEN2_POKEDEX_SEEN);
+    gen2_save->pokedex_owned = &PKSAV_GEN2_DATA(gen2_save,PKSAV_GEN2_POKEDEX_OWNED);
+    gen2_save->daylight_savings = &PKSAV_GEN2_DATA(gen2_save,PKSAV_GEN2_DAYLIGHT_SAVINGS);
+    gen2_save->time_played = (pksav_gen2_time_t*)&PKSAV_GEN2_DATA(gen2_save,PKSAV_GEN2_TIME_PLAYED);
+    gen2_save->money = &PKSAV_GEN2_DATA(gen2_save,PKSAV_GEN2_MONEY);
+    gen2_save->trainer_id = (uint16_t*)&PKSAV_GEN2_DATA(gen2_save,PKSAV_GEN2_PLAYER_ID);
+    gen2_save->trainer_name = &PKSAV_GEN2_DATA(gen2_save,PKSAV_GEN2_PLAYER_NAME);
+    gen2_save->rival_name = &PKSAV_GEN2_DATA(gen2_save,PKSAV_GEN2_RIVAL_NAME);
+
+    if(gen2_save->gen2_game == PKSAV_GEN2_CRYSTAL) {
+        gen2_save->trainer_gender = &PKSAV_GEN2_DATA(gen2_save,PKSAV_GEN2_PLAYER_GENDER);
+    } else {
+        gen2_save->trainer_gender = NULL;
     }
+}
 
+// Validates the save in gen2_save->raw and sets its pointers, freeing it on failure.
+static pksav_error_t _pksav_gen2_save_load_raw(
+    pksav_gen2_save_t* gen2_save
+) {
     pksav_error_t error_code = PKSAV_ERROR_NONE;
     bool is_valid = false;
 
@@ -256,7 +269,7 @@ pksav_error_t pksav_gen2_save_load(
                      &is_valid
                  );
     if(error_code) {
-        free(gen2_save->raw);
+        _pksav_free(gen2_save->raw);
         return error_code;
     } else if(is_valid) {
         gen2_save->gen2_game = PKSAV_GEN2_GS;
@@ -270,49 +283,76 @@ pksav_error_t pksav_gen2_save_load(
                          &is_valid
                      );
         if(error_code) {
-            free(gen2_save->raw);
+            _pksav_free(gen2_save->raw);
             return error_code;
         } else if(is_valid) {
             gen2_save->gen2_game = PKSAV_GEN2_CRYSTAL;
         } else {
-            free(gen2_save->raw);
+            _pksav_free(gen2_save->raw);
             return PKSAV_ERROR_INVALID_SAVE;
         }
     }
 
-    // Set pointers
-    gen2_save->pokemon_party = (pksav_gen2_pokemon_party_t*)&PKSAV_GEN2_DATA(gen2_save,PKSAV_GEN2_POKEMON_PARTY);
-    gen2_save->current_pokemon_box_num = &PKSAV_GEN2_DATA(gen2_save,PKSAV_GEN2_CURRENT_POKEMON_BOX_NUM);
-    gen2_save->current_pokemon_box = (pksav_gen2_pokemon_box_t*)&PKSAV_GEN2_DATA(gen2_save,PKSAV_GEN2_CURRENT_POKEMON_BOX);
+    _pksav_gen2_save_set_pointers(
+        gen2_save
+    );
 
-    for(uint8_t i = 0; i < 7; ++i) {
-        uint16_t offset = pksav_gen2_offsets[PKSAV_GEN2_POKEMON_PC_FIRST_HALF][0] + (sizeof(pksav_gen2_pokemon_box_t)*i);
-        gen2_save->pokemon_boxes[i] = (pksav_gen2_pokemon_box_t*)&gen2_save->raw[offset];
+    return PKSAV_ERROR_NONE;
+}
+
+pksav_error_t pksav_gen2_save_load(
+    const char* filepath,
+    pksav_gen2_save_t* gen2_save
+) {
+    if(!filepath || !gen2_save) {
+        return PKSAV_ERROR_NULL_POINTER;
     }
-    for(uint8_t i = 7; i < 14; ++i) {
-        uint16_t offset = pksav_gen2_offsets[PKSAV_GEN2_POKEMON_PC_SECOND_HALF][0] + (sizeof(pksav_gen2_pokemon_box_t)*(i-7));
-        gen2_save->pokemon_boxes[i] = (pksav_gen2_pokemon_box_t*)&gen2_save->raw[offset];
+
+    // Read the file and make sure it's valid
+    FILE* gen2_save_file = fopen(filepath, "rb");
+    if(!gen2_save_file) {
+        return PKSAV_ERROR_FILE_IO;
     }
 
-    gen2_save->pokemon_box_names = (pksav_gen2_pokemon_box_names_t*)&PKSAV_GEN2_DATA(gen2_save, PKSAV_GEN2_PC_BOX_NAMES);
-    gen2_save->item_bag = (pksav_gen2_item_bag_t*)&PKSAV_GEN2_DATA(gen2_save,PKSAV_GEN2_ITEM_BAG);
-    gen2_save->item_pc = (pksav_gen2_item_pc_t*)&PKSAV_GEN2_DATA(gen2_save,PKSAV_GEN2_ITEM_PC);
-    gen2_save->pokedex_seen = &PKSAV_GEN2_DATA(gen2_save,PKSAV_GEN2_POKEDEX_SEEN);
-    gen2_save->pokedex_owned = &PKSAV_GEN2_DATA(gen2_save,PKSAV_GEN2_POKEDEX_OWNED);
-    gen2_save->daylight_savings = &PKSAV_GEN2_DATA(gen2_save,PKSAV_GEN2_DAYLIGHT_SAVINGS);
-    gen2_save->time_played = (pksav_gen2_time_t*)&PKSAV_GEN2_DATA(gen2_save,PKSAV_GEN2_TIME_PLAYED);
-    gen2_save->money = &PKSAV_GEN2_DATA(gen2_save,PKSAV_GEN2_MONEY);
-    gen2_save->trainer_id = (uint16_t*)&PKSAV_GEN2_DATA(gen2_save,PKSAV_GEN2_PLAYER_ID);
-    gen2_save->trainer_name = &PKSAV_GEN2_DATA(gen2_save,PKSAV_GEN2_PLAYER_NAME);
-    gen2_save->rival_name = &PKSAV_GEN2_DATA(gen2_save,PKSAV_GEN2_RIVAL_NAME);
+    fseek(gen2_save_file, 0, SEEK_END);
 
-    if(gen2_save->gen2_game == PKSAV_GEN2_CRYSTAL) {
-        gen2_save->trainer_gender = &PKSAV_GEN2_DATA(gen2_save,PKSAV_GEN2_PLAYER_GENDER);
-    } else {
-        gen2_save->trainer_gender = NULL;
+    if(ftell(gen2_save_file) < PKSAV_GEN2_SAVE_SIZE) {
+        fclose(gen2_save_file);
+        return PKSAV_ERROR_INVALID_SAVE;
     }
 
-    return PKSAV_ERROR_NONE;
+    gen2_save->raw = _pksav_calloc(PKSAV_GEN2_SAVE_SIZE, 1);
+    fseek(gen2_save_file, 0, SEEK_SET);
+    size_t num_read = fread((void*)gen2_save->raw, 1, PKSAV_GEN2_SAVE_SIZE, gen2_save_file);
+    fclose(gen2_save_file);
+    if(num_read != PKSAV_GEN2_SAVE_SIZE) {
+        _pksav_free(gen2_save->raw);
+        return PKSAV_ERROR_FILE_IO;
+    }
+
+    return _pksav_gen2_save_load_raw(
+               gen2_save
+           );
+}
+
+pksav_error_t pksav_gen2_save_load_buffer(
+    const uint8_t* buffer,
+    size_t buffer_len,
+    pksav_gen2_save_t* gen2_save
+) {
+    if(!buffer || !gen2_save) {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+    if(buffer_len < PKSAV_GEN2_SAVE_SIZE) {
+        return PKSAV_ERROR_INVALID_SAVE;
+    }
+
+    gen2_save->raw = _pksav_calloc(PKSAV_GEN2_SAVE_SIZE, 1);
+    memcpy(gen2_save->raw, buffer, PKSAV_GEN2_SAVE_SIZE);
+
+    return _pksav_gen2_save_load_raw(
+               gen2_save
+           );
 }
 
 pksav_error_t pksav_gen2_save_save(
@@ -342,6 +382,65 @@ pksav_error_t pksav_gen2_save_save(
     return PKSAV_ERROR_NONE;
 }
 
+pksav_error_t pksav_gen2_save_save_buffer(
+    uint8_t* buffer,
+    size_t buffer_len,
+    pksav_gen2_save_t* gen2_save
+) {
+    if(!buffer || !gen2_save) {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+    if(buffer_len < PKSAV_GEN2_SAVE_SIZE) {
+        return PKSAV_ERROR_PARAM_OUT_OF_RANGE;
+    }
+
+    _pksav_gen2_set_save_checksums(
+        (gen2_save->gen2_game == PKSAV_GEN2_CRYSTAL),
+        gen2_save->raw
+    );
+    memcpy(buffer, gen2_save->raw, PKSAV_GEN2_SAVE_SIZE);
+
+    return PKSAV_ERROR_NONE;
+}
+
+pksav_error_t pksav_gen2_save_clone(
+    const pksav_gen2_save_t* gen2_save,
+    pksav_gen2_save_t* clone_out
+) {
+    if(!gen2_save || !gen2_save->raw || !clone_out) {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+
+    // Everything is in raw, so only the pointers need to be moved over.
+    *clone_out = *gen2_save;
+    clone_out->raw = _pksav_calloc(PKSAV_GEN2_SAVE_SIZE, 1);
+    memcpy(clone_out->raw, gen2_save->raw, PKSAV_GEN2_SAVE_SIZE);
+
+    _pksav_gen2_save_set_pointers(
+        clone_out
+    );
+
+    return PKSAV_ERROR_NONE;
+}
+
+pksav_error_t pksav_gen2_save_restore(
+    pksav_gen2_save_t* gen2_save,
+    const pksav_gen2_save_t* snapshot
+) {
+    if(!gen2_save || !gen2_save->raw || !snapshot || !snapshot->raw) {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+
+    memcpy(gen2_save->raw, snapshot->raw, PKSAV_GEN2_SAVE_SIZE);
+    gen2_save->gen2_game = snapshot->gen2_game;
+
+    _pksav_gen2_save_set_pointers(
+        gen2_save
+    );
+
+    return PKSAV_ERROR_NONE;
+}
+
 pksav_error_t pksav_gen2_save_free(
     pksav_gen2_save_t* gen2_save
 ) {
@@ -350,7 +449,7 @@ pksav_error_t pksav_gen2_save_free(
     }
 
     // Free dynamically allocated memory
-    free(gen2_save->raw);
+    _pksav_free(gen2_save->raw);
 
     // Set all pointer members to NULL
     gen2_save->pokemon_party = NULL;
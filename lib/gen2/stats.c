@@ -0,0 +1,158 @@
+/*
+ * Copyright (c) 2018 Nicholas Corgan (n.corgan@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include <pksav/gen2/stats.h>
+#include <pksav/math/endian.h>
+
+#include <stdbool.h>
+#include <string.h>
+
+#define PKSAV_GEN2_NUM_SPECIES 251
+
+static pksav_error_t _pksav_gen2_calc_stats(
+    const pksav_gen2_pc_pokemon_t* pc_pokemon,
+    pksav_battle_stats_t* stats_out
+) {
+    if(pc_pokemon->species == 0) {
+        memset(stats_out, 0, sizeof(*stats_out));
+        return PKSAV_ERROR_NONE;
+    }
+    if(pc_pokemon->species > PKSAV_GEN2_NUM_SPECIES) {
+        return PKSAV_ERROR_PARAM_OUT_OF_RANGE;
+    }
+
+    // Generation II species indices match the National Pokédex.
+    pksav_base_stats_t base_stats;
+    (void)pksav_get_base_stats(pc_pokemon->species, &base_stats);
+
+    const uint16_t EVs[5] = {
+        pksav_bigendian16(pc_pokemon->ev_hp),
+        pksav_bigendian16(pc_pokemon->ev_atk),
+        pksav_bigendian16(pc_pokemon->ev_def),
+        pksav_bigendian16(pc_pokemon->ev_spd),
+        pksav_bigendian16(pc_pokemon->ev_spcl)
+    };
+
+    return pksav_calc_gb_stats(
+               &base_stats,
+               pc_pokemon->level,
+               pksav_bigendian16(pc_pokemon->iv_data),
+               EVs,
+               stats_out
+           );
+}
+
+static PKSAV_INLINE bool _pksav_gen2_party_data_matches(
+    const pksav_gen2_pokemon_party_data_t* party_data,
+    const pksav_battle_stats_t* stats
+) {
+    return (pksav_bigendian16(party_data->max_hp) == stats->hp)
+         & (pksav_bigendian16(party_data->atk)    == stats->attack)
+         & (pksav_bigendian16(party_data->def)    == stats->defense)
+         & (pksav_bigendian16(party_data->spd)    == stats->speed)
+         & (pksav_bigendian16(party_data->spatk)  == stats->spatk)
+         & (pksav_bigendian16(party_data->spdef)  == stats->spdef);
+}
+
+pksav_error_t pksav_gen2_pokemon_calc_stats(
+    const pksav_gen2_pc_pokemon_t* pc_pokemon,
+    pksav_battle_stats_t* stats_out
+) {
+    if(!pc_pokemon || !stats_out) {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+
+    return _pksav_gen2_calc_stats(pc_pokemon, stats_out);
+}
+
+pksav_error_t pksav_gen2_party_update_stats(
+    pksav_gen2_pokemon_party_t* party
+) {
+    if(!party) {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+    if(party->count > 6) {
+        return PKSAV_ERROR_PARAM_OUT_OF_RANGE;
+    }
+
+    pksav_battle_stats_t stats[6];
+    for(uint8_t i = 0; i < party->count; ++i) {
+        pksav_error_t error = _pksav_gen2_calc_stats(
+                                  &party->party[i].pc,
+                                  &stats[i]
+                              );
+        if(error) {
+            return error;
+        }
+    }
+
+    for(uint8_t i = 0; i < party->count; ++i) {
+        pksav_gen2_pokemon_party_data_t* party_data = &party->party[i].party_data;
+        party_data->max_hp = pksav_bigendian16(stats[i].hp);
+        party_data->atk    = pksav_bigendian16(stats[i].attack);
+        party_data->def    = pksav_bigendian16(stats[i].defense);
+        party_data->spd    = pksav_bigendian16(stats[i].speed);
+        party_data->spatk  = pksav_bigendian16(stats[i].spatk);
+        party_data->spdef  = pksav_bigendian16(stats[i].spdef);
+    }
+
+    return PKSAV_ERROR_NONE;
+}
+
+pksav_error_t pksav_gen2_party_verify_stats(
+    const pksav_gen2_pokemon_party_t* party,
+    uint8_t* mismatches_out
+) {
+    if(!party || !mismatches_out) {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+    if(party->count > 6) {
+        return PKSAV_ERROR_PARAM_OUT_OF_RANGE;
+    }
+
+    uint8_t mismatches = 0;
+    for(uint8_t i = 0; i < party->count; ++i) {
+        pksav_battle_stats_t stats;
+        pksav_error_t error = _pksav_gen2_calc_stats(
+                                  &party->party[i].pc,
+                                  &stats
+                              );
+        if(error) {
+            return error;
+        }
+
+        mismatches |= (uint8_t)(!_pksav_gen2_party_data_matches(&party->party[i].party_data, &stats) << i);
+    }
+
+    *mismatches_out = mismatches;
+
+    return PKSAV_ERROR_NONE;
+}
+
+pksav_error_t pksav_gen2_box_calc_stats(
+    const pksav_gen2_pokemon_box_t* box,
+    pksav_battle_stats_t* stats_out
+) {
+    if(!box || !stats_out) {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+    if(box->count > 20) {
+        return PKSAV_ERROR_PARAM_OUT_OF_RANGE;
+    }
+
+    for(uint8_t i = 0; i < box->count; ++i) {
+        pksav_error_t error = _pksav_gen2_calc_stats(
+                                  &box->entries[i],
+                                  &stats_out[i]
+                              );
+        if(error) {
+            return error;
+        }
+    }
+
+    return PKSAV_ERROR_NONE;
+}
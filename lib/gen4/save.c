@@ -0,0 +1,409 @@
+/*
+ * Copyright (c) 2018 Nicholas Corgan (n.corgan@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "../common/allocator.h"
+#include "../common/crc16.h"
+
+#include <pksav/config.h>
+
+#include <pksav/gen4/save.h>
+
+#include <pksav/math/endian.h>
+
+#include <stdio.h>
+#include <string.h>
+
+#define PKSAV_GEN4_SAVE_SIZE 0x80000
+#define PKSAV_GEN4_COPY_SIZE 0x40000
+
+/*
+ * Each block ends in a footer whose first field is the block's save
+ * counter and whose last field is the CRC16 of everything before the
+ * footer.
+ */
+typedef struct {
+    size_t general_size;
+    size_t storage_offset;
+    size_t storage_size;
+    size_t footer_size;
+    size_t trainer_info_offset;
+    size_t party_offset;
+    size_t boxes_offset;
+    size_t box_stride;
+} pksav_gen4_layout_t;
+
+static const pksav_gen4_layout_t pksav_gen4_layouts[] = {
+    // Diamond/Pearl
+    {0xC100, 0xC100, 0x121E0, 0x14, 0x64, 0x94, 0x4, sizeof(pksav_gen4_pokemon_box_t)},
+    // Platinum
+    {0xCF2C, 0xCF2C, 0x121E4, 0x14, 0x68, 0x9C, 0x4, sizeof(pksav_gen4_pokemon_box_t)},
+    // HeartGold/SoulSilver
+    {0xF628, 0xF700, 0x12310, 0x10, 0x64, 0x94, 0x0, 0x1000}
+};
+
+typedef enum {
+    PKSAV_GEN4_GENERAL_BLOCK = 0,
+    PKSAV_GEN4_STORAGE_BLOCK
+} pksav_gen4_block_t;
+
+static PKSAV_INLINE size_t _pksav_gen4_block_offset(
+    const pksav_gen4_layout_t* layout,
+    pksav_gen4_block_t block,
+    uint8_t copy
+) {
+    return (copy * PKSAV_GEN4_COPY_SIZE) +
+           ((block == PKSAV_GEN4_GENERAL_BLOCK) ? 0 : layout->storage_offset);
+}
+
+static PKSAV_INLINE size_t _pksav_gen4_block_size(
+    const pksav_gen4_layout_t* layout,
+    pksav_gen4_block_t block
+) {
+    return (block == PKSAV_GEN4_GENERAL_BLOCK) ? layout->general_size : layout->storage_size;
+}
+
+static PKSAV_INLINE uint32_t* _pksav_gen4_block_counter(
+    uint8_t* block,
+    size_t block_size,
+    const pksav_gen4_layout_t* layout
+) {
+    return (uint32_t*)&block[block_size - layout->footer_size];
+}
+
+static PKSAV_INLINE uint16_t* _pksav_gen4_block_checksum(
+    uint8_t* block,
+    size_t block_size
+) {
+    return (uint16_t*)&block[block_size - 2];
+}
+
+static bool _pksav_gen4_block_is_valid(
+    const uint8_t* block,
+    size_t block_size,
+    const pksav_gen4_layout_t* layout
+) {
+    uint16_t checksum = pksav_littleendian16(*_pksav_gen4_block_checksum((uint8_t*)block, block_size));
+    return pksav_crc16_ccitt(block, block_size - layout->footer_size) == checksum;
+}
+
+/*
+ * Returns the copy (0 or 1) of the given block with the highest save
+ * counter that passes its checksum, or -1 if neither does.
+ */
+static int _pksav_gen4_find_newest_copy(
+    const uint8_t* buffer,
+    const pksav_gen4_layout_t* layout,
+    pksav_gen4_block_t block
+) {
+    size_t block_size = _pksav_gen4_block_size(layout, block);
+    int newest = -1;
+    uint32_t newest_counter = 0;
+
+    for(uint8_t copy = 0; copy < 2; ++copy) {
+        uint8_t* block_ptr = (uint8_t*)&buffer[_pksav_gen4_block_offset(layout, block, copy)];
+        if(_pksav_gen4_block_is_valid(block_ptr, block_size, layout)) {
+            uint32_t counter = pksav_littleendian32(*_pksav_gen4_block_counter(block_ptr, block_size, layout));
+            if((newest == -1) || (counter > newest_counter)) {
+                newest = copy;
+                newest_counter = counter;
+            }
+        }
+    }
+
+    return newest;
+}
+
+pksav_error_t pksav_buffer_is_gen4_save(
+    const uint8_t* buffer,
+    size_t buffer_len,
+    pksav_gen4_game_t gen4_game,
+    bool* result_out
+) {
+    if(!buffer || !result_out) {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+
+    if(buffer_len < PKSAV_GEN4_SAVE_SIZE || gen4_game > PKSAV_GEN4_HGSS) {
+        *result_out = false;
+        return PKSAV_ERROR_NONE;
+    }
+
+    const pksav_gen4_layout_t* layout = &pksav_gen4_layouts[gen4_game];
+    *result_out = (_pksav_gen4_find_newest_copy(buffer, layout, PKSAV_GEN4_GENERAL_BLOCK) != -1) &&
+                  (_pksav_gen4_find_newest_copy(buffer, layout, PKSAV_GEN4_STORAGE_BLOCK) != -1);
+
+    return PKSAV_ERROR_NONE;
+}
+
+pksav_error_t pksav_file_is_gen4_save(
+    const char* filepath,
+    pksav_gen4_game_t gen4_game,
+    bool* result_out
+) {
+    if(!filepath || !result_out) {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+
+    FILE* gen4_save = fopen(filepath, "rb");
+    if(!gen4_save) {
+        *result_out = false;
+        return PKSAV_ERROR_FILE_IO;
+    }
+
+    fseek(gen4_save, 0, SEEK_END);
+    size_t filesize = ftell(gen4_save);
+
+    if(filesize < PKSAV_GEN4_SAVE_SIZE) {
+        fclose(gen4_save);
+        *result_out = false;
+        return PKSAV_ERROR_NONE;
+    }
+
+    uint8_t* gen4_save_data = _pksav_calloc(filesize, 1);
+    fseek(gen4_save, 0, SEEK_SET);
+    size_t num_read = fread((void*)gen4_save_data, 1, filesize, gen4_save);
+    fclose(gen4_save);
+
+    bool ret = false;
+    if(num_read == filesize) {
+        pksav_buffer_is_gen4_save(
+            gen4_save_data,
+            filesize,
+            gen4_game,
+            &ret
+        );
+    }
+
+    _pksav_free(gen4_save_data);
+    *result_out = ret;
+    return PKSAV_ERROR_NONE;
+}
+
+static void _pksav_gen4_save_set_pointers(
+    pksav_gen4_save_t* gen4_save
+) {
+    const pksav_gen4_layout_t* layout = &pksav_gen4_layouts[gen4_save->gen4_game];
+
+    uint8_t* general = &gen4_save->raw[_pksav_gen4_block_offset(
+                                           layout,
+                                           PKSAV_GEN4_GENERAL_BLOCK,
+                                           gen4_save->general_copy
+                                       )];
+    uint8_t* storage = &gen4_save->raw[_pksav_gen4_block_offset(
+                                           layout,
+                                           PKSAV_GEN4_STORAGE_BLOCK,
+                                           gen4_save->storage_copy
+                                       )];
+
+    gen4_save->trainer_info = (pksav_gen4_trainer_info_t*)&general[layout->trainer_info_offset];
+    gen4_save->pokemon_party = (pksav_gen4_pokemon_party_t*)&general[layout->party_offset];
+    for(size_t i = 0; i < PKSAV_GEN4_NUM_POKEMON_BOXES; ++i) {
+        gen4_save->pokemon_boxes[i] = (pksav_gen4_pokemon_box_t*)&storage[layout->boxes_offset +
+                                                                          (i * layout->box_stride)];
+    }
+}
+
+// Validates the save in gen4_save->raw and sets its pointers, freeing it on failure.
+static pksav_error_t _pksav_gen4_save_load_raw(
+    pksav_gen4_save_t* gen4_save
+) {
+    // Detect what kind of save this is
+    bool found = false;
+    for(pksav_gen4_game_t i = PKSAV_GEN4_DP; i <= PKSAV_GEN4_HGSS; ++i) {
+        const pksav_gen4_layout_t* layout = &pksav_gen4_layouts[i];
+        int general_copy = _pksav_gen4_find_newest_copy(gen4_save->raw, layout, PKSAV_GEN4_GENERAL_BLOCK);
+        int storage_copy = _pksav_gen4_find_newest_copy(gen4_save->raw, layout, PKSAV_GEN4_STORAGE_BLOCK);
+        if((general_copy != -1) && (storage_copy != -1)) {
+            gen4_save->gen4_game = i;
+            gen4_save->general_copy = (uint8_t)general_copy;
+            gen4_save->storage_copy = (uint8_t)storage_copy;
+            found = true;
+            break;
+        }
+    }
+
+    if(!found) {
+        _pksav_free(gen4_save->raw);
+        return PKSAV_ERROR_INVALID_SAVE;
+    }
+
+    /*
+     * Keep a copy of each active block as loaded, so saving can tell which
+     * ones were modified and only re-checksum those.
+     */
+    const pksav_gen4_layout_t* layout = &pksav_gen4_layouts[gen4_save->gen4_game];
+    gen4_save->general_snapshot = _pksav_calloc(layout->general_size, 1);
+    memcpy(
+        gen4_save->general_snapshot,
+        &gen4_save->raw[_pksav_gen4_block_offset(layout, PKSAV_GEN4_GENERAL_BLOCK, gen4_save->general_copy)],
+        layout->general_size
+    );
+    gen4_save->storage_snapshot = _pksav_calloc(layout->storage_size, 1);
+    memcpy(
+        gen4_save->storage_snapshot,
+        &gen4_save->raw[_pksav_gen4_block_offset(layout, PKSAV_GEN4_STORAGE_BLOCK, gen4_save->storage_copy)],
+        layout->storage_size
+    );
+
+    _pksav_gen4_save_set_pointers(
+        gen4_save
+    );
+
+    return PKSAV_ERROR_NONE;
+}
+
+pksav_error_t pksav_gen4_save_load(
+    const char* filepath,
+    pksav_gen4_save_t* gen4_save
+) {
+    if(!filepath || !gen4_save) {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+
+    // Read the file and make sure it's valid
+    FILE* gen4_save_file = fopen(filepath, "rb");
+    if(!gen4_save_file) {
+        return PKSAV_ERROR_FILE_IO;
+    }
+
+    fseek(gen4_save_file, 0, SEEK_END);
+    size_t filesize = ftell(gen4_save_file);
+
+    if(filesize < PKSAV_GEN4_SAVE_SIZE) {
+        fclose(gen4_save_file);
+        return PKSAV_ERROR_INVALID_SAVE;
+    }
+
+    // Emulator saves can have trailing data, which is preserved.
+    gen4_save->raw = _pksav_calloc(filesize, 1);
+    fseek(gen4_save_file, 0, SEEK_SET);
+    size_t num_read = fread((void*)gen4_save->raw, 1, filesize, gen4_save_file);
+    fclose(gen4_save_file);
+    if(num_read != filesize) {
+        _pksav_free(gen4_save->raw);
+        return PKSAV_ERROR_FILE_IO;
+    }
+    gen4_save->raw_size = filesize;
+
+    return _pksav_gen4_save_load_raw(
+               gen4_save
+           );
+}
+
+pksav_error_t pksav_gen4_save_load_buffer(
+    const uint8_t* buffer,
+    size_t buffer_len,
+    pksav_gen4_save_t* gen4_save
+) {
+    if(!buffer || !gen4_save) {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+    if(buffer_len < PKSAV_GEN4_SAVE_SIZE) {
+        return PKSAV_ERROR_INVALID_SAVE;
+    }
+
+    gen4_save->raw = _pksav_calloc(buffer_len, 1);
+    memcpy(gen4_save->raw, buffer, buffer_len);
+    gen4_save->raw_size = buffer_len;
+
+    return _pksav_gen4_save_load_raw(
+               gen4_save
+           );
+}
+
+/*
+ * If the active copy of the given block was modified, bump its counter,
+ * checksum it, and move it into the other copy's place. The active copy
+ * is restored from the snapshot so the previous save stays intact.
+ */
+static void _pksav_gen4_save_commit_block(
+    pksav_gen4_save_t* gen4_save,
+    pksav_gen4_block_t block,
+    uint8_t* copy,
+    uint8_t* snapshot
+) {
+    const pksav_gen4_layout_t* layout = &pksav_gen4_layouts[gen4_save->gen4_game];
+    size_t block_size = _pksav_gen4_block_size(layout, block);
+
+    uint8_t* active = &gen4_save->raw[_pksav_gen4_block_offset(layout, block, *copy)];
+    if(!memcmp(active, snapshot, block_size)) {
+        return;
+    }
+
+    uint8_t* other = &gen4_save->raw[_pksav_gen4_block_offset(layout, block, !(*copy))];
+
+    uint32_t* counter = _pksav_gen4_block_counter(active, block_size, layout);
+    *counter = pksav_littleendian32(pksav_littleendian32(*counter) + 1);
+    *_pksav_gen4_block_checksum(active, block_size) = pksav_littleendian16(
+                                                          pksav_crc16_ccitt(
+                                                              active,
+                                                              block_size - layout->footer_size
+                                                          )
+                                                      );
+
+    memcpy(other, active, block_size);
+    memcpy(active, snapshot, block_size);
+    memcpy(snapshot, other, block_size);
+    *copy = !(*copy);
+}
+
+pksav_error_t pksav_gen4_save_save(
+    const char* filepath,
+    pksav_gen4_save_t* gen4_save
+) {
+    if(!filepath || !gen4_save) {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+
+    // Make sure we can write to this file
+    FILE* gen4_save_file = fopen(filepath, "wb");
+    if(!gen4_save_file) {
+        return PKSAV_ERROR_FILE_IO;
+    }
+
+    _pksav_gen4_save_commit_block(
+        gen4_save,
+        PKSAV_GEN4_GENERAL_BLOCK,
+        &gen4_save->general_copy,
+        gen4_save->general_snapshot
+    );
+    _pksav_gen4_save_commit_block(
+        gen4_save,
+        PKSAV_GEN4_STORAGE_BLOCK,
+        &gen4_save->storage_copy,
+        gen4_save->storage_snapshot
+    );
+    _pksav_gen4_save_set_pointers(
+        gen4_save
+    );
+
+    // Write to file
+    fwrite(
+        (void*)gen4_save->raw,
+        1,
+        gen4_save->raw_size,
+        gen4_save_file
+    );
+
+    fclose(gen4_save_file);
+
+    return PKSAV_ERROR_NONE;
+}
+
+pksav_error_t pksav_gen4_save_free(
+    pksav_gen4_save_t* gen4_save
+) {
+    if(!gen4_save) {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+
+    _pksav_free(gen4_save->general_snapshot);
+    _pksav_free(gen4_save->storage_snapshot);
+    _pksav_free(gen4_save->raw);
+
+    return PKSAV_ERROR_NONE;
+}
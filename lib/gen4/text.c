@@ -6,12 +6,14 @@
  */
 
 #include "../common/text_common.h"
+#include "../common/thread.h"
 
 #include <pksav/gen4/text.h>
 
 #include <string.h>
 
 #define PKSAV_GEN4_TERMINATOR 0xFFFF
+#define PKSAV_GEN4_MAP2_START 0x0400
 
 /*
  * Character map for Generation IV
@@ -206,6 +208,97 @@ static const wchar_t pksav_gen4_char_map2[] = {
     0xC330,0xC3BC,0xC4D4,0xCB2C,
 };
 
+#define PKSAV_GEN4_MAP1_SIZE (sizeof(pksav_gen4_char_map1)/sizeof(pksav_gen4_char_map1[0]))
+#define PKSAV_GEN4_MAP2_SIZE (sizeof(pksav_gen4_char_map2)/sizeof(pksav_gen4_char_map2[0]))
+
+/*
+ * Reverse lookup from a code point in the Basic Multilingual Plane to its
+ * Generation IV value, so encoding doesn't need to scan both character maps
+ * for every character. Unmappable code points hold the terminator value.
+ *
+ * This is built the first time it is needed.
+ */
+static uint16_t pksav_gen4_reverse_map[0x10000];
+static pksav_once_t pksav_gen4_reverse_map_once = PKSAV_ONCE_INIT;
+
+static void _pksav_gen4_build_reverse_map(void) {
+    memset(pksav_gen4_reverse_map, 0xFF, sizeof(pksav_gen4_reverse_map));
+
+    // Iterate backwards so that the first occurrence of a duplicate wins.
+    for(size_t i = PKSAV_GEN4_MAP2_SIZE; i > 0; --i) {
+        if(pksav_gen4_char_map2[i-1] != 0) {
+            pksav_gen4_reverse_map[pksav_gen4_char_map2[i-1]] = (uint16_t)(PKSAV_GEN4_MAP2_START + i - 1);
+        }
+    }
+    for(size_t i = PKSAV_GEN4_MAP1_SIZE; i > 0; --i) {
+        if(pksav_gen4_char_map1[i-1] != 0) {
+            pksav_gen4_reverse_map[pksav_gen4_char_map1[i-1]] = (uint16_t)(i - 1);
+        }
+    }
+}
+
+static PKSAV_INLINE const uint16_t* _pksav_gen4_get_reverse_map(void) {
+    _pksav_call_once(&pksav_gen4_reverse_map_once, _pksav_gen4_build_reverse_map);
+    return pksav_gen4_reverse_map;
+}
+
+// Returns 0 for values with no Unicode equivalent.
+static PKSAV_INLINE uint32_t _pksav_gen4_char_to_code_point(
+    uint16_t gen4_char
+) {
+    if(gen4_char < PKSAV_GEN4_MAP1_SIZE) {
+        return (uint32_t)pksav_gen4_char_map1[gen4_char];
+    } else if((gen4_char >= PKSAV_GEN4_MAP2_START) &&
+              ((size_t)(gen4_char - PKSAV_GEN4_MAP2_START) < PKSAV_GEN4_MAP2_SIZE)) {
+        return (uint32_t)pksav_gen4_char_map2[gen4_char - PKSAV_GEN4_MAP2_START];
+    } else {
+        return 0;
+    }
+}
+
+static PKSAV_INLINE uint16_t _pksav_gen4_code_point_to_char(
+    const uint16_t* reverse_map,
+    uint32_t code_point
+) {
+    return (code_point < 0x10000) ? reverse_map[code_point]
+                                  : PKSAV_GEN4_TERMINATOR;
+}
+
+/*
+ * Decodes a run of characters straight into UTF-8, stopping at the
+ * terminator, at num_chars, or when the output buffer is full. If
+ * null_terminate is set, the output is always null-terminated if
+ * output_len > 0. Otherwise, characters can fill the whole buffer, and the
+ * terminator is only added if there's room for it.
+ */
+static size_t _pksav_gen4_to_utf8(
+    const uint16_t* input_buffer,
+    size_t num_chars,
+    char* output_text,
+    size_t output_len,
+    bool null_terminate
+) {
+    size_t capacity = null_terminate ? output_len : (output_len + 1);
+    size_t pos = 0;
+
+    for(size_t i = 0; i < num_chars; ++i) {
+        if(input_buffer[i] == PKSAV_GEN4_TERMINATOR) {
+            break;
+        }
+
+        uint32_t code_point = _pksav_gen4_char_to_code_point(input_buffer[i]);
+        if((code_point != 0) &&
+           !pksav_utf8_append(code_point, output_text, capacity, &pos)) {
+            break;
+        }
+    }
+    if(pos < output_len) {
+        output_text[pos] = '\0';
+    }
+
+    return pos;
+}
+
 pksav_error_t pksav_text_from_gen4(
     const uint16_t* input_buffer,
     char* output_text,
@@ -215,14 +308,61 @@ pksav_error_t pksav_text_from_gen4(
         return PKSAV_ERROR_NULL_POINTER;
     }
 
-    wchar_t* widetext = calloc(num_chars, sizeof(wchar_t));
-    pksav_widetext_from_gen4(
-        input_buffer, widetext, num_chars
-    );
-
+    // As with wcstombs, a string that fills the buffer isn't null-terminated.
     memset(output_text, 0, num_chars);
-    wcstombs(output_text, widetext, num_chars);
-    free(widetext);
+    (void)_pksav_gen4_to_utf8(
+              input_buffer, num_chars, output_text, num_chars, false
+          );
+
+    return PKSAV_ERROR_NONE;
+}
+
+pksav_error_t pksav_text_from_gen4_utf8(
+    const uint16_t* input_buffer,
+    size_t num_chars,
+    char* output_text,
+    size_t output_len,
+    size_t* num_bytes_out
+) {
+    if(!input_buffer || !output_text) {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+
+    size_t num_bytes = _pksav_gen4_to_utf8(
+                           input_buffer, num_chars, output_text, output_len, true
+                       );
+    if(num_bytes_out) {
+        *num_bytes_out = num_bytes;
+    }
+
+    return PKSAV_ERROR_NONE;
+}
+
+pksav_error_t pksav_text_from_gen4_batch(
+    const uint16_t* input_records,
+    size_t record_stride,
+    size_t num_chars,
+    size_t num_records,
+    char* output_text,
+    size_t output_stride
+) {
+    if(!input_records || !output_text) {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+
+    const uint8_t* record = (const uint8_t*)input_records;
+    for(size_t i = 0; i < num_records; ++i) {
+        (void)_pksav_gen4_to_utf8(
+                  (const uint16_t*)record,
+                  num_chars,
+                  output_text,
+                  output_stride,
+                  true
+              );
+
+        record += record_stride;
+        output_text += output_stride;
+    }
 
     return PKSAV_ERROR_NONE;
 }
@@ -236,15 +376,20 @@ pksav_error_t pksav_widetext_from_gen4(
         return PKSAV_ERROR_NULL_POINTER;
     }
 
-    memset(output_text, 0, sizeof(wchar_t)*num_chars);
-
+    size_t pos = 0;
     for(size_t i = 0; i < num_chars; ++i) {
-        if(input_buffer[i] < 0x400) {
-            output_text[i] = pksav_gen4_char_map1[input_buffer[i]];
-        } else {
-            output_text[i] = pksav_gen4_char_map2[input_buffer[i]];
+        if(input_buffer[i] == PKSAV_GEN4_TERMINATOR) {
+            break;
+        }
+
+        uint32_t code_point = _pksav_gen4_char_to_code_point(input_buffer[i]);
+        if(code_point != 0) {
+            output_text[pos++] = (wchar_t)code_point;
         }
     }
+    if(pos < num_chars) {
+        output_text[pos] = 0;
+    }
 
     return PKSAV_ERROR_NONE;
 }
@@ -258,14 +403,23 @@ pksav_error_t pksav_text_to_gen4(
         return PKSAV_ERROR_NULL_POINTER;
     }
 
-    wchar_t* widetext = calloc(num_chars, sizeof(wchar_t));
-    mbstowcs(widetext, input_text, num_chars);
+    const uint16_t* reverse_map = _pksav_gen4_get_reverse_map();
 
-    pksav_widetext_to_gen4(
-        widetext, output_buffer, num_chars
-    );
+    size_t pos = 0;
+    uint32_t code_point = 0;
+    size_t num_bytes = 0;
+    while((pos < num_chars) && (num_bytes = pksav_utf8_decode(input_text, &code_point)) > 0) {
+        uint16_t gen4_char = _pksav_gen4_code_point_to_char(reverse_map, code_point);
+        if(gen4_char == PKSAV_GEN4_TERMINATOR) {
+            break;
+        }
 
-    free(widetext);
+        output_buffer[pos++] = gen4_char;
+        input_text += num_bytes;
+    }
+    if(pos < num_chars) {
+        output_buffer[pos] = PKSAV_GEN4_TERMINATOR;
+    }
 
     return PKSAV_ERROR_NONE;
 }
@@ -279,15 +433,21 @@ pksav_error_t pksav_widetext_to_gen4(
         return PKSAV_ERROR_NULL_POINTER;
     }
 
-    memset(output_buffer, 0xFF, sizeof(wchar_t)*num_chars);
+    const uint16_t* reverse_map = _pksav_gen4_get_reverse_map();
 
-    for(size_t i = 0; i < num_chars; ++i) {
-        ssize_t index = wchar_map_index(pksav_gen4_char_map2, 485, input_text[i]);
-        if(index == -1) {
+    size_t pos = 0;
+    for(; (pos < num_chars) && (input_text[pos] != 0); ++pos) {
+        uint16_t gen4_char = _pksav_gen4_code_point_to_char(
+                                 reverse_map, (uint32_t)input_text[pos]
+                             );
+        if(gen4_char == PKSAV_GEN4_TERMINATOR) {
             break;
-        } else {
-            output_buffer[i] = (uint16_t)index;
         }
+
+        output_buffer[pos] = gen4_char;
+    }
+    if(pos < num_chars) {
+        output_buffer[pos] = PKSAV_GEN4_TERMINATOR;
     }
 
     return PKSAV_ERROR_NONE;
@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) 2018 Nicholas Corgan (n.corgan@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "../common/pokemon_record.h"
+
+#include <pksav/gen5/pokemon_record.h>
+
+#include <pksav/math/endian.h>
+
+pksav_error_t pksav_gen5_box_to_records(
+    const pksav_gen5_pokemon_box_t* box,
+    pksav_pokemon_record_t* records_out,
+    size_t* num_records_out
+) {
+    if(!box || !records_out || !num_records_out) {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+
+    size_t num_records = 0;
+    for(size_t i = 0; i < 30; ++i) {
+        if(box->entries[i].blocks.blockA.species) {
+            _pksav_nds_pc_pokemon_to_record(
+                &box->entries[i],
+                5,
+                &records_out[num_records++]
+            );
+        }
+    }
+    *num_records_out = num_records;
+
+    return PKSAV_ERROR_NONE;
+}
+
+pksav_error_t pksav_gen5_party_to_records(
+    const pksav_gen5_pokemon_party_t* party,
+    pksav_pokemon_record_t* records_out,
+    size_t* num_records_out
+) {
+    if(!party || !records_out || !num_records_out) {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+
+    uint32_t count = pksav_littleendian32(party->count);
+    if(count > 6) {
+        return PKSAV_ERROR_PARAM_OUT_OF_RANGE;
+    }
+
+    for(uint32_t i = 0; i < count; ++i) {
+        _pksav_nds_pc_pokemon_to_record(
+            &party->party[i].pc,
+            5,
+            &records_out[i]
+        );
+        records_out[i].level = party->party[i].party_data.level;
+    }
+    *num_records_out = count;
+
+    return PKSAV_ERROR_NONE;
+}
@@ -0,0 +1,512 @@
+/*
+ * Copyright (c) 2018 Nicholas Corgan (n.corgan@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "../common/allocator.h"
+#include "../common/crc16.h"
+#include "../common/nds_crypt.h"
+
+#include <pksav/config.h>
+
+#include <pksav/gen5/save.h>
+
+#include <pksav/math/endian.h>
+
+#include <stdio.h>
+#include <string.h>
+
+#define PKSAV_GEN5_SAVE_SIZE 0x80000
+
+#define PKSAV_GEN5_BOX_BLOCK_INDEX     1
+#define PKSAV_GEN5_BOXES_OFFSET        0x400
+#define PKSAV_GEN5_BOX_STRIDE          0x1000
+#define PKSAV_GEN5_PARTY_BLOCK_INDEX   26
+#define PKSAV_GEN5_PARTY_OFFSET        0x18E00
+#define PKSAV_GEN5_PARTY_SIZE          0x534
+#define PKSAV_GEN5_TRAINER_BLOCK_INDEX 27
+#define PKSAV_GEN5_TRAINER_OFFSET      0x19400
+
+// The party count comes before the party itself.
+#define PKSAV_GEN5_PARTY_DATA_OFFSET   0x4
+#define PKSAV_GEN5_PARTY_DATA_NUM_WORDS (sizeof(pksav_gen5_pokemon_party_data_t) / 2)
+
+/*
+ * Every block is followed by its CRC16 two bytes after its end, and the
+ * same CRC is mirrored in the checksum table, which has a CRC of its own.
+ */
+typedef struct {
+    size_t table_offset;
+    size_t table_size;
+    size_t table_checksum_offset;
+    size_t trainer_info_size;
+} pksav_gen5_layout_t;
+
+static const pksav_gen5_layout_t pksav_gen5_layouts[] = {
+    // Black/White
+    {0x23F00, 0x8C, 0x23F9A, 0x68},
+    // Black 2/White 2
+    {0x25F00, 0x94, 0x25FA2, 0xB0}
+};
+
+static PKSAV_INLINE uint16_t _pksav_gen5_read16(
+    const uint8_t* buffer,
+    size_t offset
+) {
+    return (uint16_t)(buffer[offset] | (buffer[offset+1] << 8));
+}
+
+static PKSAV_INLINE void _pksav_gen5_write16(
+    uint8_t* buffer,
+    size_t offset,
+    uint16_t value
+) {
+    buffer[offset]   = (uint8_t)(value & 0xFF);
+    buffer[offset+1] = (uint8_t)(value >> 8);
+}
+
+static bool _pksav_gen5_block_is_valid(
+    const uint8_t* buffer,
+    const pksav_gen5_layout_t* layout,
+    size_t block_index,
+    size_t block_offset,
+    size_t block_size
+) {
+    uint16_t checksum = pksav_crc16_ccitt(&buffer[block_offset], block_size);
+
+    return (_pksav_gen5_read16(buffer, block_offset + block_size + 2) == checksum) &&
+           (_pksav_gen5_read16(buffer, layout->table_offset + (2 * block_index)) == checksum);
+}
+
+static void _pksav_gen5_update_block_checksum(
+    uint8_t* buffer,
+    const pksav_gen5_layout_t* layout,
+    size_t block_index,
+    size_t block_offset,
+    size_t block_size
+) {
+    uint16_t checksum = pksav_crc16_ccitt(&buffer[block_offset], block_size);
+
+    _pksav_gen5_write16(buffer, block_offset + block_size + 2, checksum);
+    _pksav_gen5_write16(buffer, layout->table_offset + (2 * block_index), checksum);
+}
+
+static PKSAV_INLINE size_t _pksav_gen5_box_offset(
+    size_t box_num
+) {
+    return PKSAV_GEN5_BOXES_OFFSET + (box_num * PKSAV_GEN5_BOX_STRIDE);
+}
+
+/*
+ * Only the blocks pksav exposes are validated, since the layout of the
+ * others differs between versions and isn't needed here.
+ */
+static bool _pksav_gen5_buffer_is_valid(
+    const uint8_t* buffer,
+    const pksav_gen5_layout_t* layout
+) {
+    uint16_t table_checksum = pksav_crc16_ccitt(&buffer[layout->table_offset], layout->table_size);
+    if(_pksav_gen5_read16(buffer, layout->table_checksum_offset) != table_checksum) {
+        return false;
+    }
+
+    for(size_t i = 0; i < PKSAV_GEN5_NUM_POKEMON_BOXES; ++i) {
+        if(!_pksav_gen5_block_is_valid(
+                buffer,
+                layout,
+                PKSAV_GEN5_BOX_BLOCK_INDEX + i,
+                _pksav_gen5_box_offset(i),
+                sizeof(pksav_gen5_pokemon_box_t)
+           )) {
+            return false;
+        }
+    }
+
+    return _pksav_gen5_block_is_valid(
+               buffer,
+               layout,
+               PKSAV_GEN5_PARTY_BLOCK_INDEX,
+               PKSAV_GEN5_PARTY_OFFSET,
+               PKSAV_GEN5_PARTY_SIZE
+           ) &&
+           _pksav_gen5_block_is_valid(
+               buffer,
+               layout,
+               PKSAV_GEN5_TRAINER_BLOCK_INDEX,
+               PKSAV_GEN5_TRAINER_OFFSET,
+               layout->trainer_info_size
+           );
+}
+
+static PKSAV_INLINE bool _pksav_gen5_is_empty(
+    const void* data,
+    size_t len
+) {
+    const uint8_t* bytes = (const uint8_t*)data;
+    for(size_t i = 0; i < len; ++i) {
+        if(bytes[i]) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/*
+ * Empty slots are stored as all zeroes rather than encrypted, so they're
+ * left alone in both directions.
+ */
+static void _pksav_gen5_crypt_box(
+    pksav_gen5_pokemon_box_t* box,
+    bool encrypt
+) {
+    for(size_t i = 0; i < 30; ++i) {
+        if(!_pksav_gen5_is_empty(&box->entries[i], sizeof(box->entries[i]))) {
+            _pksav_nds_crypt_pc_pokemon(&box->entries[i], encrypt);
+        }
+    }
+}
+
+static void _pksav_gen5_crypt_party(
+    pksav_gen5_pokemon_party_t* party,
+    bool encrypt
+) {
+    for(size_t i = 0; i < 6; ++i) {
+        pksav_gen5_party_pokemon_t* party_pokemon = &party->party[i];
+        if(_pksav_gen5_is_empty(party_pokemon, sizeof(*party_pokemon))) {
+            continue;
+        }
+
+        // The party data is keyed on the personality, which the PC data encryption leaves alone.
+        _pksav_nds_crypt_pc_pokemon(&party_pokemon->pc, encrypt);
+        _pksav_nds_crypt_words(
+            (uint8_t*)&party_pokemon->party_data,
+            PKSAV_GEN5_PARTY_DATA_NUM_WORDS,
+            pksav_littleendian32(party_pokemon->pc.personality)
+        );
+    }
+}
+
+pksav_error_t pksav_buffer_is_gen5_save(
+    const uint8_t* buffer,
+    size_t buffer_len,
+    pksav_gen5_game_t gen5_game,
+    bool* result_out
+) {
+    if(!buffer || !result_out) {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+
+    if(buffer_len < PKSAV_GEN5_SAVE_SIZE || gen5_game > PKSAV_GEN5_B2W2) {
+        *result_out = false;
+        return PKSAV_ERROR_NONE;
+    }
+
+    *result_out = _pksav_gen5_buffer_is_valid(buffer, &pksav_gen5_layouts[gen5_game]);
+
+    return PKSAV_ERROR_NONE;
+}
+
+pksav_error_t pksav_file_is_gen5_save(
+    const char* filepath,
+    pksav_gen5_game_t gen5_game,
+    bool* result_out
+) {
+    if(!filepath || !result_out) {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+
+    FILE* gen5_save = fopen(filepath, "rb");
+    if(!gen5_save) {
+        *result_out = false;
+        return PKSAV_ERROR_FILE_IO;
+    }
+
+    fseek(gen5_save, 0, SEEK_END);
+    size_t filesize = ftell(gen5_save);
+
+    if(filesize < PKSAV_GEN5_SAVE_SIZE) {
+        fclose(gen5_save);
+        *result_out = false;
+        return PKSAV_ERROR_NONE;
+    }
+
+    uint8_t* gen5_save_data = _pksav_calloc(filesize, 1);
+    fseek(gen5_save, 0, SEEK_SET);
+    size_t num_read = fread((void*)gen5_save_data, 1, filesize, gen5_save);
+    fclose(gen5_save);
+
+    bool ret = false;
+    if(num_read == filesize) {
+        pksav_buffer_is_gen5_save(
+            gen5_save_data,
+            filesize,
+            gen5_game,
+            &ret
+        );
+    }
+
+    _pksav_free(gen5_save_data);
+    *result_out = ret;
+    return PKSAV_ERROR_NONE;
+}
+
+// Validates the save in gen5_save->raw and sets its pointers, freeing it on failure.
+static pksav_error_t _pksav_gen5_save_load_raw(
+    pksav_gen5_save_t* gen5_save
+) {
+    // Detect what kind of save this is
+    bool found = false;
+    for(pksav_gen5_game_t i = PKSAV_GEN5_BW; i <= PKSAV_GEN5_B2W2; ++i) {
+        if(_pksav_gen5_buffer_is_valid(gen5_save->raw, &pksav_gen5_layouts[i])) {
+            gen5_save->gen5_game = i;
+            found = true;
+            break;
+        }
+    }
+
+    if(!found) {
+        _pksav_free(gen5_save->raw);
+        return PKSAV_ERROR_INVALID_SAVE;
+    }
+
+    gen5_save->trainer_info = (pksav_gen5_trainer_info_t*)&gen5_save->raw[PKSAV_GEN5_TRAINER_OFFSET];
+    gen5_save->trainer_info_snapshot = _pksav_calloc(sizeof(pksav_gen5_trainer_info_t), 1);
+    memcpy(gen5_save->trainer_info_snapshot, gen5_save->trainer_info, sizeof(pksav_gen5_trainer_info_t));
+
+    /*
+     * The party is small enough to decrypt up front. A copy of it as
+     * loaded tells saving whether it needs to be re-encrypted.
+     */
+    gen5_save->pokemon_party = _pksav_calloc(sizeof(pksav_gen5_pokemon_party_t), 1);
+    memcpy(
+        gen5_save->pokemon_party,
+        &gen5_save->raw[PKSAV_GEN5_PARTY_OFFSET + PKSAV_GEN5_PARTY_DATA_OFFSET],
+        sizeof(pksav_gen5_pokemon_party_t)
+    );
+    _pksav_gen5_crypt_party(gen5_save->pokemon_party, false);
+    gen5_save->party_snapshot = _pksav_calloc(sizeof(pksav_gen5_pokemon_party_t), 1);
+    memcpy(gen5_save->party_snapshot, gen5_save->pokemon_party, sizeof(pksav_gen5_pokemon_party_t));
+
+    // Boxes are decrypted on first access.
+    for(size_t i = 0; i < PKSAV_GEN5_NUM_POKEMON_BOXES; ++i) {
+        gen5_save->pokemon_boxes[i] = NULL;
+    }
+    gen5_save->dirty_boxes = 0;
+
+    return PKSAV_ERROR_NONE;
+}
+
+pksav_error_t pksav_gen5_save_load(
+    const char* filepath,
+    pksav_gen5_save_t* gen5_save
+) {
+    if(!filepath || !gen5_save) {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+
+    // Read the file and make sure it's valid
+    FILE* gen5_save_file = fopen(filepath, "rb");
+    if(!gen5_save_file) {
+        return PKSAV_ERROR_FILE_IO;
+    }
+
+    fseek(gen5_save_file, 0, SEEK_END);
+    size_t filesize = ftell(gen5_save_file);
+
+    if(filesize < PKSAV_GEN5_SAVE_SIZE) {
+        fclose(gen5_save_file);
+        return PKSAV_ERROR_INVALID_SAVE;
+    }
+
+    // Emulator saves can have trailing data, which is preserved.
+    gen5_save->raw = _pksav_calloc(filesize, 1);
+    fseek(gen5_save_file, 0, SEEK_SET);
+    size_t num_read = fread((void*)gen5_save->raw, 1, filesize, gen5_save_file);
+    fclose(gen5_save_file);
+    if(num_read != filesize) {
+        _pksav_free(gen5_save->raw);
+        return PKSAV_ERROR_FILE_IO;
+    }
+    gen5_save->raw_size = filesize;
+
+    return _pksav_gen5_save_load_raw(
+               gen5_save
+           );
+}
+
+pksav_error_t pksav_gen5_save_load_buffer(
+    const uint8_t* buffer,
+    size_t buffer_len,
+    pksav_gen5_save_t* gen5_save
+) {
+    if(!buffer || !gen5_save) {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+    if(buffer_len < PKSAV_GEN5_SAVE_SIZE) {
+        return PKSAV_ERROR_INVALID_SAVE;
+    }
+
+    gen5_save->raw = _pksav_calloc(buffer_len, 1);
+    memcpy(gen5_save->raw, buffer, buffer_len);
+    gen5_save->raw_size = buffer_len;
+
+    return _pksav_gen5_save_load_raw(
+               gen5_save
+           );
+}
+
+static pksav_gen5_pokemon_box_t* _pksav_gen5_save_get_box(
+    pksav_gen5_save_t* gen5_save,
+    uint8_t box_num
+) {
+    if(!gen5_save->pokemon_boxes[box_num]) {
+        pksav_gen5_pokemon_box_t* box = _pksav_calloc(sizeof(pksav_gen5_pokemon_box_t), 1);
+        memcpy(box, &gen5_save->raw[_pksav_gen5_box_offset(box_num)], sizeof(*box));
+        _pksav_gen5_crypt_box(box, false);
+
+        gen5_save->pokemon_boxes[box_num] = box;
+    }
+
+    return gen5_save->pokemon_boxes[box_num];
+}
+
+pksav_error_t pksav_gen5_save_get_pokemon_box(
+    pksav_gen5_save_t* gen5_save,
+    uint8_t box_num,
+    const pksav_gen5_pokemon_box_t** box_out
+) {
+    if(!gen5_save || !box_out) {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+    if(box_num >= PKSAV_GEN5_NUM_POKEMON_BOXES) {
+        return PKSAV_ERROR_PARAM_OUT_OF_RANGE;
+    }
+
+    *box_out = _pksav_gen5_save_get_box(gen5_save, box_num);
+
+    return PKSAV_ERROR_NONE;
+}
+
+pksav_error_t pksav_gen5_save_edit_pokemon_box(
+    pksav_gen5_save_t* gen5_save,
+    uint8_t box_num,
+    pksav_gen5_pokemon_box_t** box_out
+) {
+    if(!gen5_save || !box_out) {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+    if(box_num >= PKSAV_GEN5_NUM_POKEMON_BOXES) {
+        return PKSAV_ERROR_PARAM_OUT_OF_RANGE;
+    }
+
+    *box_out = _pksav_gen5_save_get_box(gen5_save, box_num);
+    gen5_save->dirty_boxes |= (1U << box_num);
+
+    return PKSAV_ERROR_NONE;
+}
+
+pksav_error_t pksav_gen5_save_save(
+    const char* filepath,
+    pksav_gen5_save_t* gen5_save
+) {
+    if(!filepath || !gen5_save) {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+
+    // Make sure we can write to this file
+    FILE* gen5_save_file = fopen(filepath, "wb");
+    if(!gen5_save_file) {
+        return PKSAV_ERROR_FILE_IO;
+    }
+
+    const pksav_gen5_layout_t* layout = &pksav_gen5_layouts[gen5_save->gen5_game];
+    bool table_changed = false;
+
+    // Re-encrypt and re-checksum only what was modified.
+    for(uint8_t i = 0; i < PKSAV_GEN5_NUM_POKEMON_BOXES; ++i) {
+        if(gen5_save->dirty_boxes & (1U << i)) {
+            uint8_t* box = &gen5_save->raw[_pksav_gen5_box_offset(i)];
+            memcpy(box, gen5_save->pokemon_boxes[i], sizeof(pksav_gen5_pokemon_box_t));
+            _pksav_gen5_crypt_box((pksav_gen5_pokemon_box_t*)box, true);
+
+            _pksav_gen5_update_block_checksum(
+                gen5_save->raw,
+                layout,
+                PKSAV_GEN5_BOX_BLOCK_INDEX + i,
+                _pksav_gen5_box_offset(i),
+                sizeof(pksav_gen5_pokemon_box_t)
+            );
+            table_changed = true;
+        }
+    }
+    gen5_save->dirty_boxes = 0;
+
+    if(memcmp(gen5_save->pokemon_party, gen5_save->party_snapshot, sizeof(pksav_gen5_pokemon_party_t))) {
+        uint8_t* party = &gen5_save->raw[PKSAV_GEN5_PARTY_OFFSET + PKSAV_GEN5_PARTY_DATA_OFFSET];
+        memcpy(party, gen5_save->pokemon_party, sizeof(pksav_gen5_pokemon_party_t));
+        _pksav_gen5_crypt_party((pksav_gen5_pokemon_party_t*)party, true);
+
+        _pksav_gen5_update_block_checksum(
+            gen5_save->raw,
+            layout,
+            PKSAV_GEN5_PARTY_BLOCK_INDEX,
+            PKSAV_GEN5_PARTY_OFFSET,
+            PKSAV_GEN5_PARTY_SIZE
+        );
+        memcpy(gen5_save->party_snapshot, gen5_save->pokemon_party, sizeof(pksav_gen5_pokemon_party_t));
+        table_changed = true;
+    }
+
+    if(memcmp(gen5_save->trainer_info, gen5_save->trainer_info_snapshot, sizeof(pksav_gen5_trainer_info_t))) {
+        _pksav_gen5_update_block_checksum(
+            gen5_save->raw,
+            layout,
+            PKSAV_GEN5_TRAINER_BLOCK_INDEX,
+            PKSAV_GEN5_TRAINER_OFFSET,
+            layout->trainer_info_size
+        );
+        memcpy(gen5_save->trainer_info_snapshot, gen5_save->trainer_info, sizeof(pksav_gen5_trainer_info_t));
+        table_changed = true;
+    }
+
+    if(table_changed) {
+        _pksav_gen5_write16(
+            gen5_save->raw,
+            layout->table_checksum_offset,
+            pksav_crc16_ccitt(&gen5_save->raw[layout->table_offset], layout->table_size)
+        );
+    }
+
+    // Write to file
+    fwrite(
+        (void*)gen5_save->raw,
+        1,
+        gen5_save->raw_size,
+        gen5_save_file
+    );
+
+    fclose(gen5_save_file);
+
+    return PKSAV_ERROR_NONE;
+}
+
+pksav_error_t pksav_gen5_save_free(
+    pksav_gen5_save_t* gen5_save
+) {
+    if(!gen5_save) {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+
+    for(size_t i = 0; i < PKSAV_GEN5_NUM_POKEMON_BOXES; ++i) {
+        _pksav_free(gen5_save->pokemon_boxes[i]);
+    }
+    _pksav_free(gen5_save->pokemon_party);
+    _pksav_free(gen5_save->party_snapshot);
+    _pksav_free(gen5_save->trainer_info_snapshot);
+    _pksav_free(gen5_save->raw);
+
+    return PKSAV_ERROR_NONE;
+}
@@ -21,6 +21,56 @@ pksav_error_t pksav_text_from_gen5(
             );
 }
 
+pksav_error_t pksav_text_from_gen5_utf8(
+    const uint16_t* input_buffer,
+    size_t num_chars,
+    char* output_text,
+    size_t output_len,
+    size_t* num_bytes_out
+) {
+    if(!input_buffer || !output_text) {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+
+    size_t num_bytes = _pksav_xds_to_utf8(
+                           input_buffer, num_chars, output_text, output_len, true
+                       );
+    if(num_bytes_out) {
+        *num_bytes_out = num_bytes;
+    }
+
+    return PKSAV_ERROR_NONE;
+}
+
+pksav_error_t pksav_text_from_gen5_batch(
+    const uint16_t* input_records,
+    size_t record_stride,
+    size_t num_chars,
+    size_t num_records,
+    char* output_text,
+    size_t output_stride
+) {
+    if(!input_records || !output_text) {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+
+    const uint8_t* record = (const uint8_t*)input_records;
+    for(size_t i = 0; i < num_records; ++i) {
+        (void)_pksav_xds_to_utf8(
+                  (const uint16_t*)record,
+                  num_chars,
+                  output_text,
+                  output_stride,
+                  true
+              );
+
+        record += record_stride;
+        output_text += output_stride;
+    }
+
+    return PKSAV_ERROR_NONE;
+}
+
 pksav_error_t pksav_widetext_from_gen5(
     const uint16_t* input_buffer,
     wchar_t* output_text,
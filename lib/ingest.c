@@ -0,0 +1,513 @@
+/*
+ * Copyright (c) 2018 Nicholas Corgan (n.corgan@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include <pksav/ingest.h>
+
+#include <stdio.h>
+#include <string.h>
+
+#ifdef PKSAV_ENABLE_IO_URING
+#include <linux/io_uring.h>
+
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#include <unistd.h>
+#endif
+
+typedef struct {
+    const char* const* filepaths;
+    const pksav_ingest_options_t* options;
+    size_t num_failures;
+} pksav_ingest_context_t;
+
+static void _pksav_ingest_hand_off(
+    pksav_ingest_context_t* context,
+    size_t index,
+    pksav_error_t error,
+    const uint8_t* buffer,
+    size_t buffer_len
+) {
+    if(error) {
+        buffer = NULL;
+        buffer_len = 0;
+        ++context->num_failures;
+    }
+
+    context->options->ingest_fcn(
+        index,
+        context->filepaths[index],
+        error,
+        buffer,
+        buffer_len,
+        context->options->user_data
+    );
+}
+
+/*
+ * Blocking fallback
+ */
+
+static pksav_error_t _pksav_ingest_read_file(
+    const char* filepath,
+    uint8_t** buffer_inout,
+    size_t* buffer_size_inout,
+    size_t* num_read_out
+) {
+    FILE* file = fopen(filepath, "rb");
+    if(!file) {
+        return PKSAV_ERROR_FILE_IO;
+    }
+
+    fseek(file, 0, SEEK_END);
+    long filesize = ftell(file);
+    if(filesize < 0) {
+        fclose(file);
+        return PKSAV_ERROR_FILE_IO;
+    }
+
+    // Reused between files, so it only grows to fit the largest one.
+    if((size_t)filesize > *buffer_size_inout) {
+        free(*buffer_inout);
+        *buffer_inout = malloc((size_t)filesize);
+        *buffer_size_inout = *buffer_inout ? (size_t)filesize : 0;
+        if(!*buffer_inout) {
+            fclose(file);
+            return PKSAV_ERROR_FILE_IO;
+        }
+    }
+
+    fseek(file, 0, SEEK_SET);
+    size_t num_read = fread(*buffer_inout, 1, (size_t)filesize, file);
+    fclose(file);
+    if(num_read != (size_t)filesize) {
+        return PKSAV_ERROR_FILE_IO;
+    }
+
+    *num_read_out = num_read;
+    return PKSAV_ERROR_NONE;
+}
+
+static void _pksav_ingest_file_sync(
+    pksav_ingest_context_t* context,
+    size_t index,
+    uint8_t** buffer_inout,
+    size_t* buffer_size_inout
+) {
+    size_t num_read = 0;
+    pksav_error_t error = PKSAV_ERROR_NULL_POINTER;
+    if(context->filepaths[index]) {
+        error = _pksav_ingest_read_file(context->filepaths[index], buffer_inout, buffer_size_inout, &num_read);
+    }
+
+    _pksav_ingest_hand_off(context, index, error, (num_read ? *buffer_inout : NULL), num_read);
+}
+
+static void _pksav_ingest_files_sync(
+    pksav_ingest_context_t* context,
+    size_t num_filepaths
+) {
+    uint8_t* buffer = NULL;
+    size_t buffer_size = 0;
+
+    for(size_t i = 0; i < num_filepaths; ++i) {
+        _pksav_ingest_file_sync(context, i, &buffer, &buffer_size);
+    }
+
+    free(buffer);
+}
+
+#ifdef PKSAV_ENABLE_IO_URING
+
+/*
+ * io_uring, used through its system calls directly so there's no dependency
+ * on liburing.
+ */
+
+typedef struct {
+    int fd;
+
+    void* sq_ring;
+    size_t sq_ring_size;
+    uint32_t* sq_head;
+    uint32_t* sq_tail;
+    uint32_t* sq_mask;
+    uint32_t* sq_array;
+    struct io_uring_sqe* sqes;
+    size_t sqes_size;
+
+    void* cq_ring;
+    size_t cq_ring_size;
+    uint32_t* cq_head;
+    uint32_t* cq_tail;
+    uint32_t* cq_mask;
+    struct io_uring_cqe* cqes;
+
+    // Queued in the submission ring, but not yet passed into io_uring_enter.
+    uint32_t num_unsubmitted;
+} pksav_ingest_ring_t;
+
+// One file being read.
+typedef struct {
+    bool in_use;
+    // Whether a read is queued that hasn't completed.
+    bool queued;
+    size_t index;
+    int fd;
+    uint8_t* buffer;
+    size_t size;
+    size_t num_read;
+    struct iovec iov;
+} pksav_ingest_slot_t;
+
+static bool _pksav_ingest_ring_init(
+    pksav_ingest_ring_t* ring,
+    uint32_t num_entries
+) {
+    struct io_uring_params params;
+    memset(&params, 0, sizeof(params));
+    memset(ring, 0, sizeof(*ring));
+
+    ring->fd = (int)syscall(__NR_io_uring_setup, num_entries, &params);
+    if(ring->fd < 0) {
+        return false;
+    }
+
+    ring->sq_ring_size = params.sq_off.array + (params.sq_entries * sizeof(uint32_t));
+    ring->cq_ring_size = params.cq_off.cqes + (params.cq_entries * sizeof(struct io_uring_cqe));
+    ring->sqes_size = params.sq_entries * sizeof(struct io_uring_sqe);
+
+    ring->sq_ring = mmap(
+                        NULL, ring->sq_ring_size, PROT_READ | PROT_WRITE,
+                        MAP_SHARED | MAP_POPULATE, ring->fd, IORING_OFF_SQ_RING
+                    );
+    ring->cq_ring = mmap(
+                        NULL, ring->cq_ring_size, PROT_READ | PROT_WRITE,
+                        MAP_SHARED | MAP_POPULATE, ring->fd, IORING_OFF_CQ_RING
+                    );
+    void* sqes = mmap(
+                     NULL, ring->sqes_size, PROT_READ | PROT_WRITE,
+                     MAP_SHARED | MAP_POPULATE, ring->fd, IORING_OFF_SQES
+                 );
+    if((ring->sq_ring == MAP_FAILED) || (ring->cq_ring == MAP_FAILED) || (sqes == MAP_FAILED)) {
+        if(ring->sq_ring != MAP_FAILED) {
+            munmap(ring->sq_ring, ring->sq_ring_size);
+        }
+        if(ring->cq_ring != MAP_FAILED) {
+            munmap(ring->cq_ring, ring->cq_ring_size);
+        }
+        if(sqes != MAP_FAILED) {
+            munmap(sqes, ring->sqes_size);
+        }
+        close(ring->fd);
+        return false;
+    }
+
+    uint8_t* sq_ring = (uint8_t*)ring->sq_ring;
+    ring->sq_head  = (uint32_t*)(sq_ring + params.sq_off.head);
+    ring->sq_tail  = (uint32_t*)(sq_ring + params.sq_off.tail);
+    ring->sq_mask  = (uint32_t*)(sq_ring + params.sq_off.ring_mask);
+    ring->sq_array = (uint32_t*)(sq_ring + params.sq_off.array);
+    ring->sqes     = (struct io_uring_sqe*)sqes;
+
+    uint8_t* cq_ring = (uint8_t*)ring->cq_ring;
+    ring->cq_head = (uint32_t*)(cq_ring + params.cq_off.head);
+    ring->cq_tail = (uint32_t*)(cq_ring + params.cq_off.tail);
+    ring->cq_mask = (uint32_t*)(cq_ring + params.cq_off.ring_mask);
+    ring->cqes    = (struct io_uring_cqe*)(cq_ring + params.cq_off.cqes);
+
+    return true;
+}
+
+static void _pksav_ingest_ring_free(
+    pksav_ingest_ring_t* ring
+) {
+    munmap(ring->sqes, ring->sqes_size);
+    munmap(ring->cq_ring, ring->cq_ring_size);
+    munmap(ring->sq_ring, ring->sq_ring_size);
+    close(ring->fd);
+}
+
+// Queues a read of whatever's left of the slot's file.
+static void _pksav_ingest_ring_queue_read(
+    pksav_ingest_ring_t* ring,
+    pksav_ingest_slot_t* slot,
+    size_t slot_index
+) {
+    // Only this thread writes the tail.
+    uint32_t tail = *ring->sq_tail;
+    uint32_t sqe_index = tail & *ring->sq_mask;
+
+    slot->iov.iov_base = slot->buffer + slot->num_read;
+    slot->iov.iov_len = slot->size - slot->num_read;
+
+    struct io_uring_sqe* sqe = &ring->sqes[sqe_index];
+    memset(sqe, 0, sizeof(*sqe));
+    sqe->opcode = IORING_OP_READV;
+    sqe->fd = slot->fd;
+    sqe->addr = (uint64_t)(uintptr_t)&slot->iov;
+    sqe->len = 1;
+    sqe->off = (uint64_t)slot->num_read;
+    sqe->user_data = (uint64_t)slot_index;
+    slot->queued = true;
+
+    ring->sq_array[sqe_index] = sqe_index;
+    __atomic_store_n(ring->sq_tail, tail + 1, __ATOMIC_RELEASE);
+    ++ring->num_unsubmitted;
+}
+
+static bool _pksav_ingest_ring_enter(
+    pksav_ingest_ring_t* ring,
+    uint32_t min_complete
+) {
+    for(;;) {
+        long num_submitted = syscall(
+                                 __NR_io_uring_enter,
+                                 ring->fd,
+                                 ring->num_unsubmitted,
+                                 min_complete,
+                                 (min_complete ? IORING_ENTER_GETEVENTS : 0),
+                                 NULL,
+                                 0
+                             );
+        if(num_submitted >= 0) {
+            ring->num_unsubmitted -= (uint32_t)num_submitted;
+            if((ring->num_unsubmitted == 0) || min_complete) {
+                return true;
+            }
+        } else if((errno != EINTR) && (errno != EAGAIN) && (errno != EBUSY)) {
+            return false;
+        }
+    }
+}
+
+/*
+ * Opens the next file and queues its read. Files that can't be opened, and
+ * empty files, are handed off right away without taking up a slot.
+ */
+static void _pksav_ingest_start(
+    pksav_ingest_context_t* context,
+    pksav_ingest_ring_t* ring,
+    pksav_ingest_slot_t* slots,
+    size_t index,
+    size_t* num_in_use_inout
+) {
+    const char* filepath = context->filepaths[index];
+    if(!filepath) {
+        _pksav_ingest_hand_off(context, index, PKSAV_ERROR_NULL_POINTER, NULL, 0);
+        return;
+    }
+
+    int fd = open(filepath, O_RDONLY | O_CLOEXEC);
+    struct stat file_stat;
+    if((fd < 0) || fstat(fd, &file_stat) || (file_stat.st_size < 0)) {
+        if(fd >= 0) {
+            close(fd);
+        }
+        _pksav_ingest_hand_off(context, index, PKSAV_ERROR_FILE_IO, NULL, 0);
+        return;
+    }
+
+    size_t size = (size_t)file_stat.st_size;
+    uint8_t* buffer = (size > 0) ? malloc(size) : NULL;
+    if((size == 0) || !buffer) {
+        close(fd);
+        _pksav_ingest_hand_off(context, index, (size ? PKSAV_ERROR_FILE_IO : PKSAV_ERROR_NONE), NULL, 0);
+        return;
+    }
+
+    size_t slot_index = 0;
+    while(slots[slot_index].in_use) {
+        ++slot_index;
+    }
+
+    pksav_ingest_slot_t* slot = &slots[slot_index];
+    slot->in_use = true;
+    slot->index = index;
+    slot->fd = fd;
+    slot->buffer = buffer;
+    slot->size = size;
+    slot->num_read = 0;
+    ++(*num_in_use_inout);
+
+    _pksav_ingest_ring_queue_read(ring, slot, slot_index);
+}
+
+static pksav_error_t _pksav_ingest_files_async(
+    pksav_ingest_context_t* context,
+    pksav_ingest_ring_t* ring,
+    size_t num_filepaths,
+    size_t queue_depth
+) {
+    pksav_ingest_slot_t* slots = calloc(queue_depth, sizeof(pksav_ingest_slot_t));
+    size_t* finished = calloc(queue_depth, sizeof(size_t));
+
+    size_t next_index = 0;
+    size_t num_in_use = 0;
+    pksav_error_t error = PKSAV_ERROR_NONE;
+
+    for(;;) {
+        while((num_in_use < queue_depth) && (next_index < num_filepaths)) {
+            _pksav_ingest_start(context, ring, slots, next_index++, &num_in_use);
+        }
+        if(num_in_use == 0) {
+            break;
+        }
+
+        if(!_pksav_ingest_ring_enter(ring, 1)) {
+            error = PKSAV_ERROR_FILE_IO;
+            break;
+        }
+
+        // Collect everything that's finished, resubmitting short reads.
+        size_t num_finished = 0;
+        uint32_t head = *ring->cq_head;
+        while(head != __atomic_load_n(ring->cq_tail, __ATOMIC_ACQUIRE)) {
+            const struct io_uring_cqe* cqe = &ring->cqes[head & *ring->cq_mask];
+            size_t slot_index = (size_t)cqe->user_data;
+            int32_t result = cqe->res;
+            __atomic_store_n(ring->cq_head, ++head, __ATOMIC_RELEASE);
+
+            pksav_ingest_slot_t* slot = &slots[slot_index];
+            slot->queued = false;
+            if(result > 0) {
+                slot->num_read += (size_t)result;
+                if(slot->num_read < slot->size) {
+                    _pksav_ingest_ring_queue_read(ring, slot, slot_index);
+                    continue;
+                }
+            }
+
+            // Anything else means an error, or the file shrank while being read.
+            finished[num_finished++] = slot_index;
+        }
+
+        // Get any resubmitted reads going before spending time in callbacks.
+        if(ring->num_unsubmitted && !_pksav_ingest_ring_enter(ring, 0)) {
+            error = PKSAV_ERROR_FILE_IO;
+        }
+
+        for(size_t i = 0; i < num_finished; ++i) {
+            pksav_ingest_slot_t* slot = &slots[finished[i]];
+            close(slot->fd);
+
+            bool complete = (slot->num_read == slot->size);
+            _pksav_ingest_hand_off(
+                context,
+                slot->index,
+                (complete ? PKSAV_ERROR_NONE : PKSAV_ERROR_FILE_IO),
+                slot->buffer,
+                slot->size
+            );
+
+            free(slot->buffer);
+            slot->in_use = false;
+            --num_in_use;
+        }
+        if(error) {
+            break;
+        }
+    }
+
+    /*
+     * If the ring stopped working, everything that hasn't been handed off is
+     * read the blocking way instead. Reads the kernel picked up may still
+     * write into their buffers, so those are never freed. The kernel copies
+     * each read's iovec when it picks it up, so the slots themselves can be.
+     */
+    if(error) {
+        uint8_t* buffer = NULL;
+        size_t buffer_size = 0;
+
+        uint32_t tail = *ring->sq_tail;
+        for(uint32_t head = __atomic_load_n(ring->sq_head, __ATOMIC_ACQUIRE); head != tail; ++head) {
+            uint32_t sqe_index = ring->sq_array[head & *ring->sq_mask];
+            slots[ring->sqes[sqe_index].user_data].queued = false;
+        }
+
+        for(size_t i = 0; i < queue_depth; ++i) {
+            if(slots[i].in_use) {
+                close(slots[i].fd);
+                if(!slots[i].queued) {
+                    free(slots[i].buffer);
+                }
+                _pksav_ingest_file_sync(context, slots[i].index, &buffer, &buffer_size);
+            }
+        }
+        for(; next_index < num_filepaths; ++next_index) {
+            _pksav_ingest_file_sync(context, next_index, &buffer, &buffer_size);
+        }
+
+        free(buffer);
+    }
+
+    free(finished);
+    free(slots);
+
+    return error;
+}
+
+#endif /* PKSAV_ENABLE_IO_URING */
+
+bool pksav_ingest_is_async(void) {
+#ifdef PKSAV_ENABLE_IO_URING
+    pksav_ingest_ring_t ring;
+    if(_pksav_ingest_ring_init(&ring, 1)) {
+        _pksav_ingest_ring_free(&ring);
+        return true;
+    }
+#endif
+
+    return false;
+}
+
+pksav_error_t pksav_ingest_files(
+    const char* const* filepaths,
+    size_t num_filepaths,
+    const pksav_ingest_options_t* options,
+    size_t* num_failures_out
+) {
+    if(!filepaths || !options || !options->ingest_fcn) {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+
+    pksav_ingest_context_t context;
+    context.filepaths = filepaths;
+    context.options = options;
+    context.num_failures = 0;
+
+    pksav_error_t error = PKSAV_ERROR_NONE;
+    bool done = false;
+
+#ifdef PKSAV_ENABLE_IO_URING
+    size_t queue_depth = options->queue_depth ? options->queue_depth : PKSAV_INGEST_DEFAULT_QUEUE_DEPTH;
+    if(queue_depth > num_filepaths) {
+        queue_depth = num_filepaths;
+    }
+
+    pksav_ingest_ring_t ring;
+    if((queue_depth > 0) && _pksav_ingest_ring_init(&ring, (uint32_t)queue_depth)) {
+        error = _pksav_ingest_files_async(&context, &ring, num_filepaths, queue_depth);
+        _pksav_ingest_ring_free(&ring);
+        done = true;
+    }
+#endif
+
+    // Without io_uring, or if the kernel doesn't allow it
+    if(!done) {
+        _pksav_ingest_files_sync(&context, num_filepaths);
+    }
+
+    if(num_failures_out) {
+        *num_failures_out = context.num_failures;
+    }
+
+    return error;
+}
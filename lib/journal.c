@@ -0,0 +1,609 @@
+/*
+ * Copyright (c) 2018 Nicholas Corgan (n.corgan@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "common/allocator.h"
+
+#include <pksav/journal.h>
+
+#include <pksav/math/endian.h>
+
+#include <stdint.h>
+#include <string.h>
+
+#define PKSAV_JOURNAL_GB_SAVE_SIZE 0x8000
+
+// Compact GBA saves only keep the sections before the PC.
+#define PKSAV_JOURNAL_GBA_COMPACT_NUM_SECTIONS 5
+
+/*
+ * Patches are a header followed by each edit in the order it was made, all
+ * little-endian:
+ *
+ * Header: "PKSJ", number of edits (4 bytes)
+ * Edit:   region (1 byte), padding (3 bytes), offset (4 bytes), length (4 bytes),
+ *         the bytes replaced, the bytes written
+ */
+static const uint8_t pksav_journal_patch_magic[4] = {'P','K','S','J'};
+
+#define PKSAV_JOURNAL_PATCH_HEADER_SIZE 8
+#define PKSAV_JOURNAL_PATCH_EDIT_HEADER_SIZE 12
+
+// Each edit's bytes take up this many bytes of history per byte written.
+#define PKSAV_JOURNAL_BYTES_PER_BYTE 2
+
+/*
+ * Entries and their bytes are both kept in rings. Positions only ever
+ * increase, and are wrapped when used. An edit's bytes are never split
+ * across the end of the ring, so each entry's bytes can be copied in one go.
+ */
+static PKSAV_INLINE pksav_journal_entry_t* _pksav_journal_entry(
+    const pksav_journal_t* journal,
+    size_t index
+) {
+    return &journal->entries[(journal->first_entry + index) % journal->entry_capacity];
+}
+
+static PKSAV_INLINE uint8_t* _pksav_journal_old_bytes(
+    const pksav_journal_t* journal,
+    const pksav_journal_entry_t* entry
+) {
+    return &journal->data[entry->data_pos % journal->data_capacity];
+}
+
+static PKSAV_INLINE uint8_t* _pksav_journal_new_bytes(
+    const pksav_journal_t* journal,
+    const pksav_journal_entry_t* entry
+) {
+    return _pksav_journal_old_bytes(journal, entry) + entry->len;
+}
+
+static size_t _pksav_journal_first_data_pos(
+    const pksav_journal_t* journal
+) {
+    return journal->num_entries ? _pksav_journal_entry(journal, 0)->data_pos
+                                : journal->data_end;
+}
+
+// Finds which region the given range is in.
+static bool _pksav_journal_find_region(
+    const pksav_journal_t* journal,
+    const void* dest,
+    size_t len,
+    uint8_t* region_out,
+    uint32_t* offset_out
+) {
+    uintptr_t dest_addr = (uintptr_t)dest;
+    for(size_t i = 0; i < journal->num_regions; ++i) {
+        uintptr_t base_addr = (uintptr_t)journal->region_bases[i];
+        if((dest_addr >= base_addr) &&
+           ((dest_addr - base_addr) < journal->region_sizes[i]) &&
+           (len <= (journal->region_sizes[i] - (dest_addr - base_addr)))) {
+            *region_out = (uint8_t)i;
+            *offset_out = (uint32_t)(dest_addr - base_addr);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+// Anything that was undone can't be redone once something new is recorded.
+static void _pksav_journal_drop_redos(
+    pksav_journal_t* journal
+) {
+    if(journal->num_applied < journal->num_entries) {
+        journal->data_end = _pksav_journal_entry(journal, journal->num_applied)->data_pos;
+        journal->num_entries = journal->num_applied;
+    }
+}
+
+// Adds the given edit's bytes to the end of the last entry if it continues it.
+static bool _pksav_journal_merge(
+    pksav_journal_t* journal,
+    uint8_t region,
+    uint32_t offset,
+    const uint8_t* old_bytes,
+    const uint8_t* new_bytes,
+    uint32_t len
+) {
+    if(!journal->merge_with_last || !journal->num_entries) {
+        return false;
+    }
+
+    pksav_journal_entry_t* last = _pksav_journal_entry(journal, journal->num_entries-1);
+    if(last->region != region) {
+        return false;
+    }
+
+    // Overwriting part of the last edit only changes what it wrote.
+    if((offset >= last->offset) && ((offset + len) <= (last->offset + last->len))) {
+        memcpy(
+            _pksav_journal_new_bytes(journal, last) + (offset - last->offset),
+            new_bytes,
+            len
+        );
+        return true;
+    }
+
+    if(offset != (last->offset + last->len)) {
+        return false;
+    }
+
+    // Only grow in place if that doesn't need anything forgotten or wrapped.
+    size_t grown_size = PKSAV_JOURNAL_BYTES_PER_BYTE * ((size_t)last->len + len);
+    if((((last->data_pos % journal->data_capacity) + grown_size) > journal->data_capacity) ||
+       ((last->data_pos + grown_size - _pksav_journal_first_data_pos(journal)) > journal->data_capacity)) {
+        return false;
+    }
+
+    uint8_t* last_old_bytes = _pksav_journal_old_bytes(journal, last);
+    memmove(
+        last_old_bytes + last->len + len,
+        last_old_bytes + last->len,
+        last->len
+    );
+    memcpy(last_old_bytes + last->len, old_bytes, len);
+    memcpy(last_old_bytes + (2 * last->len) + len, new_bytes, len);
+
+    last->len += len;
+    journal->data_end = last->data_pos + grown_size;
+
+    return true;
+}
+
+/*
+ * Records an edit, forgetting the oldest ones as needed to make room. The
+ * caller must make sure it fits at all.
+ */
+static void _pksav_journal_record(
+    pksav_journal_t* journal,
+    uint8_t region,
+    uint32_t offset,
+    const uint8_t* old_bytes,
+    const uint8_t* new_bytes,
+    uint32_t len
+) {
+    _pksav_journal_drop_redos(journal);
+    if(_pksav_journal_merge(journal, region, offset, old_bytes, new_bytes, len)) {
+        return;
+    }
+
+    size_t size = PKSAV_JOURNAL_BYTES_PER_BYTE * (size_t)len;
+    size_t data_pos = journal->data_end;
+    if(((data_pos % journal->data_capacity) + size) > journal->data_capacity) {
+        data_pos += journal->data_capacity - (data_pos % journal->data_capacity);
+    }
+
+    while(journal->num_entries &&
+          ((journal->num_entries == journal->entry_capacity) ||
+           ((data_pos + size - _pksav_journal_first_data_pos(journal)) > journal->data_capacity))) {
+        ++journal->first_entry;
+        --journal->num_entries;
+        --journal->num_applied;
+    }
+
+    pksav_journal_entry_t* entry = _pksav_journal_entry(journal, journal->num_entries);
+    entry->data_pos = data_pos;
+    entry->offset = offset;
+    entry->len = len;
+    entry->region = region;
+    memcpy(_pksav_journal_old_bytes(journal, entry), old_bytes, len);
+    memcpy(_pksav_journal_new_bytes(journal, entry), new_bytes, len);
+
+    journal->data_end = data_pos + size;
+    ++journal->num_entries;
+    ++journal->num_applied;
+}
+
+pksav_error_t pksav_journal_init(
+    pksav_journal_t* journal,
+    size_t capacity
+) {
+    if(!journal) {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+
+    memset(journal, 0, sizeof(*journal));
+
+    journal->data_capacity = capacity ? capacity : PKSAV_JOURNAL_DEFAULT_CAPACITY;
+    journal->data = _pksav_calloc(journal->data_capacity, 1);
+
+    // Edits are usually a few bytes, so this is rarely what runs out.
+    journal->entry_capacity = (journal->data_capacity / 16) + 1;
+    journal->entries = _pksav_calloc(journal->entry_capacity, sizeof(pksav_journal_entry_t));
+
+    return PKSAV_ERROR_NONE;
+}
+
+pksav_error_t pksav_journal_add_region(
+    pksav_journal_t* journal,
+    void* base,
+    size_t size
+) {
+    if(!journal || !base) {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+    if((journal->num_regions >= PKSAV_JOURNAL_MAX_REGIONS) || !size || (size > UINT32_MAX)) {
+        return PKSAV_ERROR_PARAM_OUT_OF_RANGE;
+    }
+
+    journal->region_bases[journal->num_regions] = (uint8_t*)base;
+    journal->region_sizes[journal->num_regions] = size;
+    ++journal->num_regions;
+
+    return PKSAV_ERROR_NONE;
+}
+
+pksav_error_t pksav_journal_add_gen1_save(
+    pksav_journal_t* journal,
+    pksav_gen1_save_t* gen1_save
+) {
+    if(!journal || !gen1_save) {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+
+    return pksav_journal_add_region(
+               journal,
+               gen1_save->raw,
+               PKSAV_JOURNAL_GB_SAVE_SIZE
+           );
+}
+
+pksav_error_t pksav_journal_add_gen2_save(
+    pksav_journal_t* journal,
+    pksav_gen2_save_t* gen2_save
+) {
+    if(!journal || !gen2_save) {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+
+    return pksav_journal_add_region(
+               journal,
+               gen2_save->raw,
+               PKSAV_JOURNAL_GB_SAVE_SIZE
+           );
+}
+
+pksav_error_t pksav_journal_add_gba_save(
+    pksav_journal_t* journal,
+    pksav_gba_save_t* gba_save
+) {
+    if(!journal || !gba_save) {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+    if((journal->num_regions + 2) > PKSAV_JOURNAL_MAX_REGIONS) {
+        return PKSAV_ERROR_PARAM_OUT_OF_RANGE;
+    }
+
+    size_t unshuffled_size = gba_save->compact ? (PKSAV_JOURNAL_GBA_COMPACT_NUM_SECTIONS * sizeof(pksav_gba_save_section_t))
+                                               : sizeof(pksav_gba_save_slot_t);
+
+    pksav_error_t error = pksav_journal_add_region(
+                              journal,
+                              gba_save->unshuffled,
+                              unshuffled_size
+                          );
+    if(!error) {
+        error = pksav_journal_add_region(
+                    journal,
+                    gba_save->pokemon_pc,
+                    sizeof(pksav_gba_pokemon_pc_t)
+                );
+    }
+
+    return error;
+}
+
+pksav_error_t pksav_journal_write(
+    pksav_journal_t* journal,
+    void* dest,
+    const void* src,
+    size_t len
+) {
+    if(!journal || !dest || !src) {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+
+    uint8_t region = 0;
+    uint32_t offset = 0;
+    if(!_pksav_journal_find_region(journal, dest, len, &region, &offset) ||
+       ((PKSAV_JOURNAL_BYTES_PER_BYTE * len) > journal->data_capacity)) {
+        return PKSAV_ERROR_PARAM_OUT_OF_RANGE;
+    }
+    if(!len) {
+        return PKSAV_ERROR_NONE;
+    }
+
+    // Written from the journal's copy in case src and dest overlap.
+    _pksav_journal_record(
+        journal,
+        region,
+        offset,
+        (const uint8_t*)dest,
+        (const uint8_t*)src,
+        (uint32_t)len
+    );
+
+    const pksav_journal_entry_t* last = _pksav_journal_entry(journal, journal->num_entries-1);
+    memcpy(
+        dest,
+        _pksav_journal_new_bytes(journal, last) + (offset - last->offset),
+        len
+    );
+    journal->merge_with_last = true;
+
+    return PKSAV_ERROR_NONE;
+}
+
+pksav_error_t pksav_journal_checkpoint(
+    pksav_journal_t* journal
+) {
+    if(!journal) {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+
+    journal->merge_with_last = false;
+
+    return PKSAV_ERROR_NONE;
+}
+
+pksav_error_t pksav_journal_undo(
+    pksav_journal_t* journal
+) {
+    if(!journal) {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+    if(!journal->num_applied) {
+        return PKSAV_ERROR_PARAM_OUT_OF_RANGE;
+    }
+
+    const pksav_journal_entry_t* entry = _pksav_journal_entry(journal, journal->num_applied-1);
+    memcpy(
+        journal->region_bases[entry->region] + entry->offset,
+        _pksav_journal_old_bytes(journal, entry),
+        entry->len
+    );
+    --journal->num_applied;
+    journal->merge_with_last = false;
+
+    return PKSAV_ERROR_NONE;
+}
+
+pksav_error_t pksav_journal_redo(
+    pksav_journal_t* journal
+) {
+    if(!journal) {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+    if(journal->num_applied == journal->num_entries) {
+        return PKSAV_ERROR_PARAM_OUT_OF_RANGE;
+    }
+
+    const pksav_journal_entry_t* entry = _pksav_journal_entry(journal, journal->num_applied);
+    memcpy(
+        journal->region_bases[entry->region] + entry->offset,
+        _pksav_journal_new_bytes(journal, entry),
+        entry->len
+    );
+    ++journal->num_applied;
+    journal->merge_with_last = false;
+
+    return PKSAV_ERROR_NONE;
+}
+
+pksav_error_t pksav_journal_get_depth(
+    const pksav_journal_t* journal,
+    size_t* num_undos_out,
+    size_t* num_redos_out
+) {
+    if(!journal || !num_undos_out || !num_redos_out) {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+
+    *num_undos_out = journal->num_applied;
+    *num_redos_out = journal->num_entries - journal->num_applied;
+
+    return PKSAV_ERROR_NONE;
+}
+
+pksav_error_t pksav_journal_get_patch_size(
+    const pksav_journal_t* journal,
+    size_t* patch_size_out
+) {
+    if(!journal || !patch_size_out) {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+
+    size_t patch_size = PKSAV_JOURNAL_PATCH_HEADER_SIZE;
+    for(size_t i = 0; i < journal->num_applied; ++i) {
+        patch_size += PKSAV_JOURNAL_PATCH_EDIT_HEADER_SIZE +
+                      (PKSAV_JOURNAL_BYTES_PER_BYTE * _pksav_journal_entry(journal, i)->len);
+    }
+    *patch_size_out = patch_size;
+
+    return PKSAV_ERROR_NONE;
+}
+
+static PKSAV_INLINE void _pksav_journal_write32(
+    uint8_t* buffer,
+    uint32_t value
+) {
+    value = pksav_littleendian32(value);
+    memcpy(buffer, &value, sizeof(value));
+}
+
+static PKSAV_INLINE uint32_t _pksav_journal_read32(
+    const uint8_t* buffer
+) {
+    uint32_t value = 0;
+    memcpy(&value, buffer, sizeof(value));
+
+    return pksav_littleendian32(value);
+}
+
+pksav_error_t pksav_journal_export_patch(
+    const pksav_journal_t* journal,
+    uint8_t* buffer,
+    size_t buffer_len
+) {
+    if(!journal || !buffer) {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+
+    size_t patch_size = 0;
+    pksav_journal_get_patch_size(journal, &patch_size);
+    if(buffer_len < patch_size) {
+        return PKSAV_ERROR_PARAM_OUT_OF_RANGE;
+    }
+
+    memcpy(buffer, pksav_journal_patch_magic, sizeof(pksav_journal_patch_magic));
+    _pksav_journal_write32(&buffer[4], (uint32_t)journal->num_applied);
+    buffer += PKSAV_JOURNAL_PATCH_HEADER_SIZE;
+
+    for(size_t i = 0; i < journal->num_applied; ++i) {
+        const pksav_journal_entry_t* entry = _pksav_journal_entry(journal, i);
+
+        memset(buffer, 0, PKSAV_JOURNAL_PATCH_EDIT_HEADER_SIZE);
+        buffer[0] = entry->region;
+        _pksav_journal_write32(&buffer[4], entry->offset);
+        _pksav_journal_write32(&buffer[8], entry->len);
+        buffer += PKSAV_JOURNAL_PATCH_EDIT_HEADER_SIZE;
+
+        memcpy(buffer, _pksav_journal_old_bytes(journal, entry), PKSAV_JOURNAL_BYTES_PER_BYTE * entry->len);
+        buffer += PKSAV_JOURNAL_BYTES_PER_BYTE * entry->len;
+    }
+
+    return PKSAV_ERROR_NONE;
+}
+
+// Checks that the given edit from a patch is within the journal's regions.
+static bool _pksav_journal_patch_edit_is_valid(
+    const pksav_journal_t* journal,
+    const uint8_t* edit,
+    size_t remaining_len
+) {
+    if(remaining_len < PKSAV_JOURNAL_PATCH_EDIT_HEADER_SIZE) {
+        return false;
+    }
+
+    uint8_t region = edit[0];
+    uint32_t offset = _pksav_journal_read32(&edit[4]);
+    uint32_t len = _pksav_journal_read32(&edit[8]);
+
+    return (region < journal->num_regions) &&
+           (offset < journal->region_sizes[region]) &&
+           (len <= (journal->region_sizes[region] - offset)) &&
+           ((PKSAV_JOURNAL_BYTES_PER_BYTE * (size_t)len) <= journal->data_capacity) &&
+           ((PKSAV_JOURNAL_BYTES_PER_BYTE * (size_t)len) <= (remaining_len - PKSAV_JOURNAL_PATCH_EDIT_HEADER_SIZE));
+}
+
+// Finds the given edit in an already validated patch.
+static const uint8_t* _pksav_journal_patch_edit(
+    const uint8_t* edits,
+    uint32_t index
+) {
+    const uint8_t* edit = edits;
+    for(uint32_t i = 0; i < index; ++i) {
+        edit += PKSAV_JOURNAL_PATCH_EDIT_HEADER_SIZE +
+                (PKSAV_JOURNAL_BYTES_PER_BYTE * (size_t)_pksav_journal_read32(&edit[8]));
+    }
+
+    return edit;
+}
+
+pksav_error_t pksav_journal_apply_patch(
+    pksav_journal_t* journal,
+    const uint8_t* patch,
+    size_t patch_len
+) {
+    if(!journal || !patch) {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+    if((patch_len < PKSAV_JOURNAL_PATCH_HEADER_SIZE) ||
+       memcmp(patch, pksav_journal_patch_magic, sizeof(pksav_journal_patch_magic))) {
+        return PKSAV_ERROR_PARAM_OUT_OF_RANGE;
+    }
+
+    // Make sure the whole patch is readable before touching anything.
+    uint32_t num_edits = _pksav_journal_read32(&patch[4]);
+    const uint8_t* edits = patch + PKSAV_JOURNAL_PATCH_HEADER_SIZE;
+    const uint8_t* patch_end = patch + patch_len;
+
+    const uint8_t* edit = edits;
+    for(uint32_t i = 0; i < num_edits; ++i) {
+        if(!_pksav_journal_patch_edit_is_valid(journal, edit, (size_t)(patch_end - edit))) {
+            return PKSAV_ERROR_PARAM_OUT_OF_RANGE;
+        }
+        edit += PKSAV_JOURNAL_PATCH_EDIT_HEADER_SIZE +
+                (PKSAV_JOURNAL_BYTES_PER_BYTE * (size_t)_pksav_journal_read32(&edit[8]));
+    }
+
+    /*
+     * Each edit can only be checked once the ones before it are applied, so
+     * they're applied as they're checked, and put back if one doesn't match.
+     * Only once they've all been applied are they recorded.
+     */
+    edit = edits;
+    for(uint32_t i = 0; i < num_edits; ++i) {
+        uint8_t* dest = journal->region_bases[edit[0]] + _pksav_journal_read32(&edit[4]);
+        uint32_t len = _pksav_journal_read32(&edit[8]);
+        const uint8_t* old_bytes = &edit[PKSAV_JOURNAL_PATCH_EDIT_HEADER_SIZE];
+
+        if(memcmp(dest, old_bytes, len)) {
+            // Put back what was applied, newest first, in case edits overlap.
+            while(i-- > 0) {
+                const uint8_t* applied_edit = _pksav_journal_patch_edit(edits, i);
+                memcpy(
+                    journal->region_bases[applied_edit[0]] + _pksav_journal_read32(&applied_edit[4]),
+                    &applied_edit[PKSAV_JOURNAL_PATCH_EDIT_HEADER_SIZE],
+                    _pksav_journal_read32(&applied_edit[8])
+                );
+            }
+
+            return PKSAV_ERROR_INVALID_SAVE;
+        }
+
+        memcpy(dest, old_bytes + len, len);
+        edit += PKSAV_JOURNAL_PATCH_EDIT_HEADER_SIZE + (PKSAV_JOURNAL_BYTES_PER_BYTE * (size_t)len);
+    }
+
+    edit = edits;
+    for(uint32_t i = 0; i < num_edits; ++i) {
+        uint32_t len = _pksav_journal_read32(&edit[8]);
+        const uint8_t* old_bytes = &edit[PKSAV_JOURNAL_PATCH_EDIT_HEADER_SIZE];
+
+        journal->merge_with_last = false;
+        _pksav_journal_record(
+            journal,
+            edit[0],
+            _pksav_journal_read32(&edit[4]),
+            old_bytes,
+            old_bytes + len,
+            len
+        );
+        edit += PKSAV_JOURNAL_PATCH_EDIT_HEADER_SIZE + (PKSAV_JOURNAL_BYTES_PER_BYTE * (size_t)len);
+    }
+    journal->merge_with_last = false;
+
+    return PKSAV_ERROR_NONE;
+}
+
+pksav_error_t pksav_journal_free(
+    pksav_journal_t* journal
+) {
+    if(!journal) {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+
+    _pksav_free(journal->entries);
+    _pksav_free(journal->data);
+
+    journal->entries = NULL;
+    journal->data = NULL;
+
+    return PKSAV_ERROR_NONE;
+}
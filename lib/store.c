@@ -0,0 +1,302 @@
+/*
+ * Copyright (c) 2018 Nicholas Corgan (n.corgan@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "common/allocator.h"
+
+#include <pksav/store.h>
+
+#include <pksav/math/endian.h>
+
+#include <string.h>
+
+// Anything smaller is a Game Boy save.
+#define PKSAV_STORE_GBA_MIN_SAVE_SIZE 0x10000
+
+#define PKSAV_STORE_GB_BANK_SIZE         0x2000
+#define PKSAV_STORE_GBA_SECTOR_SIZE      0x1000
+#define PKSAV_STORE_GBA_FOOTER_SIZE      12
+#define PKSAV_STORE_GBA_SECTOR_DATA_SIZE (PKSAV_STORE_GBA_SECTOR_SIZE - PKSAV_STORE_GBA_FOOTER_SIZE)
+
+#define PKSAV_STORE_INITIAL_NUM_BUCKETS 1024
+
+// Returns the size of the chunk at the given position in a save.
+static size_t _pksav_store_chunk_len(
+    size_t save_len,
+    size_t pos
+) {
+    size_t chunk_len = 0;
+    if(save_len < PKSAV_STORE_GBA_MIN_SAVE_SIZE) {
+        chunk_len = PKSAV_STORE_GB_BANK_SIZE;
+    } else {
+        chunk_len = ((pos % PKSAV_STORE_GBA_SECTOR_SIZE) == 0) ? PKSAV_STORE_GBA_SECTOR_DATA_SIZE
+                                                               : PKSAV_STORE_GBA_FOOTER_SIZE;
+    }
+
+    return ((save_len - pos) < chunk_len) ? (save_len - pos) : chunk_len;
+}
+
+static size_t _pksav_store_num_chunks(
+    size_t save_len
+) {
+    size_t num_chunks = 0;
+    for(size_t pos = 0; pos < save_len; pos += _pksav_store_chunk_len(save_len, pos)) {
+        ++num_chunks;
+    }
+
+    return num_chunks;
+}
+
+/*
+ * A 64-bit multiply-xorshift hash, reading eight bytes at a time. Words are
+ * read little-endian, so hashes are the same on every platform.
+ */
+static uint64_t _pksav_store_hash(
+    const uint8_t* data,
+    size_t len
+) {
+    uint64_t hash = 0x9E3779B97F4A7C15ULL ^ (uint64_t)len;
+
+    size_t i = 0;
+    for(; (i + 8) <= len; i += 8) {
+        uint32_t words[2];
+        memcpy(words, &data[i], sizeof(words));
+
+        uint64_t word = (uint64_t)pksav_littleendian32(words[0]) |
+                        ((uint64_t)pksav_littleendian32(words[1]) << 32);
+        hash = (hash ^ word) * 0xFF51AFD7ED558CCDULL;
+        hash ^= (hash >> 32);
+    }
+    for(; i < len; ++i) {
+        hash = (hash ^ data[i]) * 0x100000001B3ULL;
+    }
+
+    hash ^= (hash >> 33);
+    hash *= 0xFF51AFD7ED558CCDULL;
+    hash ^= (hash >> 33);
+    hash *= 0xC4CEB9FE1A85EC53ULL;
+    hash ^= (hash >> 33);
+
+    return hash;
+}
+
+/*
+ * Buckets hold the ID of the first chunk in them plus one, and each chunk
+ * holds the next one in its bucket the same way, so 0 is the end of a bucket.
+ */
+static void _pksav_store_rehash(
+    pksav_store_t* store,
+    size_t num_buckets
+) {
+    _pksav_free(store->buckets);
+    store->buckets = _pksav_calloc(num_buckets, sizeof(uint32_t));
+    store->num_buckets = num_buckets;
+
+    for(size_t i = 0; i < store->num_chunks; ++i) {
+        uint32_t* bucket = &store->buckets[store->chunks[i].hash & (num_buckets - 1)];
+        store->chunks[i].next = *bucket;
+        *bucket = (uint32_t)(i + 1);
+    }
+}
+
+// Returns the ID of the given chunk, adding it if the store doesn't have it.
+static uint32_t _pksav_store_add_chunk(
+    pksav_store_t* store,
+    const uint8_t* data,
+    size_t len
+) {
+    uint64_t hash = _pksav_store_hash(data, len);
+
+    for(uint32_t id = store->buckets[hash & (store->num_buckets - 1)]; id; id = store->chunks[id-1].next) {
+        const pksav_store_chunk_t* chunk = &store->chunks[id-1];
+        if((chunk->hash == hash) && (chunk->len == len) && !memcmp(chunk->data, data, len)) {
+            return id - 1;
+        }
+    }
+
+    if(store->num_chunks == store->chunk_capacity) {
+        size_t chunk_capacity = store->chunk_capacity ? (store->chunk_capacity * 2) : store->num_buckets;
+        pksav_store_chunk_t* chunks = _pksav_calloc(chunk_capacity, sizeof(pksav_store_chunk_t));
+        if(store->num_chunks) {
+            memcpy(chunks, store->chunks, store->num_chunks * sizeof(pksav_store_chunk_t));
+        }
+
+        _pksav_free(store->chunks);
+        store->chunks = chunks;
+        store->chunk_capacity = chunk_capacity;
+    }
+
+    uint32_t id = (uint32_t)store->num_chunks;
+    pksav_store_chunk_t* chunk = &store->chunks[id];
+    chunk->hash = hash;
+    chunk->data = _pksav_calloc(len, 1);
+    chunk->len = (uint32_t)len;
+    memcpy(chunk->data, data, len);
+
+    uint32_t* bucket = &store->buckets[hash & (store->num_buckets - 1)];
+    chunk->next = *bucket;
+    *bucket = id + 1;
+
+    ++store->num_chunks;
+    store->num_bytes += len;
+
+    // Keep buckets short as the store grows.
+    if(store->num_chunks > store->num_buckets) {
+        _pksav_store_rehash(store, store->num_buckets * 2);
+    }
+
+    return id;
+}
+
+pksav_error_t pksav_store_init(
+    pksav_store_t* store
+) {
+    if(!store) {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+
+    memset(store, 0, sizeof(*store));
+    _pksav_store_rehash(store, PKSAV_STORE_INITIAL_NUM_BUCKETS);
+
+    return PKSAV_ERROR_NONE;
+}
+
+pksav_error_t pksav_store_add_save(
+    pksav_store_t* store,
+    const uint8_t* buffer,
+    size_t buffer_len,
+    pksav_store_manifest_t* manifest_out
+) {
+    if(!store || !buffer || !manifest_out) {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+
+    // Chunk IDs have to fit in 32 bits.
+    size_t num_chunks = _pksav_store_num_chunks(buffer_len);
+    if(!buffer_len || (num_chunks > (UINT32_MAX - store->num_chunks))) {
+        return PKSAV_ERROR_PARAM_OUT_OF_RANGE;
+    }
+
+    manifest_out->save_len = buffer_len;
+    manifest_out->num_chunks = num_chunks;
+    manifest_out->chunk_ids = _pksav_calloc(manifest_out->num_chunks, sizeof(uint32_t));
+
+    size_t pos = 0;
+    for(size_t i = 0; i < manifest_out->num_chunks; ++i) {
+        size_t chunk_len = _pksav_store_chunk_len(buffer_len, pos);
+        manifest_out->chunk_ids[i] = _pksav_store_add_chunk(
+                                         store,
+                                         &buffer[pos],
+                                         chunk_len
+                                     );
+        pos += chunk_len;
+    }
+
+    return PKSAV_ERROR_NONE;
+}
+
+pksav_error_t pksav_store_rebuild_save(
+    const pksav_store_t* store,
+    const pksav_store_manifest_t* manifest,
+    uint8_t* buffer,
+    size_t buffer_len
+) {
+    if(!store || !manifest || !manifest->chunk_ids || !buffer) {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+    if((buffer_len < manifest->save_len) ||
+       (manifest->num_chunks != _pksav_store_num_chunks(manifest->save_len))) {
+        return PKSAV_ERROR_PARAM_OUT_OF_RANGE;
+    }
+
+    // Make sure every chunk is there before writing anything.
+    size_t pos = 0;
+    for(size_t i = 0; i < manifest->num_chunks; ++i) {
+        size_t chunk_len = _pksav_store_chunk_len(manifest->save_len, pos);
+        if((manifest->chunk_ids[i] >= store->num_chunks) ||
+           (store->chunks[manifest->chunk_ids[i]].len != chunk_len)) {
+            return PKSAV_ERROR_PARAM_OUT_OF_RANGE;
+        }
+        pos += chunk_len;
+    }
+
+    pos = 0;
+    for(size_t i = 0; i < manifest->num_chunks; ++i) {
+        const pksav_store_chunk_t* chunk = &store->chunks[manifest->chunk_ids[i]];
+        memcpy(&buffer[pos], chunk->data, chunk->len);
+        pos += chunk->len;
+    }
+
+    return PKSAV_ERROR_NONE;
+}
+
+pksav_error_t pksav_store_get_chunk(
+    const pksav_store_t* store,
+    uint32_t chunk_id,
+    const uint8_t** chunk_out,
+    size_t* chunk_len_out,
+    uint64_t* hash_out
+) {
+    if(!store || !chunk_out || !chunk_len_out || !hash_out) {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+    if(chunk_id >= store->num_chunks) {
+        return PKSAV_ERROR_PARAM_OUT_OF_RANGE;
+    }
+
+    *chunk_out = store->chunks[chunk_id].data;
+    *chunk_len_out = store->chunks[chunk_id].len;
+    *hash_out = store->chunks[chunk_id].hash;
+
+    return PKSAV_ERROR_NONE;
+}
+
+pksav_error_t pksav_store_get_stats(
+    const pksav_store_t* store,
+    size_t* num_chunks_out,
+    size_t* num_bytes_out
+) {
+    if(!store || !num_chunks_out || !num_bytes_out) {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+
+    *num_chunks_out = store->num_chunks;
+    *num_bytes_out = store->num_bytes;
+
+    return PKSAV_ERROR_NONE;
+}
+
+pksav_error_t pksav_store_manifest_free(
+    pksav_store_manifest_t* manifest
+) {
+    if(!manifest) {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+
+    _pksav_free(manifest->chunk_ids);
+    manifest->chunk_ids = NULL;
+    manifest->num_chunks = 0;
+
+    return PKSAV_ERROR_NONE;
+}
+
+pksav_error_t pksav_store_free(
+    pksav_store_t* store
+) {
+    if(!store) {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+
+    for(size_t i = 0; i < store->num_chunks; ++i) {
+        _pksav_free(store->chunks[i].data);
+    }
+    _pksav_free(store->chunks);
+    _pksav_free(store->buckets);
+
+    memset(store, 0, sizeof(*store));
+
+    return PKSAV_ERROR_NONE;
+}
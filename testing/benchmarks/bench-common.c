@@ -0,0 +1,229 @@
+/*
+ * Copyright (c) 2018 Nicholas Corgan (n.corgan@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "bench-common.h"
+
+#include <pksav/config.h>
+
+#include <string.h>
+
+#if defined(PKSAV_PLATFORM_WIN32) || defined(PKSAV_PLATFORM_MINGW)
+#    include <windows.h>
+#else
+#    include <time.h>
+#endif
+
+uint64_t bench_now_ns(void)
+{
+#if defined(PKSAV_PLATFORM_WIN32) || defined(PKSAV_PLATFORM_MINGW)
+    LARGE_INTEGER frequency, counter;
+    QueryPerformanceFrequency(&frequency);
+    QueryPerformanceCounter(&counter);
+
+    return (uint64_t)((double)counter.QuadPart * 1e9 / (double)frequency.QuadPart);
+#else
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return ((uint64_t)now.tv_sec * 1000000000ULL) + (uint64_t)now.tv_nsec;
+#endif
+}
+
+static volatile uint8_t bench_sink = 0;
+
+void bench_consume(
+    const void* ptr,
+    size_t len
+)
+{
+    const uint8_t* bytes = (const uint8_t*)ptr;
+    if(len > 0)
+    {
+        bench_sink ^= (uint8_t)(bytes[0] ^ bytes[len-1]);
+    }
+}
+
+static int bench_compare_doubles(
+    const void* lhs,
+    const void* rhs
+)
+{
+    double lhs_value = *(const double*)lhs;
+    double rhs_value = *(const double*)rhs;
+
+    return (lhs_value > rhs_value) - (lhs_value < rhs_value);
+}
+
+static double bench_percentile(
+    const double* sorted_samples,
+    size_t num_samples,
+    double percentile
+)
+{
+    double position = (percentile / 100.0) * (double)(num_samples - 1);
+    size_t lower = (size_t)position;
+    size_t upper = (lower + 1 < num_samples) ? (lower + 1) : lower;
+    double fraction = position - (double)lower;
+
+    return sorted_samples[lower] + ((sorted_samples[upper] - sorted_samples[lower]) * fraction);
+}
+
+void bench_get_stats(
+    double* samples,
+    size_t num_samples,
+    bench_stats_t* stats_out
+)
+{
+    memset(stats_out, 0, sizeof(*stats_out));
+    stats_out->num_samples = num_samples;
+    if(num_samples == 0)
+    {
+        return;
+    }
+
+    qsort(samples, num_samples, sizeof(double), bench_compare_doubles);
+
+    double sum = 0.0;
+    for(size_t i = 0; i < num_samples; ++i)
+    {
+        sum += samples[i];
+    }
+
+    stats_out->min = samples[0];
+    stats_out->mean = sum / (double)num_samples;
+    stats_out->p50 = bench_percentile(samples, num_samples, 50.0);
+    stats_out->p90 = bench_percentile(samples, num_samples, 90.0);
+    stats_out->p99 = bench_percentile(samples, num_samples, 99.0);
+    stats_out->max = samples[num_samples-1];
+}
+
+void bench_json_begin(
+    bench_json_writer_t* writer,
+    FILE* output
+)
+{
+    writer->output = output;
+    writer->num_results = 0;
+    writer->num_fields = 0;
+    fprintf(writer->output, "[");
+}
+
+void bench_json_end(
+    bench_json_writer_t* writer
+)
+{
+    if(writer->num_results > 0)
+    {
+        fprintf(writer->output, "}");
+    }
+    fprintf(writer->output, "\n]\n");
+    fflush(writer->output);
+}
+
+void bench_json_begin_result(
+    bench_json_writer_t* writer
+)
+{
+    fprintf(writer->output, "%s\n  {", (writer->num_results > 0) ? "}," : "");
+    ++writer->num_results;
+    writer->num_fields = 0;
+}
+
+static void bench_json_add_key(
+    bench_json_writer_t* writer,
+    const char* key
+)
+{
+    fprintf(writer->output, "%s\"%s\": ", (writer->num_fields > 0) ? ", " : "", key);
+    ++writer->num_fields;
+}
+
+void bench_json_add_string(
+    bench_json_writer_t* writer,
+    const char* key,
+    const char* value
+)
+{
+    bench_json_add_key(writer, key);
+    fprintf(writer->output, "\"%s\"", value);
+}
+
+void bench_json_add_uint(
+    bench_json_writer_t* writer,
+    const char* key,
+    uint64_t value
+)
+{
+    bench_json_add_key(writer, key);
+    fprintf(writer->output, "%llu", (unsigned long long)value);
+}
+
+void bench_json_add_double(
+    bench_json_writer_t* writer,
+    const char* key,
+    double value
+)
+{
+    bench_json_add_key(writer, key);
+    fprintf(writer->output, "%.3f", value);
+}
+
+// Returns where the key's value starts, or NULL if the key isn't on this line.
+static const char* bench_json_find_value(
+    const char* line,
+    const char* key
+)
+{
+    char pattern[128] = {0};
+    snprintf(pattern, sizeof(pattern), "\"%s\": ", key);
+
+    const char* match = strstr(line, pattern);
+    return match ? (match + strlen(pattern)) : NULL;
+}
+
+bool bench_json_get_string(
+    const char* line,
+    const char* key,
+    char* value_out,
+    size_t value_len
+)
+{
+    const char* value = bench_json_find_value(line, key);
+    if(!value || (*value != '"') || (value_len == 0))
+    {
+        return false;
+    }
+
+    ++value;
+    size_t len = 0;
+    while(value[len] && (value[len] != '"') && (len < (value_len - 1)))
+    {
+        value_out[len] = value[len];
+        ++len;
+    }
+    value_out[len] = '\0';
+
+    return (value[len] == '"');
+}
+
+bool bench_json_get_double(
+    const char* line,
+    const char* key,
+    double* value_out
+)
+{
+    const char* value = bench_json_find_value(line, key);
+    if(!value)
+    {
+        return false;
+    }
+
+    char* end = NULL;
+    *value_out = strtod(value, &end);
+
+    return (end != value);
+}
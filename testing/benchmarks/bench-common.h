@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2018 Nicholas Corgan (n.corgan@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+#ifndef PKSAV_BENCH_COMMON_H
+#define PKSAV_BENCH_COMMON_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+// Monotonic time in nanoseconds, for measuring intervals only.
+uint64_t bench_now_ns(void);
+
+// Prevents the compiler from optimizing away a benchmarked result.
+void bench_consume(
+    const void* ptr,
+    size_t len
+);
+
+/*
+ * Summary statistics over a set of samples. Percentiles interpolate between
+ * the two nearest samples.
+ */
+typedef struct
+{
+    size_t num_samples;
+    double min;
+    double mean;
+    double p50;
+    double p90;
+    double p99;
+    double max;
+} bench_stats_t;
+
+// Sorts the samples in place.
+void bench_get_stats(
+    double* samples,
+    size_t num_samples,
+    bench_stats_t* stats_out
+);
+
+/*
+ * Results are printed as a JSON array of flat objects, one per line, so
+ * they can be parsed by any JSON library or grepped line by line.
+ */
+typedef struct
+{
+    FILE* output;
+    size_t num_results;
+    size_t num_fields;
+} bench_json_writer_t;
+
+void bench_json_begin(
+    bench_json_writer_t* writer,
+    FILE* output
+);
+
+void bench_json_end(
+    bench_json_writer_t* writer
+);
+
+/*
+ * Starts a new result object. Fields are added with the functions below,
+ * and the object is closed by the next call to bench_json_begin_result()
+ * or bench_json_end().
+ */
+void bench_json_begin_result(
+    bench_json_writer_t* writer
+);
+
+void bench_json_add_string(
+    bench_json_writer_t* writer,
+    const char* key,
+    const char* value
+);
+
+void bench_json_add_uint(
+    bench_json_writer_t* writer,
+    const char* key,
+    uint64_t value
+);
+
+void bench_json_add_double(
+    bench_json_writer_t* writer,
+    const char* key,
+    double value
+);
+
+/*
+ * Reads a field from one line of output written by the functions above.
+ * These only handle the flat, one-object-per-line format written here, not
+ * JSON in general.
+ */
+bool bench_json_get_string(
+    const char* line,
+    const char* key,
+    char* value_out,
+    size_t value_len
+);
+
+bool bench_json_get_double(
+    const char* line,
+    const char* key,
+    double* value_out
+);
+
+#endif /* PKSAV_BENCH_COMMON_H */
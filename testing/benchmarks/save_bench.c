@@ -0,0 +1,1070 @@
+/*
+ * Copyright (c) 2018 Nicholas Corgan (n.corgan@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+
+/*
+ * Measures the latency of loading, saving, and detecting saves for every
+ * generation, along with the GBA section shuffle, Pokémon encryption, and
+ * checksum functions underneath them.
+ *
+ * Each function is run on synthetic saves with valid checksums, and on any
+ * sample saves found in the test save repository (given by --saves-dir or the
+ * PKSAV_TEST_SAVES environment variable). After calibrating how many calls
+ * fit in one sample, warmup samples are discarded, and the rest are reported
+ * as per-call percentiles.
+ *
+ * Usage: pksav-bench [--reps N] [--warmup N] [--min-sample-us N]
+ *                    [--filter SUBSTRING] [--saves-dir DIR]
+ *        pksav-bench --compare BASELINE.json CURRENT.json [--threshold PERCENT]
+ *
+ * Results are printed to stdout as JSON. In compare mode, the median of each
+ * benchmark in CURRENT.json is compared to the one in BASELINE.json, and the
+ * exit status is nonzero if any became slower by more than the threshold.
+ */
+
+#include "bench-common.h"
+
+#include "common/crc16.h"
+#include "gba/checksum.h"
+#include "gba/crypt.h"
+#include "gba/shuffle.h"
+
+#include <pksav.h>
+
+#include <string.h>
+
+#if defined(PKSAV_PLATFORM_WIN32) || defined(PKSAV_PLATFORM_MINGW)
+#    define FS_SEPARATOR "\\"
+#else
+#    define FS_SEPARATOR "/"
+#endif
+
+#define GEN1_SAVE_SIZE     0x8000
+#define GEN2_SAVE_SIZE     0x8000
+#define GBA_SAVE_SIZE      0x20000
+#define GBA_SLOT_SIZE      0xE000
+#define GBA_VALIDATION     0x08012025
+#define NDS_SAVE_SIZE      0x80000
+
+// Diamond/Pearl
+#define GEN4_COPY_SIZE     0x40000
+#define GEN4_GENERAL_SIZE  0xC100
+#define GEN4_STORAGE_SIZE  0x121E0
+#define GEN4_FOOTER_SIZE   0x14
+#define GEN4_PARTY_OFFSET  0x94
+
+// Black/White
+#define GEN5_BOXES_OFFSET  0x400
+#define GEN5_BOX_STRIDE    0x1000
+#define GEN5_PARTY_OFFSET  0x18E00
+#define GEN5_PARTY_SIZE    0x534
+#define GEN5_TRAINER_OFFSET 0x19400
+#define GEN5_TRAINER_SIZE  0x68
+#define GEN5_TABLE_OFFSET  0x23F00
+#define GEN5_TABLE_SIZE    0x8C
+#define GEN5_TABLE_CHECKSUM_OFFSET 0x23F9A
+
+#define NUM_BOX_POKEMON    30
+#define MAX_SAVE_SIZE      NDS_SAVE_SIZE
+
+/*
+ * Wrappers to give every generation the same signature
+ */
+
+typedef union
+{
+    pksav_gen1_save_t gen1;
+    pksav_gen2_save_t gen2;
+    pksav_gba_save_t gba;
+    pksav_gen4_save_t gen4;
+    pksav_gen5_save_t gen5;
+} bench_save_t;
+
+#define PKSAV_BENCH_SAVE_WRAPPERS(gen) \
+    static pksav_error_t gen ## _load(const char* filepath, bench_save_t* save) \
+    { \
+        return pksav_ ## gen ## _save_load(filepath, &save->gen); \
+    } \
+    static pksav_error_t gen ## _load_buffer(const uint8_t* buffer, size_t buffer_len, bench_save_t* save) \
+    { \
+        return pksav_ ## gen ## _save_load_buffer(buffer, buffer_len, &save->gen); \
+    } \
+    static pksav_error_t gen ## _save(const char* filepath, bench_save_t* save) \
+    { \
+        return pksav_ ## gen ## _save_save(filepath, &save->gen); \
+    } \
+    static pksav_error_t gen ## _free(bench_save_t* save) \
+    { \
+        return pksav_ ## gen ## _save_free(&save->gen); \
+    }
+
+PKSAV_BENCH_SAVE_WRAPPERS(gen1)
+PKSAV_BENCH_SAVE_WRAPPERS(gen2)
+PKSAV_BENCH_SAVE_WRAPPERS(gba)
+PKSAV_BENCH_SAVE_WRAPPERS(gen4)
+PKSAV_BENCH_SAVE_WRAPPERS(gen5)
+
+// Detection checks every game in the generation, as loading does.
+static pksav_error_t gen1_is_save(const uint8_t* buffer, size_t buffer_len, bool* result_out)
+{
+    return pksav_buffer_is_gen1_save(buffer, buffer_len, result_out);
+}
+
+static pksav_error_t gen2_is_save(const uint8_t* buffer, size_t buffer_len, bool* result_out)
+{
+    pksav_error_t error = pksav_buffer_is_gen2_save(buffer, buffer_len, false, result_out);
+    if(!error && !*result_out)
+    {
+        error = pksav_buffer_is_gen2_save(buffer, buffer_len, true, result_out);
+    }
+
+    return error;
+}
+
+static pksav_error_t gba_is_save(const uint8_t* buffer, size_t buffer_len, bool* result_out)
+{
+    pksav_error_t error = PKSAV_ERROR_NONE;
+    *result_out = false;
+    for(pksav_gba_game_t game = PKSAV_GBA_RS; (game <= PKSAV_GBA_FRLG) && !error && !*result_out; ++game)
+    {
+        error = pksav_buffer_is_gba_save(buffer, buffer_len, game, result_out);
+    }
+
+    return error;
+}
+
+static pksav_error_t gen4_is_save(const uint8_t* buffer, size_t buffer_len, bool* result_out)
+{
+    pksav_error_t error = PKSAV_ERROR_NONE;
+    *result_out = false;
+    for(pksav_gen4_game_t game = PKSAV_GEN4_DP; (game <= PKSAV_GEN4_HGSS) && !error && !*result_out; ++game)
+    {
+        error = pksav_buffer_is_gen4_save(buffer, buffer_len, game, result_out);
+    }
+
+    return error;
+}
+
+static pksav_error_t gen5_is_save(const uint8_t* buffer, size_t buffer_len, bool* result_out)
+{
+    pksav_error_t error = PKSAV_ERROR_NONE;
+    *result_out = false;
+    for(pksav_gen5_game_t game = PKSAV_GEN5_BW; (game <= PKSAV_GEN5_B2W2) && !error && !*result_out; ++game)
+    {
+        error = pksav_buffer_is_gen5_save(buffer, buffer_len, game, result_out);
+    }
+
+    return error;
+}
+
+typedef struct
+{
+    const char* name;
+    pksav_error_t (*load)(const char*, bench_save_t*);
+    pksav_error_t (*load_buffer)(const uint8_t*, size_t, bench_save_t*);
+    pksav_error_t (*save)(const char*, bench_save_t*);
+    pksav_error_t (*free)(bench_save_t*);
+    pksav_error_t (*is_save)(const uint8_t*, size_t, bool*);
+} bench_generation_t;
+
+enum
+{
+    BENCH_GEN1 = 0,
+    BENCH_GEN2,
+    BENCH_GBA,
+    BENCH_GEN4,
+    BENCH_GEN5
+};
+
+static const bench_generation_t generations[] =
+{
+    {"gen1", gen1_load, gen1_load_buffer, gen1_save, gen1_free, gen1_is_save},
+    {"gen2", gen2_load, gen2_load_buffer, gen2_save, gen2_free, gen2_is_save},
+    {"gba",  gba_load,  gba_load_buffer,  gba_save,  gba_free,  gba_is_save},
+    {"gen4", gen4_load, gen4_load_buffer, gen4_save, gen4_free, gen4_is_save},
+    {"gen5", gen5_load, gen5_load_buffer, gen5_save, gen5_free, gen5_is_save},
+};
+
+// Sample saves from the test save repository, skipped if not present
+typedef struct
+{
+    size_t generation;
+    const char* subdir;
+    const char* filename;
+} bench_sample_save_t;
+
+static const bench_sample_save_t sample_saves[] =
+{
+    {BENCH_GEN1, "red_blue",          "pokemon_red.sav"},
+    {BENCH_GEN1, "yellow",            "pokemon_yellow.sav"},
+    {BENCH_GEN2, "gold_silver",       "pokemon_gold.sav"},
+    {BENCH_GEN2, "crystal",           "pokemon_crystal.sav"},
+    {BENCH_GBA,  "ruby_sapphire",     "pokemon_ruby.sav"},
+    {BENCH_GBA,  "emerald",           "pokemon_emerald.sav"},
+    {BENCH_GBA,  "firered_leafgreen", "pokemon_firered.sav"},
+};
+
+/*
+ * Synthetic saves: random contents from a fixed seed, so every run measures
+ * the same data, with whatever checksums each format validates.
+ */
+
+static uint32_t rng_state = 0x5041534B;
+
+static uint32_t rng_next(void)
+{
+    // xorshift32
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 17;
+    rng_state ^= rng_state << 5;
+
+    return rng_state;
+}
+
+static void randomize(
+    uint8_t* buffer,
+    size_t len
+)
+{
+    for(size_t i = 0; i < len; ++i)
+    {
+        buffer[i] = (uint8_t)(rng_next() >> 24);
+    }
+}
+
+static void write16(
+    uint8_t* buffer,
+    size_t offset,
+    uint16_t value
+)
+{
+    buffer[offset] = (uint8_t)(value & 0xFF);
+    buffer[offset+1] = (uint8_t)(value >> 8);
+}
+
+static void write32(
+    uint8_t* buffer,
+    size_t offset,
+    uint32_t value
+)
+{
+    write16(buffer, offset, (uint16_t)(value & 0xFFFF));
+    write16(buffer, offset+2, (uint16_t)(value >> 16));
+}
+
+static void make_gen1_save(
+    uint8_t* buffer
+)
+{
+    randomize(buffer, GEN1_SAVE_SIZE);
+
+    uint8_t checksum = 255;
+    for(size_t i = 0x2598; i < 0x3523; ++i)
+    {
+        checksum -= buffer[i];
+    }
+    buffer[0x3523] = checksum;
+}
+
+// Gold/Silver
+static void make_gen2_save(
+    uint8_t* buffer
+)
+{
+    randomize(buffer, GEN2_SAVE_SIZE);
+
+    uint16_t checksum1 = 0;
+    for(size_t i = 0x2009; i <= 0x2D68; ++i)
+    {
+        checksum1 += buffer[i];
+    }
+
+    uint16_t checksum2 = 0;
+    for(size_t i = 0x0C6B; i <= 0x17EC; ++i)
+    {
+        checksum2 += buffer[i];
+    }
+    for(size_t i = 0x3D96; i <= 0x3F3F; ++i)
+    {
+        checksum2 += buffer[i];
+    }
+    for(size_t i = 0x7E39; i <= 0x7E6C; ++i)
+    {
+        checksum2 += buffer[i];
+    }
+
+    write16(buffer, 0x2D69, checksum1);
+    write16(buffer, 0x7E6D, checksum2);
+}
+
+// Ruby/Sapphire, with both slots' sections rotated to different positions
+static void make_gba_save(
+    uint8_t* buffer
+)
+{
+    randomize(buffer, GBA_SAVE_SIZE);
+
+    for(size_t slot_index = 0; slot_index < 2; ++slot_index)
+    {
+        pksav_gba_save_slot_t* slot = (pksav_gba_save_slot_t*)&buffer[slot_index * GBA_SLOT_SIZE];
+        for(uint8_t i = 0; i < 14; ++i)
+        {
+            pksav_gba_save_section_t* section = &slot->sections_arr[i];
+            uint8_t section_id = (uint8_t)((i + 3 + (5 * slot_index)) % 14);
+
+            // The game code and security key share an offset in Ruby/Sapphire.
+            if(section_id == 0)
+            {
+                write32(section->data8, 0x00AC, 0);
+            }
+
+            section->footer.section_id = section_id;
+            section->footer.padding = 0;
+            section->footer.checksum = pksav_littleendian16(
+                                           pksav_get_gba_section_checksum(section, section_id)
+                                       );
+            section->footer.validation = pksav_littleendian32(GBA_VALIDATION);
+            section->footer.save_index = pksav_littleendian32((uint32_t)(10 + slot_index));
+        }
+    }
+}
+
+// Diamond/Pearl, with the second copy of each block newest
+static void make_gen4_save(
+    uint8_t* buffer
+)
+{
+    randomize(buffer, NDS_SAVE_SIZE);
+
+    for(size_t copy = 0; copy < 2; ++copy)
+    {
+        uint8_t* general = &buffer[copy * GEN4_COPY_SIZE];
+        uint8_t* storage = general + GEN4_GENERAL_SIZE;
+        write32(general, GEN4_PARTY_OFFSET, 6);
+
+        const struct
+        {
+            uint8_t* block;
+            size_t size;
+        } blocks[] =
+        {
+            {general, GEN4_GENERAL_SIZE},
+            {storage, GEN4_STORAGE_SIZE}
+        };
+        for(size_t i = 0; i < 2; ++i)
+        {
+            uint8_t* block = blocks[i].block;
+            size_t size = blocks[i].size;
+
+            write32(block, size - GEN4_FOOTER_SIZE, (uint32_t)(1 + copy));
+            write16(block, size - 2, pksav_crc16_ccitt(block, size - GEN4_FOOTER_SIZE));
+        }
+    }
+}
+
+// Black/White
+static void make_gen5_save(
+    uint8_t* buffer
+)
+{
+    randomize(buffer, NDS_SAVE_SIZE);
+    write32(buffer, GEN5_PARTY_OFFSET + 4, 6);
+
+    const struct
+    {
+        size_t index;
+        size_t offset;
+        size_t size;
+    } blocks[] =
+    {
+        {26, GEN5_PARTY_OFFSET,   GEN5_PARTY_SIZE},
+        {27, GEN5_TRAINER_OFFSET, GEN5_TRAINER_SIZE}
+    };
+
+    for(size_t i = 0; i < PKSAV_GEN5_NUM_POKEMON_BOXES; ++i)
+    {
+        size_t offset = GEN5_BOXES_OFFSET + (i * GEN5_BOX_STRIDE);
+        size_t size = sizeof(pksav_gen5_pokemon_box_t);
+        uint16_t checksum = pksav_crc16_ccitt(&buffer[offset], size);
+
+        write16(buffer, offset + size + 2, checksum);
+        write16(buffer, GEN5_TABLE_OFFSET + (2 * (1 + i)), checksum);
+    }
+    for(size_t i = 0; i < (sizeof(blocks)/sizeof(blocks[0])); ++i)
+    {
+        uint16_t checksum = pksav_crc16_ccitt(&buffer[blocks[i].offset], blocks[i].size);
+
+        write16(buffer, blocks[i].offset + blocks[i].size + 2, checksum);
+        write16(buffer, GEN5_TABLE_OFFSET + (2 * blocks[i].index), checksum);
+    }
+
+    write16(
+        buffer,
+        GEN5_TABLE_CHECKSUM_OFFSET,
+        pksav_crc16_ccitt(&buffer[GEN5_TABLE_OFFSET], GEN5_TABLE_SIZE)
+    );
+}
+
+/*
+ * Benchmark harness
+ */
+
+typedef pksav_error_t (*bench_op_fcn_t)(void* arg);
+
+typedef struct
+{
+    bench_json_writer_t writer;
+    size_t num_reps;
+    size_t num_warmup;
+    uint64_t min_sample_ns;
+    const char* filter;
+    double* samples;
+    size_t num_failures;
+} bench_context_t;
+
+static void bench_run(
+    bench_context_t* context,
+    const char* source,
+    const char* save_name,
+    const char* function,
+    size_t bytes_per_op,
+    bench_op_fcn_t op,
+    void* arg
+)
+{
+    char name[256] = {0};
+    snprintf(name, sizeof(name), "%s/%s/%s", source, save_name, function);
+    if(context->filter && !strstr(name, context->filter))
+    {
+        return;
+    }
+
+    // Run once to check for errors and estimate how many calls fill a sample.
+    uint64_t start = bench_now_ns();
+    pksav_error_t error = op(arg);
+    uint64_t single_op_ns = bench_now_ns() - start;
+    if(error)
+    {
+        fprintf(stderr, "%s: %s\n", name, pksav_strerror(error));
+        ++context->num_failures;
+        return;
+    }
+
+    size_t ops_per_sample = 1;
+    if((single_op_ns > 0) && (single_op_ns < context->min_sample_ns))
+    {
+        ops_per_sample = (size_t)(context->min_sample_ns / single_op_ns);
+    }
+    else if(single_op_ns == 0)
+    {
+        ops_per_sample = 1000;
+    }
+
+    for(size_t rep = 0; rep < (context->num_warmup + context->num_reps); ++rep)
+    {
+        start = bench_now_ns();
+        for(size_t i = 0; i < ops_per_sample; ++i)
+        {
+            (void)op(arg);
+        }
+        uint64_t elapsed = bench_now_ns() - start;
+
+        if(rep >= context->num_warmup)
+        {
+            context->samples[rep - context->num_warmup] = (double)elapsed / (double)ops_per_sample;
+        }
+    }
+
+    bench_stats_t stats;
+    bench_get_stats(context->samples, context->num_reps, &stats);
+
+    bench_json_begin_result(&context->writer);
+    bench_json_add_string(&context->writer, "name", name);
+    bench_json_add_string(&context->writer, "source", source);
+    bench_json_add_string(&context->writer, "save", save_name);
+    bench_json_add_string(&context->writer, "function", function);
+    bench_json_add_uint(&context->writer, "reps", context->num_reps);
+    bench_json_add_uint(&context->writer, "ops_per_rep", ops_per_sample);
+    bench_json_add_uint(&context->writer, "bytes", bytes_per_op);
+    bench_json_add_double(&context->writer, "min_ns", stats.min);
+    bench_json_add_double(&context->writer, "mean_ns", stats.mean);
+    bench_json_add_double(&context->writer, "p50_ns", stats.p50);
+    bench_json_add_double(&context->writer, "p90_ns", stats.p90);
+    bench_json_add_double(&context->writer, "p99_ns", stats.p99);
+    bench_json_add_double(&context->writer, "max_ns", stats.max);
+    bench_json_add_double(&context->writer, "ops_per_sec", 1e9 / stats.p50);
+    if(bytes_per_op > 0)
+    {
+        bench_json_add_double(&context->writer, "mb_per_sec", ((double)bytes_per_op / 1e6) / (stats.p50 / 1e9));
+    }
+}
+
+/*
+ * Save operations
+ */
+
+typedef struct
+{
+    const bench_generation_t* generation;
+    const char* filepath;
+    const char* output_filepath;
+    const uint8_t* buffer;
+    size_t buffer_len;
+    bench_save_t loaded_save;
+} bench_save_arg_t;
+
+static pksav_error_t op_load(void* arg)
+{
+    bench_save_arg_t* save_arg = (bench_save_arg_t*)arg;
+    bench_save_t save;
+
+    pksav_error_t error = save_arg->generation->load(save_arg->filepath, &save);
+    if(!error)
+    {
+        save_arg->generation->free(&save);
+    }
+
+    return error;
+}
+
+static pksav_error_t op_load_buffer(void* arg)
+{
+    bench_save_arg_t* save_arg = (bench_save_arg_t*)arg;
+    bench_save_t save;
+
+    pksav_error_t error = save_arg->generation->load_buffer(save_arg->buffer, save_arg->buffer_len, &save);
+    if(!error)
+    {
+        save_arg->generation->free(&save);
+    }
+
+    return error;
+}
+
+static pksav_error_t op_save(void* arg)
+{
+    bench_save_arg_t* save_arg = (bench_save_arg_t*)arg;
+
+    return save_arg->generation->save(save_arg->output_filepath, &save_arg->loaded_save);
+}
+
+static pksav_error_t op_is_save(void* arg)
+{
+    bench_save_arg_t* save_arg = (bench_save_arg_t*)arg;
+    bool is_save = false;
+
+    pksav_error_t error = save_arg->generation->is_save(save_arg->buffer, save_arg->buffer_len, &is_save);
+    if(!error && !is_save)
+    {
+        error = PKSAV_ERROR_INVALID_SAVE;
+    }
+
+    return error;
+}
+
+static void bench_save(
+    bench_context_t* context,
+    const char* source,
+    const char* save_name,
+    const bench_generation_t* generation,
+    const char* filepath,
+    const char* output_filepath,
+    const uint8_t* buffer,
+    size_t buffer_len
+)
+{
+    char function[64] = {0};
+
+    bench_save_arg_t save_arg;
+    memset(&save_arg, 0, sizeof(save_arg));
+    save_arg.generation = generation;
+    save_arg.filepath = filepath;
+    save_arg.output_filepath = output_filepath;
+    save_arg.buffer = buffer;
+    save_arg.buffer_len = buffer_len;
+
+    snprintf(function, sizeof(function), "pksav_%s_save_load", generation->name);
+    bench_run(context, source, save_name, function, buffer_len, op_load, &save_arg);
+
+    snprintf(function, sizeof(function), "pksav_%s_save_load_buffer", generation->name);
+    bench_run(context, source, save_name, function, buffer_len, op_load_buffer, &save_arg);
+
+    pksav_error_t error = generation->load_buffer(buffer, buffer_len, &save_arg.loaded_save);
+    if(!error)
+    {
+        snprintf(function, sizeof(function), "pksav_%s_save_save", generation->name);
+        bench_run(context, source, save_name, function, buffer_len, op_save, &save_arg);
+        generation->free(&save_arg.loaded_save);
+    }
+
+    snprintf(function, sizeof(function), "pksav_buffer_is_%s_save", generation->name);
+    bench_run(context, source, save_name, function, buffer_len, op_is_save, &save_arg);
+}
+
+/*
+ * Internals: GBA shuffling and encryption, and checksums
+ */
+
+typedef struct
+{
+    pksav_gba_save_slot_t shuffled;
+    pksav_gba_save_slot_t unshuffled;
+    uint8_t section_nums[14];
+    pksav_gba_pc_pokemon_t gba_pokemon[NUM_BOX_POKEMON];
+    pksav_nds_pc_pokemon_t nds_pokemon[NUM_BOX_POKEMON];
+    uint8_t* nds_block;
+    uint16_t checksums[NUM_BOX_POKEMON];
+} bench_internals_arg_t;
+
+static pksav_error_t op_gba_unshuffle(void* arg)
+{
+    bench_internals_arg_t* internals = (bench_internals_arg_t*)arg;
+    pksav_gba_save_unshuffle_sections(&internals->shuffled, &internals->unshuffled, internals->section_nums);
+    bench_consume(&internals->unshuffled, sizeof(internals->unshuffled));
+
+    return PKSAV_ERROR_NONE;
+}
+
+static pksav_error_t op_gba_shuffle(void* arg)
+{
+    bench_internals_arg_t* internals = (bench_internals_arg_t*)arg;
+    pksav_gba_save_shuffle_sections(&internals->unshuffled, &internals->shuffled, internals->section_nums);
+    bench_consume(&internals->shuffled, sizeof(internals->shuffled));
+
+    return PKSAV_ERROR_NONE;
+}
+
+// Decrypts and re-encrypts a box's worth of Pokémon.
+static pksav_error_t op_gba_crypt_pokemon(void* arg)
+{
+    bench_internals_arg_t* internals = (bench_internals_arg_t*)arg;
+    for(size_t i = 0; i < NUM_BOX_POKEMON; ++i)
+    {
+        pksav_gba_crypt_pokemon(&internals->gba_pokemon[i], false);
+    }
+    for(size_t i = 0; i < NUM_BOX_POKEMON; ++i)
+    {
+        pksav_gba_crypt_pokemon(&internals->gba_pokemon[i], true);
+    }
+    bench_consume(internals->gba_pokemon, sizeof(internals->gba_pokemon));
+
+    return PKSAV_ERROR_NONE;
+}
+
+static pksav_error_t op_gba_pokemon_checksum(void* arg)
+{
+    bench_internals_arg_t* internals = (bench_internals_arg_t*)arg;
+    for(size_t i = 0; i < NUM_BOX_POKEMON; ++i)
+    {
+        internals->checksums[i] = pksav_get_gba_pokemon_checksum(&internals->gba_pokemon[i]);
+    }
+    bench_consume(internals->checksums, sizeof(internals->checksums));
+
+    return PKSAV_ERROR_NONE;
+}
+
+static pksav_error_t op_gba_section_checksum(void* arg)
+{
+    bench_internals_arg_t* internals = (bench_internals_arg_t*)arg;
+    for(uint8_t i = 0; i < 14; ++i)
+    {
+        internals->checksums[i] = pksav_get_gba_section_checksum(&internals->unshuffled.sections_arr[i], i);
+    }
+    bench_consume(internals->checksums, sizeof(internals->checksums));
+
+    return PKSAV_ERROR_NONE;
+}
+
+static pksav_error_t op_nds_pokemon_checksum(void* arg)
+{
+    bench_internals_arg_t* internals = (bench_internals_arg_t*)arg;
+    for(size_t i = 0; i < NUM_BOX_POKEMON; ++i)
+    {
+        (void)pksav_nds_get_pokemon_checksum(&internals->nds_pokemon[i], &internals->checksums[i]);
+    }
+    bench_consume(internals->checksums, sizeof(internals->checksums));
+
+    return PKSAV_ERROR_NONE;
+}
+
+static pksav_error_t op_crc16_ccitt(void* arg)
+{
+    bench_internals_arg_t* internals = (bench_internals_arg_t*)arg;
+    internals->checksums[0] = pksav_crc16_ccitt(internals->nds_block, GEN4_GENERAL_SIZE);
+    bench_consume(internals->checksums, sizeof(uint16_t));
+
+    return PKSAV_ERROR_NONE;
+}
+
+static void bench_internals(
+    bench_context_t* context,
+    const uint8_t* gba_save,
+    uint8_t* gen4_save
+)
+{
+    bench_internals_arg_t* internals = calloc(1, sizeof(bench_internals_arg_t));
+    memcpy(&internals->shuffled, gba_save, sizeof(internals->shuffled));
+    pksav_gba_save_unshuffle_sections(&internals->shuffled, &internals->unshuffled, internals->section_nums);
+
+    randomize((uint8_t*)internals->gba_pokemon, sizeof(internals->gba_pokemon));
+    randomize((uint8_t*)internals->nds_pokemon, sizeof(internals->nds_pokemon));
+    internals->nds_block = gen4_save;
+
+    bench_run(context, "synthetic", "gba", "pksav_gba_save_unshuffle_sections",
+              sizeof(pksav_gba_save_slot_t), op_gba_unshuffle, internals);
+    bench_run(context, "synthetic", "gba", "pksav_gba_save_shuffle_sections",
+              sizeof(pksav_gba_save_slot_t), op_gba_shuffle, internals);
+    bench_run(context, "synthetic", "gba_box", "pksav_gba_crypt_pokemon",
+              2 * sizeof(internals->gba_pokemon), op_gba_crypt_pokemon, internals);
+    bench_run(context, "synthetic", "gba_box", "pksav_get_gba_pokemon_checksum",
+              sizeof(internals->gba_pokemon), op_gba_pokemon_checksum, internals);
+    bench_run(context, "synthetic", "gba", "pksav_get_gba_section_checksum",
+              sizeof(pksav_gba_save_slot_t), op_gba_section_checksum, internals);
+    bench_run(context, "synthetic", "nds_box", "pksav_nds_get_pokemon_checksum",
+              sizeof(internals->nds_pokemon), op_nds_pokemon_checksum, internals);
+    bench_run(context, "synthetic", "gen4", "pksav_crc16_ccitt",
+              GEN4_GENERAL_SIZE, op_crc16_ccitt, internals);
+
+    free(internals);
+}
+
+/*
+ * Files
+ */
+
+static const char* get_tmp_dir(void)
+{
+    const char* tmp_dir = getenv("TMPDIR");
+    if(!tmp_dir)
+    {
+        tmp_dir = getenv("TMP");
+    }
+    if(!tmp_dir)
+    {
+        tmp_dir = getenv("TEMP");
+    }
+
+    return tmp_dir ? tmp_dir : "/tmp";
+}
+
+static bool write_file(
+    const char* filepath,
+    const uint8_t* buffer,
+    size_t len
+)
+{
+    FILE* file = fopen(filepath, "wb");
+    if(!file)
+    {
+        return false;
+    }
+
+    size_t num_written = fwrite(buffer, 1, len, file);
+    fclose(file);
+
+    return (num_written == len);
+}
+
+static size_t read_file(
+    const char* filepath,
+    uint8_t* buffer,
+    size_t max_len
+)
+{
+    FILE* file = fopen(filepath, "rb");
+    if(!file)
+    {
+        return 0;
+    }
+
+    size_t num_read = fread(buffer, 1, max_len, file);
+    fclose(file);
+
+    return num_read;
+}
+
+/*
+ * Compare mode
+ */
+
+#define MAX_LINE_LEN 1024
+
+static int compare_runs(
+    const char* baseline_filepath,
+    const char* current_filepath,
+    double threshold
+)
+{
+    FILE* baseline_file = fopen(baseline_filepath, "r");
+    FILE* current_file = fopen(current_filepath, "r");
+    if(!baseline_file || !current_file)
+    {
+        fprintf(stderr, "Failed to open %s\n", (baseline_file ? current_filepath : baseline_filepath));
+        if(baseline_file)
+        {
+            fclose(baseline_file);
+        }
+        if(current_file)
+        {
+            fclose(current_file);
+        }
+        return EXIT_FAILURE;
+    }
+
+    bench_json_writer_t writer;
+    bench_json_begin(&writer, stdout);
+
+    size_t num_regressions = 0;
+    char current_line[MAX_LINE_LEN];
+    char baseline_line[MAX_LINE_LEN];
+    char name[256];
+    char baseline_name[256];
+
+    while(fgets(current_line, sizeof(current_line), current_file))
+    {
+        double current_p50 = 0.0;
+        if(!bench_json_get_string(current_line, "name", name, sizeof(name)) ||
+           !bench_json_get_double(current_line, "p50_ns", &current_p50))
+        {
+            continue;
+        }
+
+        // Runs are small, so just rescan the baseline for each benchmark.
+        bool found = false;
+        double baseline_p50 = 0.0;
+        rewind(baseline_file);
+        while(!found && fgets(baseline_line, sizeof(baseline_line), baseline_file))
+        {
+            found = bench_json_get_string(baseline_line, "name", baseline_name, sizeof(baseline_name)) &&
+                    !strcmp(name, baseline_name) &&
+                    bench_json_get_double(baseline_line, "p50_ns", &baseline_p50);
+        }
+
+        bench_json_begin_result(&writer);
+        bench_json_add_string(&writer, "name", name);
+        bench_json_add_double(&writer, "current_p50_ns", current_p50);
+        if(!found || (baseline_p50 <= 0.0))
+        {
+            bench_json_add_string(&writer, "status", "new");
+            continue;
+        }
+
+        double change_percent = ((current_p50 - baseline_p50) / baseline_p50) * 100.0;
+        const char* status = "unchanged";
+        if(change_percent > threshold)
+        {
+            status = "regression";
+            ++num_regressions;
+        }
+        else if(change_percent < -threshold)
+        {
+            status = "improvement";
+        }
+
+        bench_json_add_double(&writer, "baseline_p50_ns", baseline_p50);
+        bench_json_add_double(&writer, "change_percent", change_percent);
+        bench_json_add_string(&writer, "status", status);
+    }
+
+    // Then list anything in the baseline that's no longer run.
+    rewind(baseline_file);
+    while(fgets(baseline_line, sizeof(baseline_line), baseline_file))
+    {
+        double baseline_p50 = 0.0;
+        if(!bench_json_get_string(baseline_line, "name", baseline_name, sizeof(baseline_name)) ||
+           !bench_json_get_double(baseline_line, "p50_ns", &baseline_p50))
+        {
+            continue;
+        }
+
+        bool found = false;
+        rewind(current_file);
+        while(!found && fgets(current_line, sizeof(current_line), current_file))
+        {
+            found = bench_json_get_string(current_line, "name", name, sizeof(name)) &&
+                    !strcmp(name, baseline_name);
+        }
+        if(!found)
+        {
+            bench_json_begin_result(&writer);
+            bench_json_add_string(&writer, "name", baseline_name);
+            bench_json_add_double(&writer, "baseline_p50_ns", baseline_p50);
+            bench_json_add_string(&writer, "status", "removed");
+        }
+    }
+
+    bench_json_end(&writer);
+    fclose(current_file);
+    fclose(baseline_file);
+
+    if(num_regressions > 0)
+    {
+        fprintf(stderr, "%zu benchmark(s) regressed by more than %.1f%%.\n", num_regressions, threshold);
+    }
+
+    return num_regressions ? EXIT_FAILURE : EXIT_SUCCESS;
+}
+
+static void print_usage(
+    const char* program_name
+)
+{
+    fprintf(stderr, "Usage: %s [--reps N] [--warmup N] [--min-sample-us N] [--filter SUBSTRING] [--saves-dir DIR]\n", program_name);
+    fprintf(stderr, "       %s --compare BASELINE.json CURRENT.json [--threshold PERCENT]\n", program_name);
+}
+
+int main(int argc, char** argv)
+{
+    bench_context_t context;
+    memset(&context, 0, sizeof(context));
+    context.num_reps = 50;
+    context.num_warmup = 5;
+    context.min_sample_ns = 200000;
+
+    const char* saves_dir = getenv("PKSAV_TEST_SAVES");
+    const char* baseline_filepath = NULL;
+    const char* current_filepath = NULL;
+    double threshold = 5.0;
+
+    for(int i = 1; i < argc; ++i)
+    {
+        if(!strcmp(argv[i], "--reps") && ((i+1) < argc))
+        {
+            context.num_reps = (size_t)strtoul(argv[++i], NULL, 10);
+        }
+        else if(!strcmp(argv[i], "--warmup") && ((i+1) < argc))
+        {
+            context.num_warmup = (size_t)strtoul(argv[++i], NULL, 10);
+        }
+        else if(!strcmp(argv[i], "--min-sample-us") && ((i+1) < argc))
+        {
+            context.min_sample_ns = (uint64_t)strtoul(argv[++i], NULL, 10) * 1000;
+        }
+        else if(!strcmp(argv[i], "--filter") && ((i+1) < argc))
+        {
+            context.filter = argv[++i];
+        }
+        else if(!strcmp(argv[i], "--saves-dir") && ((i+1) < argc))
+        {
+            saves_dir = argv[++i];
+        }
+        else if(!strcmp(argv[i], "--compare") && ((i+2) < argc))
+        {
+            baseline_filepath = argv[++i];
+            current_filepath = argv[++i];
+        }
+        else if(!strcmp(argv[i], "--threshold") && ((i+1) < argc))
+        {
+            threshold = atof(argv[++i]);
+        }
+        else
+        {
+            print_usage(argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    if(baseline_filepath)
+    {
+        return compare_runs(baseline_filepath, current_filepath, threshold);
+    }
+    if(context.num_reps == 0)
+    {
+        print_usage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    context.samples = calloc(context.num_reps, sizeof(double));
+
+    static char input_filepath[256];
+    static char output_filepath[256];
+    snprintf(input_filepath, sizeof(input_filepath), "%s%spksav_bench_input.sav", get_tmp_dir(), FS_SEPARATOR);
+    snprintf(output_filepath, sizeof(output_filepath), "%s%spksav_bench_output.sav", get_tmp_dir(), FS_SEPARATOR);
+
+    static const size_t synthetic_sizes[] =
+    {
+        GEN1_SAVE_SIZE, GEN2_SAVE_SIZE, GBA_SAVE_SIZE, NDS_SAVE_SIZE, NDS_SAVE_SIZE
+    };
+    static void (*const synthetic_fcns[])(uint8_t*) =
+    {
+        make_gen1_save, make_gen2_save, make_gba_save, make_gen4_save, make_gen5_save
+    };
+    uint8_t* synthetic_saves[5];
+    for(size_t i = 0; i < 5; ++i)
+    {
+        synthetic_saves[i] = calloc(synthetic_sizes[i], 1);
+        synthetic_fcns[i](synthetic_saves[i]);
+    }
+
+    bench_json_begin(&context.writer, stdout);
+
+    for(size_t i = 0; i < 5; ++i)
+    {
+        if(!write_file(input_filepath, synthetic_saves[i], synthetic_sizes[i]))
+        {
+            fprintf(stderr, "Failed to write %s\n", input_filepath);
+            ++context.num_failures;
+            continue;
+        }
+        bench_save(
+            &context,
+            "synthetic",
+            generations[i].name,
+            &generations[i],
+            input_filepath,
+            output_filepath,
+            synthetic_saves[i],
+            synthetic_sizes[i]
+        );
+    }
+
+    bench_internals(&context, synthetic_saves[BENCH_GBA], synthetic_saves[BENCH_GEN4]);
+
+    if(saves_dir)
+    {
+        uint8_t* sample_buffer = calloc(MAX_SAVE_SIZE, 1);
+        for(size_t i = 0; i < (sizeof(sample_saves)/sizeof(sample_saves[0])); ++i)
+        {
+            char filepath[512] = {0};
+            snprintf(
+                filepath, sizeof(filepath),
+                "%s%s%s%s%s",
+                saves_dir, FS_SEPARATOR, sample_saves[i].subdir, FS_SEPARATOR, sample_saves[i].filename
+            );
+
+            size_t sample_size = read_file(filepath, sample_buffer, MAX_SAVE_SIZE);
+            if(sample_size == 0)
+            {
+                fprintf(stderr, "Skipping %s\n", filepath);
+                continue;
+            }
+
+            bench_save(
+                &context,
+                "sample",
+                sample_saves[i].filename,
+                &generations[sample_saves[i].generation],
+                filepath,
+                output_filepath,
+                sample_buffer,
+                sample_size
+            );
+        }
+        free(sample_buffer);
+    }
+
+    bench_json_end(&context.writer);
+
+    remove(input_filepath);
+    remove(output_filepath);
+    for(size_t i = 0; i < 5; ++i)
+    {
+        free(synthetic_saves[i]);
+    }
+    free(context.samples);
+
+    return context.num_failures ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,306 @@
+/*
+ * Copyright (c) 2018 Nicholas Corgan (n.corgan@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+
+/*
+ * Measures the throughput of every text conversion function in strings per
+ * second and (UTF-8) megabytes per second, over a Latin-only corpus and, for
+ * the generations whose character maps support it, a mixed Japanese corpus.
+ * For the generations with a batch path, the batch call is measured against
+ * converting the same records one string at a time.
+ *
+ * Usage: pksav-bench-text [--min-time SECONDS] [--filter SUBSTRING]
+ *
+ * Results are printed to stdout as JSON.
+ */
+
+#include "bench-common.h"
+
+#include <pksav.h>
+
+#include <string.h>
+
+#define NUM_RECORDS   4096
+#define RECORD_CHARS  32
+#define RECORD_BYTES  (RECORD_CHARS * sizeof(uint16_t))
+#define OUTPUT_STRIDE 64
+
+static const char* latin_corpus[] =
+{
+    "Bulbasaur", "Nidoran♀", "Nidoran♂", "Flabébé", "Farfetch'd",
+    "Mr. Mime", "Ho-Oh", "Porygon2", "RED", "BLUE", "Gary", "Ash",
+    "Évoli", "Léviator", "Ectoplasma", "Dracaufeu", "Smogogo",
+    "Tortank", "Pikachu", "Charizard", "Sparky", "MISTY", "Brock",
+    NULL
+};
+
+static const char* japanese_corpus[] =
+{
+    "フシギダネ", "ピカチュウ", "ヒトカゲ", "サトシ", "シゲル",
+    "ミュウツー", "ポッチャマ", "ナエトル", "ヒコザル", "ツタージャ",
+    "ポカブ", "ミジュマル", "カスミ", "タケシ", "ピカチュウ２",
+    "Ｎ", "コイキング", "ゲンガー", "ポリゴン２", "ブイ",
+    NULL
+};
+
+typedef struct
+{
+    const char* name;
+    const char** strings;
+    // Expanded to NUM_RECORDS entries
+    const char* records[NUM_RECORDS];
+    size_t total_bytes;
+} text_corpus_t;
+
+typedef pksav_error_t (*text_from_fcn_t)(const void*, char*, size_t);
+typedef pksav_error_t (*text_to_fcn_t)(const char*, void*, size_t);
+typedef pksav_error_t (*text_from_batch_fcn_t)(
+                          const uint16_t*, size_t, size_t, size_t, char*, size_t
+                      );
+typedef pksav_error_t (*text_from_utf8_fcn_t)(
+                          const uint16_t*, size_t, char*, size_t, size_t*
+                      );
+
+/*
+ * Wrappers to give every generation the same signature
+ */
+
+#define PKSAV_BENCH_TEXT_WRAPPERS(gen, type) \
+    static pksav_error_t text_from_ ## gen (const void* input, char* output, size_t num_chars) \
+    { \
+        return pksav_text_from_ ## gen ((const type*)input, output, num_chars); \
+    } \
+    static pksav_error_t text_to_ ## gen (const char* input, void* output, size_t num_chars) \
+    { \
+        return pksav_text_to_ ## gen (input, (type*)output, num_chars); \
+    }
+
+PKSAV_BENCH_TEXT_WRAPPERS(gen1, uint8_t)
+PKSAV_BENCH_TEXT_WRAPPERS(gen2, uint8_t)
+PKSAV_BENCH_TEXT_WRAPPERS(gba, uint8_t)
+PKSAV_BENCH_TEXT_WRAPPERS(gen4, uint16_t)
+PKSAV_BENCH_TEXT_WRAPPERS(gen5, uint16_t)
+
+typedef struct
+{
+    const char* name;
+    text_from_fcn_t text_from;
+    text_to_fcn_t text_to;
+    // Only for generations with a direct UTF-8 path
+    text_from_utf8_fcn_t text_from_utf8;
+    text_from_batch_fcn_t text_from_batch;
+    bool supports_japanese;
+} text_generation_t;
+
+static const text_generation_t generations[] =
+{
+    {"gen1", text_from_gen1, text_to_gen1, NULL, NULL, false},
+    {"gen2", text_from_gen2, text_to_gen2, NULL, NULL, false},
+    {"gba",  text_from_gba,  text_to_gba,  NULL, NULL, false},
+    {"gen4", text_from_gen4, text_to_gen4, pksav_text_from_gen4_utf8, pksav_text_from_gen4_batch, true},
+    {"gen5", text_from_gen5, text_to_gen5, pksav_text_from_gen5_utf8, pksav_text_from_gen5_batch, true},
+};
+#define NUM_GENERATIONS (sizeof(generations)/sizeof(generations[0]))
+
+static uint8_t records[NUM_RECORDS][RECORD_BYTES];
+static char output[NUM_RECORDS][OUTPUT_STRIDE];
+
+static void text_corpus_init(
+    text_corpus_t* corpus,
+    const char* name,
+    const char** strings
+)
+{
+    size_t num_strings = 0;
+    while(strings[num_strings])
+    {
+        ++num_strings;
+    }
+
+    corpus->name = name;
+    corpus->strings = strings;
+    corpus->total_bytes = 0;
+    for(size_t i = 0; i < NUM_RECORDS; ++i)
+    {
+        corpus->records[i] = strings[i % num_strings];
+        corpus->total_bytes += strlen(corpus->records[i]);
+    }
+}
+
+typedef enum
+{
+    TEXT_BENCH_TO,
+    TEXT_BENCH_FROM,
+    TEXT_BENCH_FROM_UTF8,
+    TEXT_BENCH_FROM_BATCH
+} text_bench_type_t;
+
+// One pass over every record in the corpus
+static void text_bench_pass(
+    const text_generation_t* generation,
+    const text_corpus_t* corpus,
+    text_bench_type_t type
+)
+{
+    switch(type)
+    {
+        case TEXT_BENCH_TO:
+            for(size_t i = 0; i < NUM_RECORDS; ++i)
+            {
+                (void)generation->text_to(corpus->records[i], records[i], RECORD_CHARS);
+            }
+            break;
+
+        case TEXT_BENCH_FROM:
+            for(size_t i = 0; i < NUM_RECORDS; ++i)
+            {
+                (void)generation->text_from(records[i], output[i], RECORD_CHARS);
+            }
+            break;
+
+        case TEXT_BENCH_FROM_UTF8:
+            for(size_t i = 0; i < NUM_RECORDS; ++i)
+            {
+                (void)generation->text_from_utf8(
+                          (const uint16_t*)records[i],
+                          RECORD_CHARS,
+                          output[i],
+                          OUTPUT_STRIDE,
+                          NULL
+                      );
+            }
+            break;
+
+        case TEXT_BENCH_FROM_BATCH:
+            (void)generation->text_from_batch(
+                      (const uint16_t*)records[0],
+                      RECORD_BYTES,
+                      RECORD_CHARS,
+                      NUM_RECORDS,
+                      output[0],
+                      OUTPUT_STRIDE
+                  );
+            break;
+    }
+
+    bench_consume(output, sizeof(output));
+    bench_consume(records, sizeof(records));
+}
+
+static void text_bench_run(
+    bench_json_writer_t* writer,
+    const text_generation_t* generation,
+    const text_corpus_t* corpus,
+    text_bench_type_t type,
+    double min_time,
+    const char* filter
+)
+{
+    static const char* directions[] = {"to", "from", "from", "from"};
+    static const char* suffixes[] = {"", "", "_utf8", "_batch"};
+    static const char* path_names[] = {"single", "single", "single", "batch"};
+
+    char function_name[64] = {0};
+    snprintf(
+        function_name,
+        sizeof(function_name),
+        "pksav_text_%s_%s%s",
+        directions[type],
+        generation->name,
+        suffixes[type]
+    );
+    if(filter && !strstr(function_name, filter))
+    {
+        return;
+    }
+
+    // The records must hold this generation's encoding of the corpus.
+    for(size_t i = 0; i < NUM_RECORDS; ++i)
+    {
+        memset(records[i], 0xFF, RECORD_BYTES);
+        (void)generation->text_to(corpus->records[i], records[i], RECORD_CHARS);
+    }
+
+    // Warm up caches and any lazily built tables.
+    text_bench_pass(generation, corpus, type);
+
+    const uint64_t min_time_ns = (uint64_t)(min_time * 1e9);
+    size_t num_passes = 0;
+    uint64_t start = bench_now_ns();
+    uint64_t elapsed = 0;
+    do
+    {
+        text_bench_pass(generation, corpus, type);
+        ++num_passes;
+        elapsed = bench_now_ns() - start;
+    } while(elapsed < min_time_ns);
+
+    double seconds = (double)elapsed / 1e9;
+    uint64_t num_strings = (uint64_t)num_passes * NUM_RECORDS;
+    uint64_t num_bytes = (uint64_t)num_passes * corpus->total_bytes;
+
+    bench_json_begin_result(writer);
+    bench_json_add_string(writer, "function", function_name);
+    bench_json_add_string(writer, "corpus", corpus->name);
+    bench_json_add_string(writer, "path", path_names[type]);
+    bench_json_add_uint(writer, "strings", num_strings);
+    bench_json_add_uint(writer, "bytes", num_bytes);
+    bench_json_add_double(writer, "seconds", seconds);
+    bench_json_add_double(writer, "strings_per_sec", (double)num_strings / seconds);
+    bench_json_add_double(writer, "mb_per_sec", ((double)num_bytes / 1e6) / seconds);
+}
+
+int main(int argc, char** argv)
+{
+    double min_time = 0.25;
+    const char* filter = NULL;
+
+    for(int i = 1; i < argc; ++i)
+    {
+        if(!strcmp(argv[i], "--min-time") && ((i+1) < argc))
+        {
+            min_time = atof(argv[++i]);
+        }
+        else if(!strcmp(argv[i], "--filter") && ((i+1) < argc))
+        {
+            filter = argv[++i];
+        }
+        else
+        {
+            fprintf(stderr, "Usage: %s [--min-time SECONDS] [--filter SUBSTRING]\n", argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    static text_corpus_t latin, japanese;
+    text_corpus_init(&latin, "latin", latin_corpus);
+    text_corpus_init(&japanese, "japanese", japanese_corpus);
+
+    bench_json_writer_t writer;
+    bench_json_begin(&writer, stdout);
+
+    for(size_t i = 0; i < NUM_GENERATIONS; ++i)
+    {
+        const text_generation_t* generation = &generations[i];
+        const text_corpus_t* corpora[] = {&latin, &japanese};
+        size_t num_corpora = generation->supports_japanese ? 2 : 1;
+
+        for(size_t j = 0; j < num_corpora; ++j)
+        {
+            text_bench_run(&writer, generation, corpora[j], TEXT_BENCH_TO, min_time, filter);
+            text_bench_run(&writer, generation, corpora[j], TEXT_BENCH_FROM, min_time, filter);
+            if(generation->text_from_batch)
+            {
+                text_bench_run(&writer, generation, corpora[j], TEXT_BENCH_FROM_UTF8, min_time, filter);
+                text_bench_run(&writer, generation, corpora[j], TEXT_BENCH_FROM_BATCH, min_time, filter);
+            }
+        }
+    }
+
+    bench_json_end(&writer);
+
+    return EXIT_SUCCESS;
+}
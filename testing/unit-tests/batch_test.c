@@ -0,0 +1,339 @@
+/*
+ * Copyright (c) 2018 Nicholas Corgan (n.corgan@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "c_test_common.h"
+#include "test-utils.h"
+
+#include <pksav.h>
+
+#include <stdio.h>
+#include <string.h>
+
+#define GEN1_SAVE_SIZE     0x8000
+#define GEN1_MONEY         0x25F3
+#define GEN1_CHECKSUM      0x3523
+
+#define NUM_INPUTS         200
+#define NUM_THREADS        4
+
+typedef struct
+{
+    size_t num_calls;
+    size_t worker;
+    pksav_batch_save_type_t save_type;
+    pksav_error_t error;
+} batch_result_t;
+
+typedef struct
+{
+    size_t num_callocs;
+    size_t num_frees;
+} allocator_counts_t;
+
+static void set_gen1_checksum(
+    uint8_t* buffer
+)
+{
+    uint8_t checksum = 255;
+    for(size_t i = 0x2598; i < GEN1_CHECKSUM; ++i)
+    {
+        checksum -= buffer[i];
+    }
+    buffer[GEN1_CHECKSUM] = checksum;
+}
+
+/*
+ * Random data with a valid Generation I checksum, making sure it doesn't also
+ * happen to validate as a Generation II save.
+ */
+static void make_gen1_save(
+    uint8_t* buffer
+)
+{
+    bool is_gen2_save = true;
+    while(is_gen2_save)
+    {
+        TEST_ASSERT_EQUAL(0, randomize_buffer(buffer, GEN1_SAVE_SIZE));
+        set_gen1_checksum(buffer);
+
+        bool is_gold_silver = false;
+        bool is_crystal = false;
+        pksav_buffer_is_gen2_save(buffer, GEN1_SAVE_SIZE, false, &is_gold_silver);
+        pksav_buffer_is_gen2_save(buffer, GEN1_SAVE_SIZE, true, &is_crystal);
+        is_gen2_save = is_gold_silver || is_crystal;
+    }
+}
+
+static void* counting_calloc(
+    size_t num,
+    size_t size,
+    void* user_data
+)
+{
+    ++((allocator_counts_t*)user_data)->num_callocs;
+    return calloc(num, size);
+}
+
+static void counting_free(
+    void* ptr,
+    void* user_data
+)
+{
+    ++((allocator_counts_t*)user_data)->num_frees;
+    free(ptr);
+}
+
+static void gen1_save_load_buffer_test()
+{
+    char filepath[256] = {0};
+    snprintf(
+        filepath, sizeof(filepath),
+        "%s%spksav_%d_batch_load_buffer_test.sav",
+        get_tmp_dir(), FS_SEPARATOR, get_pid()
+    );
+
+    uint8_t* buffer = calloc(GEN1_SAVE_SIZE, 1);
+    make_gen1_save(buffer);
+
+    FILE* file = fopen(filepath, "wb");
+    TEST_ASSERT_NOT_NULL(file);
+    TEST_ASSERT_EQUAL(GEN1_SAVE_SIZE, fwrite(buffer, 1, GEN1_SAVE_SIZE, file));
+    fclose(file);
+
+    pksav_gen1_save_t file_save;
+    pksav_gen1_save_t buffer_save;
+
+    pksav_error_t error = pksav_gen1_save_load(filepath, &file_save);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+    error = pksav_gen1_save_load_buffer(buffer, GEN1_SAVE_SIZE, &buffer_save);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+
+    TEST_ASSERT_EQUAL_MEMORY(file_save.raw, buffer_save.raw, GEN1_SAVE_SIZE);
+    TEST_ASSERT_EQUAL(buffer_save.raw + GEN1_MONEY, buffer_save.money);
+
+    // The save has its own copy of the buffer.
+    TEST_ASSERT_TRUE(buffer_save.raw != buffer);
+
+    pksav_gen1_save_free(&file_save);
+    pksav_gen1_save_free(&buffer_save);
+
+    error = pksav_gen1_save_load_buffer(buffer, GEN1_SAVE_SIZE-1, &buffer_save);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_INVALID_SAVE, error);
+
+    ++buffer[GEN1_CHECKSUM];
+    error = pksav_gen1_save_load_buffer(buffer, GEN1_SAVE_SIZE, &buffer_save);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_INVALID_SAVE, error);
+
+    free(buffer);
+    TEST_ASSERT_EQUAL(0, delete_file(filepath));
+}
+
+static void thread_allocator_test()
+{
+    uint8_t* buffer = calloc(GEN1_SAVE_SIZE, 1);
+    make_gen1_save(buffer);
+
+    allocator_counts_t counts = {0, 0};
+    pksav_allocator_t allocator =
+    {
+        .calloc_fcn = counting_calloc,
+        .free_fcn = counting_free,
+        .user_data = &counts
+    };
+
+    pksav_set_thread_allocator(&allocator);
+
+    pksav_gen1_save_t gen1_save;
+    pksav_error_t error = pksav_gen1_save_load_buffer(buffer, GEN1_SAVE_SIZE, &gen1_save);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL(1, counts.num_callocs);
+    TEST_ASSERT_EQUAL(0, counts.num_frees);
+
+    pksav_gen1_save_free(&gen1_save);
+    TEST_ASSERT_EQUAL(1, counts.num_frees);
+
+    // Once reset, the default allocator is used again.
+    pksav_set_thread_allocator(NULL);
+
+    error = pksav_gen1_save_load_buffer(buffer, GEN1_SAVE_SIZE, &gen1_save);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+    pksav_gen1_save_free(&gen1_save);
+    TEST_ASSERT_EQUAL(1, counts.num_callocs);
+    TEST_ASSERT_EQUAL(1, counts.num_frees);
+
+    free(buffer);
+}
+
+// Each input has its own slot, so no locking is needed.
+static void store_result(
+    const pksav_batch_item_t* item,
+    void* user_data
+)
+{
+    batch_result_t* results = (batch_result_t*)user_data;
+
+    ++results[item->index].num_calls;
+    results[item->index].worker = item->worker;
+    results[item->index].save_type = item->save_type;
+    results[item->index].error = item->error;
+}
+
+static void batch_process_test()
+{
+    uint8_t* gen1_buffer = calloc(GEN1_SAVE_SIZE, 1);
+    uint8_t* junk_buffer = calloc(GEN1_SAVE_SIZE, 1);
+    make_gen1_save(gen1_buffer);
+    memcpy(junk_buffer, gen1_buffer, GEN1_SAVE_SIZE);
+    ++junk_buffer[GEN1_CHECKSUM];
+
+    // Every third input is invalid.
+    pksav_batch_input_t inputs[NUM_INPUTS];
+    memset(inputs, 0, sizeof(inputs));
+    size_t expected_num_failures = 0;
+    for(size_t i = 0; i < NUM_INPUTS; ++i)
+    {
+        if((i % 3) == 0)
+        {
+            inputs[i].buffer = junk_buffer;
+            ++expected_num_failures;
+        }
+        else
+        {
+            inputs[i].buffer = gen1_buffer;
+        }
+        inputs[i].buffer_len = GEN1_SAVE_SIZE;
+    }
+
+    batch_result_t results[NUM_INPUTS];
+    memset(results, 0, sizeof(results));
+
+    pksav_batch_options_t options;
+    memset(&options, 0, sizeof(options));
+    options.num_threads = NUM_THREADS;
+    options.result_fcn = store_result;
+    options.user_data = results;
+
+    size_t num_failures = 0;
+    pksav_error_t error = pksav_batch_process(inputs, NUM_INPUTS, &options, &num_failures);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL(expected_num_failures, num_failures);
+
+    for(size_t i = 0; i < NUM_INPUTS; ++i)
+    {
+        TEST_ASSERT_EQUAL(1, results[i].num_calls);
+        TEST_ASSERT_TRUE(results[i].worker < NUM_THREADS);
+        if((i % 3) == 0)
+        {
+            TEST_ASSERT_EQUAL(PKSAV_ERROR_INVALID_SAVE, results[i].error);
+            TEST_ASSERT_EQUAL(PKSAV_BATCH_SAVE_TYPE_NONE, results[i].save_type);
+        }
+        else
+        {
+            TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, results[i].error);
+            TEST_ASSERT_EQUAL(PKSAV_BATCH_SAVE_TYPE_GEN1, results[i].save_type);
+        }
+    }
+
+    // More threads than inputs
+    memset(results, 0, sizeof(results));
+    options.num_threads = 16;
+    error = pksav_batch_process(inputs, 3, &options, &num_failures);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL(1, num_failures);
+    for(size_t i = 0; i < 3; ++i)
+    {
+        TEST_ASSERT_EQUAL(1, results[i].num_calls);
+        TEST_ASSERT_TRUE(results[i].worker < 3);
+    }
+
+    // Nothing to do
+    error = pksav_batch_process(inputs, 0, &options, &num_failures);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL(0, num_failures);
+
+    free(junk_buffer);
+    free(gen1_buffer);
+}
+
+static pksav_error_t set_money(
+    pksav_batch_item_t* item,
+    void* user_data
+)
+{
+    (void)user_data;
+
+    if(item->save_type != PKSAV_BATCH_SAVE_TYPE_GEN1)
+    {
+        return PKSAV_ERROR_INVALID_SAVE;
+    }
+
+    item->save.gen1.money[0] = 0x12;
+    item->save.gen1.money[1] = 0x34;
+    item->save.gen1.money[2] = 0x56;
+
+    return PKSAV_ERROR_NONE;
+}
+
+static void batch_transform_test()
+{
+    char input_filepath[256] = {0};
+    char output_filepath[256] = {0};
+    snprintf(
+        input_filepath, sizeof(input_filepath),
+        "%s%spksav_%d_batch_input.sav",
+        get_tmp_dir(), FS_SEPARATOR, get_pid()
+    );
+    snprintf(
+        output_filepath, sizeof(output_filepath),
+        "%s%spksav_%d_batch_output.sav",
+        get_tmp_dir(), FS_SEPARATOR, get_pid()
+    );
+
+    uint8_t* buffer = calloc(GEN1_SAVE_SIZE, 1);
+    make_gen1_save(buffer);
+
+    FILE* file = fopen(input_filepath, "wb");
+    TEST_ASSERT_NOT_NULL(file);
+    TEST_ASSERT_EQUAL(GEN1_SAVE_SIZE, fwrite(buffer, 1, GEN1_SAVE_SIZE, file));
+    fclose(file);
+
+    pksav_batch_input_t input;
+    memset(&input, 0, sizeof(input));
+    input.filepath = input_filepath;
+    input.output_filepath = output_filepath;
+
+    pksav_batch_options_t options;
+    memset(&options, 0, sizeof(options));
+    options.num_threads = 1;
+    options.arena_size = 1024;
+    options.transform_fcn = set_money;
+
+    size_t num_failures = 0;
+    pksav_error_t error = pksav_batch_process(&input, 1, &options, &num_failures);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL(0, num_failures);
+
+    // The checksum should have been updated to match the new money.
+    pksav_gen1_save_t gen1_save;
+    error = pksav_gen1_save_load(output_filepath, &gen1_save);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL(0x12, gen1_save.money[0]);
+    TEST_ASSERT_EQUAL(0x34, gen1_save.money[1]);
+    TEST_ASSERT_EQUAL(0x56, gen1_save.money[2]);
+    pksav_gen1_save_free(&gen1_save);
+
+    free(buffer);
+    TEST_ASSERT_EQUAL(0, delete_file(output_filepath));
+    TEST_ASSERT_EQUAL(0, delete_file(input_filepath));
+}
+
+PKSAV_TEST_MAIN(
+    PKSAV_TEST(gen1_save_load_buffer_test)
+    PKSAV_TEST(thread_allocator_test)
+    PKSAV_TEST(batch_process_test)
+    PKSAV_TEST(batch_transform_test)
+)
@@ -0,0 +1,206 @@
+/*
+ * Copyright (c) 2018 Nicholas Corgan (n.corgan@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "c_test_common.h"
+#include "test-utils.h"
+
+#include <pksav.h>
+
+#include <stdio.h>
+#include <string.h>
+
+#define NUM_RECORDS    10
+#define MAX_CHUNK_ROWS 4
+
+static uint16_t read16(
+    const uint8_t* buffer
+)
+{
+    return (uint16_t)(buffer[0] | (buffer[1] << 8));
+}
+
+static uint32_t read32(
+    const uint8_t* buffer
+)
+{
+    return ((uint32_t)read16(buffer) | ((uint32_t)read16(buffer+2) << 16));
+}
+
+static void fill_records(
+    pksav_pokemon_record_t* records,
+    size_t num_records
+)
+{
+    memset(records, 0, sizeof(pksav_pokemon_record_t) * num_records);
+    for(size_t i = 0; i < num_records; ++i)
+    {
+        records[i].personality = 0x01020304 * (uint32_t)i;
+        records[i].exp = 1000 + (uint32_t)i;
+        records[i].pokedex_num = (uint16_t)(i + 1);
+        records[i].ot_public_id = 0xABCD;
+        for(size_t j = 0; j < 4; ++j)
+        {
+            records[i].moves[j] = (uint16_t)((i * 4) + j);
+        }
+        for(size_t j = 0; j < 6; ++j)
+        {
+            records[i].EVs[j] = (uint16_t)(i * 100);
+            records[i].IVs[j] = (uint8_t)(i + j);
+        }
+        records[i].level = (uint8_t)(i + 5);
+        records[i].generation = 3;
+        records[i].nature = (uint8_t)(i % 25);
+    }
+}
+
+static void columnar_writer_test()
+{
+    char filepath[256] = {0};
+    snprintf(
+        filepath, sizeof(filepath),
+        "%s%spksav_%d_columnar_test.bin",
+        get_tmp_dir(), FS_SEPARATOR, get_pid()
+    );
+
+    pksav_pokemon_record_t records[NUM_RECORDS];
+    fill_records(records, NUM_RECORDS);
+
+    pksav_columnar_writer_t writer;
+    pksav_error_t error = pksav_columnar_writer_open(filepath, MAX_CHUNK_ROWS, &writer);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+
+    // The first three come from save 7's party, the rest from save 8's third box.
+    error = pksav_columnar_writer_append(&writer, records, 3, 7, PKSAV_COLUMNAR_LOCATION_PARTY);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL(3, writer.num_buffered_rows);
+    TEST_ASSERT_EQUAL(0, writer.num_chunks);
+
+    error = pksav_columnar_writer_append(&writer, records+3, NUM_RECORDS-3, 8, 2);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL(2, writer.num_buffered_rows);
+    TEST_ASSERT_EQUAL(2, writer.num_chunks);
+
+    error = pksav_columnar_writer_close(&writer);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+
+    size_t filesize = 0;
+    TEST_ASSERT_EQUAL(0, get_filesize(filepath, &filesize));
+    uint8_t* buffer = calloc(filesize, 1);
+    TEST_ASSERT_EQUAL(0, read_file_into_buffer(filepath, buffer, filesize));
+
+    // Header
+    TEST_ASSERT_EQUAL(0, memcmp(buffer, PKSAV_COLUMNAR_MAGIC, 8));
+    TEST_ASSERT_EQUAL(PKSAV_COLUMNAR_VERSION, read32(buffer+8));
+    TEST_ASSERT_EQUAL(PKSAV_COLUMNAR_NUM_COLUMNS, read32(buffer+12));
+    TEST_ASSERT_EQUAL(MAX_CHUNK_ROWS, read32(buffer+16));
+    TEST_ASSERT_EQUAL(3, read32(buffer+20));
+    TEST_ASSERT_EQUAL(NUM_RECORDS, read32(buffer+24));
+    TEST_ASSERT_EQUAL(0, read32(buffer+28));
+
+    // Column descriptions
+    const uint8_t* columns = buffer + sizeof(pksav_columnar_header_t);
+    size_t row_sizes[PKSAV_COLUMNAR_NUM_COLUMNS] = {0};
+    for(size_t i = 0; i < PKSAV_COLUMNAR_NUM_COLUMNS; ++i)
+    {
+        const uint8_t* column = columns + (i * sizeof(pksav_columnar_column_t));
+        row_sizes[i] = read32(column+24) * read32(column+28);
+    }
+    TEST_ASSERT_EQUAL_STRING("save_index", (const char*)columns);
+    TEST_ASSERT_EQUAL_STRING("moves", (const char*)(columns + (PKSAV_COLUMNAR_MOVES * 32)));
+    TEST_ASSERT_EQUAL(8, row_sizes[PKSAV_COLUMNAR_MOVES]);
+    TEST_ASSERT_EQUAL(6, row_sizes[PKSAV_COLUMNAR_IVS]);
+    TEST_ASSERT_EQUAL(12, row_sizes[PKSAV_COLUMNAR_EVS]);
+
+    // Chunks
+    static const uint32_t expected_chunk_rows[] = {4, 4, 2};
+    size_t offset = sizeof(pksav_columnar_header_t)
+                  + (PKSAV_COLUMNAR_NUM_COLUMNS * sizeof(pksav_columnar_column_t));
+    size_t first_row = 0;
+    for(size_t chunk = 0; chunk < 3; ++chunk)
+    {
+        const uint8_t* chunk_header = buffer + offset;
+        uint32_t num_rows = read32(chunk_header+8);
+        uint32_t num_bytes = read32(chunk_header+12);
+        TEST_ASSERT_EQUAL(0, memcmp(chunk_header, PKSAV_COLUMNAR_CHUNK_MAGIC, 8));
+        TEST_ASSERT_EQUAL(expected_chunk_rows[chunk], num_rows);
+
+        const uint8_t* arrays[PKSAV_COLUMNAR_NUM_COLUMNS];
+        size_t array_offset = offset + sizeof(pksav_columnar_chunk_header_t);
+        for(size_t i = 0; i < PKSAV_COLUMNAR_NUM_COLUMNS; ++i)
+        {
+            TEST_ASSERT_EQUAL(0, array_offset % 8);
+            arrays[i] = buffer + array_offset;
+            array_offset += ((num_rows * row_sizes[i]) + 7) & ~7;
+        }
+        TEST_ASSERT_EQUAL(num_bytes, array_offset - offset - sizeof(pksav_columnar_chunk_header_t));
+
+        for(size_t row = 0; row < num_rows; ++row)
+        {
+            const pksav_pokemon_record_t* record = &records[first_row + row];
+            bool from_party = ((first_row + row) < 3);
+
+            TEST_ASSERT_EQUAL((from_party ? 7 : 8), read32(arrays[PKSAV_COLUMNAR_SAVE_INDEX] + (row * 4)));
+            TEST_ASSERT_EQUAL((from_party ? PKSAV_COLUMNAR_LOCATION_PARTY : 2), arrays[PKSAV_COLUMNAR_LOCATION][row]);
+            TEST_ASSERT_EQUAL(record->personality, read32(arrays[PKSAV_COLUMNAR_PERSONALITY] + (row * 4)));
+            TEST_ASSERT_EQUAL(record->exp, read32(arrays[PKSAV_COLUMNAR_EXP] + (row * 4)));
+            TEST_ASSERT_EQUAL(record->pokedex_num, read16(arrays[PKSAV_COLUMNAR_POKEDEX_NUM] + (row * 2)));
+            TEST_ASSERT_EQUAL(record->ot_public_id, read16(arrays[PKSAV_COLUMNAR_OT_PUBLIC_ID] + (row * 2)));
+            TEST_ASSERT_EQUAL(record->moves[3], read16(arrays[PKSAV_COLUMNAR_MOVES] + (row * 8) + 6));
+            TEST_ASSERT_EQUAL(record->EVs[5], read16(arrays[PKSAV_COLUMNAR_EVS] + (row * 12) + 10));
+            TEST_ASSERT_EQUAL_MEMORY(record->IVs, arrays[PKSAV_COLUMNAR_IVS] + (row * 6), 6);
+            TEST_ASSERT_EQUAL(record->level, arrays[PKSAV_COLUMNAR_LEVEL][row]);
+            TEST_ASSERT_EQUAL(record->generation, arrays[PKSAV_COLUMNAR_GENERATION][row]);
+            TEST_ASSERT_EQUAL(record->nature, arrays[PKSAV_COLUMNAR_NATURE][row]);
+        }
+
+        first_row += num_rows;
+        offset = array_offset;
+    }
+    TEST_ASSERT_EQUAL(filesize, offset);
+
+    free(buffer);
+    TEST_ASSERT_EQUAL(0, delete_file(filepath));
+}
+
+static void columnar_writer_params_test()
+{
+    char filepath[256] = {0};
+    snprintf(
+        filepath, sizeof(filepath),
+        "%s%spksav_%d_columnar_params_test.bin",
+        get_tmp_dir(), FS_SEPARATOR, get_pid()
+    );
+
+    pksav_columnar_writer_t writer;
+    pksav_error_t error = pksav_columnar_writer_open(
+                              filepath,
+                              PKSAV_COLUMNAR_MAX_CHUNK_ROWS + 1,
+                              &writer
+                          );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_PARAM_OUT_OF_RANGE, error);
+
+    error = pksav_columnar_writer_open(filepath, 0, &writer);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL(PKSAV_COLUMNAR_DEFAULT_CHUNK_ROWS, writer.max_chunk_rows);
+
+    // Closing an empty file leaves only the header and column descriptions.
+    error = pksav_columnar_writer_close(&writer);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+
+    size_t filesize = 0;
+    TEST_ASSERT_EQUAL(0, get_filesize(filepath, &filesize));
+    TEST_ASSERT_EQUAL(
+        sizeof(pksav_columnar_header_t) + (PKSAV_COLUMNAR_NUM_COLUMNS * sizeof(pksav_columnar_column_t)),
+        filesize
+    );
+    TEST_ASSERT_EQUAL(0, delete_file(filepath));
+}
+
+PKSAV_TEST_MAIN(
+    PKSAV_TEST(columnar_writer_test)
+    PKSAV_TEST(columnar_writer_params_test)
+)
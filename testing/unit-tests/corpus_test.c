@@ -0,0 +1,283 @@
+/*
+ * Copyright (c) 2018 Nicholas Corgan (n.corgan@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "c_test_common.h"
+
+#include <pksav.h>
+
+#include <string.h>
+
+#define GB_SAVE_SIZE      0x8000
+#define GBA_SAVE_SIZE     0x20000
+#define GBA_SLOT_SIZE     0xE000
+
+#define NUM_SEEDS         20
+
+static uint8_t* generate_save(
+    pksav_corpus_game_t game,
+    uint32_t seed,
+    size_t expected_save_size
+)
+{
+    uint8_t* buffer = calloc(PKSAV_CORPUS_MAX_SAVE_SIZE, 1);
+    TEST_ASSERT_NOT_NULL(buffer);
+
+    size_t save_size = 0;
+    pksav_error_t error = pksav_corpus_generate_save(
+                              game, seed, buffer, PKSAV_CORPUS_MAX_SAVE_SIZE, &save_size
+                          );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL(expected_save_size, save_size);
+
+    return buffer;
+}
+
+static void corpus_params_test()
+{
+    size_t save_size = 0;
+    uint8_t buffer[GB_SAVE_SIZE];
+
+    pksav_error_t error = pksav_corpus_get_save_size(PKSAV_CORPUS_YELLOW, &save_size);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL(GB_SAVE_SIZE, save_size);
+
+    error = pksav_corpus_get_save_size(PKSAV_CORPUS_EMERALD, &save_size);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL(GBA_SAVE_SIZE, save_size);
+
+    error = pksav_corpus_get_save_size((pksav_corpus_game_t)PKSAV_CORPUS_NUM_GAMES, &save_size);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_PARAM_OUT_OF_RANGE, error);
+
+    error = pksav_corpus_generate_save(
+                (pksav_corpus_game_t)PKSAV_CORPUS_NUM_GAMES, 0, buffer, sizeof(buffer), NULL
+            );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_PARAM_OUT_OF_RANGE, error);
+
+    // A Game Boy Advance save doesn't fit.
+    error = pksav_corpus_generate_save(
+                PKSAV_CORPUS_RUBY_SAPPHIRE, 0, buffer, sizeof(buffer), NULL
+            );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_PARAM_OUT_OF_RANGE, error);
+
+    error = pksav_corpus_generate_save(
+                PKSAV_CORPUS_RED_BLUE, 0, buffer, (sizeof(buffer) - 1), NULL
+            );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_PARAM_OUT_OF_RANGE, error);
+
+    // The size is optional.
+    error = pksav_corpus_generate_save(
+                PKSAV_CORPUS_RED_BLUE, 0, buffer, sizeof(buffer), NULL
+            );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+}
+
+static void corpus_determinism_test()
+{
+    for(int game = 0; game < PKSAV_CORPUS_NUM_GAMES; ++game)
+    {
+        size_t save_size = 0;
+        TEST_ASSERT_EQUAL(
+            PKSAV_ERROR_NONE,
+            pksav_corpus_get_save_size((pksav_corpus_game_t)game, &save_size)
+        );
+
+        uint8_t* save1 = generate_save((pksav_corpus_game_t)game, 12345, save_size);
+        uint8_t* save2 = generate_save((pksav_corpus_game_t)game, 12345, save_size);
+        uint8_t* save3 = generate_save((pksav_corpus_game_t)game, 12346, save_size);
+
+        TEST_ASSERT_EQUAL_MEMORY(save1, save2, save_size);
+        TEST_ASSERT_TRUE(memcmp(save1, save3, save_size) != 0);
+
+        free(save3);
+        free(save2);
+        free(save1);
+    }
+}
+
+static void corpus_gen1_test()
+{
+    for(uint32_t seed = 0; seed < NUM_SEEDS; ++seed)
+    {
+        for(int yellow = 0; yellow < 2; ++yellow)
+        {
+            pksav_corpus_game_t game = yellow ? PKSAV_CORPUS_YELLOW : PKSAV_CORPUS_RED_BLUE;
+            uint8_t* buffer = generate_save(game, seed, GB_SAVE_SIZE);
+
+            bool is_gen2_save = true;
+            pksav_buffer_is_gen2_save(buffer, GB_SAVE_SIZE, false, &is_gen2_save);
+            TEST_ASSERT_FALSE(is_gen2_save);
+
+            pksav_gen1_save_t gen1_save;
+            pksav_error_t error = pksav_gen1_save_load_buffer(buffer, GB_SAVE_SIZE, &gen1_save);
+            TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+            TEST_ASSERT_EQUAL((yellow != 0), gen1_save.yellow);
+
+            const pksav_gen1_pokemon_party_t* party = gen1_save.pokemon_party;
+            TEST_ASSERT_TRUE((party->count >= 1) && (party->count <= 6));
+            TEST_ASSERT_EQUAL(0xFF, party->species[party->count]);
+            for(size_t i = 0; i < party->count; ++i)
+            {
+                uint16_t pokedex_num = 0;
+                TEST_ASSERT_EQUAL(party->species[i], party->party[i].pc.species);
+                TEST_ASSERT_EQUAL(
+                    PKSAV_ERROR_NONE,
+                    pksav_gen1_species_to_pokedex_num(party->species[i], &pokedex_num)
+                );
+
+                bool owned = false;
+                pksav_get_pokedex_bit(gen1_save.pokedex_owned, pokedex_num, &owned);
+                TEST_ASSERT_TRUE(owned);
+
+                TEST_ASSERT_EQUAL(party->party[i].pc.level, party->party[i].party_data.level);
+                TEST_ASSERT_EQUAL(party->party[i].pc.current_hp, party->party[i].party_data.max_hp);
+            }
+
+            uint8_t current_box = (*gen1_save.current_pokemon_box_num & PKSAV_GEN1_CURRENT_POKEMON_BOX_NUM_MASK);
+            TEST_ASSERT_EQUAL_MEMORY(
+                gen1_save.pokemon_boxes[current_box],
+                gen1_save.current_pokemon_box,
+                sizeof(pksav_gen1_pokemon_box_t)
+            );
+
+            // Saving it again changes nothing.
+            uint8_t* resaved = calloc(GB_SAVE_SIZE, 1);
+            error = pksav_gen1_save_save_buffer(resaved, GB_SAVE_SIZE, &gen1_save);
+            TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+            TEST_ASSERT_EQUAL_MEMORY(buffer, resaved, GB_SAVE_SIZE);
+
+            pksav_gen1_save_free(&gen1_save);
+            free(resaved);
+            free(buffer);
+        }
+    }
+}
+
+static void corpus_gen2_test()
+{
+    for(uint32_t seed = 0; seed < NUM_SEEDS; ++seed)
+    {
+        for(int crystal = 0; crystal < 2; ++crystal)
+        {
+            pksav_corpus_game_t game = crystal ? PKSAV_CORPUS_CRYSTAL : PKSAV_CORPUS_GOLD_SILVER;
+            uint8_t* buffer = generate_save(game, seed, GB_SAVE_SIZE);
+
+            pksav_gen2_save_t gen2_save;
+            pksav_error_t error = pksav_gen2_save_load_buffer(buffer, GB_SAVE_SIZE, &gen2_save);
+            TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+            TEST_ASSERT_EQUAL((crystal ? PKSAV_GEN2_CRYSTAL : PKSAV_GEN2_GS), gen2_save.gen2_game);
+
+            const pksav_gen2_pokemon_party_t* party = gen2_save.pokemon_party;
+            TEST_ASSERT_TRUE((party->count >= 1) && (party->count <= 6));
+            TEST_ASSERT_EQUAL(0xFF, party->species[party->count]);
+            for(size_t i = 0; i < party->count; ++i)
+            {
+                TEST_ASSERT_EQUAL(party->species[i], party->party[i].pc.species);
+                TEST_ASSERT_TRUE((party->species[i] >= 1) && (party->species[i] <= 251));
+                TEST_ASSERT_EQUAL(
+                    party->party[i].party_data.current_hp,
+                    party->party[i].party_data.max_hp
+                );
+            }
+
+            uint8_t* resaved = calloc(GB_SAVE_SIZE, 1);
+            error = pksav_gen2_save_save_buffer(resaved, GB_SAVE_SIZE, &gen2_save);
+            TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+            TEST_ASSERT_EQUAL_MEMORY(buffer, resaved, GB_SAVE_SIZE);
+
+            pksav_gen2_save_free(&gen2_save);
+            free(resaved);
+            free(buffer);
+        }
+    }
+}
+
+static void check_gba_save(
+    const uint8_t* buffer,
+    pksav_gba_game_t expected_gba_game,
+    bool* from_first_slot_out
+)
+{
+    pksav_gba_save_t gba_save;
+    pksav_error_t error = pksav_gba_save_load_buffer(buffer, GBA_SAVE_SIZE, &gba_save);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL(expected_gba_game, gba_save.gba_game);
+
+    const pksav_gba_pokemon_party_t* party = gba_save.pokemon_party;
+    uint32_t party_count = pksav_littleendian32(party->count);
+    TEST_ASSERT_TRUE((party_count >= 1) && (party_count <= 6));
+
+    // The Pokémon are decrypted, so their checksums can be checked directly.
+    for(size_t i = 0; i < party_count; ++i)
+    {
+        const pksav_gba_pc_pokemon_t* pc = &party->party[i].pc;
+
+        uint16_t checksum = 0;
+        for(size_t j = 0; j < 24; ++j)
+        {
+            checksum += pksav_littleendian16(pc->blocks.blocks16[j]);
+        }
+        TEST_ASSERT_EQUAL(checksum, pksav_littleendian16(pc->checksum));
+        TEST_ASSERT_TRUE(pksav_littleendian16(pc->blocks.growth.species) > 0);
+
+        bool owned = false;
+        uint16_t pokedex_num = 0;
+        TEST_ASSERT_EQUAL(
+            PKSAV_ERROR_NONE,
+            pksav_gba_species_to_pokedex_num(pksav_littleendian16(pc->blocks.growth.species), &pokedex_num)
+        );
+        pksav_get_pokedex_bit(gba_save.pokedex_owned, pokedex_num, &owned);
+        TEST_ASSERT_TRUE(owned);
+    }
+    TEST_ASSERT_TRUE(pksav_littleendian32(gba_save.pokemon_pc->current_box) < 14);
+
+    *from_first_slot_out = gba_save.from_first_slot;
+    pksav_gba_save_free(&gba_save);
+}
+
+static void corpus_gba_test()
+{
+    static const pksav_corpus_game_t games[] =
+    {
+        PKSAV_CORPUS_RUBY_SAPPHIRE,
+        PKSAV_CORPUS_EMERALD,
+        PKSAV_CORPUS_FIRERED_LEAFGREEN
+    };
+    static const pksav_gba_game_t gba_games[] =
+    {
+        PKSAV_GBA_RS,
+        PKSAV_GBA_EMERALD,
+        PKSAV_GBA_FRLG
+    };
+
+    for(uint32_t seed = 0; seed < NUM_SEEDS; ++seed)
+    {
+        for(size_t i = 0; i < 3; ++i)
+        {
+            uint8_t* buffer = generate_save(games[i], seed, GBA_SAVE_SIZE);
+
+            bool from_first_slot = false;
+            check_gba_save(buffer, gba_games[i], &from_first_slot);
+
+            // Both slots are valid, so wiping the newer one falls back on the older one.
+            memset(buffer + (from_first_slot ? 0 : GBA_SLOT_SIZE), 0, GBA_SLOT_SIZE);
+
+            bool older_from_first_slot = false;
+            check_gba_save(buffer, gba_games[i], &older_from_first_slot);
+            TEST_ASSERT_TRUE(from_first_slot != older_from_first_slot);
+
+            free(buffer);
+        }
+    }
+}
+
+PKSAV_TEST_MAIN(
+    PKSAV_TEST(corpus_params_test)
+    PKSAV_TEST(corpus_determinism_test)
+    PKSAV_TEST(corpus_gen1_test)
+    PKSAV_TEST(corpus_gen2_test)
+    PKSAV_TEST(corpus_gba_test)
+)
@@ -0,0 +1,198 @@
+/*
+ * Copyright (c) 2018 Nicholas Corgan (n.corgan@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "c_test_common.h"
+
+#include <pksav.h>
+
+#include <string.h>
+
+#define GBA_SAVE_SIZE 0x20000
+
+// Big enough for any patch these tests make
+#define PATCH_BUFFER_SIZE 0x1000
+
+#define PATCH_HEADER_SIZE 8
+
+static void compare_gba_save_contents(
+    const pksav_gba_save_t* gba_save1,
+    const pksav_gba_save_t* gba_save2
+)
+{
+    for(size_t i = 0; i < 5; ++i)
+    {
+        TEST_ASSERT_EQUAL_MEMORY(
+            gba_save1->unshuffled->sections_arr[i].data8,
+            gba_save2->unshuffled->sections_arr[i].data8,
+            pksav_gba_section_sizes[i]
+        );
+    }
+    TEST_ASSERT_EQUAL_MEMORY(
+        gba_save1->pokemon_pc,
+        gba_save2->pokemon_pc,
+        sizeof(pksav_gba_pokemon_pc_t)
+    );
+}
+
+static void gba_save_patch_test(
+    pksav_corpus_game_t corpus_game
+)
+{
+    uint8_t* buffer = calloc(GBA_SAVE_SIZE, 1);
+    TEST_ASSERT_NOT_NULL(buffer);
+    TEST_ASSERT_EQUAL(
+        PKSAV_ERROR_NONE,
+        pksav_corpus_generate_save(corpus_game, 48, buffer, GBA_SAVE_SIZE, NULL)
+    );
+
+    uint8_t* patch = calloc(PATCH_BUFFER_SIZE, 1);
+    TEST_ASSERT_NOT_NULL(patch);
+
+    pksav_gba_save_t old_save;
+    pksav_gba_save_t new_save;
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, pksav_gba_save_load_buffer(buffer, GBA_SAVE_SIZE, &old_save));
+
+    // Saving re-encrypts everything, but the contents are the same.
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, pksav_gba_save_save_buffer(buffer, GBA_SAVE_SIZE, &old_save));
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, pksav_gba_save_load_buffer(buffer, GBA_SAVE_SIZE, &new_save));
+
+    size_t patch_size = 0;
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, pksav_gba_save_get_patch_size(&old_save, &new_save, &patch_size));
+    TEST_ASSERT_EQUAL(PATCH_HEADER_SIZE, patch_size);
+
+    // Change something in section 1, the middle of a box, and a box name.
+    *new_save.money = pksav_littleendian32(pksav_littleendian32(*new_save.money) + 1000);
+    new_save.pokemon_pc->boxes[7].entries[15].blocks.growth.species ^= 0x0101;
+    new_save.pokemon_pc->box_names[13][0] ^= 0xFF;
+
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, pksav_gba_save_get_patch_size(&old_save, &new_save, &patch_size));
+    TEST_ASSERT_TRUE(patch_size > PATCH_HEADER_SIZE);
+    TEST_ASSERT_TRUE(patch_size < 64);
+
+    size_t patch_size_written = 0;
+    TEST_ASSERT_EQUAL(
+        PKSAV_ERROR_PARAM_OUT_OF_RANGE,
+        pksav_gba_save_make_patch(&old_save, &new_save, patch, patch_size-1, &patch_size_written)
+    );
+    TEST_ASSERT_EQUAL(
+        PKSAV_ERROR_NONE,
+        pksav_gba_save_make_patch(&old_save, &new_save, patch, PATCH_BUFFER_SIZE, &patch_size_written)
+    );
+    TEST_ASSERT_EQUAL(patch_size, patch_size_written);
+
+    // A truncated patch changes nothing.
+    TEST_ASSERT_EQUAL(
+        PKSAV_ERROR_PARAM_OUT_OF_RANGE,
+        pksav_gba_save_apply_patch(&old_save, patch, patch_size-1)
+    );
+    uint16_t dirty_sections = 0;
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, pksav_gba_save_get_dirty_sections(&old_save, &dirty_sections));
+    TEST_ASSERT_EQUAL(0, dirty_sections);
+
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, pksav_gba_save_apply_patch(&old_save, patch, patch_size));
+    compare_gba_save_contents(&old_save, &new_save);
+
+    // Box 7's 15th Pokémon is in section 9, and the box names are in section 13.
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, pksav_gba_save_get_dirty_sections(&old_save, &dirty_sections));
+    TEST_ASSERT_EQUAL((1 << 1) | (1 << 9) | (1 << 13), dirty_sections);
+
+    // The patch no longer matches what it changes.
+    TEST_ASSERT_EQUAL(
+        PKSAV_ERROR_INVALID_SAVE,
+        pksav_gba_save_apply_patch(&old_save, patch, patch_size)
+    );
+    compare_gba_save_contents(&old_save, &new_save);
+
+    // Saving rebuilds the checksums and encryption.
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, pksav_gba_save_save_buffer(buffer, GBA_SAVE_SIZE, &old_save));
+    pksav_gba_save_free(&old_save);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, pksav_gba_save_load_buffer(buffer, GBA_SAVE_SIZE, &old_save));
+    TEST_ASSERT_EQUAL(*new_save.money, *old_save.money);
+    TEST_ASSERT_EQUAL(
+        new_save.pokemon_pc->boxes[7].entries[15].blocks.growth.species,
+        old_save.pokemon_pc->boxes[7].entries[15].blocks.growth.species
+    );
+    TEST_ASSERT_EQUAL_MEMORY(
+        new_save.pokemon_pc->box_names[13],
+        old_save.pokemon_pc->box_names[13],
+        sizeof(new_save.pokemon_pc->box_names[13])
+    );
+
+    pksav_gba_save_free(&new_save);
+    pksav_gba_save_free(&old_save);
+    free(patch);
+    free(buffer);
+}
+
+static void ruby_save_patch_test()
+{
+    gba_save_patch_test(PKSAV_CORPUS_RUBY_SAPPHIRE);
+}
+
+static void emerald_save_patch_test()
+{
+    gba_save_patch_test(PKSAV_CORPUS_EMERALD);
+}
+
+static void firered_save_patch_test()
+{
+    gba_save_patch_test(PKSAV_CORPUS_FIRERED_LEAFGREEN);
+}
+
+static void gba_save_patch_wrong_game_test()
+{
+    uint8_t* buffer1 = calloc(GBA_SAVE_SIZE, 1);
+    uint8_t* buffer2 = calloc(GBA_SAVE_SIZE, 1);
+    uint8_t* patch = calloc(PATCH_BUFFER_SIZE, 1);
+    TEST_ASSERT_NOT_NULL(buffer1);
+    TEST_ASSERT_NOT_NULL(buffer2);
+    TEST_ASSERT_NOT_NULL(patch);
+
+    TEST_ASSERT_EQUAL(
+        PKSAV_ERROR_NONE,
+        pksav_corpus_generate_save(PKSAV_CORPUS_EMERALD, 48, buffer1, GBA_SAVE_SIZE, NULL)
+    );
+    TEST_ASSERT_EQUAL(
+        PKSAV_ERROR_NONE,
+        pksav_corpus_generate_save(PKSAV_CORPUS_FIRERED_LEAFGREEN, 48, buffer2, GBA_SAVE_SIZE, NULL)
+    );
+
+    pksav_gba_save_t emerald_save;
+    pksav_gba_save_t firered_save;
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, pksav_gba_save_load_buffer(buffer1, GBA_SAVE_SIZE, &emerald_save));
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, pksav_gba_save_load_buffer(buffer2, GBA_SAVE_SIZE, &firered_save));
+
+    size_t patch_size = 0;
+    TEST_ASSERT_EQUAL(
+        PKSAV_ERROR_INVALID_SAVE,
+        pksav_gba_save_get_patch_size(&emerald_save, &firered_save, &patch_size)
+    );
+
+    // An empty Emerald patch can't be applied to FireRed.
+    TEST_ASSERT_EQUAL(
+        PKSAV_ERROR_NONE,
+        pksav_gba_save_make_patch(&emerald_save, &emerald_save, patch, PATCH_BUFFER_SIZE, &patch_size)
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, pksav_gba_save_apply_patch(&emerald_save, patch, patch_size));
+    TEST_ASSERT_EQUAL(
+        PKSAV_ERROR_INVALID_SAVE,
+        pksav_gba_save_apply_patch(&firered_save, patch, patch_size)
+    );
+
+    pksav_gba_save_free(&firered_save);
+    pksav_gba_save_free(&emerald_save);
+    free(patch);
+    free(buffer2);
+    free(buffer1);
+}
+
+PKSAV_TEST_MAIN(
+    PKSAV_TEST(ruby_save_patch_test)
+    PKSAV_TEST(emerald_save_patch_test)
+    PKSAV_TEST(firered_save_patch_test)
+    PKSAV_TEST(gba_save_patch_wrong_game_test)
+)
@@ -0,0 +1,191 @@
+/*
+ * Copyright (c) 2018 Nicholas Corgan (n.corgan@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "c_test_common.h"
+#include "test-utils.h"
+
+#include <pksav.h>
+
+#include <string.h>
+
+/*
+ * These tests don't need real saves, so the save's pointers are aimed at
+ * local buffers rather than going through pksav_gba_save_load.
+ */
+typedef struct
+{
+    pksav_gba_save_t gba_save;
+
+    uint8_t seenA[PKSAV_GBA_POKEDEX_BUFFER_SIZE];
+    uint8_t seenB[PKSAV_GBA_POKEDEX_BUFFER_SIZE];
+    uint8_t seenC[PKSAV_GBA_POKEDEX_BUFFER_SIZE];
+    uint16_t nat_pokedex_unlockedA;
+    uint8_t nat_pokedex_unlockedB;
+    uint16_t nat_pokedex_unlockedC;
+} fake_gba_save_t;
+
+static void init_fake_save(
+    fake_gba_save_t* fake_save,
+    pksav_gba_game_t gba_game
+)
+{
+    memset(fake_save, 0, sizeof(*fake_save));
+
+    fake_save->gba_save.gba_game = gba_game;
+    fake_save->gba_save.pokedex_seenA = fake_save->seenA;
+    fake_save->gba_save.pokedex_seenB = fake_save->seenB;
+    fake_save->gba_save.pokedex_seenC = fake_save->seenC;
+    fake_save->gba_save.rse_nat_pokedex_unlockedA = &fake_save->nat_pokedex_unlockedA;
+    fake_save->gba_save.frlg_nat_pokedex_unlockedA = (uint8_t*)&fake_save->nat_pokedex_unlockedA;
+    fake_save->gba_save.nat_pokedex_unlockedB = &fake_save->nat_pokedex_unlockedB;
+    fake_save->gba_save.nat_pokedex_unlockedC = &fake_save->nat_pokedex_unlockedC;
+}
+
+static bool mirrors_match(
+    const pksav_gba_save_t* gba_save
+)
+{
+    bool result = false;
+    pksav_error_t error = pksav_gba_save_check_pokedex_mirrors(gba_save, &result);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+
+    return result;
+}
+
+static uint16_t dirty_sections(
+    const pksav_gba_save_t* gba_save
+)
+{
+    uint16_t result = 0;
+    pksav_error_t error = pksav_gba_save_get_dirty_sections(gba_save, &result);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+
+    return result;
+}
+
+static void gba_pokedex_seen_test()
+{
+    pksav_error_t error = PKSAV_ERROR_NONE;
+    fake_gba_save_t fake_save;
+    init_fake_save(&fake_save, PKSAV_GBA_EMERALD);
+
+    TEST_ASSERT_TRUE(mirrors_match(&fake_save.gba_save));
+    TEST_ASSERT_EQUAL(0, dirty_sections(&fake_save.gba_save));
+
+    for(uint16_t pokedex_num = 1; pokedex_num <= PKSAV_GBA_POKEDEX_NUM_SPECIES; pokedex_num += 7)
+    {
+        error = pksav_gba_save_set_pokedex_seen(&fake_save.gba_save, pokedex_num, true);
+        TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+
+        bool seen = false;
+        error = pksav_get_pokedex_bit(fake_save.seenA, pokedex_num, &seen);
+        TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+        TEST_ASSERT_TRUE(seen);
+        TEST_ASSERT_TRUE(mirrors_match(&fake_save.gba_save));
+    }
+    TEST_ASSERT_EQUAL((1 << 0) | (1 << 1) | (1 << 4), dirty_sections(&fake_save.gba_save));
+
+    error = pksav_gba_save_set_pokedex_seen_range(&fake_save.gba_save, 20, 300, true);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+    TEST_ASSERT_TRUE(mirrors_match(&fake_save.gba_save));
+
+    error = pksav_gba_save_set_pokedex_seen_range(&fake_save.gba_save, 150, 160, false);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+    TEST_ASSERT_TRUE(mirrors_match(&fake_save.gba_save));
+
+    uint16_t num_seen = 0;
+    error = pksav_count_pokedex_bits(fake_save.seenC, PKSAV_GBA_POKEDEX_NUM_SPECIES, &num_seen);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL(281 - 11 + 3 + 13, num_seen);
+
+    // Invalid input shouldn't touch anything.
+    error = pksav_gba_save_set_pokedex_seen(&fake_save.gba_save, 0, true);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_PARAM_OUT_OF_RANGE, error);
+    error = pksav_gba_save_set_pokedex_seen(&fake_save.gba_save, PKSAV_GBA_POKEDEX_NUM_SPECIES+1, true);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_PARAM_OUT_OF_RANGE, error);
+    error = pksav_gba_save_set_pokedex_seen_range(&fake_save.gba_save, 10, 9, true);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_PARAM_OUT_OF_RANGE, error);
+
+    // Diverge the mirrors, then repair them.
+    (void)randomize_buffer(fake_save.seenB, sizeof(fake_save.seenB));
+    fake_save.seenB[0] = ~fake_save.seenA[0];
+    TEST_ASSERT_FALSE(mirrors_match(&fake_save.gba_save));
+
+    error = pksav_gba_save_sync_pokedex_seen(&fake_save.gba_save);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+    TEST_ASSERT_TRUE(mirrors_match(&fake_save.gba_save));
+    TEST_ASSERT_EQUAL_MEMORY(fake_save.seenA, fake_save.seenB, PKSAV_GBA_POKEDEX_BUFFER_SIZE);
+}
+
+static void gba_nat_pokedex_test(
+    pksav_gba_game_t gba_game
+)
+{
+    pksav_error_t error = PKSAV_ERROR_NONE;
+    fake_gba_save_t fake_save;
+    init_fake_save(&fake_save, gba_game);
+
+    // Unrelated bits in these fields must be preserved.
+    fake_save.nat_pokedex_unlockedA = pksav_littleendian16(0x2000);
+    fake_save.nat_pokedex_unlockedB = 0x80;
+    fake_save.nat_pokedex_unlockedC = pksav_littleendian16(0x8000);
+
+    bool unlocked = true;
+    error = pksav_gba_save_get_nat_pokedex_unlocked(&fake_save.gba_save, &unlocked);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+    TEST_ASSERT_FALSE(unlocked);
+
+    error = pksav_gba_save_set_nat_pokedex_unlocked(&fake_save.gba_save, true);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+    error = pksav_gba_save_get_nat_pokedex_unlocked(&fake_save.gba_save, &unlocked);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+    TEST_ASSERT_TRUE(unlocked);
+    TEST_ASSERT_TRUE(mirrors_match(&fake_save.gba_save));
+    TEST_ASSERT_EQUAL((1 << 0) | (1 << 2), dirty_sections(&fake_save.gba_save));
+
+    if(gba_game == PKSAV_GBA_FRLG)
+    {
+        TEST_ASSERT_EQUAL(PKSAV_GBA_FRLG_NAT_POKEDEX_UNLOCKED_MASK_A, *fake_save.gba_save.frlg_nat_pokedex_unlockedA);
+        TEST_ASSERT_EQUAL(0x80 | PKSAV_GBA_FRLG_NAT_POKEDEX_UNLOCKED_MASK_B, fake_save.nat_pokedex_unlockedB);
+        TEST_ASSERT_EQUAL(0x8000 | PKSAV_GBA_FRLG_NAT_POKEDEX_UNLOCKED_MASK_C, pksav_littleendian16(fake_save.nat_pokedex_unlockedC));
+    }
+    else
+    {
+        TEST_ASSERT_EQUAL(0x2000 | PKSAV_GBA_RSE_NAT_POKEDEX_UNLOCKED_MASK_A, pksav_littleendian16(fake_save.nat_pokedex_unlockedA));
+        TEST_ASSERT_EQUAL(0x80 | PKSAV_GBA_RSE_NAT_POKEDEX_UNLOCKED_MASK_B, fake_save.nat_pokedex_unlockedB);
+        TEST_ASSERT_EQUAL(0x8000 | PKSAV_GBA_RSE_NAT_POKEDEX_UNLOCKED_MASK_C, pksav_littleendian16(fake_save.nat_pokedex_unlockedC));
+    }
+
+    // Only one of the three being set counts as a mismatch.
+    fake_save.nat_pokedex_unlockedB = 0x80;
+    TEST_ASSERT_FALSE(mirrors_match(&fake_save.gba_save));
+
+    error = pksav_gba_save_set_nat_pokedex_unlocked(&fake_save.gba_save, false);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+    error = pksav_gba_save_get_nat_pokedex_unlocked(&fake_save.gba_save, &unlocked);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+    TEST_ASSERT_FALSE(unlocked);
+    TEST_ASSERT_TRUE(mirrors_match(&fake_save.gba_save));
+    TEST_ASSERT_EQUAL(0x80, fake_save.nat_pokedex_unlockedB);
+    TEST_ASSERT_EQUAL(0x8000, pksav_littleendian16(fake_save.nat_pokedex_unlockedC));
+}
+
+static void rse_nat_pokedex_test()
+{
+    gba_nat_pokedex_test(PKSAV_GBA_EMERALD);
+}
+
+static void frlg_nat_pokedex_test()
+{
+    gba_nat_pokedex_test(PKSAV_GBA_FRLG);
+}
+
+PKSAV_TEST_MAIN(
+    PKSAV_TEST(gba_pokedex_seen_test)
+    PKSAV_TEST(rse_nat_pokedex_test)
+    PKSAV_TEST(frlg_nat_pokedex_test)
+)
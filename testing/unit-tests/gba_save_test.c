@@ -9,7 +9,9 @@
 #include "test-utils.h"
 
 #include <pksav/config.h>
+#include <pksav/corpus.h>
 #include <pksav/gba/save.h>
+#include <pksav/math/endian.h>
 
 #include <stdio.h>
 #include <string.h>
@@ -230,6 +232,435 @@ static void gba_save_load_and_save_match_test(
     }
 }
 
+static void compare_gba_saves(
+    const pksav_gba_save_t* gba_save1,
+    const pksav_gba_save_t* gba_save2
+)
+{
+    TEST_ASSERT_EQUAL(gba_save1->gba_game, gba_save2->gba_game);
+    TEST_ASSERT_EQUAL_MEMORY(gba_save1->trainer_info, gba_save2->trainer_info, sizeof(pksav_gba_trainer_info_t));
+    TEST_ASSERT_EQUAL_MEMORY(gba_save1->pokemon_party, gba_save2->pokemon_party, sizeof(pksav_gba_pokemon_party_t));
+    TEST_ASSERT_EQUAL_MEMORY(gba_save1->pokemon_pc, gba_save2->pokemon_pc, sizeof(pksav_gba_pokemon_pc_t));
+    TEST_ASSERT_EQUAL_MEMORY(gba_save1->item_storage, gba_save2->item_storage, sizeof(pksav_gba_item_storage_t));
+    TEST_ASSERT_EQUAL(*gba_save1->money, *gba_save2->money);
+    TEST_ASSERT_EQUAL(*gba_save1->casino_coins, *gba_save2->casino_coins);
+    TEST_ASSERT_EQUAL_MEMORY(gba_save1->pokedex_owned, gba_save2->pokedex_owned, 49);
+    TEST_ASSERT_EQUAL_MEMORY(gba_save1->pokedex_seenA, gba_save2->pokedex_seenA, 49);
+}
+
+/*
+ * A compact save should look exactly like a normal one, and since generated
+ * saves have no stray bytes in their padding, saving one should produce
+ * exactly the same bytes as a normal save.
+ */
+static void gba_save_compact_test(
+    pksav_corpus_game_t corpus_game
+)
+{
+    uint8_t* original = calloc(GBA_SAVE_SIZE, 1);
+    uint8_t* saved = calloc(GBA_SAVE_SIZE, 1);
+    uint8_t* compact_saved = calloc(GBA_SAVE_SIZE, 1);
+    TEST_ASSERT_EQUAL(
+        PKSAV_ERROR_NONE,
+        pksav_corpus_generate_save(corpus_game, 44, original, GBA_SAVE_SIZE, NULL)
+    );
+
+    pksav_gba_save_t gba_save;
+    pksav_gba_save_t compact_save;
+    pksav_error_t error = pksav_gba_save_load_buffer(original, GBA_SAVE_SIZE, &gba_save);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+    error = pksav_gba_save_load_buffer_compact(original, GBA_SAVE_SIZE, &compact_save);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+    TEST_ASSERT_TRUE(compact_save.compact);
+    TEST_ASSERT_NULL(compact_save.raw);
+    compare_gba_saves(&gba_save, &compact_save);
+
+    // A compact save is written over a save that's already there, not erased flash.
+    memset(compact_saved, 0xFF, GBA_SAVE_SIZE);
+    error = pksav_gba_save_save_buffer(compact_saved, GBA_SAVE_SIZE, &compact_save);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_INVALID_SAVE, error);
+
+    memcpy(compact_saved, original, GBA_SAVE_SIZE);
+    for(int i = 0; i < 2; ++i)
+    {
+        gba_save.trainer_info->time_played.seconds = (uint8_t)(10 + i);
+        compact_save.trainer_info->time_played.seconds = (uint8_t)(10 + i);
+        gba_save.pokemon_pc->boxes[3].entries[7] = gba_save.pokemon_party->party[0].pc;
+        compact_save.pokemon_pc->boxes[3].entries[7] = compact_save.pokemon_party->party[0].pc;
+
+        error = pksav_gba_save_save_buffer(saved, GBA_SAVE_SIZE, &gba_save);
+        TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+        error = pksav_gba_save_save_buffer(compact_saved, GBA_SAVE_SIZE, &compact_save);
+        TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+
+        TEST_ASSERT_EQUAL_MEMORY(saved, compact_saved, GBA_SAVE_SIZE);
+        TEST_ASSERT_EQUAL(gba_save.from_first_slot, compact_save.from_first_slot);
+        compare_gba_saves(&gba_save, &compact_save);
+    }
+
+    // The same goes for files, which are read back in to be written over.
+    char filepath[256] = {0};
+    snprintf(
+        filepath, sizeof(filepath),
+        "%s%spksav_%d_gba_compact_test.sav",
+        get_tmp_dir(), FS_SEPARATOR, get_pid()
+    );
+    FILE* file = fopen(filepath, "wb");
+    TEST_ASSERT_NOT_NULL(file);
+    TEST_ASSERT_EQUAL(GBA_SAVE_SIZE, fwrite(original, 1, GBA_SAVE_SIZE, file));
+    fclose(file);
+
+    pksav_gba_save_t file_save;
+    error = pksav_gba_save_load_compact(filepath, &file_save);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+    error = pksav_gba_save_save(filepath, &file_save);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+    pksav_gba_save_free(&file_save);
+
+    error = pksav_gba_save_load_buffer(original, GBA_SAVE_SIZE, &file_save);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+    error = pksav_gba_save_save_buffer(saved, GBA_SAVE_SIZE, &file_save);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+    pksav_gba_save_free(&file_save);
+
+    file = fopen(filepath, "rb");
+    TEST_ASSERT_NOT_NULL(file);
+    TEST_ASSERT_EQUAL(GBA_SAVE_SIZE, fread(compact_saved, 1, GBA_SAVE_SIZE, file));
+    fclose(file);
+    TEST_ASSERT_EQUAL_MEMORY(saved, compact_saved, GBA_SAVE_SIZE);
+
+    // A file that isn't a save from the same game is left alone.
+    pksav_corpus_game_t other_game = (corpus_game == PKSAV_CORPUS_FIRERED_LEAFGREEN) ? PKSAV_CORPUS_EMERALD
+                                                                                     : PKSAV_CORPUS_FIRERED_LEAFGREEN;
+    TEST_ASSERT_EQUAL(
+        PKSAV_ERROR_NONE,
+        pksav_corpus_generate_save(other_game, 44, saved, GBA_SAVE_SIZE, NULL)
+    );
+    file = fopen(filepath, "wb");
+    TEST_ASSERT_NOT_NULL(file);
+    TEST_ASSERT_EQUAL(GBA_SAVE_SIZE, fwrite(saved, 1, GBA_SAVE_SIZE, file));
+    fclose(file);
+
+    error = pksav_gba_save_save(filepath, &compact_save);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_INVALID_SAVE, error);
+
+    file = fopen(filepath, "rb");
+    TEST_ASSERT_NOT_NULL(file);
+    TEST_ASSERT_EQUAL(GBA_SAVE_SIZE, fread(compact_saved, 1, GBA_SAVE_SIZE, file));
+    fclose(file);
+    TEST_ASSERT_EQUAL_MEMORY(saved, compact_saved, GBA_SAVE_SIZE);
+
+    pksav_gba_save_free(&compact_save);
+    pksav_gba_save_free(&gba_save);
+    free(compact_saved);
+    free(saved);
+    free(original);
+    TEST_ASSERT_EQUAL(0, delete_file(filepath));
+}
+
+static void gba_save_clone_test(
+    pksav_corpus_game_t corpus_game
+)
+{
+    uint8_t* original = calloc(GBA_SAVE_SIZE, 1);
+    uint8_t* saved = calloc(GBA_SAVE_SIZE, 1);
+    uint8_t* clone_saved = calloc(GBA_SAVE_SIZE, 1);
+    TEST_ASSERT_EQUAL(
+        PKSAV_ERROR_NONE,
+        pksav_corpus_generate_save(corpus_game, 45, original, GBA_SAVE_SIZE, NULL)
+    );
+
+    pksav_gba_save_t gba_save;
+    pksav_gba_save_t clone;
+    pksav_error_t error = pksav_gba_save_load_buffer(original, GBA_SAVE_SIZE, &gba_save);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+    error = pksav_gba_save_clone(&gba_save, &clone);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+    compare_gba_saves(&gba_save, &clone);
+    TEST_ASSERT_TRUE(gba_save.pokemon_party != clone.pokemon_party);
+    TEST_ASSERT_TRUE(gba_save.pokemon_pc != clone.pokemon_pc);
+
+    // Editing the clone leaves the original alone.
+    uint32_t money = *gba_save.money;
+    *clone.money = money + 1;
+    clone.pokemon_pc->boxes[0].entries[0] = clone.pokemon_party->party[0].pc;
+    TEST_ASSERT_EQUAL(money, *gba_save.money);
+
+    // Both can be saved, in either order, and each matches an unshared load.
+    error = pksav_gba_save_save_buffer(clone_saved, GBA_SAVE_SIZE, &clone);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+    error = pksav_gba_save_save_buffer(saved, GBA_SAVE_SIZE, &gba_save);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+    TEST_ASSERT_TRUE(memcmp(saved, clone_saved, GBA_SAVE_SIZE) != 0);
+
+    pksav_gba_save_t unshared;
+    error = pksav_gba_save_load_buffer(original, GBA_SAVE_SIZE, &unshared);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+    error = pksav_gba_save_save_buffer(clone_saved, GBA_SAVE_SIZE, &unshared);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL_MEMORY(clone_saved, saved, GBA_SAVE_SIZE);
+    pksav_gba_save_free(&unshared);
+    pksav_gba_save_free(&clone);
+
+    // Take a snapshot, make a mess, and roll back to it.
+    pksav_gba_save_t snapshot;
+    error = pksav_gba_save_clone(&gba_save, &snapshot);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+
+    pksav_gba_pokemon_party_t* pokemon_party = gba_save.pokemon_party;
+    memset(gba_save.pokemon_party, 0, sizeof(pksav_gba_pokemon_party_t));
+    memset(gba_save.pokemon_pc, 0, sizeof(pksav_gba_pokemon_pc_t));
+    *gba_save.money = 0;
+    error = pksav_gba_save_save_buffer(clone_saved, GBA_SAVE_SIZE, &gba_save);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+
+    error = pksav_gba_save_restore(&gba_save, &snapshot);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL_PTR(pokemon_party, gba_save.pokemon_party);
+    compare_gba_saves(&snapshot, &gba_save);
+
+    // The snapshot can be freed first, and the save still saves the same way it would have.
+    error = pksav_gba_save_save_buffer(clone_saved, GBA_SAVE_SIZE, &snapshot);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+    pksav_gba_save_free(&snapshot);
+    error = pksav_gba_save_save_buffer(saved, GBA_SAVE_SIZE, &gba_save);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL_MEMORY(clone_saved, saved, GBA_SAVE_SIZE);
+
+    // Snapshots only restore saves from the same game loaded the same way.
+    pksav_gba_save_t compact_save;
+    error = pksav_gba_save_load_buffer_compact(original, GBA_SAVE_SIZE, &compact_save);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+    error = pksav_gba_save_restore(&gba_save, &compact_save);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_INVALID_SAVE, error);
+
+    error = pksav_gba_save_clone(&compact_save, &snapshot);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+    TEST_ASSERT_NULL(snapshot.raw);
+    compare_gba_saves(&compact_save, &snapshot);
+    pksav_gba_save_free(&snapshot);
+    pksav_gba_save_free(&compact_save);
+
+    pksav_gba_save_free(&gba_save);
+    free(clone_saved);
+    free(saved);
+    free(original);
+}
+
+/*
+ * Saving encrypts a copy of the save, so nothing other threads could be
+ * reading changes, not even the checksums written into the save.
+ */
+static void gba_save_leaves_loaded_data_alone_test(
+    pksav_corpus_game_t corpus_game
+)
+{
+    uint8_t* buffer = calloc(GBA_SAVE_SIZE, 1);
+    TEST_ASSERT_EQUAL(
+        PKSAV_ERROR_NONE,
+        pksav_corpus_generate_save(corpus_game, 46, buffer, GBA_SAVE_SIZE, NULL)
+    );
+
+    for(int compact = 0; compact < 2; ++compact)
+    {
+        pksav_gba_save_t gba_save;
+        pksav_error_t error = compact ? pksav_gba_save_load_buffer_compact(buffer, GBA_SAVE_SIZE, &gba_save)
+                                      : pksav_gba_save_load_buffer(buffer, GBA_SAVE_SIZE, &gba_save);
+        TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+
+        uint16_t checksum = gba_save.pokemon_party->party[0].pc.checksum;
+        gba_save.pokemon_party->party[0].pc.checksum ^= 0xFFFF;
+
+        pksav_gba_save_t before;
+        error = pksav_gba_save_clone(&gba_save, &before);
+        TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+
+        for(int i = 0; i < 2; ++i)
+        {
+            pksav_gba_pokemon_party_t* pokemon_party = gba_save.pokemon_party;
+            pksav_gba_pokemon_pc_t* pokemon_pc = gba_save.pokemon_pc;
+
+            error = pksav_gba_save_save_buffer(buffer, GBA_SAVE_SIZE, &gba_save);
+            TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+
+            TEST_ASSERT_EQUAL_PTR(pokemon_party, gba_save.pokemon_party);
+            TEST_ASSERT_EQUAL_PTR(pokemon_pc, gba_save.pokemon_pc);
+            compare_gba_saves(&before, &gba_save);
+        }
+        pksav_gba_save_free(&before);
+        pksav_gba_save_free(&gba_save);
+
+        // The checksum is only fixed in what was written.
+        error = pksav_gba_save_load_buffer(buffer, GBA_SAVE_SIZE, &gba_save);
+        TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+        TEST_ASSERT_EQUAL(checksum, gba_save.pokemon_party->party[0].pc.checksum);
+        pksav_gba_save_free(&gba_save);
+    }
+
+    free(buffer);
+}
+
+static void check_slot_health(
+    const pksav_gba_slot_health_t* slot_health,
+    uint16_t bad_sections
+)
+{
+    TEST_ASSERT_EQUAL(!bad_sections, slot_health->valid);
+    TEST_ASSERT_EQUAL_HEX16(0x3FFF & ~bad_sections, slot_health->checksums_valid);
+    TEST_ASSERT_EQUAL_HEX16(0x3FFF, slot_health->validations_valid | bad_sections);
+    TEST_ASSERT_EQUAL_HEX16(0x3FFF, slot_health->save_indices_match | bad_sections);
+}
+
+/*
+ * A corrupted most recent slot is still loaded by a normal load, but a strict
+ * load falls back to the older slot, as the games do.
+ */
+static void gba_save_strict_load_test(
+    pksav_corpus_game_t corpus_game
+)
+{
+    uint8_t* buffer = calloc(GBA_SAVE_SIZE, 1);
+    TEST_ASSERT_EQUAL(
+        PKSAV_ERROR_NONE,
+        pksav_corpus_generate_save(corpus_game, 50, buffer, GBA_SAVE_SIZE, NULL)
+    );
+    pksav_gba_save_slot_t* slots = (pksav_gba_save_slot_t*)buffer;
+
+    // Make sure each slot has different money.
+    pksav_gba_save_t gba_save;
+    pksav_error_t error = pksav_gba_save_load_buffer(buffer, GBA_SAVE_SIZE, &gba_save);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+    uint32_t old_money = *gba_save.money;
+    uint32_t new_money = pksav_littleendian32(pksav_littleendian32(old_money) + 1);
+    *gba_save.money = new_money;
+    error = pksav_gba_save_save_buffer(buffer, GBA_SAVE_SIZE, &gba_save);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+    size_t newest_slot = gba_save.from_first_slot ? 0 : 1;
+    pksav_gba_save_free(&gba_save);
+
+    pksav_gba_save_health_t health;
+    error = pksav_gba_save_verify_buffer(buffer, GBA_SAVE_SIZE, &health);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL(2, health.num_slots);
+    check_slot_health(&health.slots[0], 0);
+    check_slot_health(&health.slots[1], 0);
+    TEST_ASSERT_TRUE(health.has_valid_slot);
+    TEST_ASSERT_EQUAL(newest_slot, health.load_slot);
+    TEST_ASSERT_FALSE(health.is_fallback);
+    TEST_ASSERT_EQUAL(
+        health.slots[1 - newest_slot].save_index + 1,
+        health.slots[newest_slot].save_index
+    );
+
+    error = pksav_gba_save_verify_buffer(buffer, GBA_SAVE_SLOT_SIZE - 1, &health);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_INVALID_SAVE, error);
+
+    // Corrupt the PC's last section, so the money isn't affected.
+    pksav_gba_save_section_t* corrupted = NULL;
+    for(size_t i = 0; i < 14; ++i)
+    {
+        if(slots[newest_slot].sections_arr[i].footer.section_id == 13)
+        {
+            corrupted = &slots[newest_slot].sections_arr[i];
+        }
+    }
+    TEST_ASSERT_NOT_NULL(corrupted);
+    corrupted->data8[100] ^= 0xFF;
+
+    error = pksav_gba_save_verify_buffer(buffer, GBA_SAVE_SIZE, &health);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+    check_slot_health(&health.slots[newest_slot], (1 << 13));
+    check_slot_health(&health.slots[1 - newest_slot], 0);
+    TEST_ASSERT_TRUE(health.has_valid_slot);
+    TEST_ASSERT_EQUAL(1 - newest_slot, health.load_slot);
+    TEST_ASSERT_TRUE(health.is_fallback);
+
+    error = pksav_gba_save_load_buffer(buffer, GBA_SAVE_SIZE, &gba_save);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL(new_money, *gba_save.money);
+    pksav_gba_save_free(&gba_save);
+
+    memset(&health, 0, sizeof(health));
+    error = pksav_gba_save_load_buffer_strict(buffer, GBA_SAVE_SIZE, &gba_save, &health);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+    TEST_ASSERT_TRUE(health.is_fallback);
+    TEST_ASSERT_EQUAL(old_money, *gba_save.money);
+    TEST_ASSERT_EQUAL((newest_slot == 1), gba_save.from_first_slot);
+
+    // Saving writes over the corrupted slot.
+    error = pksav_gba_save_save_buffer(buffer, GBA_SAVE_SIZE, &gba_save);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+    pksav_gba_save_free(&gba_save);
+
+    error = pksav_gba_save_verify_buffer(buffer, GBA_SAVE_SIZE, &health);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+    check_slot_health(&health.slots[0], 0);
+    check_slot_health(&health.slots[1], 0);
+    TEST_ASSERT_EQUAL(newest_slot, health.load_slot);
+    TEST_ASSERT_FALSE(health.is_fallback);
+
+    // Give the older slot two sections with the same ID, and a bad validation number.
+    pksav_gba_save_slot_t* older = &slots[1 - newest_slot];
+    uint8_t missing_section = older->sections_arr[2].footer.section_id;
+    uint8_t duplicated_section = older->sections_arr[3].footer.section_id;
+    older->sections_arr[2].footer.section_id = duplicated_section;
+    error = pksav_gba_save_verify_buffer(buffer, GBA_SAVE_SIZE, &health);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+    TEST_ASSERT_FALSE(health.slots[1 - newest_slot].valid);
+    TEST_ASSERT_EQUAL_HEX16(
+        0x3FFF & ~((1 << missing_section) | (1 << duplicated_section)),
+        health.slots[1 - newest_slot].sections_present
+    );
+    older->sections_arr[2].footer.section_id = missing_section;
+
+    older->sections_arr[5].footer.validation ^= 1;
+    error = pksav_gba_save_verify_buffer(buffer, GBA_SAVE_SIZE, &health);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+    TEST_ASSERT_FALSE(health.slots[1 - newest_slot].valid);
+    TEST_ASSERT_EQUAL_HEX16(
+        0x3FFF & ~(1 << older->sections_arr[5].footer.section_id),
+        health.slots[1 - newest_slot].validations_valid
+    );
+    TEST_ASSERT_EQUAL(newest_slot, health.load_slot);
+
+    // With neither slot valid, there's nothing to load.
+    slots[newest_slot].sections_arr[0].footer.checksum ^= 0xFFFF;
+    error = pksav_gba_save_load_buffer_strict(buffer, GBA_SAVE_SIZE, &gba_save, &health);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_INVALID_SAVE, error);
+    TEST_ASSERT_FALSE(health.has_valid_slot);
+    TEST_ASSERT_FALSE(health.slots[0].valid);
+    TEST_ASSERT_FALSE(health.slots[1].valid);
+
+    // The same goes for files.
+    char filepath[256] = {0};
+    snprintf(
+        filepath, sizeof(filepath),
+        "%s%spksav_%d_gba_strict_load_test.sav",
+        get_tmp_dir(), FS_SEPARATOR, get_pid()
+    );
+    FILE* file = fopen(filepath, "wb");
+    TEST_ASSERT_NOT_NULL(file);
+    TEST_ASSERT_EQUAL(GBA_SAVE_SIZE, fwrite(buffer, 1, GBA_SAVE_SIZE, file));
+    fclose(file);
+
+    error = pksav_gba_save_load_strict(filepath, &gba_save, NULL);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_INVALID_SAVE, error);
+
+    older->sections_arr[5].footer.validation ^= 1;
+    file = fopen(filepath, "wb");
+    TEST_ASSERT_NOT_NULL(file);
+    TEST_ASSERT_EQUAL(GBA_SAVE_SIZE, fwrite(buffer, 1, GBA_SAVE_SIZE, file));
+    fclose(file);
+
+    error = pksav_gba_save_load_strict(filepath, &gba_save, NULL);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL(old_money, *gba_save.money);
+    pksav_gba_save_free(&gba_save);
+
+    free(buffer);
+    TEST_ASSERT_EQUAL(0, delete_file(filepath));
+}
+
 static void pksav_buffer_is_ruby_save_test()
 {
     pksav_buffer_is_gba_save_test("ruby_sapphire", "pokemon_ruby.sav", PKSAV_GBA_RS);
@@ -255,6 +686,26 @@ static void pksav_file_is_emerald_save_test()
     pksav_file_is_gba_save_test("emerald", "pokemon_emerald.sav", PKSAV_GBA_EMERALD);
 }
 
+static void ruby_save_compact_test()
+{
+    gba_save_compact_test(PKSAV_CORPUS_RUBY_SAPPHIRE);
+}
+
+static void ruby_save_clone_test()
+{
+    gba_save_clone_test(PKSAV_CORPUS_RUBY_SAPPHIRE);
+}
+
+static void ruby_save_leaves_loaded_data_alone_test()
+{
+    gba_save_leaves_loaded_data_alone_test(PKSAV_CORPUS_RUBY_SAPPHIRE);
+}
+
+static void ruby_save_strict_load_test()
+{
+    gba_save_strict_load_test(PKSAV_CORPUS_RUBY_SAPPHIRE);
+}
+
 static void emerald_save_load_and_save_match_test()
 {
     gba_save_load_and_save_match_test("emerald", "pokemon_emerald.sav", PKSAV_GBA_EMERALD);
@@ -270,23 +721,75 @@ static void pksav_file_is_firered_save_test()
     pksav_file_is_gba_save_test("firered_leafgreen", "pokemon_firered.sav", PKSAV_GBA_FRLG);
 }
 
+static void emerald_save_compact_test()
+{
+    gba_save_compact_test(PKSAV_CORPUS_EMERALD);
+}
+
+static void emerald_save_clone_test()
+{
+    gba_save_clone_test(PKSAV_CORPUS_EMERALD);
+}
+
+static void emerald_save_leaves_loaded_data_alone_test()
+{
+    gba_save_leaves_loaded_data_alone_test(PKSAV_CORPUS_EMERALD);
+}
+
+static void emerald_save_strict_load_test()
+{
+    gba_save_strict_load_test(PKSAV_CORPUS_EMERALD);
+}
+
 static void firered_save_load_and_save_match_test()
 {
     gba_save_load_and_save_match_test("firered_leafgreen", "pokemon_firered.sav", PKSAV_GBA_FRLG);
 }
 
+static void firered_save_compact_test()
+{
+    gba_save_compact_test(PKSAV_CORPUS_FIRERED_LEAFGREEN);
+}
+
+static void firered_save_clone_test()
+{
+    gba_save_clone_test(PKSAV_CORPUS_FIRERED_LEAFGREEN);
+}
+
+static void firered_save_leaves_loaded_data_alone_test()
+{
+    gba_save_leaves_loaded_data_alone_test(PKSAV_CORPUS_FIRERED_LEAFGREEN);
+}
+
+static void firered_save_strict_load_test()
+{
+    gba_save_strict_load_test(PKSAV_CORPUS_FIRERED_LEAFGREEN);
+}
+
 PKSAV_TEST_MAIN(
     PKSAV_TEST(pksav_buffer_is_gba_save_on_random_buffer_test)
 
     PKSAV_TEST(pksav_buffer_is_ruby_save_test)
     PKSAV_TEST(pksav_file_is_ruby_save_test)
     PKSAV_TEST(ruby_save_load_and_save_match_test)
+    PKSAV_TEST(ruby_save_compact_test)
+    PKSAV_TEST(ruby_save_clone_test)
+    PKSAV_TEST(ruby_save_leaves_loaded_data_alone_test)
+    PKSAV_TEST(ruby_save_strict_load_test)
 
     PKSAV_TEST(pksav_buffer_is_emerald_save_test)
     PKSAV_TEST(pksav_file_is_emerald_save_test)
     PKSAV_TEST(emerald_save_load_and_save_match_test)
+    PKSAV_TEST(emerald_save_compact_test)
+    PKSAV_TEST(emerald_save_clone_test)
+    PKSAV_TEST(emerald_save_leaves_loaded_data_alone_test)
+    PKSAV_TEST(emerald_save_strict_load_test)
 
     PKSAV_TEST(pksav_buffer_is_firered_save_test)
     PKSAV_TEST(pksav_file_is_firered_save_test)
     PKSAV_TEST(firered_save_load_and_save_match_test)
+    PKSAV_TEST(firered_save_compact_test)
+    PKSAV_TEST(firered_save_clone_test)
+    PKSAV_TEST(firered_save_leaves_loaded_data_alone_test)
+    PKSAV_TEST(firered_save_strict_load_test)
 )
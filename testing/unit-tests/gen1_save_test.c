@@ -9,9 +9,11 @@
 #include "test-utils.h"
 
 #include <pksav/config.h>
+#include <pksav/corpus.h>
 #include <pksav/gen1/save.h>
 
 #include <stdio.h>
+#include <string.h>
 
 // TODO: replace when size is moved to header
 #define GEN1_SAVE_SIZE 0x8000
@@ -167,6 +169,46 @@ static void gen1_save_load_and_save_match_test(
     TEST_ASSERT_FALSE(files_differ);
 }
 
+static void gen1_save_clone_test(
+    pksav_corpus_game_t corpus_game
+)
+{
+    uint8_t original[GEN1_SAVE_SIZE] = {0};
+    uint8_t saved[GEN1_SAVE_SIZE] = {0};
+    uint8_t clone_saved[GEN1_SAVE_SIZE] = {0};
+    TEST_ASSERT_EQUAL(
+        PKSAV_ERROR_NONE,
+        pksav_corpus_generate_save(corpus_game, 45, original, sizeof(original), NULL)
+    );
+
+    pksav_gen1_save_t gen1_save;
+    pksav_gen1_save_t clone;
+    pksav_error_t error = pksav_gen1_save_load_buffer(original, sizeof(original), &gen1_save);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+    error = pksav_gen1_save_clone(&gen1_save, &clone);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL(gen1_save.yellow, clone.yellow);
+    TEST_ASSERT_TRUE(gen1_save.pokemon_party != clone.pokemon_party);
+    TEST_ASSERT_EQUAL_MEMORY(gen1_save.pokemon_party, clone.pokemon_party, sizeof(pksav_gen1_pokemon_party_t));
+    TEST_ASSERT_EQUAL_MEMORY(gen1_save.pokemon_boxes[11], clone.pokemon_boxes[11], sizeof(pksav_gen1_pokemon_box_t));
+
+    // Editing the clone leaves the original alone, and restoring it undoes that.
+    memset(clone.pokemon_party, 0, sizeof(pksav_gen1_pokemon_party_t));
+    memset(clone.money, 0, 3);
+    error = pksav_gen1_save_save_buffer(saved, sizeof(saved), &gen1_save);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL_MEMORY(original, saved, sizeof(original));
+
+    error = pksav_gen1_save_restore(&clone, &gen1_save);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+    error = pksav_gen1_save_save_buffer(clone_saved, sizeof(clone_saved), &clone);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL_MEMORY(saved, clone_saved, sizeof(saved));
+
+    pksav_gen1_save_free(&clone);
+    pksav_gen1_save_free(&gen1_save);
+}
+
 static void pksav_buffer_is_red_save_test()
 {
     pksav_buffer_is_gen1_save_test("red_blue", "pokemon_red.sav");
@@ -182,6 +224,11 @@ static void red_save_load_and_save_match_test()
     gen1_save_load_and_save_match_test("red_blue", "pokemon_red.sav");
 }
 
+static void red_save_clone_test()
+{
+    gen1_save_clone_test(PKSAV_CORPUS_RED_BLUE);
+}
+
 static void pksav_buffer_is_yellow_save_test()
 {
     pksav_buffer_is_gen1_save_test("yellow", "pokemon_yellow.sav");
@@ -197,14 +244,21 @@ static void yellow_save_load_and_save_match_test()
     gen1_save_load_and_save_match_test("yellow", "pokemon_yellow.sav");
 }
 
+static void yellow_save_clone_test()
+{
+    gen1_save_clone_test(PKSAV_CORPUS_YELLOW);
+}
+
 PKSAV_TEST_MAIN(
     PKSAV_TEST(pksav_buffer_is_gen1_save_on_random_buffer_test)
 
     PKSAV_TEST(pksav_buffer_is_red_save_test)
     PKSAV_TEST(pksav_file_is_red_save_test)
     PKSAV_TEST(red_save_load_and_save_match_test)
+    PKSAV_TEST(red_save_clone_test)
 
     PKSAV_TEST(pksav_buffer_is_yellow_save_test)
     PKSAV_TEST(pksav_file_is_yellow_save_test)
     PKSAV_TEST(yellow_save_load_and_save_match_test)
+    PKSAV_TEST(yellow_save_clone_test)
 )
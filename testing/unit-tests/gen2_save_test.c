@@ -9,6 +9,7 @@
 #include "test-utils.h"
 
 #include <pksav/config.h>
+#include <pksav/corpus.h>
 #include <pksav/gen2/save.h>
 
 #include <stdio.h>
@@ -224,6 +225,46 @@ static void gen2_save_load_and_save_match_test(
     }
 }
 
+static void gen2_save_clone_test(
+    pksav_corpus_game_t corpus_game
+)
+{
+    uint8_t original[GEN2_SAVE_SIZE] = {0};
+    uint8_t saved[GEN2_SAVE_SIZE] = {0};
+    uint8_t clone_saved[GEN2_SAVE_SIZE] = {0};
+    TEST_ASSERT_EQUAL(
+        PKSAV_ERROR_NONE,
+        pksav_corpus_generate_save(corpus_game, 45, original, sizeof(original), NULL)
+    );
+
+    pksav_gen2_save_t gen2_save;
+    pksav_gen2_save_t clone;
+    pksav_error_t error = pksav_gen2_save_load_buffer(original, sizeof(original), &gen2_save);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+    error = pksav_gen2_save_clone(&gen2_save, &clone);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL(gen2_save.gen2_game, clone.gen2_game);
+    TEST_ASSERT_TRUE(gen2_save.pokemon_party != clone.pokemon_party);
+    TEST_ASSERT_EQUAL_MEMORY(gen2_save.pokemon_party, clone.pokemon_party, sizeof(pksav_gen2_pokemon_party_t));
+    TEST_ASSERT_EQUAL_MEMORY(gen2_save.pokemon_boxes[11], clone.pokemon_boxes[11], sizeof(pksav_gen2_pokemon_box_t));
+
+    // Editing the clone leaves the original alone, and restoring it undoes that.
+    memset(clone.pokemon_party, 0, sizeof(pksav_gen2_pokemon_party_t));
+    memset(clone.money, 0, 3);
+    error = pksav_gen2_save_save_buffer(saved, sizeof(saved), &gen2_save);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL_MEMORY(original, saved, sizeof(original));
+
+    error = pksav_gen2_save_restore(&clone, &gen2_save);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+    error = pksav_gen2_save_save_buffer(clone_saved, sizeof(clone_saved), &clone);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL_MEMORY(saved, clone_saved, sizeof(saved));
+
+    pksav_gen2_save_free(&clone);
+    pksav_gen2_save_free(&gen2_save);
+}
+
 static void pksav_buffer_is_gold_save_test()
 {
     pksav_buffer_is_gen2_save_test("gold_silver", "pokemon_gold.sav", false);
@@ -239,6 +280,11 @@ static void gold_save_load_and_save_match_test()
     gen2_save_load_and_save_match_test("gold_silver", "pokemon_gold.sav", false);
 }
 
+static void gold_save_clone_test()
+{
+    gen2_save_clone_test(PKSAV_CORPUS_GOLD_SILVER);
+}
+
 static void pksav_buffer_is_crystal_save_test()
 {
     pksav_buffer_is_gen2_save_test("crystal", "pokemon_crystal.sav", true);
@@ -254,14 +300,21 @@ static void crystal_save_load_and_save_match_test()
     gen2_save_load_and_save_match_test("crystal", "pokemon_crystal.sav", true);
 }
 
+static void crystal_save_clone_test()
+{
+    gen2_save_clone_test(PKSAV_CORPUS_CRYSTAL);
+}
+
 PKSAV_TEST_MAIN(
     PKSAV_TEST(pksav_buffer_is_gen2_save_on_random_buffer_test)
 
     PKSAV_TEST(pksav_buffer_is_gold_save_test)
     PKSAV_TEST(pksav_file_is_gold_save_test)
     PKSAV_TEST(gold_save_load_and_save_match_test)
+    PKSAV_TEST(gold_save_clone_test)
 
     PKSAV_TEST(pksav_buffer_is_crystal_save_test)
     PKSAV_TEST(pksav_file_is_crystal_save_test)
     PKSAV_TEST(crystal_save_load_and_save_match_test)
+    PKSAV_TEST(crystal_save_clone_test)
 )
@@ -0,0 +1,251 @@
+/*
+ * Copyright (c) 2018 Nicholas Corgan (n.corgan@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "c_test_common.h"
+#include "test-utils.h"
+
+#include <pksav.h>
+
+#include <stdio.h>
+#include <string.h>
+
+#define GEN4_SAVE_SIZE 0x80000
+#define GEN4_COPY_SIZE 0x40000
+
+/*
+ * There are no Generation IV saves in the test save repository, so these
+ * tests build saves with random contents and valid block footers.
+ */
+typedef struct
+{
+    size_t general_size;
+    size_t storage_offset;
+    size_t storage_size;
+    size_t footer_size;
+    size_t party_offset;
+} gen4_layout_t;
+
+static const gen4_layout_t gen4_layouts[] =
+{
+    {0xC100, 0xC100, 0x121E0, 0x14, 0x94}, // Diamond/Pearl
+    {0xCF2C, 0xCF2C, 0x121E4, 0x14, 0x9C}, // Platinum
+    {0xF628, 0xF700, 0x12310, 0x10, 0x94}  // HeartGold/SoulSilver
+};
+
+static uint8_t save_buffer[GEN4_SAVE_SIZE];
+static uint8_t reread_buffer[GEN4_SAVE_SIZE];
+
+// Bitwise reference implementation
+static uint16_t crc16_ccitt(
+    const uint8_t* buffer,
+    size_t len
+)
+{
+    uint16_t crc = 0xFFFF;
+    for(size_t i = 0; i < len; ++i)
+    {
+        crc ^= (uint16_t)(buffer[i] << 8);
+        for(size_t bit = 0; bit < 8; ++bit)
+        {
+            crc = (uint16_t)((crc & 0x8000) ? ((crc << 1) ^ 0x1021) : (crc << 1));
+        }
+    }
+
+    return crc;
+}
+
+static uint8_t* get_block(
+    uint8_t* buffer,
+    const gen4_layout_t* layout,
+    bool storage,
+    size_t copy
+)
+{
+    return &buffer[(copy * GEN4_COPY_SIZE) + (storage ? layout->storage_offset : 0)];
+}
+
+static void finish_block(
+    uint8_t* block,
+    size_t block_size,
+    const gen4_layout_t* layout,
+    uint32_t counter,
+    bool valid
+)
+{
+    uint32_t counter_le = pksav_littleendian32(counter);
+    memcpy(&block[block_size - layout->footer_size], &counter_le, sizeof(counter_le));
+
+    uint16_t checksum = crc16_ccitt(block, block_size - layout->footer_size);
+    if(!valid)
+    {
+        checksum ^= 0x1;
+    }
+    checksum = pksav_littleendian16(checksum);
+    memcpy(&block[block_size - 2], &checksum, sizeof(checksum));
+}
+
+static uint32_t get_counter(
+    uint8_t* block,
+    size_t block_size,
+    const gen4_layout_t* layout
+)
+{
+    uint32_t counter = 0;
+    memcpy(&counter, &block[block_size - layout->footer_size], sizeof(counter));
+
+    return pksav_littleendian32(counter);
+}
+
+static void write_buffer(
+    const char* filepath,
+    const uint8_t* buffer,
+    size_t len
+)
+{
+    FILE* file = fopen(filepath, "wb");
+    TEST_ASSERT_NOT_NULL(file);
+    TEST_ASSERT_EQUAL(len, fwrite(buffer, 1, len, file));
+    fclose(file);
+}
+
+static void gen4_save_test(
+    pksav_gen4_game_t game,
+    const char* save_name
+)
+{
+    static char save_filepath[256];
+    static char tmp_save_filepath[256];
+
+    const gen4_layout_t* layout = &gen4_layouts[game];
+    pksav_error_t error = PKSAV_ERROR_NONE;
+
+    snprintf(
+        save_filepath, sizeof(save_filepath),
+        "%s%spksav_%d_%s",
+        get_tmp_dir(), FS_SEPARATOR, get_pid(), save_name
+    );
+    snprintf(
+        tmp_save_filepath, sizeof(tmp_save_filepath),
+        "%s%spksav_%d_tmp_%s",
+        get_tmp_dir(), FS_SEPARATOR, get_pid(), save_name
+    );
+
+    /*
+     * The second general block is newest. The second storage block is
+     * newer but corrupted, so the first should be used.
+     */
+    TEST_ASSERT_EQUAL(0, randomize_buffer(save_buffer, sizeof(save_buffer)));
+    for(size_t copy = 0; copy < 2; ++copy)
+    {
+        uint8_t* general = get_block(save_buffer, layout, false, copy);
+        uint32_t party_count = pksav_littleendian32((uint32_t)(copy + 2));
+        memcpy(&general[layout->party_offset], &party_count, sizeof(party_count));
+
+        finish_block(general, layout->general_size, layout, (uint32_t)(5 + copy), true);
+        finish_block(
+            get_block(save_buffer, layout, true, copy),
+            layout->storage_size,
+            layout,
+            (uint32_t)(9 + copy),
+            (copy == 0)
+        );
+    }
+    write_buffer(save_filepath, save_buffer, sizeof(save_buffer));
+
+    bool is_save = false;
+    for(pksav_gen4_game_t other_game = PKSAV_GEN4_DP; other_game <= PKSAV_GEN4_HGSS; ++other_game)
+    {
+        error = pksav_file_is_gen4_save(save_filepath, other_game, &is_save);
+        TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+        TEST_ASSERT_EQUAL((other_game == game), is_save);
+    }
+
+    pksav_gen4_save_t gen4_save;
+    error = pksav_gen4_save_load(save_filepath, &gen4_save);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL(game, gen4_save.gen4_game);
+    TEST_ASSERT_EQUAL(3, pksav_littleendian32(gen4_save.pokemon_party->count));
+
+    // The boxes should come from the first storage block.
+    size_t box_offset = (size_t)((uint8_t*)gen4_save.pokemon_boxes[0] - gen4_save.raw);
+    TEST_ASSERT_TRUE(box_offset < GEN4_COPY_SIZE);
+    TEST_ASSERT_EQUAL(0,
+        memcmp(gen4_save.pokemon_boxes[0], &save_buffer[box_offset], sizeof(pksav_gen4_pokemon_box_t))
+    );
+
+    // Only modify the general block.
+    gen4_save.pokemon_party->count = pksav_littleendian32(1);
+    gen4_save.trainer_info->money = pksav_littleendian32(123456);
+
+    error = pksav_gen4_save_save(tmp_save_filepath, &gen4_save);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+    error = pksav_gen4_save_free(&gen4_save);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+
+    TEST_ASSERT_EQUAL(0, read_file_into_buffer(tmp_save_filepath, reread_buffer, sizeof(reread_buffer)));
+
+    // The new general block replaced the older copy, leaving the previous one intact.
+    uint8_t* new_general = get_block(reread_buffer, layout, false, 0);
+    TEST_ASSERT_EQUAL(7, get_counter(new_general, layout->general_size, layout));
+    TEST_ASSERT_EQUAL(0,
+        memcmp(get_block(save_buffer, layout, false, 1), get_block(reread_buffer, layout, false, 1), layout->general_size)
+    );
+
+    // The storage block wasn't modified, so neither copy was touched.
+    for(size_t copy = 0; copy < 2; ++copy)
+    {
+        TEST_ASSERT_EQUAL(0,
+            memcmp(get_block(save_buffer, layout, true, copy), get_block(reread_buffer, layout, true, copy), layout->storage_size)
+        );
+    }
+
+    error = pksav_gen4_save_load(tmp_save_filepath, &gen4_save);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL(1, pksav_littleendian32(gen4_save.pokemon_party->count));
+    TEST_ASSERT_EQUAL(123456, pksav_littleendian32(gen4_save.trainer_info->money));
+
+    // Saving without changes leaves the file as-is.
+    error = pksav_gen4_save_save(save_filepath, &gen4_save);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+    error = pksav_gen4_save_free(&gen4_save);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+
+    bool files_differ = true;
+    TEST_ASSERT_EQUAL(0, do_files_differ(save_filepath, tmp_save_filepath, &files_differ));
+    TEST_ASSERT_FALSE(files_differ);
+
+    // With both copies of a block corrupted, the save is invalid.
+    reread_buffer[0] ^= 0xFF;
+    reread_buffer[GEN4_COPY_SIZE] ^= 0xFF;
+    write_buffer(tmp_save_filepath, reread_buffer, sizeof(reread_buffer));
+    error = pksav_gen4_save_load(tmp_save_filepath, &gen4_save);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_INVALID_SAVE, error);
+
+    TEST_ASSERT_EQUAL(0, delete_file(save_filepath));
+    TEST_ASSERT_EQUAL(0, delete_file(tmp_save_filepath));
+}
+
+static void pokemon_diamond_test()
+{
+    gen4_save_test(PKSAV_GEN4_DP, "pokemon_diamond.sav");
+}
+
+static void pokemon_platinum_test()
+{
+    gen4_save_test(PKSAV_GEN4_PLATINUM, "pokemon_platinum.sav");
+}
+
+static void pokemon_heartgold_test()
+{
+    gen4_save_test(PKSAV_GEN4_HGSS, "pokemon_heartgold.sav");
+}
+
+PKSAV_TEST_MAIN(
+    PKSAV_TEST(pokemon_diamond_test)
+    PKSAV_TEST(pokemon_platinum_test)
+    PKSAV_TEST(pokemon_heartgold_test)
+)
@@ -0,0 +1,311 @@
+/*
+ * Copyright (c) 2018 Nicholas Corgan (n.corgan@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "c_test_common.h"
+#include "test-utils.h"
+
+#include <pksav.h>
+
+#include <stdio.h>
+#include <string.h>
+
+#define GEN5_SAVE_SIZE 0x80000
+
+#define BOXES_OFFSET   0x400
+#define BOX_STRIDE     0x1000
+#define PARTY_OFFSET   0x18E00
+#define PARTY_SIZE     0x534
+#define TRAINER_OFFSET 0x19400
+
+/*
+ * There are no Generation V saves in the test save repository, so these
+ * tests build saves with random contents and valid checksums.
+ */
+typedef struct
+{
+    size_t table_offset;
+    size_t table_size;
+    size_t table_checksum_offset;
+    size_t trainer_info_size;
+} gen5_layout_t;
+
+static const gen5_layout_t gen5_layouts[] =
+{
+    {0x23F00, 0x8C, 0x23F9A, 0x68}, // Black/White
+    {0x25F00, 0x94, 0x25FA2, 0xB0}  // Black 2/White 2
+};
+
+static uint8_t save_buffer[GEN5_SAVE_SIZE];
+static uint8_t reread_buffer[GEN5_SAVE_SIZE];
+
+// Bitwise reference implementation
+static uint16_t crc16_ccitt(
+    const uint8_t* buffer,
+    size_t len
+)
+{
+    uint16_t crc = 0xFFFF;
+    for(size_t i = 0; i < len; ++i)
+    {
+        crc ^= (uint16_t)(buffer[i] << 8);
+        for(size_t bit = 0; bit < 8; ++bit)
+        {
+            crc = (uint16_t)((crc & 0x8000) ? ((crc << 1) ^ 0x1021) : (crc << 1));
+        }
+    }
+
+    return crc;
+}
+
+static uint16_t read16(
+    const uint8_t* buffer,
+    size_t offset
+)
+{
+    return (uint16_t)(buffer[offset] | (buffer[offset+1] << 8));
+}
+
+static void write16(
+    uint8_t* buffer,
+    size_t offset,
+    uint16_t value
+)
+{
+    buffer[offset] = (uint8_t)(value & 0xFF);
+    buffer[offset+1] = (uint8_t)(value >> 8);
+}
+
+static void finish_block(
+    uint8_t* buffer,
+    const gen5_layout_t* layout,
+    size_t block_index,
+    size_t block_offset,
+    size_t block_size
+)
+{
+    uint16_t checksum = crc16_ccitt(&buffer[block_offset], block_size);
+    write16(buffer, block_offset + block_size + 2, checksum);
+    write16(buffer, layout->table_offset + (2 * block_index), checksum);
+}
+
+static void finish_table(
+    uint8_t* buffer,
+    const gen5_layout_t* layout
+)
+{
+    write16(
+        buffer,
+        layout->table_checksum_offset,
+        crc16_ccitt(&buffer[layout->table_offset], layout->table_size)
+    );
+}
+
+static bool is_table_valid(
+    const uint8_t* buffer,
+    const gen5_layout_t* layout
+)
+{
+    return (read16(buffer, layout->table_checksum_offset) ==
+            crc16_ccitt(&buffer[layout->table_offset], layout->table_size));
+}
+
+static void write_buffer(
+    const char* filepath,
+    const uint8_t* buffer,
+    size_t len
+)
+{
+    FILE* file = fopen(filepath, "wb");
+    TEST_ASSERT_NOT_NULL(file);
+    TEST_ASSERT_EQUAL(len, fwrite(buffer, 1, len, file));
+    fclose(file);
+}
+
+static void random_pc_pokemon(
+    pksav_nds_pc_pokemon_t* pc_pokemon
+)
+{
+    TEST_ASSERT_EQUAL(0, randomize_buffer((uint8_t*)pc_pokemon, sizeof(*pc_pokemon)));
+
+    uint16_t checksum = 0;
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, pksav_nds_get_pokemon_checksum(pc_pokemon, &checksum));
+    pc_pokemon->checksum = pksav_littleendian16(checksum);
+}
+
+static void gen5_save_test(
+    pksav_gen5_game_t game,
+    const char* save_name
+)
+{
+    static char save_filepath[256];
+    static char tmp_save_filepath[256];
+
+    const gen5_layout_t* layout = &gen5_layouts[game];
+    pksav_error_t error = PKSAV_ERROR_NONE;
+
+    snprintf(
+        save_filepath, sizeof(save_filepath),
+        "%s%spksav_%d_%s",
+        get_tmp_dir(), FS_SEPARATOR, get_pid(), save_name
+    );
+    snprintf(
+        tmp_save_filepath, sizeof(tmp_save_filepath),
+        "%s%spksav_%d_tmp_%s",
+        get_tmp_dir(), FS_SEPARATOR, get_pid(), save_name
+    );
+
+    // Box 0 has a single Pokémon in its first slot, and the party has one.
+    pksav_nds_pc_pokemon_t box_pokemon;
+    random_pc_pokemon(&box_pokemon);
+
+    pksav_nds_party_pokemon_t party_pokemon;
+    TEST_ASSERT_EQUAL(0, randomize_buffer((uint8_t*)&party_pokemon, sizeof(party_pokemon)));
+    random_pc_pokemon(&party_pokemon.pc);
+    party_pokemon.party_data.level = 50;
+    pksav_gen5_party_pokemon_t gen5_party_pokemon;
+    memcpy(&gen5_party_pokemon, &party_pokemon, sizeof(gen5_party_pokemon));
+
+    TEST_ASSERT_EQUAL(0, randomize_buffer(save_buffer, sizeof(save_buffer)));
+
+    pksav_gen5_pokemon_box_t* box = (pksav_gen5_pokemon_box_t*)&save_buffer[BOXES_OFFSET];
+    memset(box, 0, sizeof(*box));
+    box->entries[0] = box_pokemon;
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, pksav_nds_encrypt_pc_pokemon(box->entries, 1));
+
+    pksav_gen5_pokemon_party_t* party = (pksav_gen5_pokemon_party_t*)&save_buffer[PARTY_OFFSET + 4];
+    memset(party, 0, sizeof(*party));
+    party->count = pksav_littleendian32(1);
+    pksav_nds_party_pokemon_t encrypted_party_pokemon = party_pokemon;
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, pksav_nds_encrypt_party_pokemon(&encrypted_party_pokemon, 1));
+    memcpy(&party->party[0], &encrypted_party_pokemon, sizeof(party->party[0]));
+
+    for(size_t i = 0; i < PKSAV_GEN5_NUM_POKEMON_BOXES; ++i)
+    {
+        finish_block(save_buffer, layout, 1 + i, BOXES_OFFSET + (i * BOX_STRIDE), sizeof(pksav_gen5_pokemon_box_t));
+    }
+    finish_block(save_buffer, layout, 26, PARTY_OFFSET, PARTY_SIZE);
+    finish_block(save_buffer, layout, 27, TRAINER_OFFSET, layout->trainer_info_size);
+    finish_table(save_buffer, layout);
+    write_buffer(save_filepath, save_buffer, sizeof(save_buffer));
+
+    bool is_save = false;
+    for(pksav_gen5_game_t other_game = PKSAV_GEN5_BW; other_game <= PKSAV_GEN5_B2W2; ++other_game)
+    {
+        error = pksav_file_is_gen5_save(save_filepath, other_game, &is_save);
+        TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+        TEST_ASSERT_EQUAL((other_game == game), is_save);
+    }
+
+    pksav_gen5_save_t gen5_save;
+    error = pksav_gen5_save_load(save_filepath, &gen5_save);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL(game, gen5_save.gen5_game);
+    TEST_ASSERT_EQUAL(1, pksav_littleendian32(gen5_save.pokemon_party->count));
+    TEST_ASSERT_EQUAL(0,
+        memcmp(&gen5_save.pokemon_party->party[0], &gen5_party_pokemon, sizeof(gen5_party_pokemon))
+    );
+
+    const pksav_gen5_pokemon_box_t* read_box = NULL;
+    error = pksav_gen5_save_get_pokemon_box(&gen5_save, 0, &read_box);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+    TEST_ASSERT_NOT_NULL(read_box);
+    TEST_ASSERT_EQUAL(0, memcmp(&read_box->entries[0], &box_pokemon, sizeof(box_pokemon)));
+    for(size_t i = 1; i < 30; ++i)
+    {
+        pksav_nds_pc_pokemon_t empty;
+        memset(&empty, 0, sizeof(empty));
+        TEST_ASSERT_EQUAL(0, memcmp(&read_box->entries[i], &empty, sizeof(empty)));
+    }
+
+    error = pksav_gen5_save_get_pokemon_box(&gen5_save, PKSAV_GEN5_NUM_POKEMON_BOXES, &read_box);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_PARAM_OUT_OF_RANGE, error);
+
+    // Reading boxes without editing them leaves the file as-is.
+    error = pksav_gen5_save_save(tmp_save_filepath, &gen5_save);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+
+    bool files_differ = true;
+    TEST_ASSERT_EQUAL(0, do_files_differ(save_filepath, tmp_save_filepath, &files_differ));
+    TEST_ASSERT_FALSE(files_differ);
+
+    // Move the box Pokémon into box 3 and edit the party.
+    pksav_gen5_pokemon_box_t* edit_box = NULL;
+    error = pksav_gen5_save_edit_pokemon_box(&gen5_save, 3, &edit_box);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+    edit_box->entries[5] = box_pokemon;
+
+    gen5_save.pokemon_party->party[0].party_data.level = 100;
+
+    error = pksav_gen5_save_save(tmp_save_filepath, &gen5_save);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+    error = pksav_gen5_save_free(&gen5_save);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+
+    TEST_ASSERT_EQUAL(0, read_file_into_buffer(tmp_save_filepath, reread_buffer, sizeof(reread_buffer)));
+    TEST_ASSERT_TRUE(is_table_valid(reread_buffer, layout));
+
+    // Only the edited blocks changed.
+    for(size_t i = 0; i < PKSAV_GEN5_NUM_POKEMON_BOXES; ++i)
+    {
+        size_t box_offset = BOXES_OFFSET + (i * BOX_STRIDE);
+        TEST_ASSERT_EQUAL((i == 3),
+            (memcmp(&save_buffer[box_offset], &reread_buffer[box_offset], sizeof(pksav_gen5_pokemon_box_t)) != 0)
+        );
+    }
+    TEST_ASSERT_EQUAL(0,
+        memcmp(&save_buffer[TRAINER_OFFSET], &reread_buffer[TRAINER_OFFSET], layout->trainer_info_size + 4)
+    );
+
+    pksav_gen5_pokemon_box_t* box3 = (pksav_gen5_pokemon_box_t*)&reread_buffer[BOXES_OFFSET + (3 * BOX_STRIDE)];
+    TEST_ASSERT_EQUAL(0, memcmp(&box3->entries[5], &box->entries[0], sizeof(box_pokemon)));
+
+    error = pksav_gen5_save_load(tmp_save_filepath, &gen5_save);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL(100, gen5_save.pokemon_party->party[0].party_data.level);
+    TEST_ASSERT_EQUAL(0,
+        memcmp(&gen5_save.pokemon_party->party[0].pc, &gen5_party_pokemon.pc, sizeof(gen5_party_pokemon.pc))
+    );
+
+    error = pksav_gen5_save_get_pokemon_box(&gen5_save, 3, &read_box);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL(0, memcmp(&read_box->entries[5], &box_pokemon, sizeof(box_pokemon)));
+
+    // Editing the trainer info in place is detected.
+    gen5_save.trainer_info->gender = !gen5_save.trainer_info->gender;
+    error = pksav_gen5_save_save(save_filepath, &gen5_save);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+    error = pksav_gen5_save_free(&gen5_save);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+
+    error = pksav_file_is_gen5_save(save_filepath, game, &is_save);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+    TEST_ASSERT_TRUE(is_save);
+
+    // A corrupted box block makes the save invalid.
+    reread_buffer[BOXES_OFFSET + (7 * BOX_STRIDE)] ^= 0xFF;
+    write_buffer(tmp_save_filepath, reread_buffer, sizeof(reread_buffer));
+    error = pksav_gen5_save_load(tmp_save_filepath, &gen5_save);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_INVALID_SAVE, error);
+
+    TEST_ASSERT_EQUAL(0, delete_file(save_filepath));
+    TEST_ASSERT_EQUAL(0, delete_file(tmp_save_filepath));
+}
+
+static void pokemon_black_test()
+{
+    gen5_save_test(PKSAV_GEN5_BW, "pokemon_black.sav");
+}
+
+static void pokemon_black2_test()
+{
+    gen5_save_test(PKSAV_GEN5_B2W2, "pokemon_black2.sav");
+}
+
+PKSAV_TEST_MAIN(
+    PKSAV_TEST(pokemon_black_test)
+    PKSAV_TEST(pokemon_black2_test)
+)
@@ -0,0 +1,199 @@
+/*
+ * Copyright (c) 2018 Nicholas Corgan (n.corgan@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "c_test_common.h"
+#include "test-utils.h"
+
+#include <pksav.h>
+
+#include <stdio.h>
+#include <string.h>
+
+#define NUM_FILES   12
+#define QUEUE_DEPTH 4
+
+typedef struct
+{
+    size_t num_calls;
+    pksav_error_t error;
+    size_t buffer_len;
+    bool contents_match;
+} ingest_result_t;
+
+typedef struct
+{
+    uint8_t* contents[NUM_FILES];
+    size_t sizes[NUM_FILES];
+    ingest_result_t results[NUM_FILES];
+} ingest_test_data_t;
+
+static void store_result(
+    size_t index,
+    const char* filepath,
+    pksav_error_t error,
+    const uint8_t* buffer,
+    size_t buffer_len,
+    void* user_data
+)
+{
+    (void)filepath;
+
+    ingest_test_data_t* data = (ingest_test_data_t*)user_data;
+    ingest_result_t* result = &data->results[index];
+
+    ++result->num_calls;
+    result->error = error;
+    result->buffer_len = buffer_len;
+    result->contents_match = (buffer_len == data->sizes[index]) &&
+                             ((buffer_len == 0) || !memcmp(buffer, data->contents[index], buffer_len));
+}
+
+static void ingest_files_test()
+{
+    char filepaths[NUM_FILES][256];
+    const char* filepath_ptrs[NUM_FILES];
+
+    ingest_test_data_t* data = calloc(1, sizeof(ingest_test_data_t));
+
+    /*
+     * Files of different sizes (including an empty one), with every fifth
+     * one never being created.
+     */
+    for(size_t i = 0; i < NUM_FILES; ++i)
+    {
+        snprintf(
+            filepaths[i], sizeof(filepaths[i]),
+            "%s%spksav_%d_ingest_test_%d.sav",
+            get_tmp_dir(), FS_SEPARATOR, get_pid(), (int)i
+        );
+        filepath_ptrs[i] = filepaths[i];
+
+        if((i % 5) == 4)
+        {
+            continue;
+        }
+
+        data->sizes[i] = (i == 0) ? 0 : (0x8000 * i) + i;
+        data->contents[i] = calloc(data->sizes[i] + 1, 1);
+        if(data->sizes[i] > 0)
+        {
+            TEST_ASSERT_EQUAL(0, randomize_buffer(data->contents[i], data->sizes[i]));
+        }
+
+        FILE* file = fopen(filepaths[i], "wb");
+        TEST_ASSERT_NOT_NULL(file);
+        TEST_ASSERT_EQUAL(data->sizes[i], fwrite(data->contents[i], 1, data->sizes[i], file));
+        fclose(file);
+    }
+
+    pksav_ingest_options_t options;
+    memset(&options, 0, sizeof(options));
+    options.queue_depth = QUEUE_DEPTH;
+    options.ingest_fcn = store_result;
+    options.user_data = data;
+
+    size_t num_failures = 0;
+    pksav_error_t error = pksav_ingest_files(filepath_ptrs, NUM_FILES, &options, &num_failures);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL(2, num_failures);
+
+    for(size_t i = 0; i < NUM_FILES; ++i)
+    {
+        ingest_result_t* result = &data->results[i];
+        TEST_ASSERT_EQUAL(1, result->num_calls);
+        if((i % 5) == 4)
+        {
+            TEST_ASSERT_EQUAL(PKSAV_ERROR_FILE_IO, result->error);
+            TEST_ASSERT_EQUAL(0, result->buffer_len);
+        }
+        else
+        {
+            TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, result->error);
+            TEST_ASSERT_TRUE(result->contents_match);
+
+            TEST_ASSERT_EQUAL(0, delete_file(filepaths[i]));
+        }
+
+        free(data->contents[i]);
+    }
+
+    free(data);
+}
+
+static void load_gen1_save(
+    size_t index,
+    const char* filepath,
+    pksav_error_t error,
+    const uint8_t* buffer,
+    size_t buffer_len,
+    void* user_data
+)
+{
+    (void)filepath;
+
+    pksav_error_t* load_errors = (pksav_error_t*)user_data;
+    if(!error)
+    {
+        pksav_gen1_save_t gen1_save;
+        error = pksav_gen1_save_load_buffer(buffer, buffer_len, &gen1_save);
+        if(!error)
+        {
+            pksav_gen1_save_free(&gen1_save);
+        }
+    }
+
+    load_errors[index] = error;
+}
+
+static void ingest_load_buffer_test()
+{
+    char filepath[256] = {0};
+    snprintf(
+        filepath, sizeof(filepath),
+        "%s%spksav_%d_ingest_load_buffer_test.sav",
+        get_tmp_dir(), FS_SEPARATOR, get_pid()
+    );
+    const char* filepaths[] = {filepath, NULL, filepath};
+
+    // A Generation I save with nothing in it but a valid checksum
+    uint8_t* buffer = calloc(0x8000, 1);
+    buffer[0x3523] = 0xFF;
+
+    FILE* file = fopen(filepath, "wb");
+    TEST_ASSERT_NOT_NULL(file);
+    TEST_ASSERT_EQUAL(0x8000, fwrite(buffer, 1, 0x8000, file));
+    fclose(file);
+
+    pksav_error_t load_errors[3] = {PKSAV_ERROR_NONE, PKSAV_ERROR_NONE, PKSAV_ERROR_NONE};
+
+    pksav_ingest_options_t options;
+    memset(&options, 0, sizeof(options));
+    options.ingest_fcn = load_gen1_save;
+    options.user_data = load_errors;
+
+    size_t num_failures = 0;
+    pksav_error_t error = pksav_ingest_files(filepaths, 3, &options, &num_failures);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL(1, num_failures);
+
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, load_errors[0]);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, load_errors[1]);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, load_errors[2]);
+
+    // Nothing to do
+    error = pksav_ingest_files(filepaths, 0, &options, &num_failures);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL(0, num_failures);
+
+    free(buffer);
+    TEST_ASSERT_EQUAL(0, delete_file(filepath));
+}
+
+PKSAV_TEST_MAIN(
+    PKSAV_TEST(ingest_files_test)
+    PKSAV_TEST(ingest_load_buffer_test)
+)
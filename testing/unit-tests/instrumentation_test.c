@@ -0,0 +1,152 @@
+/*
+ * Copyright (c) 2018 Nicholas Corgan (n.corgan@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "c_test_common.h"
+
+#include <pksav.h>
+
+#include <string.h>
+
+#define GBA_SAVE_SIZE 0x20000
+
+typedef struct
+{
+    size_t num_reports[PKSAV_NUM_PHASES];
+    size_t bytes_touched[PKSAV_NUM_PHASES];
+    pksav_phase_t order[64];
+    size_t num_total_reports;
+} phase_counts_t;
+
+static void count_phase(
+    pksav_phase_t phase,
+    uint64_t duration_ns,
+    size_t bytes_touched,
+    void* user_data
+)
+{
+    (void)duration_ns;
+
+    phase_counts_t* counts = (phase_counts_t*)user_data;
+    TEST_ASSERT_TRUE((unsigned int)phase < PKSAV_NUM_PHASES);
+
+    ++counts->num_reports[phase];
+    counts->bytes_touched[phase] += bytes_touched;
+    if(counts->num_total_reports < (sizeof(counts->order)/sizeof(counts->order[0])))
+    {
+        counts->order[counts->num_total_reports] = phase;
+    }
+    ++counts->num_total_reports;
+}
+
+static void phase_name_test()
+{
+    TEST_ASSERT_EQUAL_STRING("read", pksav_phase_name(PKSAV_PHASE_READ));
+    TEST_ASSERT_EQUAL_STRING("unshuffle", pksav_phase_name(PKSAV_PHASE_UNSHUFFLE));
+    TEST_ASSERT_EQUAL_STRING("write", pksav_phase_name(PKSAV_PHASE_WRITE));
+    TEST_ASSERT_EQUAL_STRING("unknown", pksav_phase_name((pksav_phase_t)PKSAV_NUM_PHASES));
+}
+
+static void gba_phases_test()
+{
+    uint8_t* buffer = calloc(GBA_SAVE_SIZE, 1);
+    TEST_ASSERT_NOT_NULL(buffer);
+    TEST_ASSERT_EQUAL(
+        PKSAV_ERROR_NONE,
+        pksav_corpus_generate_save(PKSAV_CORPUS_EMERALD, 43, buffer, GBA_SAVE_SIZE, NULL)
+    );
+
+    phase_counts_t load_counts;
+    memset(&load_counts, 0, sizeof(load_counts));
+
+    pksav_instrumentation_t instrumentation =
+    {
+        .phase_fcn = count_phase,
+        .user_data = &load_counts
+    };
+    pksav_set_thread_instrumentation(&instrumentation);
+
+    pksav_gba_save_t gba_save;
+    pksav_error_t error = pksav_gba_save_load_buffer(buffer, GBA_SAVE_SIZE, &gba_save);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+
+    if(!pksav_instrumentation_is_enabled())
+    {
+        // Compiled out, so nothing is ever reported.
+        TEST_ASSERT_EQUAL(0, load_counts.num_total_reports);
+    }
+    else
+    {
+        static const pksav_phase_t expected_load_order[] =
+        {
+            PKSAV_PHASE_READ,
+            PKSAV_PHASE_DETECT,
+            PKSAV_PHASE_SLOT_SELECT,
+            PKSAV_PHASE_UNSHUFFLE,
+            PKSAV_PHASE_POKEMON_CRYPT,
+            PKSAV_PHASE_ITEM_CRYPT
+        };
+        TEST_ASSERT_EQUAL(6, load_counts.num_total_reports);
+        for(size_t i = 0; i < 6; ++i)
+        {
+            TEST_ASSERT_EQUAL(expected_load_order[i], load_counts.order[i]);
+        }
+        TEST_ASSERT_EQUAL(GBA_SAVE_SIZE, load_counts.bytes_touched[PKSAV_PHASE_READ]);
+
+        // Emerald is the second game checked.
+        TEST_ASSERT_EQUAL(
+            2 * sizeof(pksav_gba_save_slot_t),
+            load_counts.bytes_touched[PKSAV_PHASE_DETECT]
+        );
+    }
+
+    phase_counts_t save_counts;
+    memset(&save_counts, 0, sizeof(save_counts));
+    instrumentation.user_data = &save_counts;
+    pksav_set_thread_instrumentation(&instrumentation);
+
+    error = pksav_gba_save_save_buffer(buffer, GBA_SAVE_SIZE, &gba_save);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+
+    if(pksav_instrumentation_is_enabled())
+    {
+        // Saving encrypts a copy, so nothing is reloaded afterwards.
+        static const pksav_phase_t expected_save_order[] =
+        {
+            PKSAV_PHASE_ITEM_CRYPT,
+            PKSAV_PHASE_POKEMON_CRYPT,
+            PKSAV_PHASE_CHECKSUM,
+            PKSAV_PHASE_SHUFFLE,
+            PKSAV_PHASE_WRITE
+        };
+        TEST_ASSERT_EQUAL(5, save_counts.num_total_reports);
+        for(size_t i = 0; i < 5; ++i)
+        {
+            TEST_ASSERT_EQUAL(expected_save_order[i], save_counts.order[i]);
+        }
+        TEST_ASSERT_EQUAL(GBA_SAVE_SIZE, save_counts.bytes_touched[PKSAV_PHASE_WRITE]);
+    }
+    else
+    {
+        TEST_ASSERT_EQUAL(0, save_counts.num_total_reports);
+    }
+
+    // Nothing is reported once it's unset.
+    pksav_set_thread_instrumentation(NULL);
+    memset(&save_counts, 0, sizeof(save_counts));
+
+    error = pksav_gba_save_save_buffer(buffer, GBA_SAVE_SIZE, &gba_save);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL(0, save_counts.num_total_reports);
+
+    pksav_gba_save_free(&gba_save);
+    free(buffer);
+}
+
+PKSAV_TEST_MAIN(
+    PKSAV_TEST(phase_name_test)
+    PKSAV_TEST(gba_phases_test)
+)
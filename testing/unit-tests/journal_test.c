@@ -0,0 +1,306 @@
+/*
+ * Copyright (c) 2018 Nicholas Corgan (n.corgan@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "c_test_common.h"
+
+#include <pksav.h>
+
+#include <string.h>
+
+#define BUFFER_SIZE   256
+#define GBA_SAVE_SIZE 0x20000
+
+static void check_depth(
+    const pksav_journal_t* journal,
+    size_t expected_num_undos,
+    size_t expected_num_redos
+)
+{
+    size_t num_undos = 0;
+    size_t num_redos = 0;
+    TEST_ASSERT_EQUAL(
+        PKSAV_ERROR_NONE,
+        pksav_journal_get_depth(journal, &num_undos, &num_redos)
+    );
+    TEST_ASSERT_EQUAL(expected_num_undos, num_undos);
+    TEST_ASSERT_EQUAL(expected_num_redos, num_redos);
+}
+
+static void journal_undo_redo_test()
+{
+    uint8_t buffer[BUFFER_SIZE] = {0};
+    uint8_t outside = 0;
+
+    pksav_journal_t journal;
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, pksav_journal_init(&journal, 0));
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, pksav_journal_add_region(&journal, buffer, sizeof(buffer)));
+    check_depth(&journal, 0, 0);
+
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_PARAM_OUT_OF_RANGE, pksav_journal_undo(&journal));
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_PARAM_OUT_OF_RANGE, pksav_journal_redo(&journal));
+
+    // Nothing outside of a region can be written.
+    uint8_t value = 0xAB;
+    TEST_ASSERT_EQUAL(
+        PKSAV_ERROR_PARAM_OUT_OF_RANGE,
+        pksav_journal_write(&journal, &outside, &value, 1)
+    );
+    TEST_ASSERT_EQUAL(
+        PKSAV_ERROR_PARAM_OUT_OF_RANGE,
+        pksav_journal_write(&journal, &buffer[BUFFER_SIZE-1], "ab", 2)
+    );
+    TEST_ASSERT_EQUAL(0, outside);
+    TEST_ASSERT_EQUAL(0, buffer[BUFFER_SIZE-1]);
+
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, pksav_journal_write(&journal, &buffer[10], "abc", 3));
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, pksav_journal_checkpoint(&journal));
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, pksav_journal_write(&journal, &buffer[11], "XY", 2));
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, pksav_journal_checkpoint(&journal));
+    TEST_ASSERT_EQUAL_MEMORY("aXY", &buffer[10], 3);
+    check_depth(&journal, 2, 0);
+
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, pksav_journal_undo(&journal));
+    TEST_ASSERT_EQUAL_MEMORY("abc", &buffer[10], 3);
+    check_depth(&journal, 1, 1);
+
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, pksav_journal_undo(&journal));
+    TEST_ASSERT_EQUAL_MEMORY("\0\0\0", &buffer[10], 3);
+    check_depth(&journal, 0, 2);
+
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, pksav_journal_redo(&journal));
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, pksav_journal_redo(&journal));
+    TEST_ASSERT_EQUAL_MEMORY("aXY", &buffer[10], 3);
+    check_depth(&journal, 2, 0);
+
+    // A new edit replaces anything that was undone.
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, pksav_journal_undo(&journal));
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, pksav_journal_write(&journal, &buffer[20], "z", 1));
+    check_depth(&journal, 2, 0);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_PARAM_OUT_OF_RANGE, pksav_journal_redo(&journal));
+    TEST_ASSERT_EQUAL_MEMORY("abc", &buffer[10], 3);
+
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, pksav_journal_free(&journal));
+}
+
+static void journal_merge_test()
+{
+    uint8_t buffer[BUFFER_SIZE] = {0};
+    static const char name[] = "PIKACHU";
+
+    pksav_journal_t journal;
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, pksav_journal_init(&journal, 0));
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, pksav_journal_add_region(&journal, buffer, sizeof(buffer)));
+
+    // Writing one character at a time is undone as a single edit.
+    for(size_t i = 0; i < strlen(name); ++i)
+    {
+        TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, pksav_journal_write(&journal, &buffer[i], &name[i], 1));
+    }
+
+    // So is going back and fixing part of it.
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, pksav_journal_write(&journal, &buffer[1], "O", 1));
+    TEST_ASSERT_EQUAL_STRING("POKACHU", (const char*)buffer);
+    check_depth(&journal, 1, 0);
+
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, pksav_journal_checkpoint(&journal));
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, pksav_journal_write(&journal, &buffer[7], "!", 1));
+    check_depth(&journal, 2, 0);
+
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, pksav_journal_undo(&journal));
+    TEST_ASSERT_EQUAL_STRING("POKACHU", (const char*)buffer);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, pksav_journal_undo(&journal));
+    TEST_ASSERT_EQUAL_MEMORY("\0\0\0\0\0\0\0\0", buffer, 8);
+
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, pksav_journal_redo(&journal));
+    TEST_ASSERT_EQUAL_STRING("POKACHU", (const char*)buffer);
+
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, pksav_journal_free(&journal));
+}
+
+static void journal_capacity_test()
+{
+    uint8_t buffer[BUFFER_SIZE] = {0};
+
+    // Enough for three 10-byte edits
+    pksav_journal_t journal;
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, pksav_journal_init(&journal, 64));
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, pksav_journal_add_region(&journal, buffer, sizeof(buffer)));
+
+    // Too big to ever fit
+    uint8_t big_edit[33];
+    memset(big_edit, 0xFF, sizeof(big_edit));
+    TEST_ASSERT_EQUAL(
+        PKSAV_ERROR_PARAM_OUT_OF_RANGE,
+        pksav_journal_write(&journal, buffer, big_edit, sizeof(big_edit))
+    );
+    TEST_ASSERT_EQUAL(0, buffer[0]);
+
+    for(uint8_t i = 1; i <= 10; ++i)
+    {
+        uint8_t edit[10];
+        memset(edit, i, sizeof(edit));
+        TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, pksav_journal_write(&journal, &buffer[i * 10], edit, sizeof(edit)));
+        TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, pksav_journal_checkpoint(&journal));
+    }
+
+    // Only the newest edits are remembered, and the rest stay as they are.
+    size_t num_undos = 0;
+    size_t num_redos = 0;
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, pksav_journal_get_depth(&journal, &num_undos, &num_redos));
+    TEST_ASSERT_TRUE(num_undos >= 2);
+    TEST_ASSERT_TRUE(num_undos < 10);
+
+    for(size_t i = 0; i < num_undos; ++i)
+    {
+        TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, pksav_journal_undo(&journal));
+    }
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_PARAM_OUT_OF_RANGE, pksav_journal_undo(&journal));
+
+    for(uint8_t i = 1; i <= 10; ++i)
+    {
+        uint8_t expected = (i <= (10 - num_undos)) ? i : 0;
+        TEST_ASSERT_EQUAL(expected, buffer[i * 10]);
+        TEST_ASSERT_EQUAL(expected, buffer[(i * 10) + 9]);
+    }
+
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, pksav_journal_free(&journal));
+}
+
+static void journal_patch_test()
+{
+    uint8_t original[BUFFER_SIZE];
+    for(size_t i = 0; i < sizeof(original); ++i)
+    {
+        original[i] = (uint8_t)i;
+    }
+
+    uint8_t buffer1[BUFFER_SIZE];
+    uint8_t buffer2[BUFFER_SIZE];
+    memcpy(buffer1, original, sizeof(original));
+    memcpy(buffer2, original, sizeof(original));
+
+    pksav_journal_t journal1;
+    pksav_journal_t journal2;
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, pksav_journal_init(&journal1, 0));
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, pksav_journal_add_region(&journal1, buffer1, sizeof(buffer1)));
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, pksav_journal_init(&journal2, 0));
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, pksav_journal_add_region(&journal2, buffer2, sizeof(buffer2)));
+
+    // Overlapping edits, so each one depends on the one before it
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, pksav_journal_write(&journal1, &buffer1[4], "ABCD", 4));
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, pksav_journal_checkpoint(&journal1));
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, pksav_journal_write(&journal1, &buffer1[6], "XYZ", 3));
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, pksav_journal_checkpoint(&journal1));
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, pksav_journal_write(&journal1, &buffer1[200], "!", 1));
+
+    // Undone edits aren't exported.
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, pksav_journal_undo(&journal1));
+
+    size_t patch_size = 0;
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, pksav_journal_get_patch_size(&journal1, &patch_size));
+    uint8_t* patch = calloc(patch_size, 1);
+    TEST_ASSERT_NOT_NULL(patch);
+
+    TEST_ASSERT_EQUAL(
+        PKSAV_ERROR_PARAM_OUT_OF_RANGE,
+        pksav_journal_export_patch(&journal1, patch, patch_size-1)
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, pksav_journal_export_patch(&journal1, patch, patch_size));
+
+    // Truncated
+    TEST_ASSERT_EQUAL(
+        PKSAV_ERROR_PARAM_OUT_OF_RANGE,
+        pksav_journal_apply_patch(&journal2, patch, patch_size-1)
+    );
+    TEST_ASSERT_EQUAL_MEMORY(original, buffer2, sizeof(original));
+
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, pksav_journal_apply_patch(&journal2, patch, patch_size));
+    TEST_ASSERT_EQUAL_MEMORY(buffer1, buffer2, sizeof(buffer1));
+    check_depth(&journal2, 2, 0);
+
+    // Applying it again fails, since the bytes it replaces have changed.
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_INVALID_SAVE, pksav_journal_apply_patch(&journal2, patch, patch_size));
+    TEST_ASSERT_EQUAL_MEMORY(buffer1, buffer2, sizeof(buffer1));
+    check_depth(&journal2, 2, 0);
+
+    // As does applying it once only the second edit no longer matches, which
+    // puts the first one back.
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, pksav_journal_undo(&journal2));
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, pksav_journal_undo(&journal2));
+    TEST_ASSERT_EQUAL_MEMORY(original, buffer2, sizeof(original));
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, pksav_journal_write(&journal2, &buffer2[8], "?", 1));
+    memcpy(original, buffer2, sizeof(original));
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_INVALID_SAVE, pksav_journal_apply_patch(&journal2, patch, patch_size));
+    TEST_ASSERT_EQUAL_MEMORY(original, buffer2, sizeof(original));
+
+    free(patch);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, pksav_journal_free(&journal1));
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, pksav_journal_free(&journal2));
+}
+
+static void journal_gba_save_test()
+{
+    uint8_t* buffer = calloc(GBA_SAVE_SIZE, 1);
+    TEST_ASSERT_NOT_NULL(buffer);
+    TEST_ASSERT_EQUAL(
+        PKSAV_ERROR_NONE,
+        pksav_corpus_generate_save(PKSAV_CORPUS_EMERALD, 47, buffer, GBA_SAVE_SIZE, NULL)
+    );
+
+    pksav_gba_save_t gba_save;
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, pksav_gba_save_load_buffer(buffer, GBA_SAVE_SIZE, &gba_save));
+
+    pksav_journal_t journal;
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, pksav_journal_init(&journal, 0));
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, pksav_journal_add_gba_save(&journal, &gba_save));
+
+    uint32_t original_money = *gba_save.money;
+    uint8_t original_box_name[9];
+    memcpy(original_box_name, gba_save.pokemon_pc->box_names[0], sizeof(original_box_name));
+
+    uint32_t money = original_money ^ 0x1234;
+    static const uint8_t box_name[9] = {0xBB, 0xBC, 0xBD, 0xFF, 0, 0, 0, 0, 0};
+    TEST_ASSERT_EQUAL(
+        PKSAV_ERROR_NONE,
+        pksav_journal_write(&journal, gba_save.money, &money, sizeof(money))
+    );
+    TEST_ASSERT_EQUAL(
+        PKSAV_ERROR_NONE,
+        pksav_journal_write(&journal, gba_save.pokemon_pc->box_names[0], box_name, sizeof(box_name))
+    );
+
+    // Saving doesn't get in the way of undoing.
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, pksav_gba_save_save_buffer(buffer, GBA_SAVE_SIZE, &gba_save));
+
+    pksav_gba_save_t reloaded_save;
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, pksav_gba_save_load_buffer(buffer, GBA_SAVE_SIZE, &reloaded_save));
+    TEST_ASSERT_EQUAL(money, *reloaded_save.money);
+    TEST_ASSERT_EQUAL_MEMORY(box_name, reloaded_save.pokemon_pc->box_names[0], sizeof(box_name));
+    pksav_gba_save_free(&reloaded_save);
+
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, pksav_journal_undo(&journal));
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, pksav_journal_undo(&journal));
+    TEST_ASSERT_EQUAL(original_money, *gba_save.money);
+    TEST_ASSERT_EQUAL_MEMORY(original_box_name, gba_save.pokemon_pc->box_names[0], sizeof(original_box_name));
+
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, pksav_gba_save_save_buffer(buffer, GBA_SAVE_SIZE, &gba_save));
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, pksav_gba_save_load_buffer(buffer, GBA_SAVE_SIZE, &reloaded_save));
+    TEST_ASSERT_EQUAL(original_money, *reloaded_save.money);
+    pksav_gba_save_free(&reloaded_save);
+
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, pksav_journal_free(&journal));
+    pksav_gba_save_free(&gba_save);
+    free(buffer);
+}
+
+PKSAV_TEST_MAIN(
+    PKSAV_TEST(journal_undo_redo_test)
+    PKSAV_TEST(journal_merge_test)
+    PKSAV_TEST(journal_capacity_test)
+    PKSAV_TEST(journal_patch_test)
+    PKSAV_TEST(journal_gba_save_test)
+)
@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) 2018 Nicholas Corgan (n.corgan@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "c_test_common.h"
+#include "test-utils.h"
+
+#include <pksav.h>
+
+#include <string.h>
+
+#define NUM_POKEMON 30
+
+// One LCRNG step per word, as the games do it
+static void reference_crypt(
+    uint8_t* buffer,
+    size_t num_words,
+    uint32_t seed
+)
+{
+    for(size_t i = 0; i < num_words; ++i)
+    {
+        seed = (seed * 0x41C64E6D) + 0x6073;
+        buffer[(2*i)]   ^= (uint8_t)((seed >> 16) & 0xFF);
+        buffer[(2*i)+1] ^= (uint8_t)(seed >> 24);
+    }
+}
+
+static void pc_pokemon_crypt_test()
+{
+    static pksav_nds_pc_pokemon_t pokemon[NUM_POKEMON];
+    static pksav_nds_pc_pokemon_t decrypted[NUM_POKEMON];
+
+    (void)randomize_buffer((uint8_t*)decrypted, sizeof(decrypted));
+    memcpy(pokemon, decrypted, sizeof(pokemon));
+
+    pksav_error_t error = pksav_nds_encrypt_pc_pokemon(pokemon, NUM_POKEMON);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+
+    for(size_t i = 0; i < NUM_POKEMON; ++i)
+    {
+        uint16_t checksum = 0;
+        error = pksav_nds_get_pokemon_checksum(&decrypted[i], &checksum);
+        TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+        TEST_ASSERT_EQUAL(checksum, pksav_littleendian16(pokemon[i].checksum));
+
+        // Undo the keystream one step at a time.
+        pksav_nds_pokemon_blocks_t blocks = pokemon[i].blocks;
+        reference_crypt(blocks.blocks8, 64, checksum);
+
+        // Every stored block should be one of the original blocks.
+        size_t num_matching = 0;
+        for(size_t stored = 0; stored < 4; ++stored)
+        {
+            for(size_t block = 0; block < 4; ++block)
+            {
+                if(!memcmp(blocks.blocks[stored], decrypted[i].blocks.blocks[block], 32))
+                {
+                    ++num_matching;
+                    break;
+                }
+            }
+        }
+        TEST_ASSERT_EQUAL(4, num_matching);
+    }
+
+    error = pksav_nds_decrypt_pc_pokemon(pokemon, NUM_POKEMON);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+
+    for(size_t i = 0; i < NUM_POKEMON; ++i)
+    {
+        TEST_ASSERT_EQUAL(0, memcmp(&decrypted[i].blocks, &pokemon[i].blocks, sizeof(pokemon[i].blocks)));
+        TEST_ASSERT_EQUAL(decrypted[i].personality, pokemon[i].personality);
+    }
+}
+
+static void block_order_test()
+{
+    // A personality whose block order is ABDC
+    pksav_nds_pc_pokemon_t pokemon;
+    memset(&pokemon, 0, sizeof(pokemon));
+    pokemon.personality = pksav_littleendian32(1 << 13);
+    for(size_t block = 0; block < 4; ++block)
+    {
+        memset(pokemon.blocks.blocks[block], (int)('A' + block), 32);
+    }
+
+    pksav_nds_pc_pokemon_t encrypted = pokemon;
+    pksav_error_t error = pksav_nds_encrypt_pc_pokemon(&encrypted, 1);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+
+    reference_crypt(encrypted.blocks.blocks8, 64, pksav_littleendian16(encrypted.checksum));
+    TEST_ASSERT_EQUAL('A', encrypted.blocks.blocks[0][0]);
+    TEST_ASSERT_EQUAL('B', encrypted.blocks.blocks[1][0]);
+    TEST_ASSERT_EQUAL('D', encrypted.blocks.blocks[2][0]);
+    TEST_ASSERT_EQUAL('C', encrypted.blocks.blocks[3][0]);
+}
+
+static void party_pokemon_crypt_test()
+{
+    static pksav_nds_party_pokemon_t pokemon[6];
+    static pksav_nds_party_pokemon_t decrypted[6];
+
+    (void)randomize_buffer((uint8_t*)decrypted, sizeof(decrypted));
+    memcpy(pokemon, decrypted, sizeof(pokemon));
+
+    pksav_error_t error = pksav_nds_encrypt_party_pokemon(pokemon, 6);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+
+    // Party data is seeded by the personality.
+    for(size_t i = 0; i < 6; ++i)
+    {
+        pksav_nds_pokemon_party_data_t party_data = pokemon[i].party_data;
+        reference_crypt(
+            (uint8_t*)&party_data,
+            sizeof(party_data) / 2,
+            pksav_littleendian32(pokemon[i].pc.personality)
+        );
+        TEST_ASSERT_EQUAL(0, memcmp(&decrypted[i].party_data, &party_data, sizeof(party_data)));
+    }
+
+    error = pksav_nds_decrypt_party_pokemon(pokemon, 6);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+
+    for(size_t i = 0; i < 6; ++i)
+    {
+        TEST_ASSERT_EQUAL(0, memcmp(&decrypted[i].pc.blocks, &pokemon[i].pc.blocks, sizeof(pokemon[i].pc.blocks)));
+        TEST_ASSERT_EQUAL(0, memcmp(&decrypted[i].party_data, &pokemon[i].party_data, sizeof(pokemon[i].party_data)));
+    }
+}
+
+PKSAV_TEST_MAIN(
+    PKSAV_TEST(pc_pokemon_crypt_test)
+    PKSAV_TEST(block_order_test)
+    PKSAV_TEST(party_pokemon_crypt_test)
+)
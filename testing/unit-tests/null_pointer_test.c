@@ -9,89 +9,2699 @@
 
 #include <pksav.h>
 
+#include <string.h>
+
+/*
+ * pksav/batch.h
+ */
+
+static void pksav_batch_h_test() {
+    pksav_error_t status = PKSAV_ERROR_NONE;
+
+    pksav_batch_input_t dummy_pksav_batch_input_t;
+    pksav_batch_options_t dummy_pksav_batch_options_t;
+    size_t dummy_size_t = 0;
+
+    /*
+     * pksav_batch_process
+     */
+
+    status = pksav_batch_process(
+        NULL,
+        0,
+        &dummy_pksav_batch_options_t,
+        &dummy_size_t
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_batch_process(
+        &dummy_pksav_batch_input_t,
+        0,
+        NULL,
+        &dummy_size_t
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_batch_process(
+        NULL,
+        0,
+        NULL,
+        &dummy_size_t
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+}
+
+
+/*
+ * pksav/corpus.h
+ */
+
+static void pksav_corpus_h_test() {
+    pksav_error_t status = PKSAV_ERROR_NONE;
+
+    /*
+     * pksav_corpus_get_save_size
+     */
+
+    status = pksav_corpus_get_save_size(
+        PKSAV_CORPUS_RED_BLUE,
+        NULL
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    /*
+     * pksav_corpus_generate_save
+     */
+
+    status = pksav_corpus_generate_save(
+        PKSAV_CORPUS_RED_BLUE,
+        0,
+        NULL,
+        PKSAV_CORPUS_MAX_SAVE_SIZE,
+        NULL
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+}
+
+
+/*
+ * pksav/ingest.h
+ */
+
+static void pksav_ingest_h_test() {
+    pksav_error_t status = PKSAV_ERROR_NONE;
+
+    const char* dummy_const_char_ptr = NULL;
+    pksav_ingest_options_t dummy_pksav_ingest_options_t;
+    dummy_pksav_ingest_options_t.ingest_fcn = NULL;
+    size_t dummy_size_t = 0;
+
+    /*
+     * pksav_ingest_files
+     */
+
+    status = pksav_ingest_files(
+        NULL,
+        0,
+        &dummy_pksav_ingest_options_t,
+        &dummy_size_t
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_ingest_files(
+        &dummy_const_char_ptr,
+        0,
+        NULL,
+        &dummy_size_t
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    // No callback
+    status = pksav_ingest_files(
+        &dummy_const_char_ptr,
+        0,
+        &dummy_pksav_ingest_options_t,
+        &dummy_size_t
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+}
+
+
+/*
+ * pksav/journal.h
+ */
+
+static void pksav_journal_h_test() {
+    pksav_error_t status = PKSAV_ERROR_NONE;
+
+    pksav_journal_t dummy_pksav_journal_t;
+    memset(&dummy_pksav_journal_t, 0, sizeof(dummy_pksav_journal_t));
+    pksav_gen1_save_t dummy_pksav_gen1_save_t;
+    pksav_gen2_save_t dummy_pksav_gen2_save_t;
+    pksav_gba_save_t dummy_pksav_gba_save_t;
+    uint8_t dummy_uint8_t = 0;
+    size_t dummy_size_t = 0;
+
+    /*
+     * pksav_journal_init
+     */
+
+    status = pksav_journal_init(
+        NULL,
+        0
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    /*
+     * pksav_journal_add_region
+     */
+
+    status = pksav_journal_add_region(
+        NULL,
+        &dummy_uint8_t,
+        1
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_journal_add_region(
+        &dummy_pksav_journal_t,
+        NULL,
+        1
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    /*
+     * pksav_journal_add_gen1_save
+     */
+
+    status = pksav_journal_add_gen1_save(
+        NULL,
+        &dummy_pksav_gen1_save_t
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_journal_add_gen1_save(
+        &dummy_pksav_journal_t,
+        NULL
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    /*
+     * pksav_journal_add_gen2_save
+     */
+
+    status = pksav_journal_add_gen2_save(
+        NULL,
+        &dummy_pksav_gen2_save_t
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_journal_add_gen2_save(
+        &dummy_pksav_journal_t,
+        NULL
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    /*
+     * pksav_journal_add_gba_save
+     */
+
+    status = pksav_journal_add_gba_save(
+        NULL,
+        &dummy_pksav_gba_save_t
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_journal_add_gba_save(
+        &dummy_pksav_journal_t,
+        NULL
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    /*
+     * pksav_journal_write
+     */
+
+    status = pksav_journal_write(
+        NULL,
+        &dummy_uint8_t,
+        &dummy_uint8_t,
+        1
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_journal_write(
+        &dummy_pksav_journal_t,
+        NULL,
+        &dummy_uint8_t,
+        1
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_journal_write(
+        &dummy_pksav_journal_t,
+        &dummy_uint8_t,
+        NULL,
+        1
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    /*
+     * pksav_journal_checkpoint
+     */
+
+    status = pksav_journal_checkpoint(NULL);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    /*
+     * pksav_journal_undo
+     */
+
+    status = pksav_journal_undo(NULL);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    /*
+     * pksav_journal_redo
+     */
+
+    status = pksav_journal_redo(NULL);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    /*
+     * pksav_journal_get_depth
+     */
+
+    status = pksav_journal_get_depth(
+        NULL,
+        &dummy_size_t,
+        &dummy_size_t
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_journal_get_depth(
+        &dummy_pksav_journal_t,
+        NULL,
+        &dummy_size_t
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_journal_get_depth(
+        &dummy_pksav_journal_t,
+        &dummy_size_t,
+        NULL
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    /*
+     * pksav_journal_get_patch_size
+     */
+
+    status = pksav_journal_get_patch_size(
+        NULL,
+        &dummy_size_t
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_journal_get_patch_size(
+        &dummy_pksav_journal_t,
+        NULL
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    /*
+     * pksav_journal_export_patch
+     */
+
+    status = pksav_journal_export_patch(
+        NULL,
+        &dummy_uint8_t,
+        1
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_journal_export_patch(
+        &dummy_pksav_journal_t,
+        NULL,
+        1
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    /*
+     * pksav_journal_apply_patch
+     */
+
+    status = pksav_journal_apply_patch(
+        NULL,
+        &dummy_uint8_t,
+        1
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_journal_apply_patch(
+        &dummy_pksav_journal_t,
+        NULL,
+        1
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    /*
+     * pksav_journal_free
+     */
+
+    status = pksav_journal_free(NULL);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+}
+
+
+/*
+ * pksav/store.h
+ */
+
+static void pksav_store_h_test() {
+    pksav_error_t status = PKSAV_ERROR_NONE;
+
+    pksav_store_t dummy_pksav_store_t;
+    memset(&dummy_pksav_store_t, 0, sizeof(dummy_pksav_store_t));
+    uint32_t dummy_uint32_t = 0;
+    pksav_store_manifest_t dummy_pksav_store_manifest_t;
+    dummy_pksav_store_manifest_t.save_len = 1;
+    dummy_pksav_store_manifest_t.num_chunks = 1;
+    dummy_pksav_store_manifest_t.chunk_ids = &dummy_uint32_t;
+    uint8_t dummy_uint8_t = 0;
+    const uint8_t* dummy_const_uint8_t_ptr = NULL;
+    size_t dummy_size_t = 0;
+    uint64_t dummy_uint64_t = 0;
+
+    /*
+     * pksav_store_init
+     */
+
+    status = pksav_store_init(NULL);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    /*
+     * pksav_store_add_save
+     */
+
+    status = pksav_store_add_save(
+        NULL,
+        &dummy_uint8_t,
+        1,
+        &dummy_pksav_store_manifest_t
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_store_add_save(
+        &dummy_pksav_store_t,
+        NULL,
+        1,
+        &dummy_pksav_store_manifest_t
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_store_add_save(
+        &dummy_pksav_store_t,
+        &dummy_uint8_t,
+        1,
+        NULL
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    /*
+     * pksav_store_rebuild_save
+     */
+
+    status = pksav_store_rebuild_save(
+        NULL,
+        &dummy_pksav_store_manifest_t,
+        &dummy_uint8_t,
+        1
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_store_rebuild_save(
+        &dummy_pksav_store_t,
+        NULL,
+        &dummy_uint8_t,
+        1
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_store_rebuild_save(
+        &dummy_pksav_store_t,
+        &dummy_pksav_store_manifest_t,
+        NULL,
+        1
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    /*
+     * pksav_store_get_chunk
+     */
+
+    status = pksav_store_get_chunk(
+        NULL,
+        0,
+        &dummy_const_uint8_t_ptr,
+        &dummy_size_t,
+        &dummy_uint64_t
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_store_get_chunk(
+        &dummy_pksav_store_t,
+        0,
+        NULL,
+        &dummy_size_t,
+        &dummy_uint64_t
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_store_get_chunk(
+        &dummy_pksav_store_t,
+        0,
+        &dummy_const_uint8_t_ptr,
+        NULL,
+        &dummy_uint64_t
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_store_get_chunk(
+        &dummy_pksav_store_t,
+        0,
+        &dummy_const_uint8_t_ptr,
+        &dummy_size_t,
+        NULL
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    /*
+     * pksav_store_get_stats
+     */
+
+    status = pksav_store_get_stats(
+        NULL,
+        &dummy_size_t,
+        &dummy_size_t
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_store_get_stats(
+        &dummy_pksav_store_t,
+        NULL,
+        &dummy_size_t
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_store_get_stats(
+        &dummy_pksav_store_t,
+        &dummy_size_t,
+        NULL
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    /*
+     * pksav_store_manifest_free
+     */
+
+    status = pksav_store_manifest_free(NULL);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    /*
+     * pksav_store_free
+     */
+
+    status = pksav_store_free(NULL);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+}
+
+
+/*
+ * pksav/common/base_stats.h
+ */
+static void pksav_common_base_stats_h_test() {
+    pksav_error_t status = PKSAV_ERROR_NONE;
+
+    uint8_t dummy_uint8_t_array[6] = {0};
+    uint16_t dummy_uint16_t_array[5] = {0};
+    pksav_battle_stat_t dummy_pksav_battle_stat_t = PKSAV_STAT_NONE;
+    pksav_base_stats_t dummy_pksav_base_stats_t;
+    pksav_battle_stats_t dummy_pksav_battle_stats_t;
+
+    /*
+     * pksav_get_base_stats
+     */
+
+    status = pksav_get_base_stats(
+        1,
+        NULL
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    /*
+     * pksav_get_gen1_base_stats
+     */
+
+    status = pksav_get_gen1_base_stats(
+        1,
+        NULL
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    /*
+     * pksav_gen1_species_to_pokedex_num
+     */
+
+    status = pksav_gen1_species_to_pokedex_num(
+        1,
+        NULL
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    /*
+     * pksav_gba_species_to_pokedex_num
+     */
+
+    status = pksav_gba_species_to_pokedex_num(
+        1,
+        NULL
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    /*
+     * pksav_get_nature_stat_modifiers
+     */
+
+    status = pksav_get_nature_stat_modifiers(
+        PKSAV_NATURE_HARDY,
+        NULL,
+        &dummy_pksav_battle_stat_t
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_get_nature_stat_modifiers(
+        PKSAV_NATURE_HARDY,
+        &dummy_pksav_battle_stat_t,
+        NULL
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    /*
+     * pksav_calc_gb_stats
+     */
+
+    status = pksav_calc_gb_stats(
+        NULL,
+        1,
+        0,
+        dummy_uint16_t_array,
+        &dummy_pksav_battle_stats_t
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_calc_gb_stats(
+        &dummy_pksav_base_stats_t,
+        1,
+        0,
+        NULL,
+        &dummy_pksav_battle_stats_t
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_calc_gb_stats(
+        &dummy_pksav_base_stats_t,
+        1,
+        0,
+        dummy_uint16_t_array,
+        NULL
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    /*
+     * pksav_calc_stats
+     */
+
+    status = pksav_calc_stats(
+        NULL,
+        1,
+        0,
+        dummy_uint8_t_array,
+        PKSAV_NATURE_HARDY,
+        &dummy_pksav_battle_stats_t
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_calc_stats(
+        &dummy_pksav_base_stats_t,
+        1,
+        0,
+        NULL,
+        PKSAV_NATURE_HARDY,
+        &dummy_pksav_battle_stats_t
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_calc_stats(
+        &dummy_pksav_base_stats_t,
+        1,
+        0,
+        dummy_uint8_t_array,
+        PKSAV_NATURE_HARDY,
+        NULL
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+}
+
+
+/*
+ * pksav/common/columnar.h
+ */
+static void pksav_common_columnar_h_test() {
+    pksav_error_t status = PKSAV_ERROR_NONE;
+
+    pksav_columnar_writer_t columnar_writer;
+    pksav_pokemon_record_t record;
+
+    /*
+     * pksav_columnar_writer_open
+     */
+
+    status = pksav_columnar_writer_open(
+        NULL,
+        0,
+        &columnar_writer
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_columnar_writer_open(
+        "columnar.bin",
+        0,
+        NULL
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    /*
+     * pksav_columnar_writer_append
+     */
+
+    status = pksav_columnar_writer_append(
+        NULL,
+        &record,
+        1,
+        0,
+        PKSAV_COLUMNAR_LOCATION_PARTY
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_columnar_writer_append(
+        &columnar_writer,
+        NULL,
+        1,
+        0,
+        PKSAV_COLUMNAR_LOCATION_PARTY
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    /*
+     * pksav_columnar_writer_flush
+     */
+
+    status = pksav_columnar_writer_flush(
+        NULL
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    /*
+     * pksav_columnar_writer_close
+     */
+
+    status = pksav_columnar_writer_close(
+        NULL
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+}
+
+
+/*
+ * pksav/common/datetime.h
+ */
+static void pksav_common_datetime_h_test() {
+    pksav_error_t status = PKSAV_ERROR_NONE;
+
+    time_t dummy_time_t = 0;
+    pksav_date_t dummy_pksav_date_t;
+    uint32_t dummy_uint32_t = 0;
+
+    /*
+     * pksav_time_t_to_date_t
+     */
+
+    status = pksav_time_t_to_date_t(
+        NULL,
+        &dummy_pksav_date_t
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_time_t_to_date_t(
+        &dummy_time_t,
+        NULL
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_time_t_to_date_t(
+        NULL,
+        NULL
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    /*
+     * pksav_time_to_uint32_t
+     */
+
+    status = pksav_time_t_to_uint32_t(
+        NULL,
+        &dummy_uint32_t
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_time_t_to_uint32_t(
+        &dummy_time_t,
+        NULL
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_time_t_to_uint32_t(
+        NULL,
+        NULL
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+}
+
+/*
+ * pksav/common/lcrng.h
+ */
+static void pksav_common_lcrng_h_test() {
+    pksav_error_t status = PKSAV_ERROR_NONE;
+
+    pksav_lcrng32_spread_t dummy_pksav_lcrng32_spread_t = {0, 0};
+    uint32_t dummy_uint32_t = 0;
+    size_t dummy_size_t = 0;
+
+    /*
+     * pksav_lcrng32_advance
+     */
+
+    status = pksav_lcrng32_advance(
+        0,
+        1,
+        NULL
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    /*
+     * pksav_lcrng32_reverse
+     */
+
+    status = pksav_lcrng32_reverse(
+        0,
+        1,
+        NULL
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    /*
+     * pksav_lcrng32_generate
+     */
+
+    status = pksav_lcrng32_generate(
+        0,
+        PKSAV_LCRNG32_METHOD_1,
+        NULL
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    /*
+     * pksav_lcrng32_find_seeds
+     */
+
+    status = pksav_lcrng32_find_seeds(
+        NULL,
+        PKSAV_LCRNG32_METHOD_1,
+        1,
+        &dummy_uint32_t,
+        1,
+        &dummy_size_t
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_lcrng32_find_seeds(
+        &dummy_pksav_lcrng32_spread_t,
+        PKSAV_LCRNG32_METHOD_1,
+        1,
+        NULL,
+        1,
+        &dummy_size_t
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_lcrng32_find_seeds(
+        &dummy_pksav_lcrng32_spread_t,
+        PKSAV_LCRNG32_METHOD_1,
+        1,
+        &dummy_uint32_t,
+        1,
+        NULL
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+}
+
+/*
+ * pksav/common/nds_crypt.h
+ */
+static void pksav_common_nds_crypt_h_test() {
+    pksav_error_t status = PKSAV_ERROR_NONE;
+
+    uint16_t dummy_uint16_t = 0;
+    pksav_nds_pc_pokemon_t dummy_pksav_nds_pc_pokemon_t;
+
+    /*
+     * pksav_nds_get_pokemon_checksum
+     */
+
+    status = pksav_nds_get_pokemon_checksum(
+        NULL,
+        &dummy_uint16_t
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_nds_get_pokemon_checksum(
+        &dummy_pksav_nds_pc_pokemon_t,
+        NULL
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    /*
+     * pksav_nds_decrypt_pc_pokemon
+     */
+
+    status = pksav_nds_decrypt_pc_pokemon(
+        NULL,
+        1
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    /*
+     * pksav_nds_encrypt_pc_pokemon
+     */
+
+    status = pksav_nds_encrypt_pc_pokemon(
+        NULL,
+        1
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    /*
+     * pksav_nds_decrypt_party_pokemon
+     */
+
+    status = pksav_nds_decrypt_party_pokemon(
+        NULL,
+        1
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    /*
+     * pksav_nds_encrypt_party_pokemon
+     */
+
+    status = pksav_nds_encrypt_party_pokemon(
+        NULL,
+        1
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+}
+
+
+/*
+ * pksav/common/pokedex.h
+ */
+static void pksav_common_pokedex_h_test() {
+    pksav_error_t status = PKSAV_ERROR_NONE;
+
+    uint8_t dummy_uint8_t = 0;
+    uint16_t dummy_uint16_t = 0;
+    bool dummy_bool = false;
+
+    /*
+     * pksav_get_pokedex_bit
+     */
+
+    status = pksav_get_pokedex_bit(
+        NULL,
+        0,
+        &dummy_bool
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_get_pokedex_bit(
+        &dummy_uint8_t,
+        0,
+        NULL
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_get_pokedex_bit(
+        NULL,
+        0,
+        NULL
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    /*
+     * pksav_set_pokedex_bit
+     */
+
+    status = pksav_set_pokedex_bit(
+        NULL,
+        0,
+        false
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    /*
+     * pksav_count_pokedex_bits
+     */
+
+    status = pksav_count_pokedex_bits(
+        NULL,
+        0,
+        &dummy_uint16_t
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_count_pokedex_bits(
+        &dummy_uint8_t,
+        0,
+        NULL
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    /*
+     * pksav_set_pokedex_bit_range
+     */
+
+    status = pksav_set_pokedex_bit_range(
+        NULL,
+        1,
+        1,
+        false
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    /*
+     * pksav_get_next_pokedex_bit
+     */
+
+    status = pksav_get_next_pokedex_bit(
+        NULL,
+        0,
+        0,
+        &dummy_uint16_t
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_get_next_pokedex_bit(
+        &dummy_uint8_t,
+        0,
+        0,
+        NULL
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    /*
+     * pksav_union_pokedex_bits
+     * pksav_intersect_pokedex_bits
+     * pksav_subtract_pokedex_bits
+     */
+
+    pksav_error_t (*set_operations[])(const uint8_t*, const uint8_t*, uint16_t, uint8_t*) = {
+        pksav_union_pokedex_bits,
+        pksav_intersect_pokedex_bits,
+        pksav_subtract_pokedex_bits
+    };
+    for(size_t i = 0; i < 3; ++i) {
+        status = set_operations[i](NULL, &dummy_uint8_t, 0, &dummy_uint8_t);
+        TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+        status = set_operations[i](&dummy_uint8_t, NULL, 0, &dummy_uint8_t);
+        TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+        status = set_operations[i](&dummy_uint8_t, &dummy_uint8_t, 0, NULL);
+        TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+    }
+}
+
+/*
+ * pksav/common/pokerus.h
+ */
+static void pksav_common_pokerus_h_test()
+{
+    pksav_error_t status = PKSAV_ERROR_NONE;
+    uint8_t dummy_uint8_t = 0;
+    pksav_pokerus_strain_t dummy_strain = PKSAV_POKERUS_STRAIN_A;
+
+    /*
+     * pksav_pokerus_get_strain
+     */
+
+    status = pksav_pokerus_get_strain(
+                 NULL, // pokerus_ptr
+                 &dummy_strain
+             );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_pokerus_get_strain(
+                 &dummy_uint8_t,
+                 NULL // strain_out
+             );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    /*
+     * pksav_pokerus_set_strain
+     */
+
+    status = pksav_pokerus_set_strain(
+                 NULL, // pokerus_ptr
+                 dummy_strain
+             );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    /*
+     * pksav_pokerus_get_duration
+     */
+
+    status = pksav_pokerus_get_duration(
+                 NULL, // pokerus_ptr
+                 &dummy_uint8_t
+             );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_pokerus_get_duration(
+                 &dummy_uint8_t,
+                 NULL // duration_out
+             );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    /*
+     * pksav_pokerus_set_duration
+     */
+
+    status = pksav_pokerus_set_duration(
+                  NULL, // pokerus_ptr
+                  dummy_uint8_t
+             );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+}
+
+/*
+ * pksav/common/prng.h
+ *
+ * TODO: arng, lcrng functions when gen4 update merged
+ */
+static void pksav_common_prng_h_test() {
+    pksav_error_t status = PKSAV_ERROR_NONE;
+
+    pksav_mtrng_t dummy_pksav_mtrng_t;
+    uint32_t dummy_uint32_t = 0;
+
+    /*
+     * pksav_mtrng_populate
+     */
+
+    status = pksav_mtrng_populate(
+        NULL
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    /*
+     * pksav_mtrng_next
+     */
+
+    status = pksav_mtrng_next(
+        NULL,
+        &dummy_uint32_t
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_mtrng_next(
+        &dummy_pksav_mtrng_t,
+        NULL
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_mtrng_next(
+        NULL,
+        NULL
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    /*
+     * pksav_mtrng_seed
+     */
+
+    status = pksav_mtrng_seed(
+        NULL,
+        0
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    /*
+     * pksav_mtrng_fill
+     */
+
+    status = pksav_mtrng_fill(
+        NULL,
+        &dummy_uint32_t,
+        1
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_mtrng_fill(
+        &dummy_pksav_mtrng_t,
+        NULL,
+        1
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    /*
+     * pksav_mtrng_jump
+     */
+
+    status = pksav_mtrng_jump(
+        NULL,
+        1
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    /*
+     * pksav_mtrng_split
+     */
+
+    status = pksav_mtrng_split(
+        NULL,
+        1,
+        &dummy_pksav_mtrng_t
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_mtrng_split(
+        &dummy_pksav_mtrng_t,
+        1,
+        NULL
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+}
+
+/*
+ * pksav/common/stats.h
+ */
+static void pksav_common_stats_h_test() {
+    pksav_error_t status = PKSAV_ERROR_NONE;
+
+    uint8_t dummy_uint8_t = 0;
+    uint16_t dummy_uint16_t = 0;
+    uint32_t dummy_uint32_t = 0;
+    pksav_stat_columns_t dummy_pksav_stat_columns_t = {NULL, NULL, NULL, NULL, NULL, NULL};
+    pksav_gb_EV_columns_t dummy_pksav_gb_EV_columns_t = {NULL, NULL, NULL, NULL, NULL};
+
+    /*
+     * pksav_get_gb_IV
+     */
+
+    status = pksav_get_gb_IV(
+        NULL,
+        PKSAV_STAT_NONE,
+        &dummy_uint8_t
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_get_gb_IV(
+        &dummy_uint16_t,
+        PKSAV_STAT_NONE,
+        NULL
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_get_gb_IV(
+        NULL,
+        PKSAV_STAT_NONE,
+        NULL
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    /*
+     * pksav_set_gb_IV
+     */
+
+    status = pksav_set_gb_IV(
+        NULL,
+        PKSAV_STAT_NONE,
+        0
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    /*
+     * pksav_get_IV
+     */
+
+    status = pksav_get_IV(
+        NULL,
+        PKSAV_STAT_NONE,
+        &dummy_uint8_t
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_get_IV(
+        &dummy_uint32_t,
+        PKSAV_STAT_NONE,
+        NULL
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_get_IV(
+        NULL,
+        PKSAV_STAT_NONE,
+        NULL
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    /*
+     * pksav_get_gb_IVs_bulk
+     */
+
+    status = pksav_get_gb_IVs_bulk(
+        NULL,
+        0,
+        1,
+        &dummy_pksav_stat_columns_t
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_get_gb_IVs_bulk(
+        &dummy_uint32_t,
+        0,
+        1,
+        NULL
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    /*
+     * pksav_get_IVs_bulk
+     */
+
+    status = pksav_get_IVs_bulk(
+        NULL,
+        0,
+        1,
+        &dummy_pksav_stat_columns_t
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_get_IVs_bulk(
+        &dummy_uint32_t,
+        0,
+        1,
+        NULL
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    /*
+     * pksav_get_gb_EVs_bulk
+     */
+
+    status = pksav_get_gb_EVs_bulk(
+        NULL,
+        0,
+        1,
+        &dummy_pksav_gb_EV_columns_t
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_get_gb_EVs_bulk(
+        &dummy_uint32_t,
+        0,
+        1,
+        NULL
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    /*
+     * pksav_get_EVs_bulk
+     */
+
+    status = pksav_get_EVs_bulk(
+        NULL,
+        0,
+        1,
+        &dummy_pksav_stat_columns_t
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_get_EVs_bulk(
+        &dummy_uint32_t,
+        0,
+        1,
+        NULL
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+}
+
+/*
+ * pksav/gen1/pokemon_record.h
+ */
+static void pksav_gen1_pokemon_record_h_test() {
+    pksav_error_t status = PKSAV_ERROR_NONE;
+
+    pksav_gen1_pokemon_box_t dummy_pksav_gen1_pokemon_box_t;
+    pksav_gen1_pokemon_party_t dummy_pksav_gen1_pokemon_party_t;
+    pksav_pokemon_record_t dummy_pksav_pokemon_record_t;
+    size_t dummy_size_t = 0;
+
+    /*
+     * pksav_gen1_box_to_records
+     */
+
+    status = pksav_gen1_box_to_records(
+        NULL,
+        &dummy_pksav_pokemon_record_t,
+        &dummy_size_t
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_gen1_box_to_records(
+        &dummy_pksav_gen1_pokemon_box_t,
+        NULL,
+        &dummy_size_t
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_gen1_box_to_records(
+        &dummy_pksav_gen1_pokemon_box_t,
+        &dummy_pksav_pokemon_record_t,
+        NULL
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    /*
+     * pksav_gen1_party_to_records
+     */
+
+    status = pksav_gen1_party_to_records(
+        NULL,
+        &dummy_pksav_pokemon_record_t,
+        &dummy_size_t
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_gen1_party_to_records(
+        &dummy_pksav_gen1_pokemon_party_t,
+        NULL,
+        &dummy_size_t
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_gen1_party_to_records(
+        &dummy_pksav_gen1_pokemon_party_t,
+        &dummy_pksav_pokemon_record_t,
+        NULL
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+}
+
+
+/*
+ * pksav/gen1/save.h
+ */
+static void pksav_gen1_save_h_test() {
+    pksav_error_t status = PKSAV_ERROR_NONE;
+
+    uint8_t dummy_uint8_t = 0;
+    bool dummy_bool = false;
+    char dummy_char = 0;
+    pksav_gen1_save_t dummy_pksav_gen1_save_t;
+    dummy_pksav_gen1_save_t.raw = NULL;
+
+    /*
+     * pksav_buffer_is_gen1_save
+     */
+
+    status = pksav_buffer_is_gen1_save(
+        NULL,
+        0,
+        &dummy_bool
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_buffer_is_gen1_save(
+        &dummy_uint8_t,
+        0,
+        NULL
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_buffer_is_gen1_save(
+        NULL,
+        0,
+        NULL
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    /*
+     * pksav_file_is_gen1_save
+     */
+
+    status = pksav_file_is_gen1_save(
+        NULL,
+        &dummy_bool
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_file_is_gen1_save(
+        &dummy_char,
+        NULL
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_file_is_gen1_save(
+        NULL,
+        NULL
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    /*
+     * pksav_gen1_save_load
+     */
+
+    status = pksav_gen1_save_load(
+        NULL,
+        &dummy_pksav_gen1_save_t
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_gen1_save_load(
+        &dummy_char,
+        NULL
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_gen1_save_load(
+        NULL,
+        NULL
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    /*
+     * pksav_gen1_save_load_buffer
+     */
+
+    status = pksav_gen1_save_load_buffer(
+        NULL,
+        0,
+        &dummy_pksav_gen1_save_t
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_gen1_save_load_buffer(
+        &dummy_uint8_t,
+        0,
+        NULL
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_gen1_save_load_buffer(
+        NULL,
+        0,
+        NULL
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    /*
+     * pksav_gen1_save_save
+     */
+
+    status = pksav_gen1_save_save(
+        NULL,
+        &dummy_pksav_gen1_save_t
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_gen1_save_save(
+        &dummy_char,
+        NULL
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_gen1_save_save(
+        NULL,
+        NULL
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    /*
+     * pksav_gen1_save_save_buffer
+     */
+
+    status = pksav_gen1_save_save_buffer(
+        NULL,
+        0,
+        &dummy_pksav_gen1_save_t
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_gen1_save_save_buffer(
+        &dummy_uint8_t,
+        0,
+        NULL
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_gen1_save_save_buffer(
+        NULL,
+        0,
+        NULL
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    /*
+     * pksav_gen1_save_clone
+     */
+
+    status = pksav_gen1_save_clone(
+        NULL,
+        &dummy_pksav_gen1_save_t
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_gen1_save_clone(
+        &dummy_pksav_gen1_save_t,
+        NULL
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_gen1_save_clone(
+        NULL,
+        NULL
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    /*
+     * pksav_gen1_save_restore
+     */
+
+    status = pksav_gen1_save_restore(
+        NULL,
+        &dummy_pksav_gen1_save_t
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_gen1_save_restore(
+        &dummy_pksav_gen1_save_t,
+        NULL
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_gen1_save_restore(
+        NULL,
+        NULL
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    /*
+     * pksav_gen1_save_free
+     */
+
+    status = pksav_gen1_save_free(
+        NULL
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_gen1_save_free(
+        &dummy_pksav_gen1_save_t
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+}
+
+/*
+ * pksav/gen1/stats.h
+ */
+static void pksav_gen1_stats_h_test() {
+    pksav_error_t status = PKSAV_ERROR_NONE;
+
+    uint8_t dummy_uint8_t = 0;
+    pksav_gen1_pc_pokemon_t dummy_pksav_gen1_pc_pokemon_t;
+    pksav_gen1_pokemon_party_t dummy_pksav_gen1_pokemon_party_t;
+    pksav_gen1_pokemon_box_t dummy_pksav_gen1_pokemon_box_t;
+    pksav_battle_stats_t dummy_pksav_battle_stats_t;
+
+    /*
+     * pksav_gen1_pokemon_calc_stats
+     */
+
+    status = pksav_gen1_pokemon_calc_stats(
+        NULL,
+        &dummy_pksav_battle_stats_t
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_gen1_pokemon_calc_stats(
+        &dummy_pksav_gen1_pc_pokemon_t,
+        NULL
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    /*
+     * pksav_gen1_party_update_stats
+     */
+
+    status = pksav_gen1_party_update_stats(
+        NULL
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    /*
+     * pksav_gen1_party_verify_stats
+     */
+
+    status = pksav_gen1_party_verify_stats(
+        NULL,
+        &dummy_uint8_t
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_gen1_party_verify_stats(
+        &dummy_pksav_gen1_pokemon_party_t,
+        NULL
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    /*
+     * pksav_gen1_box_calc_stats
+     */
+
+    status = pksav_gen1_box_calc_stats(
+        NULL,
+        &dummy_pksav_battle_stats_t
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_gen1_box_calc_stats(
+        &dummy_pksav_gen1_pokemon_box_t,
+        NULL
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+}
+
+
+/*
+ * pksav/gen1/text.h
+ */
+static void pksav_gen1_text_h_test() {
+    pksav_error_t status = PKSAV_ERROR_NONE;
+
+    uint8_t dummy_uint8_t = 0;
+    char dummy_char = 0;
+
+    /*
+     * pksav_text_from_gen1
+     */
+
+    status = pksav_text_from_gen1(
+        NULL,
+        &dummy_char,
+        0
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_text_from_gen1(
+        &dummy_uint8_t,
+        NULL,
+        0
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_text_from_gen1(
+        NULL,
+        NULL,
+        0
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    /*
+     * pksav_text_from_gen1_utf8
+     */
+
+    status = pksav_text_from_gen1_utf8(
+        NULL,
+        0,
+        &dummy_char,
+        0,
+        NULL
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_text_from_gen1_utf8(
+        &dummy_uint8_t,
+        0,
+        NULL,
+        0,
+        NULL
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    /*
+     * pksav_text_to_gen1
+     */
+
+    status = pksav_text_to_gen1(
+        NULL,
+        &dummy_uint8_t,
+        0
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_text_to_gen1(
+        &dummy_char,
+        NULL,
+        0
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_text_to_gen1(
+        NULL,
+        NULL,
+        0
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+}
+
+/*
+ * pksav/gen2/pokemon_record.h
+ */
+static void pksav_gen2_pokemon_record_h_test() {
+    pksav_error_t status = PKSAV_ERROR_NONE;
+
+    pksav_gen2_pokemon_box_t dummy_pksav_gen2_pokemon_box_t;
+    pksav_gen2_pokemon_party_t dummy_pksav_gen2_pokemon_party_t;
+    pksav_pokemon_record_t dummy_pksav_pokemon_record_t;
+    size_t dummy_size_t = 0;
+
+    /*
+     * pksav_gen2_box_to_records
+     */
+
+    status = pksav_gen2_box_to_records(
+        NULL,
+        &dummy_pksav_pokemon_record_t,
+        &dummy_size_t
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_gen2_box_to_records(
+        &dummy_pksav_gen2_pokemon_box_t,
+        NULL,
+        &dummy_size_t
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_gen2_box_to_records(
+        &dummy_pksav_gen2_pokemon_box_t,
+        &dummy_pksav_pokemon_record_t,
+        NULL
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    /*
+     * pksav_gen2_party_to_records
+     */
+
+    status = pksav_gen2_party_to_records(
+        NULL,
+        &dummy_pksav_pokemon_record_t,
+        &dummy_size_t
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_gen2_party_to_records(
+        &dummy_pksav_gen2_pokemon_party_t,
+        NULL,
+        &dummy_size_t
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_gen2_party_to_records(
+        &dummy_pksav_gen2_pokemon_party_t,
+        &dummy_pksav_pokemon_record_t,
+        NULL
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+}
+
+
+/*
+ * pksav/gen2/save.h
+ */
+static void pksav_gen2_save_h_test() {
+    pksav_error_t status = PKSAV_ERROR_NONE;
+
+    uint8_t dummy_uint8_t = 0;
+    bool dummy_bool = false;
+    char dummy_char = 0;
+    pksav_gen2_save_t dummy_pksav_gen2_save_t;
+    dummy_pksav_gen2_save_t.raw = NULL;
+
+    /*
+     * pksav_buffer_is_gen2_save
+     */
+
+    status = pksav_buffer_is_gen2_save(
+        NULL,
+        0,
+        false,
+        &dummy_bool
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_buffer_is_gen2_save(
+        &dummy_uint8_t,
+        0,
+        false,
+        NULL
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_buffer_is_gen2_save(
+        NULL,
+        0,
+        false,
+        NULL
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    /*
+     * pksav_file_is_gen2_save
+     */
+
+    status = pksav_file_is_gen2_save(
+        NULL,
+        false,
+        &dummy_bool
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_file_is_gen2_save(
+        &dummy_char,
+        false,
+        NULL
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_file_is_gen2_save(
+        NULL,
+        false,
+        NULL
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    /*
+     * pksav_gen2_save_load
+     */
+
+    status = pksav_gen2_save_load(
+        NULL,
+        &dummy_pksav_gen2_save_t
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_gen2_save_load(
+        &dummy_char,
+        NULL
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_gen2_save_load(
+        NULL,
+        NULL
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    /*
+     * pksav_gen2_save_load_buffer
+     */
+
+    status = pksav_gen2_save_load_buffer(
+        NULL,
+        0,
+        &dummy_pksav_gen2_save_t
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_gen2_save_load_buffer(
+        &dummy_uint8_t,
+        0,
+        NULL
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_gen2_save_load_buffer(
+        NULL,
+        0,
+        NULL
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    /*
+     * pksav_gen2_save_save
+     */
+
+    status = pksav_gen2_save_save(
+        NULL,
+        &dummy_pksav_gen2_save_t
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_gen2_save_save(
+        &dummy_char,
+        NULL
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_gen2_save_save(
+        NULL,
+        NULL
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    /*
+     * pksav_gen2_save_save_buffer
+     */
+
+    status = pksav_gen2_save_save_buffer(
+        NULL,
+        0,
+        &dummy_pksav_gen2_save_t
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_gen2_save_save_buffer(
+        &dummy_uint8_t,
+        0,
+        NULL
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_gen2_save_save_buffer(
+        NULL,
+        0,
+        NULL
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    /*
+     * pksav_gen2_save_clone
+     */
+
+    status = pksav_gen2_save_clone(
+        NULL,
+        &dummy_pksav_gen2_save_t
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_gen2_save_clone(
+        &dummy_pksav_gen2_save_t,
+        NULL
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_gen2_save_clone(
+        NULL,
+        NULL
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    /*
+     * pksav_gen2_save_restore
+     */
+
+    status = pksav_gen2_save_restore(
+        NULL,
+        &dummy_pksav_gen2_save_t
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_gen2_save_restore(
+        &dummy_pksav_gen2_save_t,
+        NULL
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_gen2_save_restore(
+        NULL,
+        NULL
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    /*
+     * pksav_gen2_save_free
+     */
+
+    status = pksav_gen2_save_free(
+        NULL
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_gen2_save_free(
+        &dummy_pksav_gen2_save_t
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+}
+
+/*
+ * pksav/gen2/stats.h
+ */
+static void pksav_gen2_stats_h_test() {
+    pksav_error_t status = PKSAV_ERROR_NONE;
+
+    uint8_t dummy_uint8_t = 0;
+    pksav_gen2_pc_pokemon_t dummy_pksav_gen2_pc_pokemon_t;
+    pksav_gen2_pokemon_party_t dummy_pksav_gen2_pokemon_party_t;
+    pksav_gen2_pokemon_box_t dummy_pksav_gen2_pokemon_box_t;
+    pksav_battle_stats_t dummy_pksav_battle_stats_t;
+
+    /*
+     * pksav_gen2_pokemon_calc_stats
+     */
+
+    status = pksav_gen2_pokemon_calc_stats(
+        NULL,
+        &dummy_pksav_battle_stats_t
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_gen2_pokemon_calc_stats(
+        &dummy_pksav_gen2_pc_pokemon_t,
+        NULL
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    /*
+     * pksav_gen2_party_update_stats
+     */
+
+    status = pksav_gen2_party_update_stats(
+        NULL
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    /*
+     * pksav_gen2_party_verify_stats
+     */
+
+    status = pksav_gen2_party_verify_stats(
+        NULL,
+        &dummy_uint8_t
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_gen2_party_verify_stats(
+        &dummy_pksav_gen2_pokemon_party_t,
+        NULL
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    /*
+     * pksav_gen2_box_calc_stats
+     */
+
+    status = pksav_gen2_box_calc_stats(
+        NULL,
+        &dummy_pksav_battle_stats_t
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_gen2_box_calc_stats(
+        &dummy_pksav_gen2_pokemon_box_t,
+        NULL
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+}
+
+
+/*
+ * pksav/gen2/text.h
+ */
+static void pksav_gen2_text_h_test() {
+    pksav_error_t status = PKSAV_ERROR_NONE;
+
+    uint8_t dummy_uint8_t = 0;
+    char dummy_char = 0;
+
+    /*
+     * pksav_text_from_gen2
+     */
+
+    status = pksav_text_from_gen2(
+        NULL,
+        &dummy_char,
+        0
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_text_from_gen2(
+        &dummy_uint8_t,
+        NULL,
+        0
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_text_from_gen2(
+        NULL,
+        NULL,
+        0
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    /*
+     * pksav_text_from_gen2_utf8
+     */
+
+    status = pksav_text_from_gen2_utf8(
+        NULL,
+        0,
+        &dummy_char,
+        0,
+        NULL
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_text_from_gen2_utf8(
+        &dummy_uint8_t,
+        0,
+        NULL,
+        0,
+        NULL
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    /*
+     * pksav_text_to_gen2
+     */
+
+    status = pksav_text_to_gen2(
+        NULL,
+        &dummy_uint8_t,
+        0
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_text_to_gen2(
+        &dummy_char,
+        NULL,
+        0
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_text_to_gen2(
+        NULL,
+        NULL,
+        0
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+}
+
+/*
+ * pksav/gen2/time.h
+ */
+static void pksav_gen2_time_h_test() {
+    pksav_error_t status = PKSAV_ERROR_NONE;
+
+    time_t dummy_time_t = 0;
+    uint16_t dummy_uint16_t = 0;
+
+    /*
+     * pksav_gen2_set_caught_data_time_field
+     */
+
+    status = pksav_gen2_set_caught_data_time_field(
+        NULL,
+        &dummy_uint16_t
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_gen2_set_caught_data_time_field(
+        &dummy_time_t,
+        NULL
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_gen2_set_caught_data_time_field(
+        NULL,
+        NULL
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+}
+
+/*
+ * pksav/gba/patch.h
+ */
+static void pksav_gba_patch_h_test() {
+    pksav_error_t status = PKSAV_ERROR_NONE;
+
+    uint8_t dummy_uint8_t = 0;
+    size_t dummy_size_t = 0;
+    pksav_gba_save_t dummy_pksav_gba_save_t;
+
+    /*
+     * pksav_gba_save_get_patch_size
+     */
+
+    status = pksav_gba_save_get_patch_size(
+        NULL,
+        &dummy_pksav_gba_save_t,
+        &dummy_size_t
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_gba_save_get_patch_size(
+        &dummy_pksav_gba_save_t,
+        NULL,
+        &dummy_size_t
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_gba_save_get_patch_size(
+        &dummy_pksav_gba_save_t,
+        &dummy_pksav_gba_save_t,
+        NULL
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    /*
+     * pksav_gba_save_make_patch
+     */
+
+    status = pksav_gba_save_make_patch(
+        NULL,
+        &dummy_pksav_gba_save_t,
+        &dummy_uint8_t,
+        1,
+        &dummy_size_t
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_gba_save_make_patch(
+        &dummy_pksav_gba_save_t,
+        NULL,
+        &dummy_uint8_t,
+        1,
+        &dummy_size_t
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_gba_save_make_patch(
+        &dummy_pksav_gba_save_t,
+        &dummy_pksav_gba_save_t,
+        NULL,
+        1,
+        &dummy_size_t
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_gba_save_make_patch(
+        &dummy_pksav_gba_save_t,
+        &dummy_pksav_gba_save_t,
+        &dummy_uint8_t,
+        1,
+        NULL
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    /*
+     * pksav_gba_save_apply_patch
+     */
+
+    status = pksav_gba_save_apply_patch(
+        NULL,
+        &dummy_uint8_t,
+        1
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_gba_save_apply_patch(
+        &dummy_pksav_gba_save_t,
+        NULL,
+        1
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+}
+
 /*
- * pksav/common/datetime.h
+ * pksav/gba/pokedex.h
  */
-static void pksav_common_datetime_h_test() {
+static void pksav_gba_pokedex_h_test() {
     pksav_error_t status = PKSAV_ERROR_NONE;
 
-    time_t dummy_time_t = 0;
-    pksav_date_t dummy_pksav_date_t;
-    uint32_t dummy_uint32_t = 0;
+    bool dummy_bool = false;
+    uint16_t dummy_uint16_t = 0;
+    pksav_gba_save_t dummy_pksav_gba_save_t;
 
     /*
-     * pksav_time_t_to_date_t
+     * pksav_gba_save_set_pokedex_seen
      */
 
-    status = pksav_time_t_to_date_t(
+    status = pksav_gba_save_set_pokedex_seen(
         NULL,
-        &dummy_pksav_date_t
+        1,
+        true
     );
     TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
 
-    status = pksav_time_t_to_date_t(
-        &dummy_time_t,
+    /*
+     * pksav_gba_save_set_pokedex_seen_range
+     */
+
+    status = pksav_gba_save_set_pokedex_seen_range(
+        NULL,
+        1,
+        2,
+        true
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    /*
+     * pksav_gba_save_sync_pokedex_seen
+     */
+
+    status = pksav_gba_save_sync_pokedex_seen(
         NULL
     );
     TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
 
-    status = pksav_time_t_to_date_t(
+    /*
+     * pksav_gba_save_get_nat_pokedex_unlocked
+     */
+
+    status = pksav_gba_save_get_nat_pokedex_unlocked(
         NULL,
+        &dummy_bool
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_gba_save_get_nat_pokedex_unlocked(
+        &dummy_pksav_gba_save_t,
         NULL
     );
     TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
 
     /*
-     * pksav_time_to_uint32_t
+     * pksav_gba_save_set_nat_pokedex_unlocked
      */
 
-    status = pksav_time_t_to_uint32_t(
+    status = pksav_gba_save_set_nat_pokedex_unlocked(
         NULL,
-        &dummy_uint32_t
+        true
     );
     TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
 
-    status = pksav_time_t_to_uint32_t(
-        &dummy_time_t,
+    /*
+     * pksav_gba_save_check_pokedex_mirrors
+     */
+
+    status = pksav_gba_save_check_pokedex_mirrors(
+        NULL,
+        &dummy_bool
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_gba_save_check_pokedex_mirrors(
+        &dummy_pksav_gba_save_t,
         NULL
     );
     TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
 
-    status = pksav_time_t_to_uint32_t(
+    /*
+     * pksav_gba_save_pokedex_mirrors_matched_on_load
+     */
+
+    status = pksav_gba_save_pokedex_mirrors_matched_on_load(
+        NULL,
+        &dummy_bool
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_gba_save_pokedex_mirrors_matched_on_load(
+        &dummy_pksav_gba_save_t,
+        NULL
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    /*
+     * pksav_gba_save_get_dirty_sections
+     */
+
+    status = pksav_gba_save_get_dirty_sections(
         NULL,
+        &dummy_uint16_t
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_gba_save_get_dirty_sections(
+        &dummy_pksav_gba_save_t,
         NULL
     );
     TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
 }
 
 /*
- * pksav/common/pokedex.h
+ * pksav/gba/pokemon_record.h
  */
-static void pksav_common_pokedex_h_test() {
+static void pksav_gba_pokemon_record_h_test() {
+    pksav_error_t status = PKSAV_ERROR_NONE;
+
+    pksav_gba_pokemon_box_t dummy_pksav_gba_pokemon_box_t;
+    pksav_gba_pokemon_party_t dummy_pksav_gba_pokemon_party_t;
+    pksav_pokemon_record_t dummy_pksav_pokemon_record_t;
+    size_t dummy_size_t = 0;
+
+    /*
+     * pksav_gba_box_to_records
+     */
+
+    status = pksav_gba_box_to_records(
+        NULL,
+        &dummy_pksav_pokemon_record_t,
+        &dummy_size_t
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_gba_box_to_records(
+        &dummy_pksav_gba_pokemon_box_t,
+        NULL,
+        &dummy_size_t
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_gba_box_to_records(
+        &dummy_pksav_gba_pokemon_box_t,
+        &dummy_pksav_pokemon_record_t,
+        NULL
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    /*
+     * pksav_gba_party_to_records
+     */
+
+    status = pksav_gba_party_to_records(
+        NULL,
+        &dummy_pksav_pokemon_record_t,
+        &dummy_size_t
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_gba_party_to_records(
+        &dummy_pksav_gba_pokemon_party_t,
+        NULL,
+        &dummy_size_t
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_gba_party_to_records(
+        &dummy_pksav_gba_pokemon_party_t,
+        &dummy_pksav_pokemon_record_t,
+        NULL
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+}
+
+
+/*
+ * pksav/gba/save.h
+ */
+static void pksav_gba_save_h_test() {
     pksav_error_t status = PKSAV_ERROR_NONE;
 
     uint8_t dummy_uint8_t = 0;
     bool dummy_bool = false;
+    pksav_gba_save_t dummy_pksav_gba_save_t;
+    pksav_gba_save_health_t dummy_pksav_gba_save_health_t;
+    char dummy_char = 0;
+
+    /*
+     * pksav_buffer_is_gba_save
+     */
+
+    status = pksav_buffer_is_gba_save(
+        NULL,
+        0,
+        PKSAV_GBA_RS,
+        &dummy_bool
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_buffer_is_gba_save(
+        &dummy_uint8_t,
+        0,
+        PKSAV_GBA_RS,
+        NULL
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_buffer_is_gba_save(
+        NULL,
+        0,
+        PKSAV_GBA_RS,
+        NULL
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    /*
+     * pksav_file_is_gba_save
+     */
+
+    status = pksav_file_is_gba_save(
+        NULL,
+        PKSAV_GBA_RS,
+        &dummy_bool
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_file_is_gba_save(
+        &dummy_char,
+        PKSAV_GBA_RS,
+        NULL
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_file_is_gba_save(
+        NULL,
+        PKSAV_GBA_RS,
+        NULL
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    /*
+     * pksav_gba_save_load
+     */
+
+    status = pksav_gba_save_load(
+        NULL,
+        &dummy_pksav_gba_save_t
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_gba_save_load(
+        &dummy_char,
+        NULL
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_gba_save_load(
+        NULL,
+        NULL
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    /*
+     * pksav_gba_save_load_buffer
+     */
+
+    status = pksav_gba_save_load_buffer(
+        NULL,
+        0,
+        &dummy_pksav_gba_save_t
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_gba_save_load_buffer(
+        &dummy_uint8_t,
+        0,
+        NULL
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_gba_save_load_buffer(
+        NULL,
+        0,
+        NULL
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    /*
+     * pksav_gba_save_load_compact
+     */
+
+    status = pksav_gba_save_load_compact(
+        NULL,
+        &dummy_pksav_gba_save_t
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_gba_save_load_compact(
+        &dummy_char,
+        NULL
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_gba_save_load_compact(
+        NULL,
+        NULL
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    /*
+     * pksav_gba_save_load_buffer_compact
+     */
+
+    status = pksav_gba_save_load_buffer_compact(
+        NULL,
+        0,
+        &dummy_pksav_gba_save_t
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_gba_save_load_buffer_compact(
+        &dummy_uint8_t,
+        0,
+        NULL
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_gba_save_load_buffer_compact(
+        NULL,
+        0,
+        NULL
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
 
     /*
-     * pksav_get_pokedex_bit
+     * pksav_gba_save_verify_buffer
      */
 
-    status = pksav_get_pokedex_bit(
+    status = pksav_gba_save_verify_buffer(
         NULL,
         0,
-        &dummy_bool
+        &dummy_pksav_gba_save_health_t
     );
     TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
 
-    status = pksav_get_pokedex_bit(
+    status = pksav_gba_save_verify_buffer(
         &dummy_uint8_t,
         0,
         NULL
     );
     TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
 
-    status = pksav_get_pokedex_bit(
+    status = pksav_gba_save_verify_buffer(
         NULL,
         0,
         NULL
@@ -99,777 +2709,753 @@ static void pksav_common_pokedex_h_test() {
     TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
 
     /*
-     * pksav_set_pokedex_bit
+     * pksav_gba_save_load_strict
      */
 
-    status = pksav_set_pokedex_bit(
+    status = pksav_gba_save_load_strict(
         NULL,
-        0,
-        false
+        &dummy_pksav_gba_save_t,
+        &dummy_pksav_gba_save_health_t
     );
     TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
-}
-
-/*
- * pksav/common/pokerus.h
- */
-static void pksav_common_pokerus_h_test()
-{
-    pksav_error_t status = PKSAV_ERROR_NONE;
-    uint8_t dummy_uint8_t = 0;
-    pksav_pokerus_strain_t dummy_strain = PKSAV_POKERUS_STRAIN_A;
-
-    /*
-     * pksav_pokerus_get_strain
-     */
 
-    status = pksav_pokerus_get_strain(
-                 NULL, // pokerus_ptr
-                 &dummy_strain
-             );
+    status = pksav_gba_save_load_strict(
+        &dummy_char,
+        NULL,
+        &dummy_pksav_gba_save_health_t
+    );
     TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
 
-    status = pksav_pokerus_get_strain(
-                 &dummy_uint8_t,
-                 NULL // strain_out
-             );
+    status = pksav_gba_save_load_strict(
+        NULL,
+        NULL,
+        NULL
+    );
     TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
 
     /*
-     * pksav_pokerus_set_strain
+     * pksav_gba_save_load_buffer_strict
      */
 
-    status = pksav_pokerus_set_strain(
-                 NULL, // pokerus_ptr
-                 dummy_strain
-             );
+    status = pksav_gba_save_load_buffer_strict(
+        NULL,
+        0,
+        &dummy_pksav_gba_save_t,
+        &dummy_pksav_gba_save_health_t
+    );
     TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
 
-    /*
-     * pksav_pokerus_get_duration
-     */
-
-    status = pksav_pokerus_get_duration(
-                 NULL, // pokerus_ptr
-                 &dummy_uint8_t
-             );
+    status = pksav_gba_save_load_buffer_strict(
+        &dummy_uint8_t,
+        0,
+        NULL,
+        &dummy_pksav_gba_save_health_t
+    );
     TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
 
-    status = pksav_pokerus_get_duration(
-                 &dummy_uint8_t,
-                 NULL // duration_out
-             );
+    status = pksav_gba_save_load_buffer_strict(
+        NULL,
+        0,
+        NULL,
+        NULL
+    );
     TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
 
     /*
-     * pksav_pokerus_set_duration
+     * pksav_gba_save_save
      */
 
-    status = pksav_pokerus_set_duration(
-                  NULL, // pokerus_ptr
-                  dummy_uint8_t
-             );
+    status = pksav_gba_save_save(
+        NULL,
+        &dummy_pksav_gba_save_t
+    );
     TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
-}
-
-/*
- * pksav/common/prng.h
- *
- * TODO: arng, lcrng functions when gen4 update merged
- */
-static void pksav_common_prng_h_test() {
-    pksav_error_t status = PKSAV_ERROR_NONE;
-
-    pksav_mtrng_t dummy_pksav_mtrng_t;
-    uint32_t dummy_uint32_t = 0;
 
-    /*
-     * pksav_mtrng_populate
-     */
+    status = pksav_gba_save_save(
+        &dummy_char,
+        NULL
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
 
-    status = pksav_mtrng_populate(
+    status = pksav_gba_save_save(
+        NULL,
         NULL
     );
     TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
 
     /*
-     * pksav_mtrng_next
+     * pksav_gba_save_save_buffer
      */
 
-    status = pksav_mtrng_next(
+    status = pksav_gba_save_save_buffer(
         NULL,
-        &dummy_uint32_t
+        0,
+        &dummy_pksav_gba_save_t
     );
     TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
 
-    status = pksav_mtrng_next(
-        &dummy_pksav_mtrng_t,
+    status = pksav_gba_save_save_buffer(
+        &dummy_uint8_t,
+        0,
         NULL
     );
     TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
 
-    status = pksav_mtrng_next(
+    status = pksav_gba_save_save_buffer(
         NULL,
+        0,
         NULL
     );
     TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
-}
-
-/*
- * pksav/common/stats.h
- */
-static void pksav_common_stats_h_test() {
-    pksav_error_t status = PKSAV_ERROR_NONE;
-
-    uint8_t dummy_uint8_t = 0;
-    uint16_t dummy_uint16_t = 0;
-    uint32_t dummy_uint32_t = 0;
 
     /*
-     * pksav_get_gb_IV
+     * pksav_gba_save_clone
      */
 
-    status = pksav_get_gb_IV(
+    status = pksav_gba_save_clone(
         NULL,
-        PKSAV_STAT_NONE,
-        &dummy_uint8_t
+        &dummy_pksav_gba_save_t
     );
     TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
 
-    status = pksav_get_gb_IV(
-        &dummy_uint16_t,
-        PKSAV_STAT_NONE,
+    status = pksav_gba_save_clone(
+        &dummy_pksav_gba_save_t,
         NULL
     );
     TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
 
-    status = pksav_get_gb_IV(
+    status = pksav_gba_save_clone(
         NULL,
-        PKSAV_STAT_NONE,
         NULL
     );
     TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
 
     /*
-     * pksav_set_gb_IV
+     * pksav_gba_save_restore
      */
 
-    status = pksav_set_gb_IV(
+    status = pksav_gba_save_restore(
         NULL,
-        PKSAV_STAT_NONE,
-        0
+        &dummy_pksav_gba_save_t
     );
     TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
 
-    /*
-     * pksav_get_IV
-     */
-
-    status = pksav_get_IV(
-        NULL,
-        PKSAV_STAT_NONE,
-        &dummy_uint8_t
+    status = pksav_gba_save_restore(
+        &dummy_pksav_gba_save_t,
+        NULL
     );
     TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
 
-    status = pksav_get_IV(
-        &dummy_uint32_t,
-        PKSAV_STAT_NONE,
+    status = pksav_gba_save_restore(
+        NULL,
         NULL
     );
     TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
 
-    status = pksav_get_IV(
-        NULL,
-        PKSAV_STAT_NONE,
+    /*
+     * pksav_gba_save_free
+     */
+
+    status = pksav_gba_save_free(
         NULL
     );
     TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
 }
 
 /*
- * pksav/gen1/save.h
+ * pksav/gba/stats.h
  */
-static void pksav_gen1_save_h_test() {
+static void pksav_gba_stats_h_test() {
     pksav_error_t status = PKSAV_ERROR_NONE;
 
     uint8_t dummy_uint8_t = 0;
-    bool dummy_bool = false;
-    char dummy_char = 0;
-    pksav_gen1_save_t dummy_pksav_gen1_save_t;
-    dummy_pksav_gen1_save_t.raw = NULL;
+    uint8_t dummy_uint8_t_array[30] = {0};
+    pksav_gba_pc_pokemon_t dummy_pksav_gba_pc_pokemon_t;
+    pksav_gba_pokemon_party_t dummy_pksav_gba_pokemon_party_t;
+    pksav_gba_pokemon_box_t dummy_pksav_gba_pokemon_box_t;
+    pksav_battle_stats_t dummy_pksav_battle_stats_t;
 
     /*
-     * pksav_buffer_is_gen1_save
+     * pksav_gba_pokemon_calc_stats
      */
 
-    status = pksav_buffer_is_gen1_save(
+    status = pksav_gba_pokemon_calc_stats(
         NULL,
-        0,
-        &dummy_bool
+        1,
+        &dummy_pksav_battle_stats_t
     );
     TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
 
-    status = pksav_buffer_is_gen1_save(
-        &dummy_uint8_t,
-        0,
+    status = pksav_gba_pokemon_calc_stats(
+        &dummy_pksav_gba_pc_pokemon_t,
+        1,
         NULL
     );
     TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
 
-    status = pksav_buffer_is_gen1_save(
-        NULL,
-        0,
+    /*
+     * pksav_gba_party_update_stats
+     */
+
+    status = pksav_gba_party_update_stats(
         NULL
     );
     TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
 
     /*
-     * pksav_file_is_gen1_save
+     * pksav_gba_party_verify_stats
      */
 
-    status = pksav_file_is_gen1_save(
+    status = pksav_gba_party_verify_stats(
         NULL,
-        &dummy_bool
+        &dummy_uint8_t
     );
     TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
 
-    status = pksav_file_is_gen1_save(
-        &dummy_char,
+    status = pksav_gba_party_verify_stats(
+        &dummy_pksav_gba_pokemon_party_t,
         NULL
     );
     TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
 
-    status = pksav_file_is_gen1_save(
+    /*
+     * pksav_gba_box_calc_stats
+     */
+
+    status = pksav_gba_box_calc_stats(
+        NULL,
+        dummy_uint8_t_array,
+        &dummy_pksav_battle_stats_t
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_gba_box_calc_stats(
+        &dummy_pksav_gba_pokemon_box_t,
         NULL,
+        &dummy_pksav_battle_stats_t
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_gba_box_calc_stats(
+        &dummy_pksav_gba_pokemon_box_t,
+        dummy_uint8_t_array,
         NULL
     );
     TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+}
+
+
+/*
+ * pksav/gba/text.h
+ */
+static void pksav_gba_text_h_test() {
+    pksav_error_t status = PKSAV_ERROR_NONE;
+
+    uint8_t dummy_uint8_t = 0;
+    char dummy_char = 0;
 
     /*
-     * pksav_gen1_save_load
+     * pksav_text_from_gba
      */
 
-    status = pksav_gen1_save_load(
+    status = pksav_text_from_gba(
         NULL,
-        &dummy_pksav_gen1_save_t
+        &dummy_char,
+        0
     );
     TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
 
-    status = pksav_gen1_save_load(
-        &dummy_char,
-        NULL
+    status = pksav_text_from_gba(
+        &dummy_uint8_t,
+        NULL,
+        0
     );
     TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
 
-    status = pksav_gen1_save_load(
+    status = pksav_text_from_gba(
         NULL,
-        NULL
+        NULL,
+        0
     );
     TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
 
     /*
-     * pksav_gen1_save_save
+     * pksav_text_from_gba_utf8
      */
 
-    status = pksav_gen1_save_save(
+    status = pksav_text_from_gba_utf8(
         NULL,
-        &dummy_pksav_gen1_save_t
-    );
-    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
-
-    status = pksav_gen1_save_save(
+        0,
         &dummy_char,
+        0,
         NULL
     );
     TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
 
-    status = pksav_gen1_save_save(
+    status = pksav_text_from_gba_utf8(
+        &dummy_uint8_t,
+        0,
         NULL,
+        0,
         NULL
     );
     TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
 
     /*
-     * pksav_gen1_save_free
+     * pksav_text_to_gba
      */
 
-    status = pksav_gen1_save_free(
-        NULL
+    status = pksav_text_to_gba(
+        NULL,
+        &dummy_uint8_t,
+        0
     );
     TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
 
-    status = pksav_gen1_save_free(
-        &dummy_pksav_gen1_save_t
+    status = pksav_text_to_gba(
+        &dummy_char,
+        NULL,
+        0
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_text_to_gba(
+        NULL,
+        NULL,
+        0
     );
     TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
 }
 
 /*
- * pksav/gen1/text.h
+ * pksav/gen4/pokemon_record.h
  */
-static void pksav_gen1_text_h_test() {
+static void pksav_gen4_pokemon_record_h_test() {
     pksav_error_t status = PKSAV_ERROR_NONE;
 
-    uint8_t dummy_uint8_t = 0;
-    char dummy_char = 0;
+    pksav_gen4_pokemon_box_t dummy_pksav_gen4_pokemon_box_t;
+    pksav_gen4_pokemon_party_t dummy_pksav_gen4_pokemon_party_t;
+    pksav_pokemon_record_t dummy_pksav_pokemon_record_t;
+    size_t dummy_size_t = 0;
 
     /*
-     * pksav_text_from_gen1
+     * pksav_gen4_box_to_records
      */
 
-    status = pksav_text_from_gen1(
+    status = pksav_gen4_box_to_records(
         NULL,
-        &dummy_char,
-        0
+        &dummy_pksav_pokemon_record_t,
+        &dummy_size_t
     );
     TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
 
-    status = pksav_text_from_gen1(
-        &dummy_uint8_t,
+    status = pksav_gen4_box_to_records(
+        &dummy_pksav_gen4_pokemon_box_t,
         NULL,
-        0
+        &dummy_size_t
     );
     TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
 
-    status = pksav_text_from_gen1(
-        NULL,
-        NULL,
-        0
+    status = pksav_gen4_box_to_records(
+        &dummy_pksav_gen4_pokemon_box_t,
+        &dummy_pksav_pokemon_record_t,
+        NULL
     );
     TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
 
     /*
-     * pksav_text_to_gen1
+     * pksav_gen4_party_to_records
      */
 
-    status = pksav_text_to_gen1(
+    status = pksav_gen4_party_to_records(
         NULL,
-        &dummy_uint8_t,
-        0
+        &dummy_pksav_pokemon_record_t,
+        &dummy_size_t
     );
     TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
 
-    status = pksav_text_to_gen1(
-        &dummy_char,
+    status = pksav_gen4_party_to_records(
+        &dummy_pksav_gen4_pokemon_party_t,
         NULL,
-        0
+        &dummy_size_t
     );
     TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
 
-    status = pksav_text_to_gen1(
-        NULL,
-        NULL,
-        0
+    status = pksav_gen4_party_to_records(
+        &dummy_pksav_gen4_pokemon_party_t,
+        &dummy_pksav_pokemon_record_t,
+        NULL
     );
     TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
 }
 
+
 /*
- * pksav/gen2/save.h
+ * pksav/gen4/save.h
  */
-static void pksav_gen2_save_h_test() {
+static void pksav_gen4_save_h_test() {
     pksav_error_t status = PKSAV_ERROR_NONE;
 
-    uint8_t dummy_uint8_t = 0;
+    uint8_t dummy_uint8_t_array[1] = {0};
     bool dummy_bool = false;
     char dummy_char = 0;
-    pksav_gen2_save_t dummy_pksav_gen2_save_t;
-    dummy_pksav_gen2_save_t.raw = NULL;
+    pksav_gen4_save_t dummy_pksav_gen4_save_t;
 
     /*
-     * pksav_buffer_is_gen2_save
+     * pksav_buffer_is_gen4_save
      */
 
-    status = pksav_buffer_is_gen2_save(
+    status = pksav_buffer_is_gen4_save(
         NULL,
-        0,
-        false,
+        sizeof(dummy_uint8_t_array),
+        PKSAV_GEN4_DP,
         &dummy_bool
     );
     TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
 
-    status = pksav_buffer_is_gen2_save(
-        &dummy_uint8_t,
-        0,
-        false,
-        NULL
-    );
-    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
-
-    status = pksav_buffer_is_gen2_save(
-        NULL,
-        0,
-        false,
+    status = pksav_buffer_is_gen4_save(
+        dummy_uint8_t_array,
+        sizeof(dummy_uint8_t_array),
+        PKSAV_GEN4_DP,
         NULL
     );
     TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
 
     /*
-     * pksav_file_is_gen2_save
+     * pksav_file_is_gen4_save
      */
 
-    status = pksav_file_is_gen2_save(
+    status = pksav_file_is_gen4_save(
         NULL,
-        false,
+        PKSAV_GEN4_DP,
         &dummy_bool
     );
     TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
 
-    status = pksav_file_is_gen2_save(
+    status = pksav_file_is_gen4_save(
         &dummy_char,
-        false,
+        PKSAV_GEN4_DP,
         NULL
     );
     TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
 
-    status = pksav_file_is_gen2_save(
+    /*
+     * pksav_gen4_save_load
+     */
+
+    status = pksav_gen4_save_load(
         NULL,
-        false,
+        &dummy_pksav_gen4_save_t
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_gen4_save_load(
+        &dummy_char,
         NULL
     );
     TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
 
     /*
-     * pksav_gen2_save_load
+     * pksav_gen4_save_load_buffer
      */
 
-    status = pksav_gen2_save_load(
+    status = pksav_gen4_save_load_buffer(
         NULL,
-        &dummy_pksav_gen2_save_t
+        0,
+        &dummy_pksav_gen4_save_t
     );
     TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
 
-    status = pksav_gen2_save_load(
-        &dummy_char,
+    status = pksav_gen4_save_load_buffer(
+        dummy_uint8_t_array,
+        0,
         NULL
     );
     TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
 
-    status = pksav_gen2_save_load(
+    status = pksav_gen4_save_load_buffer(
         NULL,
+        0,
         NULL
     );
     TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
 
     /*
-     * pksav_gen2_save_save
+     * pksav_gen4_save_save
      */
 
-    status = pksav_gen2_save_save(
+    status = pksav_gen4_save_save(
         NULL,
-        &dummy_pksav_gen2_save_t
+        &dummy_pksav_gen4_save_t
     );
     TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
 
-    status = pksav_gen2_save_save(
+    status = pksav_gen4_save_save(
         &dummy_char,
         NULL
     );
     TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
 
-    status = pksav_gen2_save_save(
-        NULL,
-        NULL
-    );
-    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
-
     /*
-     * pksav_gen2_save_free
+     * pksav_gen4_save_free
      */
 
-    status = pksav_gen2_save_free(
+    status = pksav_gen4_save_free(
         NULL
     );
     TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
-
-    status = pksav_gen2_save_free(
-        &dummy_pksav_gen2_save_t
-    );
-    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
 }
 
 /*
- * pksav/gen2/text.h
+ * pksav/gen5/pokemon_record.h
  */
-static void pksav_gen2_text_h_test() {
+static void pksav_gen5_pokemon_record_h_test() {
     pksav_error_t status = PKSAV_ERROR_NONE;
 
-    uint8_t dummy_uint8_t = 0;
-    char dummy_char = 0;
+    pksav_gen5_pokemon_box_t dummy_pksav_gen5_pokemon_box_t;
+    pksav_gen5_pokemon_party_t dummy_pksav_gen5_pokemon_party_t;
+    pksav_pokemon_record_t dummy_pksav_pokemon_record_t;
+    size_t dummy_size_t = 0;
 
     /*
-     * pksav_text_from_gen2
+     * pksav_gen5_box_to_records
      */
 
-    status = pksav_text_from_gen2(
+    status = pksav_gen5_box_to_records(
         NULL,
-        &dummy_char,
-        0
+        &dummy_pksav_pokemon_record_t,
+        &dummy_size_t
     );
     TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
 
-    status = pksav_text_from_gen2(
-        &dummy_uint8_t,
+    status = pksav_gen5_box_to_records(
+        &dummy_pksav_gen5_pokemon_box_t,
         NULL,
-        0
+        &dummy_size_t
     );
     TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
 
-    status = pksav_text_from_gen2(
-        NULL,
-        NULL,
-        0
+    status = pksav_gen5_box_to_records(
+        &dummy_pksav_gen5_pokemon_box_t,
+        &dummy_pksav_pokemon_record_t,
+        NULL
     );
     TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
 
     /*
-     * pksav_text_to_gen2
+     * pksav_gen5_party_to_records
      */
 
-    status = pksav_text_to_gen2(
-        NULL,
-        &dummy_uint8_t,
-        0
-    );
-    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
-
-    status = pksav_text_to_gen2(
-        &dummy_char,
-        NULL,
-        0
-    );
-    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
-
-    status = pksav_text_to_gen2(
-        NULL,
+    status = pksav_gen5_party_to_records(
         NULL,
-        0
+        &dummy_pksav_pokemon_record_t,
+        &dummy_size_t
     );
     TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
-}
 
-/*
- * pksav/gen2/time.h
- */
-static void pksav_gen2_time_h_test() {
-    pksav_error_t status = PKSAV_ERROR_NONE;
-
-    time_t dummy_time_t = 0;
-    uint16_t dummy_uint16_t = 0;
-
-    /*
-     * pksav_gen2_set_caught_data_time_field
-     */
-
-    status = pksav_gen2_set_caught_data_time_field(
+    status = pksav_gen5_party_to_records(
+        &dummy_pksav_gen5_pokemon_party_t,
         NULL,
-        &dummy_uint16_t
-    );
-    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
-
-    status = pksav_gen2_set_caught_data_time_field(
-        &dummy_time_t,
-        NULL
+        &dummy_size_t
     );
     TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
 
-    status = pksav_gen2_set_caught_data_time_field(
-        NULL,
+    status = pksav_gen5_party_to_records(
+        &dummy_pksav_gen5_pokemon_party_t,
+        &dummy_pksav_pokemon_record_t,
         NULL
     );
     TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
 }
 
+
 /*
- * pksav/gba/save.h
+ * pksav/gen5/save.h
  */
-static void pksav_gba_save_h_test() {
+static void pksav_gen5_save_h_test() {
     pksav_error_t status = PKSAV_ERROR_NONE;
 
-    uint8_t dummy_uint8_t = 0;
+    uint8_t dummy_uint8_t_array[1] = {0};
     bool dummy_bool = false;
-    pksav_gba_save_t dummy_pksav_gba_save_t;
     char dummy_char = 0;
+    pksav_gen5_save_t dummy_pksav_gen5_save_t;
+    const pksav_gen5_pokemon_box_t* dummy_const_pksav_gen5_pokemon_box_ptr = NULL;
+    pksav_gen5_pokemon_box_t* dummy_pksav_gen5_pokemon_box_ptr = NULL;
 
     /*
-     * pksav_buffer_is_gba_save
+     * pksav_buffer_is_gen5_save
      */
 
-    status = pksav_buffer_is_gba_save(
+    status = pksav_buffer_is_gen5_save(
         NULL,
-        0,
-        PKSAV_GBA_RS,
+        sizeof(dummy_uint8_t_array),
+        PKSAV_GEN5_BW,
         &dummy_bool
     );
     TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
 
-    status = pksav_buffer_is_gba_save(
-        &dummy_uint8_t,
-        0,
-        PKSAV_GBA_RS,
-        NULL
-    );
-    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
-
-    status = pksav_buffer_is_gba_save(
-        NULL,
-        0,
-        PKSAV_GBA_RS,
+    status = pksav_buffer_is_gen5_save(
+        dummy_uint8_t_array,
+        sizeof(dummy_uint8_t_array),
+        PKSAV_GEN5_BW,
         NULL
     );
     TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
 
     /*
-     * pksav_file_is_gba_save
+     * pksav_file_is_gen5_save
      */
 
-    status = pksav_file_is_gba_save(
+    status = pksav_file_is_gen5_save(
         NULL,
-        PKSAV_GBA_RS,
+        PKSAV_GEN5_BW,
         &dummy_bool
     );
     TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
 
-    status = pksav_file_is_gba_save(
+    status = pksav_file_is_gen5_save(
         &dummy_char,
-        PKSAV_GBA_RS,
-        NULL
-    );
-    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
-
-    status = pksav_file_is_gba_save(
-        NULL,
-        PKSAV_GBA_RS,
+        PKSAV_GEN5_BW,
         NULL
     );
     TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
 
     /*
-     * pksav_gba_save_load
+     * pksav_gen5_save_load
      */
 
-    status = pksav_gba_save_load(
+    status = pksav_gen5_save_load(
         NULL,
-        &dummy_pksav_gba_save_t
+        &dummy_pksav_gen5_save_t
     );
     TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
 
-    status = pksav_gba_save_load(
+    status = pksav_gen5_save_load(
         &dummy_char,
         NULL
     );
     TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
 
-    status = pksav_gba_save_load(
-        NULL,
-        NULL
-    );
-    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
-
     /*
-     * pksav_gba_save_save
+     * pksav_gen5_save_get_pokemon_box
      */
 
-    status = pksav_gba_save_save(
+    status = pksav_gen5_save_get_pokemon_box(
         NULL,
-        &dummy_pksav_gba_save_t
+        0,
+        &dummy_const_pksav_gen5_pokemon_box_ptr
     );
     TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
 
-    status = pksav_gba_save_save(
-        &dummy_char,
+    status = pksav_gen5_save_get_pokemon_box(
+        &dummy_pksav_gen5_save_t,
+        0,
         NULL
     );
     TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
 
-    status = pksav_gba_save_save(
+    /*
+     * pksav_gen5_save_edit_pokemon_box
+     */
+
+    status = pksav_gen5_save_edit_pokemon_box(
         NULL,
-        NULL
+        0,
+        &dummy_pksav_gen5_pokemon_box_ptr
     );
     TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
 
-    /*
-     * pksav_gba_save_free
-     */
-
-    status = pksav_gba_save_free(
+    status = pksav_gen5_save_edit_pokemon_box(
+        &dummy_pksav_gen5_save_t,
+        0,
         NULL
     );
     TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
-}
-
-/*
- * pksav/gba/text.h
- */
-static void pksav_gba_text_h_test() {
-    pksav_error_t status = PKSAV_ERROR_NONE;
-
-    uint8_t dummy_uint8_t = 0;
-    char dummy_char = 0;
 
     /*
-     * pksav_text_from_gba
+     * pksav_gen5_save_load_buffer
      */
 
-    status = pksav_text_from_gba(
+    status = pksav_gen5_save_load_buffer(
         NULL,
-        &dummy_char,
-        0
+        0,
+        &dummy_pksav_gen5_save_t
     );
     TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
 
-    status = pksav_text_from_gba(
-        &dummy_uint8_t,
-        NULL,
-        0
+    status = pksav_gen5_save_load_buffer(
+        dummy_uint8_t_array,
+        0,
+        NULL
     );
     TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
 
-    status = pksav_text_from_gba(
-        NULL,
+    status = pksav_gen5_save_load_buffer(
         NULL,
-        0
+        0,
+        NULL
     );
     TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
 
     /*
-     * pksav_text_to_gba
+     * pksav_gen5_save_save
      */
 
-    status = pksav_text_to_gba(
+    status = pksav_gen5_save_save(
         NULL,
-        &dummy_uint8_t,
-        0
+        &dummy_pksav_gen5_save_t
     );
     TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
 
-    status = pksav_text_to_gba(
+    status = pksav_gen5_save_save(
         &dummy_char,
-        NULL,
-        0
+        NULL
     );
     TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
 
-    status = pksav_text_to_gba(
-        NULL,
-        NULL,
-        0
+    /*
+     * pksav_gen5_save_free
+     */
+
+    status = pksav_gen5_save_free(
+        NULL
     );
     TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
 }
 
+
 PKSAV_TEST_MAIN(
+    PKSAV_TEST(pksav_batch_h_test)
+    PKSAV_TEST(pksav_corpus_h_test)
+    PKSAV_TEST(pksav_ingest_h_test)
+    PKSAV_TEST(pksav_journal_h_test)
+    PKSAV_TEST(pksav_store_h_test)
+    PKSAV_TEST(pksav_common_base_stats_h_test)
+    PKSAV_TEST(pksav_common_columnar_h_test)
     PKSAV_TEST(pksav_common_datetime_h_test)
+    PKSAV_TEST(pksav_common_lcrng_h_test)
+    PKSAV_TEST(pksav_common_nds_crypt_h_test)
     PKSAV_TEST(pksav_common_pokedex_h_test)
     PKSAV_TEST(pksav_common_pokerus_h_test)
     PKSAV_TEST(pksav_common_prng_h_test)
     PKSAV_TEST(pksav_common_stats_h_test)
+    PKSAV_TEST(pksav_gen1_pokemon_record_h_test)
     PKSAV_TEST(pksav_gen1_save_h_test)
+    PKSAV_TEST(pksav_gen1_stats_h_test)
     PKSAV_TEST(pksav_gen1_text_h_test)
+    PKSAV_TEST(pksav_gen2_pokemon_record_h_test)
     PKSAV_TEST(pksav_gen2_save_h_test)
+    PKSAV_TEST(pksav_gen2_stats_h_test)
     PKSAV_TEST(pksav_gen2_text_h_test)
     PKSAV_TEST(pksav_gen2_time_h_test)
+    PKSAV_TEST(pksav_gba_patch_h_test)
+    PKSAV_TEST(pksav_gba_pokedex_h_test)
+    PKSAV_TEST(pksav_gba_pokemon_record_h_test)
     PKSAV_TEST(pksav_gba_save_h_test)
+    PKSAV_TEST(pksav_gba_stats_h_test)
     PKSAV_TEST(pksav_gba_text_h_test)
+    PKSAV_TEST(pksav_gen4_pokemon_record_h_test)
+    PKSAV_TEST(pksav_gen4_save_h_test)
+    PKSAV_TEST(pksav_gen5_pokemon_record_h_test)
+    PKSAV_TEST(pksav_gen5_save_h_test)
 )
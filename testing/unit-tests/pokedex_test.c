@@ -0,0 +1,225 @@
+/*
+ * Copyright (c) 2018 Nicholas Corgan (n.corgan@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "c_test_common.h"
+#include "test-utils.h"
+
+#include <pksav.h>
+
+#include <string.h>
+
+// Not a multiple of 8 or 64, to exercise the partial byte and word paths
+#define NUM_SPECIES 386
+#define POKEDEX_BUFFER_LEN 52 // Bigger than needed, so we can check the tail
+
+static bool get_bit(
+    const uint8_t* raw,
+    uint16_t pokedex_num
+)
+{
+    bool result = false;
+    pksav_error_t error = pksav_get_pokedex_bit(raw, pokedex_num, &result);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+
+    return result;
+}
+
+static void pokedex_bit_test()
+{
+    pksav_error_t error = PKSAV_ERROR_NONE;
+    uint8_t pokedex[POKEDEX_BUFFER_LEN] = {0};
+
+    for(uint16_t pokedex_num = 1; pokedex_num <= NUM_SPECIES; ++pokedex_num)
+    {
+        error = pksav_set_pokedex_bit(pokedex, pokedex_num, true);
+        TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+        TEST_ASSERT_TRUE(get_bit(pokedex, pokedex_num));
+        TEST_ASSERT_EQUAL(1 << ((pokedex_num-1) % 8), pokedex[(pokedex_num-1) / 8] & (1 << ((pokedex_num-1) % 8)));
+
+        error = pksav_set_pokedex_bit(pokedex, pokedex_num, false);
+        TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+        TEST_ASSERT_FALSE(get_bit(pokedex, pokedex_num));
+    }
+
+    bool result = false;
+    error = pksav_get_pokedex_bit(pokedex, 0, &result);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_PARAM_OUT_OF_RANGE, error);
+    error = pksav_set_pokedex_bit(pokedex, 0, true);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_PARAM_OUT_OF_RANGE, error);
+}
+
+static void pokedex_count_and_iterate_test()
+{
+    pksav_error_t error = PKSAV_ERROR_NONE;
+    uint8_t pokedex[POKEDEX_BUFFER_LEN] = {0};
+
+    (void)randomize_buffer(pokedex, sizeof(pokedex));
+
+    uint16_t expected_count = 0;
+    for(uint16_t pokedex_num = 1; pokedex_num <= NUM_SPECIES; ++pokedex_num)
+    {
+        expected_count += get_bit(pokedex, pokedex_num) ? 1 : 0;
+    }
+
+    uint16_t count = 0;
+    error = pksav_count_pokedex_bits(pokedex, NUM_SPECIES, &count);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL(expected_count, count);
+
+    // Iteration must visit exactly the set bits, in order.
+    uint16_t num_visited = 0;
+    uint16_t previous = 0;
+    uint16_t next = 0;
+    for(;;)
+    {
+        error = pksav_get_next_pokedex_bit(pokedex, NUM_SPECIES, previous, &next);
+        TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+        if(next == 0)
+        {
+            break;
+        }
+
+        TEST_ASSERT_TRUE(next > previous);
+        TEST_ASSERT_TRUE(next <= NUM_SPECIES);
+        TEST_ASSERT_TRUE(get_bit(pokedex, next));
+        for(uint16_t skipped = previous + 1; skipped < next; ++skipped)
+        {
+            TEST_ASSERT_FALSE(get_bit(pokedex, skipped));
+        }
+
+        previous = next;
+        ++num_visited;
+    }
+    TEST_ASSERT_EQUAL(expected_count, num_visited);
+
+    // An empty Pokédex has nothing to count or visit.
+    memset(pokedex, 0, sizeof(pokedex));
+    pokedex[sizeof(pokedex)-1] = 0xFF; // Past NUM_SPECIES, so ignored
+
+    error = pksav_count_pokedex_bits(pokedex, NUM_SPECIES, &count);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL(0, count);
+
+    error = pksav_get_next_pokedex_bit(pokedex, NUM_SPECIES, 0, &next);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL(0, next);
+}
+
+static void pokedex_range_test()
+{
+    static const uint16_t ranges[][2] =
+    {
+        {1, 1}, {1, 8}, {2, 7}, {5, 12}, {9, 16}, {1, NUM_SPECIES},
+        {100, 251}, {152, 386}, {386, 386}
+    };
+
+    pksav_error_t error = PKSAV_ERROR_NONE;
+    uint8_t pokedex[POKEDEX_BUFFER_LEN] = {0};
+
+    for(size_t i = 0; i < (sizeof(ranges)/sizeof(ranges[0])); ++i)
+    {
+        uint16_t first = ranges[i][0];
+        uint16_t last = ranges[i][1];
+
+        memset(pokedex, 0, sizeof(pokedex));
+        error = pksav_set_pokedex_bit_range(pokedex, first, last, true);
+        TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+        for(uint16_t pokedex_num = 1; pokedex_num <= (POKEDEX_BUFFER_LEN*8); ++pokedex_num)
+        {
+            TEST_ASSERT_EQUAL((pokedex_num >= first) && (pokedex_num <= last), get_bit(pokedex, pokedex_num));
+        }
+
+        memset(pokedex, 0xFF, sizeof(pokedex));
+        error = pksav_set_pokedex_bit_range(pokedex, first, last, false);
+        TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+        for(uint16_t pokedex_num = 1; pokedex_num <= (POKEDEX_BUFFER_LEN*8); ++pokedex_num)
+        {
+            TEST_ASSERT_EQUAL((pokedex_num < first) || (pokedex_num > last), get_bit(pokedex, pokedex_num));
+        }
+    }
+
+    error = pksav_set_pokedex_bit_range(pokedex, 0, 5, true);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_PARAM_OUT_OF_RANGE, error);
+    error = pksav_set_pokedex_bit_range(pokedex, 6, 5, true);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_PARAM_OUT_OF_RANGE, error);
+}
+
+static void pokedex_set_operations_test()
+{
+    pksav_error_t error = PKSAV_ERROR_NONE;
+    uint8_t pokedex1[POKEDEX_BUFFER_LEN] = {0};
+    uint8_t pokedex2[POKEDEX_BUFFER_LEN] = {0};
+    uint8_t output[POKEDEX_BUFFER_LEN] = {0};
+
+    (void)randomize_buffer(pokedex1, sizeof(pokedex1));
+    (void)randomize_buffer(pokedex2, sizeof(pokedex2));
+
+    for(int op = 0; op < 3; ++op)
+    {
+        // Bits past NUM_SPECIES must not be touched.
+        memset(output, 0xA5, sizeof(output));
+
+        switch(op)
+        {
+            case 0:
+                error = pksav_union_pokedex_bits(pokedex1, pokedex2, NUM_SPECIES, output);
+                break;
+
+            case 1:
+                error = pksav_intersect_pokedex_bits(pokedex1, pokedex2, NUM_SPECIES, output);
+                break;
+
+            default:
+                error = pksav_subtract_pokedex_bits(pokedex1, pokedex2, NUM_SPECIES, output);
+                break;
+        }
+        TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+
+        for(uint16_t pokedex_num = 1; pokedex_num <= (POKEDEX_BUFFER_LEN*8); ++pokedex_num)
+        {
+            bool bit1 = get_bit(pokedex1, pokedex_num);
+            bool bit2 = get_bit(pokedex2, pokedex_num);
+            bool expected = false;
+
+            if(pokedex_num > NUM_SPECIES)
+            {
+                expected = (0xA5 >> ((pokedex_num-1) % 8)) & 1;
+            }
+            else if(op == 0)
+            {
+                expected = bit1 || bit2;
+            }
+            else if(op == 1)
+            {
+                expected = bit1 && bit2;
+            }
+            else
+            {
+                expected = bit1 && !bit2;
+            }
+
+            TEST_ASSERT_EQUAL(expected, get_bit(output, pokedex_num));
+        }
+    }
+
+    // The output may alias an input.
+    uint8_t expected[POKEDEX_BUFFER_LEN] = {0};
+    memcpy(expected, pokedex1, sizeof(expected));
+    error = pksav_union_pokedex_bits(pokedex1, pokedex2, NUM_SPECIES, expected);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+    memcpy(output, pokedex1, sizeof(output));
+    error = pksav_union_pokedex_bits(output, pokedex2, NUM_SPECIES, output);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL_MEMORY(expected, output, sizeof(output));
+}
+
+PKSAV_TEST_MAIN(
+    PKSAV_TEST(pokedex_bit_test)
+    PKSAV_TEST(pokedex_count_and_iterate_test)
+    PKSAV_TEST(pokedex_range_test)
+    PKSAV_TEST(pokedex_set_operations_test)
+)
@@ -0,0 +1,269 @@
+/*
+ * Copyright (c) 2018 Nicholas Corgan (n.corgan@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "c_test_common.h"
+#include "test-utils.h"
+
+#include <pksav.h>
+
+#include <stddef.h>
+#include <string.h>
+
+// "PIKACHU" and "ASH" in each generation's character map
+static const uint8_t gb_pikachu[] = {0x8F,0x88,0x8A,0x80,0x82,0x87,0x94,0x50};
+static const uint8_t gb_ash[] = {0x80,0x92,0x87,0x50};
+static const uint8_t gba_pikachu[] = {0xCA,0xC3,0xC5,0xBB,0xBD,0xC2,0xCF,0xFF};
+static const uint8_t gba_ash[] = {0xBB,0xCD,0xC2,0xFF};
+
+static void pokemon_record_layout_test()
+{
+    // The numeric fields should fit in a single cache line.
+    TEST_ASSERT_TRUE(offsetof(pksav_pokemon_record_t, nickname) <= 64);
+}
+
+static void gen1_records_test()
+{
+    pksav_gen1_pokemon_box_t box;
+    pksav_pokemon_record_t records[20];
+    size_t num_records = 0;
+
+    memset(&box, 0, sizeof(box));
+    box.count = 2;
+    box.species[0] = 0x54;
+    box.species[1] = 0x54;
+    box.species[2] = 0xFF;
+
+    pksav_gen1_pc_pokemon_t* pikachu = &box.entries[0];
+    pikachu->species = 0x54;
+    pikachu->level = 5;
+    pikachu->moves[0] = 84;
+    pikachu->ot_id = pksav_bigendian16(12345);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, pksav_to_base256(135, pikachu->exp, 3));
+    pikachu->ev_hp = pksav_bigendian16(1000);
+    pikachu->ev_spcl = pksav_bigendian16(65535);
+    pikachu->iv_data = pksav_bigendian16(0xABCD);
+    memcpy(box.nicknames[0], gb_pikachu, sizeof(gb_pikachu));
+    memcpy(box.otnames[0], gb_ash, sizeof(gb_ash));
+
+    // The second entry has an invalid species index.
+    box.entries[1].species = 0x1F;
+
+    pksav_error_t error = pksav_gen1_box_to_records(&box, records, &num_records);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL(2, num_records);
+
+    const pksav_pokemon_record_t* record = &records[0];
+    TEST_ASSERT_EQUAL(25, record->pokedex_num);
+    TEST_ASSERT_EQUAL(1, record->generation);
+    TEST_ASSERT_EQUAL(5, record->level);
+    TEST_ASSERT_EQUAL(135, record->exp);
+    TEST_ASSERT_EQUAL(84, record->moves[0]);
+    TEST_ASSERT_EQUAL(12345, record->ot_public_id);
+    TEST_ASSERT_EQUAL(0, record->ot_secret_id);
+    TEST_ASSERT_EQUAL(1000, record->EVs[0]);
+    TEST_ASSERT_EQUAL(65535, record->EVs[4]);
+    TEST_ASSERT_EQUAL(65535, record->EVs[5]);
+    TEST_ASSERT_EQUAL(PKSAV_POKEMON_RECORD_NO_NATURE, record->nature);
+    TEST_ASSERT_EQUAL(0, record->flags);
+
+    const uint8_t expected_IVs[6] = {5, 10, 11, 12, 13, 13};
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(expected_IVs, record->IVs, 6);
+
+    TEST_ASSERT_EQUAL_STRING("PIKACHU", record->nickname);
+    TEST_ASSERT_EQUAL_STRING("ASH", record->otname);
+
+    TEST_ASSERT_EQUAL(0, records[1].pokedex_num);
+
+    box.count = 21;
+    error = pksav_gen1_box_to_records(&box, records, &num_records);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_PARAM_OUT_OF_RANGE, error);
+}
+
+static void gen2_records_test()
+{
+    pksav_gen2_pokemon_party_t party;
+    pksav_pokemon_record_t records[6];
+    size_t num_records = 0;
+
+    memset(&party, 0, sizeof(party));
+    party.count = 2;
+    party.species[0] = 25;
+    party.species[1] = 0xFD;
+    party.species[2] = 0xFF;
+
+    // A shiny Pikachu, caught by a female trainer in Crystal
+    pksav_gen2_pc_pokemon_t* pikachu = &party.party[0].pc;
+    pikachu->species = 25;
+    pikachu->held_item = 0xAD;
+    pikachu->level = 50;
+    pikachu->friendship = 70;
+    pikachu->pokerus = 0x12;
+    pikachu->iv_data = pksav_bigendian16(0xFAAA);
+    pikachu->caught_data = pksav_bigendian16(PKSAV_GEN2_OT_GENDER_MASK);
+    memcpy(party.nicknames[0], gb_pikachu, sizeof(gb_pikachu));
+
+    // An egg
+    party.party[1].pc.species = 172;
+
+    pksav_error_t error = pksav_gen2_party_to_records(&party, records, &num_records);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL(2, num_records);
+
+    TEST_ASSERT_EQUAL(25, records[0].pokedex_num);
+    TEST_ASSERT_EQUAL(2, records[0].generation);
+    TEST_ASSERT_EQUAL(0xAD, records[0].held_item);
+    TEST_ASSERT_EQUAL(50, records[0].level);
+    TEST_ASSERT_EQUAL(70, records[0].friendship);
+    TEST_ASSERT_EQUAL(0x12, records[0].pokerus);
+    TEST_ASSERT_EQUAL(
+        (PKSAV_POKEMON_RECORD_IS_SHINY_MASK | PKSAV_POKEMON_RECORD_OT_FEMALE_MASK),
+        records[0].flags
+    );
+    TEST_ASSERT_EQUAL_STRING("PIKACHU", records[0].nickname);
+    TEST_ASSERT_EQUAL_STRING("", records[0].otname);
+
+    TEST_ASSERT_EQUAL(172, records[1].pokedex_num);
+    TEST_ASSERT_EQUAL(PKSAV_POKEMON_RECORD_IS_EGG_MASK, records[1].flags);
+}
+
+static void gba_records_test()
+{
+    pksav_gba_pokemon_party_t party;
+    pksav_pokemon_record_t records[6];
+    size_t num_records = 0;
+
+    memset(&party, 0, sizeof(party));
+    party.count = pksav_littleendian32(1);
+
+    // The personality and trainer ID make this Pokémon shiny.
+    pksav_gba_party_pokemon_t* pikachu = &party.party[0];
+    pikachu->pc.personality = pksav_littleendian32(0x12345678);
+    pikachu->pc.ot_id.pid = pksav_littleendian16(0x1234);
+    pikachu->pc.ot_id.sid = pksav_littleendian16(0x5678);
+    pikachu->pc.blocks.growth.species = pksav_littleendian16(25);
+    pikachu->pc.blocks.growth.exp = pksav_littleendian32(125000);
+    pikachu->pc.blocks.attacks.moves[3] = pksav_littleendian16(344);
+    pikachu->pc.blocks.effort.ev_spatk = 252;
+    pikachu->pc.blocks.misc.iv_egg_ability = pksav_littleendian32(
+                                                 (31U << 0) | (20U << 25) | PKSAV_GBA_ABILITY_MASK
+                                             );
+    pikachu->party_data.level = 50;
+    memcpy(pikachu->pc.nickname, gba_pikachu, sizeof(gba_pikachu));
+    memcpy(pikachu->pc.otname, gba_ash, sizeof(gba_ash));
+
+    pksav_error_t error = pksav_gba_party_to_records(&party, records, &num_records);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL(1, num_records);
+
+    const pksav_pokemon_record_t* record = &records[0];
+    TEST_ASSERT_EQUAL(25, record->pokedex_num);
+    TEST_ASSERT_EQUAL(3, record->generation);
+    TEST_ASSERT_EQUAL(50, record->level);
+    TEST_ASSERT_EQUAL(125000, record->exp);
+    TEST_ASSERT_EQUAL(344, record->moves[3]);
+    TEST_ASSERT_EQUAL(0x1234, record->ot_public_id);
+    TEST_ASSERT_EQUAL(0x5678, record->ot_secret_id);
+    TEST_ASSERT_EQUAL(252, record->EVs[4]);
+    TEST_ASSERT_EQUAL(31, record->IVs[0]);
+    TEST_ASSERT_EQUAL(20, record->IVs[5]);
+    TEST_ASSERT_EQUAL(0x12345678 % 25, record->nature);
+    TEST_ASSERT_EQUAL(PKSAV_POKEMON_RECORD_IS_SHINY_MASK, record->flags);
+    TEST_ASSERT_EQUAL_STRING("PIKACHU", record->nickname);
+    TEST_ASSERT_EQUAL_STRING("ASH", record->otname);
+
+    // Box conversion skips empty slots and has no level.
+    pksav_gba_pokemon_box_t box;
+    memset(&box, 0, sizeof(box));
+    box.entries[4] = pikachu->pc;
+
+    error = pksav_gba_box_to_records(&box, records, &num_records);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL(1, num_records);
+    TEST_ASSERT_EQUAL(25, records[0].pokedex_num);
+    TEST_ASSERT_EQUAL(0, records[0].level);
+}
+
+static void fill_nds_pokemon(
+    pksav_nds_pc_pokemon_t* pc_pokemon
+)
+{
+    memset(pc_pokemon, 0, sizeof(*pc_pokemon));
+    pc_pokemon->personality = pksav_littleendian32(0xDEADBEEF);
+    pc_pokemon->blocks.blockA.species = pksav_littleendian16(493);
+    pc_pokemon->blocks.blockA.ot_id.pid = pksav_littleendian16(54321);
+    pc_pokemon->blocks.blockA.ev_spd = 100;
+    pc_pokemon->blocks.blockB.iv_isegg_isnicknamed = pksav_littleendian32((15U << 15) | PKSAV_NDS_ISEGG_MASK);
+    pc_pokemon->blocks.blockB.nature = PKSAV_NATURE_TIMID;
+    pc_pokemon->blocks.blockD.metlevel_otgender = PKSAV_NDS_OTGENDER_MASK | 30;
+}
+
+static void nds_records_test()
+{
+    pksav_gen4_pokemon_box_t gen4_box;
+    pksav_gen5_pokemon_box_t gen5_box;
+    pksav_pokemon_record_t records[30];
+    size_t num_records = 0;
+
+    memset(&gen4_box, 0, sizeof(gen4_box));
+    fill_nds_pokemon(&gen4_box.entries[7]);
+    TEST_ASSERT_EQUAL(
+        PKSAV_ERROR_NONE,
+        pksav_text_to_gen4("ARCEUS", gen4_box.entries[7].blocks.blockC.nickname, 10)
+    );
+
+    memset(&gen5_box, 0, sizeof(gen5_box));
+    fill_nds_pokemon(&gen5_box.entries[29]);
+    TEST_ASSERT_EQUAL(
+        PKSAV_ERROR_NONE,
+        pksav_text_to_gen5("ARCEUS", gen5_box.entries[29].blocks.blockC.nickname, 10)
+    );
+
+    pksav_error_t error = pksav_gen4_box_to_records(&gen4_box, records, &num_records);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL(1, num_records);
+    TEST_ASSERT_EQUAL(493, records[0].pokedex_num);
+    TEST_ASSERT_EQUAL(4, records[0].generation);
+    TEST_ASSERT_EQUAL(54321, records[0].ot_public_id);
+    TEST_ASSERT_EQUAL(100, records[0].EVs[3]);
+    TEST_ASSERT_EQUAL(15, records[0].IVs[3]);
+    TEST_ASSERT_EQUAL(0xDEADBEEF % 25, records[0].nature);
+    TEST_ASSERT_EQUAL(
+        (PKSAV_POKEMON_RECORD_IS_EGG_MASK | PKSAV_POKEMON_RECORD_OT_FEMALE_MASK),
+        records[0].flags
+    );
+    TEST_ASSERT_EQUAL_STRING("ARCEUS", records[0].nickname);
+
+    // Generation V stores the nature separately.
+    error = pksav_gen5_box_to_records(&gen5_box, records, &num_records);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL(1, num_records);
+    TEST_ASSERT_EQUAL(5, records[0].generation);
+    TEST_ASSERT_EQUAL(PKSAV_NATURE_TIMID, records[0].nature);
+    TEST_ASSERT_EQUAL_STRING("ARCEUS", records[0].nickname);
+
+    pksav_gen5_pokemon_party_t gen5_party;
+    memset(&gen5_party, 0, sizeof(gen5_party));
+    gen5_party.count = pksav_littleendian32(7);
+    error = pksav_gen5_party_to_records(&gen5_party, records, &num_records);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_PARAM_OUT_OF_RANGE, error);
+
+    gen5_party.count = pksav_littleendian32(1);
+    gen5_party.party[0].pc = gen5_box.entries[29];
+    gen5_party.party[0].party_data.level = 100;
+    error = pksav_gen5_party_to_records(&gen5_party, records, &num_records);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL(1, num_records);
+    TEST_ASSERT_EQUAL(100, records[0].level);
+}
+
+PKSAV_TEST_MAIN(
+    PKSAV_TEST(pokemon_record_layout_test)
+    PKSAV_TEST(gen1_records_test)
+    PKSAV_TEST(gen2_records_test)
+    PKSAV_TEST(gba_records_test)
+    PKSAV_TEST(nds_records_test)
+)
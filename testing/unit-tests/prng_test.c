@@ -0,0 +1,344 @@
+/*
+ * Copyright (c) 2018 Nicholas Corgan (n.corgan@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "c_test_common.h"
+
+#include <pksav.h>
+
+#include <string.h>
+
+#define NUM_COMPARED_OUTPUTS 2000
+
+static uint32_t next(
+    pksav_mtrng_t* mtrng
+)
+{
+    uint32_t result = 0;
+    pksav_error_t error = pksav_mtrng_next(mtrng, &result);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+
+    return result;
+}
+
+// Compare outputs rather than states, since jumps may differ in unused bits.
+static void assert_same_outputs(
+    pksav_mtrng_t* mtrng1,
+    pksav_mtrng_t* mtrng2
+)
+{
+    for(size_t i = 0; i < NUM_COMPARED_OUTPUTS; ++i)
+    {
+        TEST_ASSERT_EQUAL_UINT32(next(mtrng1), next(mtrng2));
+    }
+}
+
+static void mtrng_reference_test()
+{
+    pksav_mtrng_t mtrng;
+    pksav_error_t error = pksav_mtrng_seed(&mtrng, 5489);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+
+    // Known values from the reference implementation
+    TEST_ASSERT_EQUAL_UINT32(3499211612U, next(&mtrng));
+    for(size_t i = 2; i < 10000; ++i)
+    {
+        (void)next(&mtrng);
+    }
+    TEST_ASSERT_EQUAL_UINT32(4123659995U, next(&mtrng));
+}
+
+static void mtrng_fill_test()
+{
+    static const size_t offsets[] = {0, 1, 623, 624, 1000};
+    static const size_t lengths[] = {0, 1, 623, 624, 625, 5000};
+
+    static uint32_t expected[5000];
+    static uint32_t actual[5000];
+
+    for(size_t offset_index = 0; offset_index < sizeof(offsets)/sizeof(offsets[0]); ++offset_index)
+    {
+        for(size_t length_index = 0; length_index < sizeof(lengths)/sizeof(lengths[0]); ++length_index)
+        {
+            size_t length = lengths[length_index];
+            pksav_mtrng_t mtrng1, mtrng2;
+            pksav_error_t error = pksav_mtrng_seed(&mtrng1, 12345);
+            TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+            mtrng2 = mtrng1;
+
+            for(size_t i = 0; i < offsets[offset_index]; ++i)
+            {
+                TEST_ASSERT_EQUAL_UINT32(next(&mtrng1), next(&mtrng2));
+            }
+
+            for(size_t i = 0; i < length; ++i)
+            {
+                expected[i] = next(&mtrng1);
+            }
+            error = pksav_mtrng_fill(&mtrng2, actual, length);
+            TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+            if(length > 0)
+            {
+                TEST_ASSERT_EQUAL_MEMORY(expected, actual, length * sizeof(uint32_t));
+            }
+
+            assert_same_outputs(&mtrng1, &mtrng2);
+        }
+    }
+}
+
+static void mtrng_jump_test()
+{
+    // Small jumps just step, but the last one goes through the polynomial.
+    static const uint64_t jump_lengths[] = {0, 1, 624, 100000, (1ULL << 20) + 12345};
+
+    for(size_t jump_index = 0; jump_index < sizeof(jump_lengths)/sizeof(jump_lengths[0]); ++jump_index)
+    {
+        pksav_mtrng_t stepped, jumped;
+        pksav_error_t error = pksav_mtrng_seed(&stepped, 5489);
+        TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+
+        // Start mid-block to make sure the index is handled.
+        for(size_t i = 0; i < 100; ++i)
+        {
+            (void)next(&stepped);
+        }
+        jumped = stepped;
+
+        for(uint64_t i = 0; i < jump_lengths[jump_index]; ++i)
+        {
+            (void)next(&stepped);
+        }
+        error = pksav_mtrng_jump(&jumped, jump_lengths[jump_index]);
+        TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+
+        assert_same_outputs(&stepped, &jumped);
+    }
+}
+
+static void mtrng_split_test()
+{
+    pksav_error_t error = PKSAV_ERROR_NONE;
+    pksav_mtrng_t base, stream0, stream3, jumped;
+
+    error = pksav_mtrng_seed(&base, 42);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+    (void)next(&base);
+
+    // Stream 0 is the base state.
+    error = pksav_mtrng_split(&base, 0, &stream0);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+    jumped = base;
+    assert_same_outputs(&stream0, &jumped);
+
+    // Splitting doesn't touch the base, and lines up with a plain jump.
+    pksav_mtrng_t base_copy = base;
+    error = pksav_mtrng_split(&base, 3, &stream3);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL_MEMORY(&base_copy, &base, sizeof(base));
+
+    jumped = base;
+    error = pksav_mtrng_jump(&jumped, 3ULL << 48);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+    assert_same_outputs(&stream3, &jumped);
+
+    // Jumps compose.
+    jumped = base;
+    error = pksav_mtrng_jump(&jumped, 1ULL << 48);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+    error = pksav_mtrng_jump(&jumped, 2ULL << 48);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+    error = pksav_mtrng_split(&base, 3, &stream3);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+    assert_same_outputs(&stream3, &jumped);
+}
+
+static void mtrng_populate_test()
+{
+    pksav_mtrng_t mtrng1, mtrng2;
+
+    // Populated at the same time, but they shouldn't match.
+    pksav_error_t error = pksav_mtrng_populate(&mtrng1);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+    error = pksav_mtrng_populate(&mtrng2);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+
+    bool all_equal = true;
+    for(size_t i = 0; i < 10; ++i)
+    {
+        if(next(&mtrng1) != next(&mtrng2))
+        {
+            all_equal = false;
+        }
+    }
+    TEST_ASSERT_FALSE(all_equal);
+}
+
+static void lcrng32_advance_test()
+{
+    pksav_error_t error = PKSAV_ERROR_NONE;
+    static const uint32_t seeds[] = {0, 1, 0x12345678, 0xFFFFFFFF};
+
+    for(size_t seed_index = 0; seed_index < sizeof(seeds)/sizeof(seeds[0]); ++seed_index)
+    {
+        uint32_t seed = seeds[seed_index];
+        uint32_t stepped = seed;
+        uint32_t result = 0;
+
+        for(uint64_t num_steps = 0; num_steps < 1000; ++num_steps)
+        {
+            error = pksav_lcrng32_advance(seed, num_steps, &result);
+            TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+            TEST_ASSERT_EQUAL_UINT32(stepped, result);
+
+            error = pksav_lcrng32_reverse(stepped, num_steps, &result);
+            TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+            TEST_ASSERT_EQUAL_UINT32(seed, result);
+
+            stepped = lcrng32_next(stepped);
+        }
+
+        // The LCRNG's period is 2^32.
+        error = pksav_lcrng32_advance(seed, (1ULL << 32), &result);
+        TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+        TEST_ASSERT_EQUAL_UINT32(seed, result);
+
+        error = pksav_lcrng32_advance(seed, 0x123456789ULL, &result);
+        TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+        error = pksav_lcrng32_reverse(result, 0x123456789ULL, &result);
+        TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+        TEST_ASSERT_EQUAL_UINT32(seed, result);
+    }
+}
+
+static void lcrng32_generate_test()
+{
+    pksav_lcrng32_spread_t spread;
+
+    // Seed 0 is what Ruby and Sapphire use once their clock battery dies.
+    pksav_error_t error = pksav_lcrng32_generate(0, PKSAV_LCRNG32_METHOD_1, &spread);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL_HEX32(0xE97E0000, spread.personality);
+
+    static const pksav_battle_stat_t stats[] =
+    {
+        PKSAV_STAT_HP, PKSAV_STAT_ATTACK, PKSAV_STAT_DEFENSE,
+        PKSAV_STAT_SPEED, PKSAV_STAT_SPATK, PKSAV_STAT_SPDEF
+    };
+    static const uint8_t expected_IVs[] = {17, 19, 20, 16, 13, 12};
+    for(size_t i = 0; i < sizeof(stats)/sizeof(stats[0]); ++i)
+    {
+        uint8_t IV = 0;
+        error = pksav_get_IV(&spread.iv_data, stats[i], &IV);
+        TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+        TEST_ASSERT_EQUAL(expected_IVs[i], IV);
+    }
+
+    error = pksav_lcrng32_generate(0, (pksav_lcrng32_method_t)3, &spread);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_PARAM_OUT_OF_RANGE, error);
+}
+
+static void lcrng32_find_seeds_test()
+{
+    static const pksav_lcrng32_method_t methods[] =
+    {
+        PKSAV_LCRNG32_METHOD_1, PKSAV_LCRNG32_METHOD_2, PKSAV_LCRNG32_METHOD_4
+    };
+    static const uint32_t seeds[] = {0, 0x5A0, 0xDEADBEEF};
+
+    for(size_t method_index = 0; method_index < sizeof(methods)/sizeof(methods[0]); ++method_index)
+    {
+        for(size_t seed_index = 0; seed_index < sizeof(seeds)/sizeof(seeds[0]); ++seed_index)
+        {
+            pksav_lcrng32_spread_t spread;
+            pksav_error_t error = pksav_lcrng32_generate(
+                                      seeds[seed_index],
+                                      methods[method_index],
+                                      &spread
+                                  );
+            TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+
+            // The egg and ability flags should be ignored.
+            spread.iv_data |= 0xC0000000;
+
+            uint32_t single_thread_seeds[16] = {0};
+            uint32_t multi_thread_seeds[16] = {0};
+            size_t num_single_thread_seeds = 0;
+            size_t num_multi_thread_seeds = 0;
+
+            error = pksav_lcrng32_find_seeds(
+                        &spread,
+                        methods[method_index],
+                        1,
+                        single_thread_seeds,
+                        16,
+                        &num_single_thread_seeds
+                    );
+            TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+            error = pksav_lcrng32_find_seeds(
+                        &spread,
+                        methods[method_index],
+                        7,
+                        multi_thread_seeds,
+                        16,
+                        &num_multi_thread_seeds
+                    );
+            TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+
+            TEST_ASSERT_TRUE(num_single_thread_seeds >= 1);
+            TEST_ASSERT_TRUE(num_single_thread_seeds <= 16);
+            TEST_ASSERT_EQUAL(num_single_thread_seeds, num_multi_thread_seeds);
+            TEST_ASSERT_EQUAL_MEMORY(
+                single_thread_seeds,
+                multi_thread_seeds,
+                num_single_thread_seeds * sizeof(uint32_t)
+            );
+
+            bool found = false;
+            for(size_t i = 0; i < num_single_thread_seeds; ++i)
+            {
+                pksav_lcrng32_spread_t found_spread;
+                error = pksav_lcrng32_generate(
+                            single_thread_seeds[i],
+                            methods[method_index],
+                            &found_spread
+                        );
+                TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+                TEST_ASSERT_EQUAL_HEX32(spread.personality, found_spread.personality);
+                TEST_ASSERT_EQUAL_HEX32(spread.iv_data & 0x3FFFFFFF, found_spread.iv_data);
+
+                if(single_thread_seeds[i] == seeds[seed_index])
+                {
+                    found = true;
+                }
+            }
+            TEST_ASSERT_TRUE(found);
+
+            // Asking for fewer seeds still reports the total.
+            error = pksav_lcrng32_find_seeds(
+                        &spread,
+                        methods[method_index],
+                        2,
+                        multi_thread_seeds,
+                        0,
+                        &num_multi_thread_seeds
+                    );
+            TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+            TEST_ASSERT_EQUAL(num_single_thread_seeds, num_multi_thread_seeds);
+        }
+    }
+}
+
+PKSAV_TEST_MAIN(
+    PKSAV_TEST(mtrng_reference_test)
+    PKSAV_TEST(mtrng_fill_test)
+    PKSAV_TEST(mtrng_jump_test)
+    PKSAV_TEST(mtrng_split_test)
+    PKSAV_TEST(mtrng_populate_test)
+    PKSAV_TEST(lcrng32_advance_test)
+    PKSAV_TEST(lcrng32_generate_test)
+    PKSAV_TEST(lcrng32_find_seeds_test)
+)
@@ -0,0 +1,472 @@
+/*
+ * Copyright (c) 2018 Nicholas Corgan (n.corgan@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "c_test_common.h"
+#include "test-utils.h"
+
+#include <pksav.h>
+
+#include <string.h>
+
+// Not a multiple of the chunk size, to exercise the partial chunk path
+#define NUM_POKEMON 150
+
+static const pksav_battle_stat_t stats[] =
+{
+    PKSAV_STAT_HP,
+    PKSAV_STAT_ATTACK,
+    PKSAV_STAT_DEFENSE,
+    PKSAV_STAT_SPEED,
+    PKSAV_STAT_SPATK,
+    PKSAV_STAT_SPDEF
+};
+#define NUM_STATS (sizeof(stats)/sizeof(stats[0]))
+
+static uint8_t IV_buffers[NUM_STATS][NUM_POKEMON];
+
+static pksav_stat_columns_t get_columns()
+{
+    pksav_stat_columns_t columns =
+    {
+        IV_buffers[0], IV_buffers[1], IV_buffers[2],
+        IV_buffers[3], IV_buffers[4], IV_buffers[5]
+    };
+    memset(IV_buffers, 0xFF, sizeof(IV_buffers));
+
+    return columns;
+}
+
+static void gb_IVs_bulk_test()
+{
+    static pksav_gen1_pc_pokemon_t pokemon[NUM_POKEMON];
+    (void)randomize_buffer((uint8_t*)pokemon, sizeof(pokemon));
+
+    pksav_stat_columns_t columns = get_columns();
+    pksav_error_t error = pksav_get_gb_IVs_bulk(
+                              &pokemon[0].iv_data,
+                              sizeof(pokemon[0]),
+                              NUM_POKEMON,
+                              &columns
+                          );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+
+    for(size_t i = 0; i < NUM_POKEMON; ++i)
+    {
+        for(size_t stat = 0; stat < NUM_STATS; ++stat)
+        {
+            uint8_t IV = 0;
+            error = pksav_get_gb_IV(&pokemon[i].iv_data, stats[stat], &IV);
+            TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+            TEST_ASSERT_EQUAL(IV, IV_buffers[stat][i]);
+        }
+    }
+
+    // The HP IV is made of the other IVs' lowest bits.
+    uint16_t iv_data = 0;
+    uint8_t IV = 0;
+    error = pksav_set_gb_IV(&iv_data, PKSAV_STAT_ATTACK, 9);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+    error = pksav_set_gb_IV(&iv_data, PKSAV_STAT_SPECIAL, 3);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+    error = pksav_get_gb_IV(&iv_data, PKSAV_STAT_HP, &IV);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL(9, IV);
+}
+
+static void IVs_bulk_test()
+{
+    static pksav_gba_pokemon_misc_t misc[NUM_POKEMON];
+    (void)randomize_buffer((uint8_t*)misc, sizeof(misc));
+
+    pksav_stat_columns_t columns = get_columns();
+
+    // Skipped columns shouldn't be touched.
+    columns.defense = NULL;
+
+    pksav_error_t error = pksav_get_IVs_bulk(
+                              &misc[0].iv_egg_ability,
+                              sizeof(misc[0]),
+                              NUM_POKEMON,
+                              &columns
+                          );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+
+    for(size_t i = 0; i < NUM_POKEMON; ++i)
+    {
+        for(size_t stat = 0; stat < NUM_STATS; ++stat)
+        {
+            if(stats[stat] == PKSAV_STAT_DEFENSE)
+            {
+                TEST_ASSERT_EQUAL(0xFF, IV_buffers[stat][i]);
+            }
+            else
+            {
+                uint8_t IV = 0;
+                error = pksav_get_IV(&misc[i].iv_egg_ability, stats[stat], &IV);
+                TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+                TEST_ASSERT_EQUAL(IV, IV_buffers[stat][i]);
+            }
+        }
+    }
+}
+
+static void gb_EVs_bulk_test()
+{
+    static pksav_gen1_pc_pokemon_t pokemon[NUM_POKEMON];
+    (void)randomize_buffer((uint8_t*)pokemon, sizeof(pokemon));
+
+    static uint16_t EV_buffers[5][NUM_POKEMON];
+    pksav_gb_EV_columns_t columns =
+    {
+        EV_buffers[0], EV_buffers[1], EV_buffers[2], EV_buffers[3], EV_buffers[4]
+    };
+
+    pksav_error_t error = pksav_get_gb_EVs_bulk(
+                              &pokemon[0].ev_hp,
+                              sizeof(pokemon[0]),
+                              NUM_POKEMON,
+                              &columns
+                          );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+
+    for(size_t i = 0; i < NUM_POKEMON; ++i)
+    {
+        TEST_ASSERT_EQUAL(pksav_bigendian16(pokemon[i].ev_hp),   EV_buffers[0][i]);
+        TEST_ASSERT_EQUAL(pksav_bigendian16(pokemon[i].ev_atk),  EV_buffers[1][i]);
+        TEST_ASSERT_EQUAL(pksav_bigendian16(pokemon[i].ev_def),  EV_buffers[2][i]);
+        TEST_ASSERT_EQUAL(pksav_bigendian16(pokemon[i].ev_spd),  EV_buffers[3][i]);
+        TEST_ASSERT_EQUAL(pksav_bigendian16(pokemon[i].ev_spcl), EV_buffers[4][i]);
+    }
+}
+
+static void EVs_bulk_test()
+{
+    static pksav_gba_pokemon_effort_t effort[NUM_POKEMON];
+    (void)randomize_buffer((uint8_t*)effort, sizeof(effort));
+
+    pksav_stat_columns_t columns = get_columns();
+    pksav_error_t error = pksav_get_EVs_bulk(
+                              &effort[0].ev_hp,
+                              sizeof(effort[0]),
+                              NUM_POKEMON,
+                              &columns
+                          );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+
+    for(size_t i = 0; i < NUM_POKEMON; ++i)
+    {
+        TEST_ASSERT_EQUAL(effort[i].ev_hp,    IV_buffers[0][i]);
+        TEST_ASSERT_EQUAL(effort[i].ev_atk,   IV_buffers[1][i]);
+        TEST_ASSERT_EQUAL(effort[i].ev_def,   IV_buffers[2][i]);
+        TEST_ASSERT_EQUAL(effort[i].ev_spd,   IV_buffers[3][i]);
+        TEST_ASSERT_EQUAL(effort[i].ev_spatk, IV_buffers[4][i]);
+        TEST_ASSERT_EQUAL(effort[i].ev_spdef, IV_buffers[5][i]);
+    }
+}
+
+static void species_conversion_test()
+{
+    uint16_t pokedex_num = 0;
+    pksav_error_t error = PKSAV_ERROR_NONE;
+
+    // Pikachu, Mewtwo, and Rhydon
+    error = pksav_gen1_species_to_pokedex_num(0x54, &pokedex_num);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL(25, pokedex_num);
+    error = pksav_gen1_species_to_pokedex_num(0x83, &pokedex_num);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL(150, pokedex_num);
+    error = pksav_gen1_species_to_pokedex_num(0x01, &pokedex_num);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL(112, pokedex_num);
+
+    // MissingNo.
+    error = pksav_gen1_species_to_pokedex_num(0x1F, &pokedex_num);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_PARAM_OUT_OF_RANGE, error);
+    error = pksav_gen1_species_to_pokedex_num(0xFF, &pokedex_num);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_PARAM_OUT_OF_RANGE, error);
+
+    // Celebi, Treecko, and Chimecho
+    error = pksav_gba_species_to_pokedex_num(251, &pokedex_num);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL(251, pokedex_num);
+    error = pksav_gba_species_to_pokedex_num(277, &pokedex_num);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL(252, pokedex_num);
+    error = pksav_gba_species_to_pokedex_num(411, &pokedex_num);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL(358, pokedex_num);
+
+    // Unused indices
+    error = pksav_gba_species_to_pokedex_num(0, &pokedex_num);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_PARAM_OUT_OF_RANGE, error);
+    error = pksav_gba_species_to_pokedex_num(252, &pokedex_num);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_PARAM_OUT_OF_RANGE, error);
+    error = pksav_gba_species_to_pokedex_num(412, &pokedex_num);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_PARAM_OUT_OF_RANGE, error);
+}
+
+static void base_stats_test()
+{
+    pksav_base_stats_t base_stats;
+    pksav_error_t error = PKSAV_ERROR_NONE;
+
+    // Alakazam's Special was split into 135/95 in Generation II.
+    error = pksav_get_gen1_base_stats(65, &base_stats);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL(135, base_stats.spatk);
+    TEST_ASSERT_EQUAL(135, base_stats.spdef);
+
+    error = pksav_get_base_stats(65, &base_stats);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL(55, base_stats.hp);
+    TEST_ASSERT_EQUAL(50, base_stats.attack);
+    TEST_ASSERT_EQUAL(45, base_stats.defense);
+    TEST_ASSERT_EQUAL(120, base_stats.speed);
+    TEST_ASSERT_EQUAL(135, base_stats.spatk);
+    TEST_ASSERT_EQUAL(85, base_stats.spdef);
+
+    error = pksav_get_gen1_base_stats(152, &base_stats);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_PARAM_OUT_OF_RANGE, error);
+    error = pksav_get_base_stats(0, &base_stats);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_PARAM_OUT_OF_RANGE, error);
+    error = pksav_get_base_stats(387, &base_stats);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_PARAM_OUT_OF_RANGE, error);
+
+    pksav_battle_stat_t increased = PKSAV_STAT_NONE;
+    pksav_battle_stat_t decreased = PKSAV_STAT_NONE;
+
+    error = pksav_get_nature_stat_modifiers(PKSAV_NATURE_ADAMANT, &increased, &decreased);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL(PKSAV_STAT_ATTACK, increased);
+    TEST_ASSERT_EQUAL(PKSAV_STAT_SPATK, decreased);
+
+    error = pksav_get_nature_stat_modifiers(PKSAV_NATURE_TIMID, &increased, &decreased);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL(PKSAV_STAT_SPEED, increased);
+    TEST_ASSERT_EQUAL(PKSAV_STAT_ATTACK, decreased);
+
+    error = pksav_get_nature_stat_modifiers(PKSAV_NATURE_QUIRKY, &increased, &decreased);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL(PKSAV_STAT_NONE, increased);
+    TEST_ASSERT_EQUAL(PKSAV_STAT_NONE, decreased);
+
+    error = pksav_get_nature_stat_modifiers((pksav_nature_t)25, &increased, &decreased);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_PARAM_OUT_OF_RANGE, error);
+}
+
+static void calc_gb_stats_test()
+{
+    pksav_base_stats_t base_stats;
+    pksav_battle_stats_t battle_stats;
+
+    // Mewtwo, level 100, perfect DVs and stat experience
+    pksav_error_t error = pksav_get_gen1_base_stats(150, &base_stats);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+
+    const uint16_t max_EVs[5] = {65535, 65535, 65535, 65535, 65535};
+    error = pksav_calc_gb_stats(&base_stats, 100, 0xFFFF, max_EVs, &battle_stats);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL(415, battle_stats.hp);
+    TEST_ASSERT_EQUAL(318, battle_stats.attack);
+    TEST_ASSERT_EQUAL(278, battle_stats.defense);
+    TEST_ASSERT_EQUAL(358, battle_stats.speed);
+    TEST_ASSERT_EQUAL(406, battle_stats.spatk);
+    TEST_ASSERT_EQUAL(406, battle_stats.spdef);
+
+    // Pikachu, level 50, perfect DVs and no stat experience
+    error = pksav_get_gen1_base_stats(25, &base_stats);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+
+    const uint16_t no_EVs[5] = {0, 0, 0, 0, 0};
+    error = pksav_calc_gb_stats(&base_stats, 50, 0xFFFF, no_EVs, &battle_stats);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL(110, battle_stats.hp);
+    TEST_ASSERT_EQUAL(75, battle_stats.attack);
+
+    error = pksav_calc_gb_stats(&base_stats, 0, 0xFFFF, no_EVs, &battle_stats);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_PARAM_OUT_OF_RANGE, error);
+    error = pksav_calc_gb_stats(&base_stats, 101, 0xFFFF, no_EVs, &battle_stats);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_PARAM_OUT_OF_RANGE, error);
+}
+
+static void calc_stats_test()
+{
+    /*
+     * A level 78 Adamant Garchomp, whose stats are widely published.
+     * Base stats are given directly, as it's not in the tables.
+     */
+    const pksav_base_stats_t garchomp_base_stats = {108, 130, 95, 102, 80, 85};
+    const uint8_t EVs[6] = {74, 190, 91, 23, 48, 84};
+
+    uint32_t iv_data = 0;
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, pksav_set_IV(&iv_data, PKSAV_STAT_HP, 24));
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, pksav_set_IV(&iv_data, PKSAV_STAT_ATTACK, 12));
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, pksav_set_IV(&iv_data, PKSAV_STAT_DEFENSE, 30));
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, pksav_set_IV(&iv_data, PKSAV_STAT_SPEED, 5));
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, pksav_set_IV(&iv_data, PKSAV_STAT_SPATK, 16));
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, pksav_set_IV(&iv_data, PKSAV_STAT_SPDEF, 23));
+
+    pksav_battle_stats_t battle_stats;
+    pksav_error_t error = pksav_calc_stats(
+                              &garchomp_base_stats,
+                              78,
+                              iv_data,
+                              EVs,
+                              PKSAV_NATURE_ADAMANT,
+                              &battle_stats
+                          );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL(289, battle_stats.hp);
+    TEST_ASSERT_EQUAL(278, battle_stats.attack);
+    TEST_ASSERT_EQUAL(193, battle_stats.defense);
+    TEST_ASSERT_EQUAL(171, battle_stats.speed);
+    TEST_ASSERT_EQUAL(135, battle_stats.spatk);
+    TEST_ASSERT_EQUAL(171, battle_stats.spdef);
+
+    // Shedinja always has 1 HP.
+    pksav_base_stats_t base_stats;
+    error = pksav_get_base_stats(292, &base_stats);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+    error = pksav_calc_stats(&base_stats, 100, 0x3FFFFFFF, EVs, PKSAV_NATURE_HARDY, &battle_stats);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL(1, battle_stats.hp);
+
+    error = pksav_calc_stats(&base_stats, 0, iv_data, EVs, PKSAV_NATURE_HARDY, &battle_stats);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_PARAM_OUT_OF_RANGE, error);
+    error = pksav_calc_stats(&base_stats, 50, iv_data, EVs, (pksav_nature_t)25, &battle_stats);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_PARAM_OUT_OF_RANGE, error);
+}
+
+static void gen1_party_stats_test()
+{
+    pksav_gen1_pokemon_party_t party;
+    memset(&party, 0, sizeof(party));
+
+    party.count = 2;
+    party.party[0].pc.species = 0x54; // Pikachu
+    party.party[0].pc.iv_data = 0xFFFF;
+    party.party[0].party_data.level = 50;
+    party.party[1].pc.species = 0x83; // Mewtwo
+    party.party[1].pc.iv_data = 0xFFFF;
+    party.party[1].pc.ev_hp   = 0xFFFF;
+    party.party[1].pc.ev_spcl = 0xFFFF;
+    party.party[1].party_data.level = 100;
+
+    uint8_t mismatches = 0;
+    pksav_error_t error = pksav_gen1_party_verify_stats(&party, &mismatches);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL(0x3, mismatches);
+
+    error = pksav_gen1_party_update_stats(&party);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL(110, pksav_bigendian16(party.party[0].party_data.max_hp));
+    TEST_ASSERT_EQUAL(75, pksav_bigendian16(party.party[0].party_data.atk));
+    TEST_ASSERT_EQUAL(415, pksav_bigendian16(party.party[1].party_data.max_hp));
+    TEST_ASSERT_EQUAL(406, pksav_bigendian16(party.party[1].party_data.spcl));
+
+    error = pksav_gen1_party_verify_stats(&party, &mismatches);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL(0, mismatches);
+
+    party.party[1].party_data.def = pksav_bigendian16(999);
+    error = pksav_gen1_party_verify_stats(&party, &mismatches);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL(0x2, mismatches);
+
+    // An invalid species leaves the whole party untouched.
+    party.party[0].pc.species = 0x1F;
+    error = pksav_gen1_party_update_stats(&party);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_PARAM_OUT_OF_RANGE, error);
+    TEST_ASSERT_EQUAL(999, pksav_bigendian16(party.party[1].party_data.def));
+}
+
+static void gen2_box_stats_test()
+{
+    pksav_gen2_pokemon_box_t box;
+    memset(&box, 0, sizeof(box));
+
+    box.count = 2;
+    box.entries[0].species = 25; // Pikachu
+    box.entries[0].iv_data = 0xFFFF;
+    box.entries[0].level = 50;
+    // Empty entry
+
+    pksav_battle_stats_t battle_stats[20];
+    memset(battle_stats, 0xFF, sizeof(battle_stats));
+
+    pksav_error_t error = pksav_gen2_box_calc_stats(&box, battle_stats);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL(110, battle_stats[0].hp);
+    TEST_ASSERT_EQUAL(75, battle_stats[0].attack);
+    TEST_ASSERT_EQUAL(60, battle_stats[0].spdef);
+    TEST_ASSERT_EQUAL(0, battle_stats[1].hp);
+    TEST_ASSERT_EQUAL(0xFFFF, battle_stats[2].hp);
+
+    box.entries[1].species = 252;
+    error = pksav_gen2_box_calc_stats(&box, battle_stats);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_PARAM_OUT_OF_RANGE, error);
+}
+
+static void gba_party_stats_test()
+{
+    pksav_gba_pokemon_party_t party;
+    memset(&party, 0, sizeof(party));
+
+    // An Adamant Pikachu with perfect IVs
+    party.count = pksav_littleendian32(1);
+    party.party[0].pc.personality = pksav_littleendian32(PKSAV_NATURE_ADAMANT);
+    party.party[0].pc.blocks.growth.species = pksav_littleendian16(25);
+    party.party[0].pc.blocks.misc.iv_egg_ability = pksav_littleendian32(0x3FFFFFFF);
+    party.party[0].party_data.level = 50;
+
+    pksav_error_t error = pksav_gba_party_update_stats(&party);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL(110, pksav_littleendian16(party.party[0].party_data.max_hp));
+    TEST_ASSERT_EQUAL(82, pksav_littleendian16(party.party[0].party_data.atk));
+    TEST_ASSERT_EQUAL(63, pksav_littleendian16(party.party[0].party_data.spatk));
+
+    uint8_t mismatches = 0xFF;
+    error = pksav_gba_party_verify_stats(&party, &mismatches);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL(0, mismatches);
+
+    // The egg and ability bits don't affect stats.
+    party.party[0].pc.blocks.misc.iv_egg_ability = pksav_littleendian32(0xFFFFFFFF);
+    party.party[0].party_data.spdef = 0;
+    error = pksav_gba_party_verify_stats(&party, &mismatches);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL(0x1, mismatches);
+
+    pksav_gba_pokemon_box_t box;
+    memset(&box, 0, sizeof(box));
+    box.entries[5] = party.party[0].pc;
+
+    uint8_t levels[30] = {0};
+    levels[5] = 50;
+
+    pksav_battle_stats_t battle_stats[30];
+    error = pksav_gba_box_calc_stats(&box, levels, battle_stats);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL(0, battle_stats[0].hp);
+    TEST_ASSERT_EQUAL(110, battle_stats[5].hp);
+    TEST_ASSERT_EQUAL(82, battle_stats[5].attack);
+}
+
+PKSAV_TEST_MAIN(
+    PKSAV_TEST(gb_IVs_bulk_test)
+    PKSAV_TEST(IVs_bulk_test)
+    PKSAV_TEST(gb_EVs_bulk_test)
+    PKSAV_TEST(EVs_bulk_test)
+    PKSAV_TEST(species_conversion_test)
+    PKSAV_TEST(base_stats_test)
+    PKSAV_TEST(calc_gb_stats_test)
+    PKSAV_TEST(calc_stats_test)
+    PKSAV_TEST(gen1_party_stats_test)
+    PKSAV_TEST(gen2_box_stats_test)
+    PKSAV_TEST(gba_party_stats_test)
+)
@@ -0,0 +1,229 @@
+/*
+ * Copyright (c) 2018 Nicholas Corgan (n.corgan@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "c_test_common.h"
+
+#include <pksav.h>
+
+#include <string.h>
+
+#define GB_SAVE_SIZE     0x8000
+#define GB_RTC_SAVE_SIZE 0x8010
+#define GBA_SAVE_SIZE    0x20000
+
+static size_t get_num_chunks(
+    const pksav_store_t* store
+)
+{
+    size_t num_chunks = 0;
+    size_t num_bytes = 0;
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, pksav_store_get_stats(store, &num_chunks, &num_bytes));
+
+    return num_chunks;
+}
+
+static void check_rebuilt_save(
+    const pksav_store_t* store,
+    const pksav_store_manifest_t* manifest,
+    const uint8_t* expected,
+    size_t expected_len
+)
+{
+    uint8_t* buffer = calloc(expected_len, 1);
+    TEST_ASSERT_NOT_NULL(buffer);
+
+    TEST_ASSERT_EQUAL(expected_len, manifest->save_len);
+    TEST_ASSERT_EQUAL(
+        PKSAV_ERROR_PARAM_OUT_OF_RANGE,
+        pksav_store_rebuild_save(store, manifest, buffer, expected_len-1)
+    );
+    TEST_ASSERT_EQUAL(
+        PKSAV_ERROR_NONE,
+        pksav_store_rebuild_save(store, manifest, buffer, expected_len)
+    );
+    TEST_ASSERT_EQUAL_MEMORY(expected, buffer, expected_len);
+
+    free(buffer);
+}
+
+static void gb_save_store_test()
+{
+    uint8_t* buffer = calloc(GB_RTC_SAVE_SIZE, 1);
+    TEST_ASSERT_NOT_NULL(buffer);
+    TEST_ASSERT_EQUAL(
+        PKSAV_ERROR_NONE,
+        pksav_corpus_generate_save(PKSAV_CORPUS_CRYSTAL, 49, buffer, GB_SAVE_SIZE, NULL)
+    );
+
+    pksav_store_t store;
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, pksav_store_init(&store));
+
+    // One chunk per bank
+    pksav_store_manifest_t manifest1;
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, pksav_store_add_save(&store, buffer, GB_SAVE_SIZE, &manifest1));
+    TEST_ASSERT_EQUAL(4, manifest1.num_chunks);
+    size_t num_chunks = get_num_chunks(&store);
+    TEST_ASSERT_TRUE(num_chunks <= 4);
+
+    // Adding the same save again adds nothing.
+    pksav_store_manifest_t manifest2;
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, pksav_store_add_save(&store, buffer, GB_SAVE_SIZE, &manifest2));
+    TEST_ASSERT_EQUAL(num_chunks, get_num_chunks(&store));
+    TEST_ASSERT_EQUAL_MEMORY(manifest1.chunk_ids, manifest2.chunk_ids, 4 * sizeof(uint32_t));
+    pksav_store_manifest_free(&manifest2);
+
+    // Changing one bank only adds that bank, and the clock data is its own chunk.
+    buffer[0x2345] ^= 0xFF;
+    memset(&buffer[GB_SAVE_SIZE], 0xAB, GB_RTC_SAVE_SIZE - GB_SAVE_SIZE);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, pksav_store_add_save(&store, buffer, GB_RTC_SAVE_SIZE, &manifest2));
+    TEST_ASSERT_EQUAL(5, manifest2.num_chunks);
+    TEST_ASSERT_EQUAL(num_chunks + 2, get_num_chunks(&store));
+    TEST_ASSERT_EQUAL(manifest1.chunk_ids[0], manifest2.chunk_ids[0]);
+    TEST_ASSERT_TRUE(manifest1.chunk_ids[1] != manifest2.chunk_ids[1]);
+
+    const uint8_t* chunk = NULL;
+    size_t chunk_len = 0;
+    uint64_t hash = 0;
+    TEST_ASSERT_EQUAL(
+        PKSAV_ERROR_NONE,
+        pksav_store_get_chunk(&store, manifest2.chunk_ids[4], &chunk, &chunk_len, &hash)
+    );
+    TEST_ASSERT_EQUAL(GB_RTC_SAVE_SIZE - GB_SAVE_SIZE, chunk_len);
+    TEST_ASSERT_EQUAL_MEMORY(&buffer[GB_SAVE_SIZE], chunk, chunk_len);
+    TEST_ASSERT_EQUAL(
+        PKSAV_ERROR_PARAM_OUT_OF_RANGE,
+        pksav_store_get_chunk(&store, (uint32_t)get_num_chunks(&store), &chunk, &chunk_len, &hash)
+    );
+
+    check_rebuilt_save(&store, &manifest2, buffer, GB_RTC_SAVE_SIZE);
+    buffer[0x2345] ^= 0xFF;
+    check_rebuilt_save(&store, &manifest1, buffer, GB_SAVE_SIZE);
+
+    // Manifests that don't match the store are rejected.
+    manifest2.chunk_ids[2] = (uint32_t)get_num_chunks(&store);
+    TEST_ASSERT_EQUAL(
+        PKSAV_ERROR_PARAM_OUT_OF_RANGE,
+        pksav_store_rebuild_save(&store, &manifest2, buffer, GB_RTC_SAVE_SIZE)
+    );
+    manifest2.chunk_ids[2] = manifest2.chunk_ids[4];
+    TEST_ASSERT_EQUAL(
+        PKSAV_ERROR_PARAM_OUT_OF_RANGE,
+        pksav_store_rebuild_save(&store, &manifest2, buffer, GB_RTC_SAVE_SIZE)
+    );
+
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, pksav_store_manifest_free(&manifest2));
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, pksav_store_manifest_free(&manifest1));
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, pksav_store_free(&store));
+    free(buffer);
+}
+
+static void gba_save_store_test()
+{
+    uint8_t* original = calloc(GBA_SAVE_SIZE, 1);
+    uint8_t* buffer = calloc(GBA_SAVE_SIZE, 1);
+    TEST_ASSERT_NOT_NULL(original);
+    TEST_ASSERT_NOT_NULL(buffer);
+    TEST_ASSERT_EQUAL(
+        PKSAV_ERROR_NONE,
+        pksav_corpus_generate_save(PKSAV_CORPUS_EMERALD, 49, original, GBA_SAVE_SIZE, NULL)
+    );
+    memcpy(buffer, original, GBA_SAVE_SIZE);
+
+    pksav_store_t store;
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, pksav_store_init(&store));
+
+    // Each sector's data and footer
+    pksav_store_manifest_t manifest1;
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, pksav_store_add_save(&store, original, GBA_SAVE_SIZE, &manifest1));
+    TEST_ASSERT_EQUAL(2 * (GBA_SAVE_SIZE / 0x1000), manifest1.num_chunks);
+    size_t num_chunks = get_num_chunks(&store);
+
+    // Save a small change, which writes a whole new slot.
+    pksav_gba_save_t gba_save;
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, pksav_gba_save_load_buffer(buffer, GBA_SAVE_SIZE, &gba_save));
+    *gba_save.money = pksav_littleendian32(pksav_littleendian32(*gba_save.money) + 1);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, pksav_gba_save_save_buffer(buffer, GBA_SAVE_SIZE, &gba_save));
+    pksav_gba_save_free(&gba_save);
+
+    /*
+     * The new slot's sections mostly match the other slot's, so it's mostly
+     * footers and the changed section that are new.
+     */
+    pksav_store_manifest_t manifest2;
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, pksav_store_add_save(&store, buffer, GBA_SAVE_SIZE, &manifest2));
+    size_t num_new_chunks = get_num_chunks(&store) - num_chunks;
+    TEST_ASSERT_TRUE(num_new_chunks > 0);
+    TEST_ASSERT_TRUE(num_new_chunks <= 16);
+
+    check_rebuilt_save(&store, &manifest1, original, GBA_SAVE_SIZE);
+    check_rebuilt_save(&store, &manifest2, buffer, GBA_SAVE_SIZE);
+
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, pksav_store_manifest_free(&manifest2));
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, pksav_store_manifest_free(&manifest1));
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, pksav_store_free(&store));
+    free(buffer);
+    free(original);
+}
+
+// Every bank of every save is different.
+static void fill_gb_save(
+    uint8_t* buffer,
+    size_t save_num
+)
+{
+    for(size_t i = 0; i < GB_SAVE_SIZE; ++i)
+    {
+        buffer[i] = (uint8_t)(i * 7);
+    }
+    for(size_t bank = 0; bank < (GB_SAVE_SIZE / 0x2000); ++bank)
+    {
+        uint32_t bank_id = (uint32_t)((save_num * 4) + bank);
+        memcpy(&buffer[bank * 0x2000], &bank_id, sizeof(bank_id));
+    }
+}
+
+static void many_saves_store_test()
+{
+    static const size_t num_saves = 512;
+
+    uint8_t* buffer = calloc(GB_SAVE_SIZE, 1);
+    TEST_ASSERT_NOT_NULL(buffer);
+
+    pksav_store_t store;
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, pksav_store_init(&store));
+
+    pksav_store_manifest_t* manifests = calloc(num_saves, sizeof(pksav_store_manifest_t));
+    TEST_ASSERT_NOT_NULL(manifests);
+
+    // Enough distinct chunks for the store to grow a few times
+    for(size_t i = 0; i < num_saves; ++i)
+    {
+        fill_gb_save(buffer, i);
+        TEST_ASSERT_EQUAL(
+            PKSAV_ERROR_NONE,
+            pksav_store_add_save(&store, buffer, GB_SAVE_SIZE, &manifests[i])
+        );
+    }
+    TEST_ASSERT_EQUAL(num_saves * 4, get_num_chunks(&store));
+
+    for(size_t i = 0; i < num_saves; ++i)
+    {
+        fill_gb_save(buffer, i);
+        check_rebuilt_save(&store, &manifests[i], buffer, GB_SAVE_SIZE);
+        pksav_store_manifest_free(&manifests[i]);
+    }
+
+    free(manifests);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, pksav_store_free(&store));
+    free(buffer);
+}
+
+PKSAV_TEST_MAIN(
+    PKSAV_TEST(gb_save_store_test)
+    PKSAV_TEST(gba_save_store_test)
+    PKSAV_TEST(many_saves_store_test)
+)
@@ -9,6 +9,8 @@
 
 #include <pksav.h>
 
+#include <string.h>
+
 #define BUFFER_LEN 256
 
 // Ugly strings to test
@@ -19,6 +21,15 @@ static const char* strings[] = {
     NULL
 };
 
+// Strings only representable in later generations
+static const char* nds_strings[] = {
+    "Nidoran♀",
+    "Flabébé",
+    "ピカチュウ",
+    "ヒトカゲ",
+    NULL
+};
+
 static void pksav_gen1_text_test() {
     pksav_error_t error = PKSAV_ERROR_NONE;
     uint8_t gen1_buffer[BUFFER_LEN] = {0};
@@ -91,8 +102,213 @@ static void pksav_gba_text_test() {
     }
 }
 
+
+static void pksav_gen4_text_test() {
+    pksav_error_t error = PKSAV_ERROR_NONE;
+    uint16_t gen4_buffer[BUFFER_LEN] = {0};
+    char strbuffer[BUFFER_LEN] = {0};
+
+    for(size_t i = 0; nds_strings[i] != NULL; ++i) {
+        error = pksav_text_to_gen4(
+                    nds_strings[i],
+                    gen4_buffer,
+                    BUFFER_LEN
+                );
+        TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+
+        error = pksav_text_from_gen4(
+                    gen4_buffer,
+                    strbuffer,
+                    BUFFER_LEN
+                );
+        TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+
+        TEST_ASSERT_EQUAL_STRING(nds_strings[i], strbuffer);
+    }
+}
+
+static void pksav_gen5_text_test() {
+    pksav_error_t error = PKSAV_ERROR_NONE;
+    uint16_t gen5_buffer[BUFFER_LEN] = {0};
+    char strbuffer[BUFFER_LEN] = {0};
+
+    for(size_t i = 0; nds_strings[i] != NULL; ++i) {
+        error = pksav_text_to_gen5(
+                    nds_strings[i],
+                    gen5_buffer,
+                    BUFFER_LEN
+                );
+        TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+
+        error = pksav_text_from_gen5(
+                    gen5_buffer,
+                    strbuffer,
+                    BUFFER_LEN
+                );
+        TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+
+        TEST_ASSERT_EQUAL_STRING(nds_strings[i], strbuffer);
+    }
+}
+
+static void pksav_nds_utf8_truncation_test() {
+    pksav_error_t error = PKSAV_ERROR_NONE;
+    uint16_t gen4_buffer[BUFFER_LEN] = {0};
+    uint16_t gen5_buffer[BUFFER_LEN] = {0};
+    char strbuffer[BUFFER_LEN] = {0};
+    size_t num_bytes = 0;
+
+    // "ピカチュウ" is three bytes per character in UTF-8.
+    error = pksav_text_to_gen4("ピカチュウ", gen4_buffer, BUFFER_LEN);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+    error = pksav_text_to_gen5("ピカチュウ", gen5_buffer, BUFFER_LEN);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+
+    // Only two characters fit, and the third must not be split.
+    error = pksav_text_from_gen4_utf8(gen4_buffer, BUFFER_LEN, strbuffer, 8, &num_bytes);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL(6, num_bytes);
+    TEST_ASSERT_EQUAL_STRING("ピカ", strbuffer);
+
+    error = pksav_text_from_gen5_utf8(gen5_buffer, BUFFER_LEN, strbuffer, 8, &num_bytes);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL(6, num_bytes);
+    TEST_ASSERT_EQUAL_STRING("ピカ", strbuffer);
+
+    // The character count limit applies independently of the output size.
+    error = pksav_text_from_gen4_utf8(gen4_buffer, 3, strbuffer, BUFFER_LEN, &num_bytes);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL(9, num_bytes);
+    TEST_ASSERT_EQUAL_STRING("ピカチ", strbuffer);
+}
+
+static void pksav_nds_text_fills_buffer_test() {
+    pksav_error_t error = PKSAV_ERROR_NONE;
+    uint16_t gen4_buffer[10] = {0};
+    uint16_t gen5_buffer[10] = {0};
+    char strbuffer[11] = {0};
+
+    error = pksav_text_to_gen4("ABCDEFGHIJ", gen4_buffer, 10);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+    error = pksav_text_to_gen5("ABCDEFGHIJ", gen5_buffer, 10);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+
+    // A name that fills num_chars keeps every character, and nothing past it is written.
+    memset(strbuffer, 'X', sizeof(strbuffer));
+    error = pksav_text_from_gen4(gen4_buffer, strbuffer, 10);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL_MEMORY("ABCDEFGHIJX", strbuffer, 11);
+
+    memset(strbuffer, 'X', sizeof(strbuffer));
+    error = pksav_text_from_gen5(gen5_buffer, strbuffer, 10);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL_MEMORY("ABCDEFGHIJX", strbuffer, 11);
+
+    // Shorter names are null-terminated.
+    gen4_buffer[5] = 0xFFFF;
+    gen5_buffer[5] = 0xFFFF;
+    memset(strbuffer, 'X', sizeof(strbuffer));
+    error = pksav_text_from_gen4(gen4_buffer, strbuffer, 10);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL_STRING("ABCDE", strbuffer);
+
+    memset(strbuffer, 'X', sizeof(strbuffer));
+    error = pksav_text_from_gen5(gen5_buffer, strbuffer, 10);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL_STRING("ABCDE", strbuffer);
+}
+
+static void pksav_gb_gba_utf8_test() {
+    pksav_error_t error = PKSAV_ERROR_NONE;
+    char strbuffer[BUFFER_LEN] = {0};
+    size_t num_bytes = 0;
+
+    // "NIDORAN♂" in each character map
+    const uint8_t gen1_buffer[] = {0x8D,0x88,0x83,0x8E,0x91,0x80,0x8D,0xEF,0x50};
+    const uint8_t gba_buffer[] = {0xC8,0xC3,0xBE,0xC9,0xCC,0xBB,0xC8,0xB5,0xFF};
+
+    error = pksav_text_from_gen1_utf8(gen1_buffer, BUFFER_LEN, strbuffer, BUFFER_LEN, &num_bytes);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL(10, num_bytes);
+    TEST_ASSERT_EQUAL_STRING("NIDORAN♂", strbuffer);
+
+    error = pksav_text_from_gen2_utf8(gen1_buffer, BUFFER_LEN, strbuffer, BUFFER_LEN, &num_bytes);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL_STRING("NIDORAN♂", strbuffer);
+
+    error = pksav_text_from_gba_utf8(gba_buffer, BUFFER_LEN, strbuffer, BUFFER_LEN, &num_bytes);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL(10, num_bytes);
+    TEST_ASSERT_EQUAL_STRING("NIDORAN♂", strbuffer);
+
+    // "♂" is three bytes in UTF-8 and must not be split.
+    error = pksav_text_from_gba_utf8(gba_buffer, BUFFER_LEN, strbuffer, 9, &num_bytes);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL(7, num_bytes);
+    TEST_ASSERT_EQUAL_STRING("NIDORAN", strbuffer);
+}
+
+#define NUM_RECORDS 4
+#define RECORD_CHARS 11
+#define OUTPUT_STRIDE 40
+
+// Mimics a string embedded in a larger fixed-width structure.
+typedef struct {
+    uint32_t before;
+    uint16_t name[RECORD_CHARS];
+    uint8_t after[6];
+} pksav_test_record_t;
+
+static void pksav_nds_text_batch_test() {
+    pksav_error_t error = PKSAV_ERROR_NONE;
+    pksav_test_record_t gen4_records[NUM_RECORDS];
+    pksav_test_record_t gen5_records[NUM_RECORDS];
+    char gen4_output[NUM_RECORDS * OUTPUT_STRIDE];
+    char gen5_output[NUM_RECORDS * OUTPUT_STRIDE];
+
+    memset(gen4_records, 0, sizeof(gen4_records));
+    memset(gen5_records, 0, sizeof(gen5_records));
+    for(size_t i = 0; i < NUM_RECORDS; ++i) {
+        error = pksav_text_to_gen4(nds_strings[i], gen4_records[i].name, RECORD_CHARS);
+        TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+        error = pksav_text_to_gen5(nds_strings[i], gen5_records[i].name, RECORD_CHARS);
+        TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+    }
+
+    error = pksav_text_from_gen4_batch(
+                gen4_records[0].name,
+                sizeof(pksav_test_record_t),
+                RECORD_CHARS,
+                NUM_RECORDS,
+                gen4_output,
+                OUTPUT_STRIDE
+            );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+
+    error = pksav_text_from_gen5_batch(
+                gen5_records[0].name,
+                sizeof(pksav_test_record_t),
+                RECORD_CHARS,
+                NUM_RECORDS,
+                gen5_output,
+                OUTPUT_STRIDE
+            );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NONE, error);
+
+    for(size_t i = 0; i < NUM_RECORDS; ++i) {
+        TEST_ASSERT_EQUAL_STRING(nds_strings[i], &gen4_output[i * OUTPUT_STRIDE]);
+        TEST_ASSERT_EQUAL_STRING(nds_strings[i], &gen5_output[i * OUTPUT_STRIDE]);
+    }
+}
+
 PKSAV_TEST_MAIN(
     PKSAV_TEST(pksav_gen1_text_test)
     PKSAV_TEST(pksav_gen2_text_test)
     PKSAV_TEST(pksav_gba_text_test)
+    PKSAV_TEST(pksav_gen4_text_test)
+    PKSAV_TEST(pksav_gen5_text_test)
+    PKSAV_TEST(pksav_nds_utf8_truncation_test)
+    PKSAV_TEST(pksav_nds_text_fills_buffer_test)
+    PKSAV_TEST(pksav_gb_gba_utf8_test)
+    PKSAV_TEST(pksav_nds_text_batch_test)
 )